@@ -97,6 +97,9 @@ final class EditorApplication: Application, NSWindowDelegate {
 
         context?.editorProjectManager.saveSettings()
         if saveChanges {
+            if let context {
+                context.materialEditStore.flush(context: context)
+            }
             context?.editorProjectManager.saveAll()
         }
 
@@ -0,0 +1,191 @@
+/// AssetDependencyGraph.swift
+/// Defines the asset dependency graph used for targeted invalidation and reference queries.
+/// Created by Kaden Cringle.
+
+import Foundation
+import MetalCupEngine
+
+/// Edges point from an asset to the assets it references. Documents (prefabs, materials, graphs,
+/// scenes) contribute every handle found in their bytes; every asset also contributes the handles
+/// stored in its import settings (mesh -> materials/skeleton/clips). Edges are kept even when the
+/// target does not exist yet, so importing an asset links it to documents that already name it.
+/// Only assets whose file time or import settings moved are rescanned on update.
+final class AssetDependencyGraph {
+    struct Stats {
+        var nodeCount: Int = 0
+        var edgeCount: Int = 0
+        var documentsScanned: Int = 0
+        var lastChanged: Int = 0
+        var lastUpdateMs: Double = 0
+    }
+
+    private struct Record {
+        var type: AssetType
+        var lastModified: TimeInterval
+        var importSettings: [String: String]
+        var dependencies: Set<AssetHandle>
+    }
+
+    private static let scannedDocumentTypes: Set<AssetType> = [.prefab, .material, .animationGraph, .scene]
+
+    private let lock = NSLock()
+    private var records: [AssetHandle: Record] = [:]
+    private var dependents: [AssetHandle: Set<AssetHandle>] = [:]
+    private var stats = Stats()
+
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+        records.removeAll()
+        dependents.removeAll()
+        stats = Stats()
+    }
+
+    /// Brings the graph in line with `metadata` and returns the assets that were added, removed,
+    /// or changed since the previous update. The first update after a reset reports every asset.
+    @discardableResult
+    func update(metadata: [AssetMetadata], rootURL: URL) -> Set<AssetHandle> {
+        let start = CFAbsoluteTimeGetCurrent()
+        let known = Set(metadata.map { $0.handle })
+
+        lock.lock()
+        var changed = Set(records.keys.filter { !known.contains($0) })
+        let stale = metadata.filter { meta in
+            guard let record = records[meta.handle] else { return true }
+            return record.lastModified != meta.lastModified
+                || record.type != meta.type
+                || record.importSettings != meta.importSettings
+        }
+        lock.unlock()
+
+        // Reading and scanning documents touches nothing shared, so it fans out over the jobs.
+        let scanned = EditorJobs.parallelMap(count: stale.count, grain: 4) { index -> Set<AssetHandle> in
+            let meta = stale[index]
+            var found = Self.handles(in: meta.importSettings.values.joined(separator: ",").utf8)
+            if Self.scannedDocumentTypes.contains(meta.type),
+               let data = try? Data(contentsOf: rootURL.appendingPathComponent(meta.sourcePath)) {
+                found.formUnion(Self.handles(in: data))
+            }
+            found.remove(meta.handle)
+            return found
+        }
+
+        lock.lock()
+        defer { lock.unlock() }
+        // Incoming edges of removed assets stay so their dependents are still found below.
+        for handle in changed {
+            if let record = records.removeValue(forKey: handle) {
+                unlink(handle, from: record.dependencies)
+            }
+        }
+        for (meta, dependencies) in zip(stale, scanned) {
+            if let previous = records[meta.handle] {
+                unlink(meta.handle, from: previous.dependencies)
+            }
+            records[meta.handle] = Record(type: meta.type,
+                                          lastModified: meta.lastModified,
+                                          importSettings: meta.importSettings,
+                                          dependencies: dependencies)
+            for dependency in dependencies {
+                dependents[dependency, default: []].insert(meta.handle)
+            }
+            changed.insert(meta.handle)
+        }
+
+        stats.nodeCount = records.count
+        stats.edgeCount = records.values.reduce(0) { total, record in
+            total + record.dependencies.filter { records[$0] != nil }.count
+        }
+        stats.documentsScanned += stale.count
+        stats.lastChanged = changed.count
+        stats.lastUpdateMs = (CFAbsoluteTimeGetCurrent() - start) * 1000.0
+        return changed
+    }
+
+    /// Every asset that reaches one of `handles` through references, excluding the inputs
+    /// themselves unless they are reached through a cycle.
+    func transitiveDependents(of handles: Set<AssetHandle>) -> Set<AssetHandle> {
+        lock.lock()
+        defer { lock.unlock() }
+        return walk(from: handles) { dependents[$0] ?? [] }
+    }
+
+    func transitiveDependencies(of handles: Set<AssetHandle>) -> Set<AssetHandle> {
+        lock.lock()
+        defer { lock.unlock() }
+        return walk(from: handles) { records[$0]?.dependencies ?? [] }.filter { records[$0] != nil }
+    }
+
+    func directDependents(of handle: AssetHandle) -> Set<AssetHandle> {
+        lock.lock()
+        defer { lock.unlock() }
+        return dependents[handle] ?? []
+    }
+
+    func directDependencies(of handle: AssetHandle) -> Set<AssetHandle> {
+        lock.lock()
+        defer { lock.unlock() }
+        return (records[handle]?.dependencies ?? []).filter { records[$0] != nil }
+    }
+
+    func currentStats() -> Stats {
+        lock.lock()
+        defer { lock.unlock() }
+        return stats
+    }
+
+    private func unlink(_ handle: AssetHandle, from dependencies: Set<AssetHandle>) {
+        for dependency in dependencies {
+            dependents[dependency]?.remove(handle)
+            if dependents[dependency]?.isEmpty == true {
+                dependents.removeValue(forKey: dependency)
+            }
+        }
+    }
+
+    private func walk(from roots: Set<AssetHandle>, next: (AssetHandle) -> Set<AssetHandle>) -> Set<AssetHandle> {
+        var visited = Set<AssetHandle>()
+        var pending = Array(roots)
+        while let handle = pending.popLast() {
+            for neighbour in next(handle) where visited.insert(neighbour).inserted {
+                pending.append(neighbour)
+            }
+        }
+        return visited
+    }
+
+    /// Finds canonical 8-4-4-4-12 UUID strings in `bytes`. Serializers write handles as UUID
+    /// strings, so this needs no knowledge of each schema; entity ids come along too but never
+    /// match an asset record.
+    private static func handles<Bytes: Collection>(in bytes: Bytes) -> Set<AssetHandle> where Bytes.Element == UInt8 {
+        let buffer = Array(bytes)
+        var found = Set<AssetHandle>()
+        guard buffer.count >= 36 else { return found }
+        var index = 0
+        while index <= buffer.count - 36 {
+            if isUUID(buffer, at: index),
+               let text = String(bytes: buffer[index..<(index + 36)], encoding: .ascii),
+               let uuid = UUID(uuidString: text) {
+                found.insert(AssetHandle(rawValue: uuid))
+                index += 36
+            } else {
+                index += 1
+            }
+        }
+        return found
+    }
+
+    private static func isUUID(_ buffer: [UInt8], at offset: Int) -> Bool {
+        for position in 0..<36 {
+            let byte = buffer[offset + position]
+            switch position {
+            case 8, 13, 18, 23:
+                if byte != UInt8(ascii: "-") { return false }
+            default:
+                let isHex = (byte >= 0x30 && byte <= 0x39) || (byte >= 0x41 && byte <= 0x46) || (byte >= 0x61 && byte <= 0x66)
+                if !isHex { return false }
+            }
+        }
+        return true
+    }
+}
@@ -800,19 +800,16 @@ private enum EmbeddedTextureExportOutcome {
 }
 
 private func inferInternalPixelFormat(srgb: Bool, bitDepth: Int, channelCount: Int) -> String {
-    if bitDepth > 8 {
-        if channelCount >= 4 { return "rgba16Float" }
-        if channelCount == 3 { return "rgb16Float" }
-        return "r16Float"
-    }
-    if channelCount >= 4 { return srgb ? "rgba8Unorm_srgb" : "rgba8Unorm" }
-    if channelCount == 2 { return "rg8Unorm" }
-    return "r8Unorm"
+    String(cString: MCETextureInternalPixelFormatName(srgb ? 1 : 0,
+                                                      UInt32(clamping: bitDepth),
+                                                      UInt32(clamping: channelCount)))
 }
 
+/// Reads only the container header; pixel data is decoded later by the texture loader, so large
+/// HDR/EXR sources no longer pay for a full decode just to validate an import.
 private func probeTextureImport(url: URL, semantic: String, srgb: Bool, outputFormat: String) -> TextureProbeOutcome {
-    guard let source = CGImageSourceCreateWithURL(url as CFURL, nil) else {
-        let diag = TextureImportDiagnostics(
+    func failure(_ reason: String) -> TextureProbeOutcome {
+        return .failure(TextureImportDiagnostics(
             sourceAssetPath: url.path,
             width: 0,
             height: 0,
@@ -822,35 +819,50 @@ private func probeTextureImport(url: URL, semantic: String, srgb: Bool, outputFo
             srgb: srgb,
             internalPixelFormat: inferInternalPixelFormat(srgb: srgb, bitDepth: 0, channelCount: 4),
             outputFormat: outputFormat,
-            failedStage: "decode",
-            reason: "CGImageSourceCreateWithURL returned nil"
-        )
-        return .failure(diag)
+            failedStage: "header",
+            reason: reason
+        ))
     }
 
-    guard let image = CGImageSourceCreateImageAtIndex(source, 0, nil) else {
-        let diag = TextureImportDiagnostics(
-            sourceAssetPath: url.path,
-            width: 0,
-            height: 0,
-            channelCount: 0,
-            bitDepth: 0,
-            semantic: semantic,
-            srgb: srgb,
-            internalPixelFormat: inferInternalPixelFormat(srgb: srgb, bitDepth: 0, channelCount: 4),
-            outputFormat: outputFormat,
-            failedStage: "decode",
-            reason: "CGImageSourceCreateImageAtIndex returned nil"
-        )
-        return .failure(diag)
+    var width = 0
+    var height = 0
+    var channels = 0
+    var bitDepth = 0
+    var compressedFormat: String?
+
+    var info = MCETextureHeaderInfo()
+    if url.withUnsafeFileSystemRepresentation({ path in path.map { MCETextureProbeFile($0, &info) } ?? 0 }) != 0 {
+        width = Int(info.width)
+        height = Int(info.height)
+        channels = Int(info.channelCount)
+        bitDepth = info.isFloat != 0 ? max(Int(info.bitDepth), 16) : Int(info.bitDepth)
+        if info.isBlockCompressed != 0 {
+            compressedFormat = withUnsafeBytes(of: info.format) { raw in
+                String(cString: raw.bindMemory(to: CChar.self).baseAddress!)
+            }
+        }
+    } else {
+        // Containers the portable probe does not parse (TIFF, HEIC, ...) still avoid a decode:
+        // ImageIO reports dimensions from its own header parse.
+        guard let source = CGImageSourceCreateWithURL(url as CFURL, nil) else {
+            return failure("CGImageSourceCreateWithURL returned nil")
+        }
+        let options = [kCGImageSourceShouldCache: false] as CFDictionary
+        guard let properties = CGImageSourceCopyPropertiesAtIndex(source, 0, options) as? [CFString: Any] else {
+            return failure("Unrecognized texture container")
+        }
+        width = (properties[kCGImagePropertyPixelWidth] as? NSNumber)?.intValue ?? 0
+        height = (properties[kCGImagePropertyPixelHeight] as? NSNumber)?.intValue ?? 0
+        bitDepth = (properties[kCGImagePropertyDepth] as? NSNumber)?.intValue ?? 8
+        let hasAlpha = (properties[kCGImagePropertyHasAlpha] as? NSNumber)?.boolValue ?? false
+        let colorModel = properties[kCGImagePropertyColorModel] as? String
+        let isGray = colorModel == (kCGImagePropertyColorModelGray as String)
+        channels = isGray ? (hasAlpha ? 2 : 1) : (hasAlpha ? 4 : 3)
     }
 
-    let width = image.width
-    let height = image.height
-    let bitsPerPixel = image.bitsPerPixel
-    let bitsPerComponent = image.bitsPerComponent
-    let channels = bitsPerComponent > 0 ? max(1, bitsPerPixel / bitsPerComponent) : 0
-    let bitDepth = max(bitsPerComponent, 0)
+    guard width > 0, height > 0 else {
+        return failure("Header reports empty dimensions \(width)x\(height)")
+    }
 
     let diag = TextureImportDiagnostics(
         sourceAssetPath: url.path,
@@ -860,7 +872,7 @@ private func probeTextureImport(url: URL, semantic: String, srgb: Bool, outputFo
         bitDepth: bitDepth,
         semantic: semantic,
         srgb: srgb,
-        internalPixelFormat: inferInternalPixelFormat(srgb: srgb, bitDepth: bitDepth, channelCount: channels),
+        internalPixelFormat: compressedFormat ?? inferInternalPixelFormat(srgb: srgb, bitDepth: bitDepth, channelCount: channels),
         outputFormat: outputFormat,
         failedStage: "",
         reason: ""
@@ -1001,8 +1013,29 @@ struct TextureImporter: AssetImporter {
             )
             return nil
         }
+        var committedSettings = settings
+        committedSettings.values.removeValue(forKey: "cookedKey")
+        committedSettings.values.removeValue(forKey: "cookedFormat")
+        if let cacheRoot = projectManager.cachePath {
+            // A failed cook is not fatal: the runtime still loads the source image.
+            switch projectManager.textureCookCache.cook(sourceURL: scan.sourceURL,
+                                                        semantic: semantic,
+                                                        srgb: srgb,
+                                                        settings: settings,
+                                                        cacheRoot: cacheRoot) {
+            case .cached(let key, let format), .cooked(let key, let format, _):
+                committedSettings.values["cookedKey"] = key
+                committedSettings.values["cookedFormat"] = format
+            case .failure(let reason):
+                EngineLoggerContext.log(
+                    "Texture cook skipped for \(scan.sourceURL.lastPathComponent): \(reason)",
+                    level: .warning,
+                    category: .assets
+                )
+            }
+        }
         return commitSourceAsset(scan: scan,
-                                 settings: settings,
+                                 settings: committedSettings,
                                  projectManager: projectManager,
                                  resolver: resolver,
                                  assetType: .texture,
@@ -1103,7 +1136,14 @@ struct MeshImporter: AssetImporter {
             "scale": "1.0",
             "combineORM": "false",
             "createPrefab": "false",
-            "createHierarchy": "false"
+            "createHierarchy": "false",
+            "generateLODs": "false",
+            "lodRatios": "0.5,0.25,0.125",
+            "lodScreenSizes": "0.5,0.25,0.125",
+            "generateMeshlets": "false",
+            "meshletMaxVertices": "64",
+            "meshletMaxTriangles": "124",
+            "vertexQuantization": "none"
         ]
         if let info = scan.meshInfo {
                 if info.hasTangents {
@@ -1211,6 +1251,9 @@ struct FbxImporter: AssetImporter {
         }
         var values = MeshImporter().defaultSettings(for: scan).values
         values["fbxImportMode"] = scan.details["fbxImportMode"] ?? "skeletalMesh"
+        values["skinInfluences"] = "4"
+        values["skinMinWeight"] = "0"
+        values["skinRenormalize"] = "sum"
         return ImportSettings(values: values)
     }
 
@@ -1844,7 +1887,11 @@ extension MeshImporter {
         let sourceExt = sourceURL.pathExtension.lowercased()
         let textureOrigin = (sourceExt == "usdz") ? "bottomLeft" : "topLeft"
         let usesFbxBakedMesh = importerId == "FbxImporter" && scan.assetType == .model
-        let fbxDataForMesh = usesFbxBakedMesh ? FbxSdkAdapter.scanFBX(url: sourceURL, suggestedName: scan.suggestedName) : nil
+        let fbxDataForMesh = usesFbxBakedMesh
+            ? FbxSdkAdapter.scanFBX(url: sourceURL,
+                                    suggestedName: scan.suggestedName,
+                                    skinInfluences: FbxSdkAdapter.skinInfluenceSettings(from: settings))
+            : nil
         let canBakeFbxMesh = fbxDataForMesh?.mode != .animationOnly && !(fbxDataForMesh?.meshes.isEmpty ?? true)
         let hasSkinnedMeshDataWithoutSkeleton: Bool = {
             guard let fbxDataForMesh else { return false }
@@ -1944,16 +1991,18 @@ extension MeshImporter {
 
             let existingMeshHandle = reimportMeshMeta?.handle ?? loadHandle(from: sourceMetaURL) ?? loadHandle(from: meshMetaURL)
 
+            var meshBakeReport: MeshBakeReport?
             if canBakeFbxMesh, let fbxDataForMesh {
                 if FileManager.default.fileExists(atPath: meshDestinationURL.path) {
                     try? FileManager.default.removeItem(at: meshDestinationURL)
                 }
-                let bakedOK = FbxSdkAdapter.writeBakedMeshAsset(
+                meshBakeReport = FbxSdkAdapter.writeBakedMeshAsset(
                     from: fbxDataForMesh,
                     name: scan.suggestedName,
-                    to: meshDestinationURL
+                    to: meshDestinationURL,
+                    options: MeshBakeOptions(settings: settings)
                 )
-                guard bakedOK else {
+                guard let meshBakeReport else {
                     EngineLoggerContext.log(
                         "FBX import failed to persist baked mesh asset for \(sourceURL.lastPathComponent).",
                         level: .error,
@@ -1961,6 +2010,27 @@ extension MeshImporter {
                     )
                     return false
                 }
+                if !meshBakeReport.lods.isEmpty {
+                    EngineLoggerContext.log(
+                        "Mesh LODs \(sourceURL.lastPathComponent): \(meshBakeReport.lodSummary())",
+                        level: .info,
+                        category: .assets
+                    )
+                }
+                if !meshBakeReport.meshlets.isEmpty {
+                    EngineLoggerContext.log(
+                        "Mesh meshlets \(sourceURL.lastPathComponent): \(meshBakeReport.meshletSummary())",
+                        level: .info,
+                        category: .assets
+                    )
+                }
+                if !meshBakeReport.quantization.isEmpty {
+                    EngineLoggerContext.log(
+                        "Mesh vertex quantization \(sourceURL.lastPathComponent): \(meshBakeReport.quantizationSummary())",
+                        level: .info,
+                        category: .assets
+                    )
+                }
                 if meshDestinationURL.standardizedFileURL.path != sourceURL.standardizedFileURL.path,
                    FileManager.default.fileExists(atPath: sourceMetaURL.path),
                    let sourceMetaHandle = loadHandle(from: sourceMetaURL),
@@ -2376,6 +2446,10 @@ extension MeshImporter {
                 _ = SkeletonAssetSerializer.save(skeletonAsset, to: skeletonURL)
 
                 let skeletonRelativePath = PathUtils.relativePath(from: rootURL, to: skeletonURL) ?? skeletonURL.lastPathComponent
+                projectManager.skeletonFingerprints.record(skeleton: skeletonAsset,
+                                                           handle: resolvedSkeletonHandle,
+                                                           sourcePath: skeletonRelativePath,
+                                                           fileURL: skeletonURL)
                 let skeletonMetaURL = AssetIO.metaURL(for: skeletonURL)
                 let skeletonMeta = AssetMetadata(
                     handle: resolvedSkeletonHandle,
@@ -2422,7 +2496,12 @@ extension MeshImporter {
                         durationSeconds: clipInfo.durationSeconds,
                         tracks: clipInfo.tracks
                     )
-                    _ = AnimationClipAssetSerializer.save(clipAsset, to: clipURL)
+                    if AnimationClipAssetSerializer.save(clipAsset, to: clipURL) {
+                        projectManager.bakedClips.bake(clipAsset,
+                                                       handle: clipHandle,
+                                                       sourceURL: clipURL,
+                                                       quantize: settings.boolValue("quantizeClipKeys", default: false))
+                    }
 
                     let clipRelativePath = PathUtils.relativePath(from: rootURL, to: clipURL) ?? clipURL.lastPathComponent
                     let clipMetaURL = AssetIO.metaURL(for: clipURL)
@@ -2489,6 +2568,26 @@ extension MeshImporter {
                 }
                 meshImportSettings["submeshMaterials"] = handleStrings.joined(separator: ",")
             }
+            if let lodSummary = meshBakeReport?.lodSummary(), !lodSummary.isEmpty {
+                meshImportSettings["lodReport"] = lodSummary
+            } else {
+                meshImportSettings.removeValue(forKey: "lodReport")
+            }
+            if let meshletSummary = meshBakeReport?.meshletSummary(), !meshletSummary.isEmpty {
+                meshImportSettings["meshletReport"] = meshletSummary
+            } else {
+                meshImportSettings.removeValue(forKey: "meshletReport")
+            }
+            if let quantizationSummary = meshBakeReport?.quantizationSummary(), !quantizationSummary.isEmpty {
+                meshImportSettings["quantizationReport"] = quantizationSummary
+            } else {
+                meshImportSettings.removeValue(forKey: "quantizationReport")
+            }
+            if let skinInfluenceReport = fbxDataForMesh?.skinInfluenceReport {
+                meshImportSettings["skinInfluenceReport"] = skinInfluenceReport
+            } else {
+                meshImportSettings.removeValue(forKey: "skinInfluenceReport")
+            }
             meshImportSettings["isSkinned"] = meshInfo.isSkinned ? "true" : "false"
             meshImportSettings["hasRootMotion"] = meshInfo.hasRootMotion ? "true" : "false"
             if let rootMotionBoneName = meshInfo.rootMotionBoneName?.trimmingCharacters(in: .whitespacesAndNewlines),
@@ -2563,39 +2662,116 @@ extension MeshImporter {
         let sourceStem: String
     }
 
+    fileprivate struct GraphRepairImport {
+        let sourceFolderURL: URL
+        let sourceURL: URL
+        let clipHandles: [AssetHandle]
+        let clipInfos: [MeshAnimationClipScanInfo]
+    }
+
     fileprivate static func repairAnimationGraphClipHandlesAfterFbxImport(projectManager: EditorProjectManager,
                                                                           rootURL: URL,
                                                                           sourceFolderURL: URL,
                                                                           sourceURL: URL,
                                                                           newClipHandles: [AssetHandle],
                                                                           clipInfos: [MeshAnimationClipScanInfo]) {
+        repairAnimationGraphClipHandles(
+            projectManager: projectManager,
+            rootURL: rootURL,
+            imports: [GraphRepairImport(sourceFolderURL: sourceFolderURL,
+                                        sourceURL: sourceURL,
+                                        clipHandles: newClipHandles,
+                                        clipInfos: clipInfos)],
+            importedClipMetas: []
+        )
+    }
+
+    /// Repairs graphs next to any of `imports` in one pass. Each graph is loaded once into a
+    /// clip-handle -> graph reverse index; only graphs that reference a handle with no clip behind it
+    /// are remapped. `importedClipMetas` covers clips written in a batch the registry has not
+    /// picked up yet.
+    fileprivate static func repairAnimationGraphClipHandles(projectManager: EditorProjectManager,
+                                                            rootURL: URL,
+                                                            imports: [GraphRepairImport],
+                                                            importedClipMetas: [AssetMetadata]) {
         let metadataSnapshot = projectManager.assetMetadataSnapshot()
         let clipMetas = metadataSnapshot.filter { $0.type == .animationClip }
-        let clipMetaByHandle = Dictionary(uniqueKeysWithValues: clipMetas.map { ($0.handle, $0) })
-        let validClipHandleSet = Set(clipMetas.map(\.handle))
-        let graphMetas = metadataSnapshot.filter { meta in
-            guard meta.type == .animationGraph else { return false }
-            let graphURL = rootURL.appendingPathComponent(meta.sourcePath).standardizedFileURL
-            return graphURL.deletingLastPathComponent().standardizedFileURL == sourceFolderURL.standardizedFileURL
-        }
-        guard !graphMetas.isEmpty else { return }
-
-        let sourceStem = sourceURL.deletingPathExtension().lastPathComponent.lowercased()
-        let newClipCandidates: [GraphClipCandidate] = newClipHandles.enumerated().map { index, handle in
-            let clipName = index < clipInfos.count ? clipInfos[index].name : ""
-            let meta = clipMetaByHandle[handle]
-            return GraphClipCandidate(
-                handle: handle,
-                clipName: normalizeGraphClipName(meta?.importSettings["clipName"] ?? clipName),
-                sourcePath: meta?.sourcePath ?? "",
-                sourceStem: normalizedSourceStem(meta: meta, fallback: sourceStem)
-            )
+        var clipMetaByHandle = Dictionary(uniqueKeysWithValues: clipMetas.map { ($0.handle, $0) })
+        for meta in importedClipMetas {
+            clipMetaByHandle[meta.handle] = meta
+        }
+        let validClipHandleSet = Set(clipMetaByHandle.keys)
+
+        struct GraphRepairWork {
+            let graphMeta: AssetMetadata
+            let graphURL: URL
+            let loaded: AnimationGraphAsset
+            let newClipCandidates: [GraphClipCandidate]
+            let sourceStem: String?
+        }
+        var work: [GraphRepairWork] = []
+        let importsByFolder = Dictionary(grouping: imports.filter { !$0.clipHandles.isEmpty }) {
+            $0.sourceFolderURL.standardizedFileURL
+        }
+        for (folderURL, folderImports) in importsByFolder {
+            let graphMetas = metadataSnapshot.filter { meta in
+                guard meta.type == .animationGraph else { return false }
+                let graphURL = rootURL.appendingPathComponent(meta.sourcePath).standardizedFileURL
+                return graphURL.deletingLastPathComponent().standardizedFileURL == folderURL
+            }
+            guard !graphMetas.isEmpty else { continue }
+
+            var newClipCandidates: [GraphClipCandidate] = []
+            var importStems = Set<String>()
+            for entry in folderImports {
+                let stem = entry.sourceURL.deletingPathExtension().lastPathComponent.lowercased()
+                importStems.insert(stem)
+                for (index, handle) in entry.clipHandles.enumerated() {
+                    let clipName = index < entry.clipInfos.count ? entry.clipInfos[index].name : ""
+                    let meta = clipMetaByHandle[handle]
+                    newClipCandidates.append(GraphClipCandidate(
+                        handle: handle,
+                        clipName: normalizeGraphClipName(meta?.importSettings["clipName"] ?? clipName),
+                        sourcePath: meta?.sourcePath ?? "",
+                        sourceStem: normalizedSourceStem(meta: meta, fallback: stem)
+                    ))
+                }
+            }
+            // Each candidate carries the stem of the import that produced it. A stale clip with no
+            // recorded source can only be attributed to an import when the whole batch for this
+            // folder came from one source file.
+            let sourceStem = importStems.count == 1 ? importStems.first : nil
+
+            var loadedGraphs: [(meta: AssetMetadata, url: URL, graph: AnimationGraphAsset)] = []
+            var graphIndicesByClipHandle: [AssetHandle: [Int]] = [:]
+            for graphMeta in graphMetas {
+                let graphURL = rootURL.appendingPathComponent(graphMeta.sourcePath).standardizedFileURL
+                guard let loaded = AnimationGraphAssetSerializer.load(from: graphURL, fallbackHandle: graphMeta.handle) else { continue }
+                for handle in Set(collectGraphClipHandles(loaded)) {
+                    graphIndicesByClipHandle[handle, default: []].append(loadedGraphs.count)
+                }
+                loadedGraphs.append((meta: graphMeta, url: graphURL, graph: loaded))
+            }
+            var staleGraphIndices = Set<Int>()
+            for (handle, indices) in graphIndicesByClipHandle where !validClipHandleSet.contains(handle) {
+                staleGraphIndices.formUnion(indices)
+            }
+            for index in staleGraphIndices.sorted() {
+                let entry = loadedGraphs[index]
+                work.append(GraphRepairWork(graphMeta: entry.meta,
+                                            graphURL: entry.url,
+                                            loaded: entry.graph,
+                                            newClipCandidates: newClipCandidates,
+                                            sourceStem: sourceStem))
+            }
         }
-        guard !newClipCandidates.isEmpty else { return }
 
-        for graphMeta in graphMetas {
-            let graphURL = rootURL.appendingPathComponent(graphMeta.sourcePath).standardizedFileURL
-            guard let loaded = AnimationGraphAssetSerializer.load(from: graphURL, fallbackHandle: graphMeta.handle) else { continue }
+        for item in work {
+            let graphMeta = item.graphMeta
+            let graphURL = item.graphURL
+            let loaded = item.loaded
+            let newClipCandidates = item.newClipCandidates
+            let sourceStem = item.sourceStem
             var graph = loaded
             var changed = false
             var ambiguousWarnings: [String] = []
@@ -2622,8 +2798,8 @@ extension MeshImporter {
                         }
                     }
 
-                    let oldStem = normalizedSourceStem(meta: oldMeta, fallback: sourceStem)
-                    let stemMatches = newClipCandidates.filter { $0.sourceStem == oldStem }
+                    let oldStem = normalizedSourceStem(meta: oldMeta, fallback: sourceStem ?? "")
+                    let stemMatches = oldStem.isEmpty ? [] : newClipCandidates.filter { $0.sourceStem == oldStem }
                     if let chosen = stemMatches.first {
                         if stemMatches.count > 1 {
                             ambiguousWarnings.append("source:\(oldStem)")
@@ -2645,6 +2821,7 @@ extension MeshImporter {
                     }
                 }
 
+                guard let sourceStem else { return nil }
                 let stemMatches = newClipCandidates.filter { $0.sourceStem == sourceStem }
                 if let chosen = stemMatches.first {
                     if stemMatches.count > 1 {
@@ -2831,6 +3008,110 @@ extension FbxImporter {
         let unmappedChannelNames: [String]
     }
 
+    /// State shared by the animation-only imports of one batch. Importing a folder of clips against
+    /// one rig would otherwise resync the fingerprint index, reload the target skeleton, rebuild the
+    /// joint remap and rescan the folder's graphs once per file.
+    fileprivate final class AnimationImportSession {
+        private struct RemapKey: Hashable {
+            let targetHandle: AssetHandle
+            let jointNames: [String]
+            let parentIndices: [Int]
+        }
+
+        let rootURL: URL
+        /// Taken once; clips written earlier in the session are tracked in `importedClipMetas`.
+        let metadataSnapshot: [AssetMetadata]
+        var importedClipMetas: [AssetMetadata] = []
+        var graphRepairs: [MeshImporter.GraphRepairImport] = []
+
+        private var fingerprintsSynced = false
+        private var skeletonsByHandle: [AssetHandle: SkeletonAsset?] = [:]
+        private var remapTables: [RemapKey: ClipRemapTable] = [:]
+        private var reservedClipPaths = Set<String>()
+        private var pendingClipWrites: [(asset: AnimationClipAsset, handle: AssetHandle, url: URL, quantize: Bool)] = []
+
+        init(projectManager: EditorProjectManager, rootURL: URL) {
+            self.rootURL = rootURL
+            self.metadataSnapshot = projectManager.assetMetadataSnapshot()
+        }
+
+        func syncSkeletonFingerprints(projectManager: EditorProjectManager) {
+            guard !fingerprintsSynced else { return }
+            fingerprintsSynced = true
+            projectManager.skeletonFingerprints.sync(metadataSnapshot: metadataSnapshot, rootURL: rootURL)
+        }
+
+        func skeleton(handle: AssetHandle) -> SkeletonAsset? {
+            if let cached = skeletonsByHandle[handle] {
+                return cached
+            }
+            let loaded = FbxImporter.loadSkeletonAsset(handle: handle, metadataSnapshot: metadataSnapshot, rootURL: rootURL)
+            skeletonsByHandle[handle] = loaded
+            return loaded
+        }
+
+        /// Keyed by the full source hierarchy, so two rigs that merely share a joint count never
+        /// share a table.
+        func remapTable(source: MeshSkeletonScanInfo?, targetHandle: AssetHandle) -> ClipRemapTable? {
+            guard let source, let target = skeleton(handle: targetHandle) else { return nil }
+            let key = RemapKey(targetHandle: targetHandle,
+                               jointNames: source.joints.map(\.name),
+                               parentIndices: source.joints.map { Int($0.parentIndex) })
+            if let table = remapTables[key] {
+                return table
+            }
+            let table = ClipRemapTable(sourceSkeleton: source, targetSkeleton: target)
+            remapTables[key] = table
+            return table
+        }
+
+        func isReserved(_ url: URL) -> Bool {
+            reservedClipPaths.contains(url.standardizedFileURL.path)
+        }
+
+        func reserve(_ url: URL) {
+            reservedClipPaths.insert(url.standardizedFileURL.path)
+        }
+
+        /// `meshUniqueFileURL`, but also skipping names claimed by clips that are not on disk yet.
+        func uniqueClipURL(in folder: URL, baseName: String) -> URL {
+            let fm = FileManager.default
+            var candidate = folder.appendingPathComponent("\(baseName).mcanim")
+            var index = 1
+            while fm.fileExists(atPath: candidate.path) || isReserved(candidate) {
+                candidate = folder.appendingPathComponent("\(baseName)_\(index).mcanim")
+                index += 1
+            }
+            return candidate
+        }
+
+        func enqueueClipWrite(_ asset: AnimationClipAsset, handle: AssetHandle, to url: URL, quantize: Bool) {
+            pendingClipWrites.append((asset: asset, handle: handle, url: url, quantize: quantize))
+        }
+
+        /// Writes and bakes every queued clip, one clip per job, then repairs the affected graphs in a
+        /// single pass. Must run inside the caller's asset mutation so the registry refresh sees both.
+        func finish(projectManager: EditorProjectManager) {
+            let writes = pendingClipWrites
+            pendingClipWrites.removeAll()
+            let bakedClips = projectManager.bakedClips
+            EditorJobs.parallelFor(count: writes.count, grain: 1) { range in
+                for index in range {
+                    let write = writes[index]
+                    guard AnimationClipAssetSerializer.save(write.asset, to: write.url) else { continue }
+                    bakedClips.bake(write.asset, handle: write.handle, sourceURL: write.url, quantize: write.quantize)
+                }
+            }
+            let repairs = graphRepairs
+            graphRepairs.removeAll()
+            guard !repairs.isEmpty else { return }
+            MeshImporter.repairAnimationGraphClipHandles(projectManager: projectManager,
+                                                         rootURL: rootURL,
+                                                         imports: repairs,
+                                                         importedClipMetas: importedClipMetas)
+        }
+    }
+
     private struct AnimationImportScaleResolution {
         let factor: Float
         let source: String
@@ -2899,19 +3180,32 @@ extension FbxImporter {
     }
 
     private static func canonicalJointName(_ raw: String) -> String {
-        let trimmed = raw.trimmingCharacters(in: .whitespacesAndNewlines)
-        guard !trimmed.isEmpty else { return "" }
-        var normalized = trimmed.replacingOccurrences(of: "\\", with: "/")
-        if let lastPath = normalized.split(separator: "/").last {
-            normalized = String(lastPath)
-        }
-        if let lastNode = normalized.split(separator: "|").last {
-            normalized = String(lastNode)
-        }
-        if let namespaceSplit = normalized.split(separator: ":").last {
-            normalized = String(namespaceSplit)
+        SkeletonFingerprintIndex.canonicalJointName(raw)
+    }
+
+    /// Imports several animation-only FBX files as one asset mutation: skeleton matching, target
+    /// skeleton loads and remap tables are shared, clip files are written in parallel at the end,
+    /// and animation graphs are repaired once for the whole batch.
+    static func commitAnimationOnlyFBXBatch(_ requests: [(scan: ImportScanResult, settings: ImportSettings)],
+                                            projectManager: EditorProjectManager,
+                                            resolver: AssetPathResolver,
+                                            importerId: String,
+                                            importerVersion: String) -> [ImportCommitResult?] {
+        guard let rootURL = projectManager.assetRootURL() else { return requests.map { _ in nil } }
+        return projectManager.performAssetMutationBatch {
+            let session = AnimationImportSession(projectManager: projectManager, rootURL: rootURL)
+            let results = requests.map { request in
+                commitAnimationOnlyFBX(scan: request.scan,
+                                       settings: request.settings,
+                                       projectManager: projectManager,
+                                       resolver: resolver,
+                                       importerId: importerId,
+                                       importerVersion: importerVersion,
+                                       session: session)
+            }
+            session.finish(projectManager: projectManager)
+            return results
         }
-        return normalized.lowercased()
     }
 
     private static func commitAnimationOnlyFBX(scan: ImportScanResult,
@@ -2919,9 +3213,11 @@ extension FbxImporter {
                                                projectManager: EditorProjectManager,
                                                resolver: AssetPathResolver,
                                                importerId: String,
-                                               importerVersion: String) -> ImportCommitResult? {
+                                               importerVersion: String,
+                                               session: AnimationImportSession? = nil) -> ImportCommitResult? {
         guard let rootURL = projectManager.assetRootURL() else { return nil }
         guard let meshInfo = scan.meshInfo, !meshInfo.clipInfos.isEmpty else { return nil }
+        let activeSession = session ?? AnimationImportSession(projectManager: projectManager, rootURL: rootURL)
         let sourceURL = scan.sourceURL.standardizedFileURL
         let sourceFolderURL = sourceURL.deletingLastPathComponent().standardizedFileURL
         let clipRoot = isUnderRoot(sourceURL, rootURL: rootURL)
@@ -2930,7 +3226,7 @@ extension FbxImporter {
         let sourceRelativePath = PathUtils.relativePath(from: rootURL, to: sourceURL) ?? sourceURL.lastPathComponent
         let sourcePathAbs = sourceURL.path
         let sourceFolder = sourceURL.deletingLastPathComponent().standardizedFileURL.path
-        let metadataSnapshot = projectManager.assetMetadataSnapshot()
+        let metadataSnapshot = activeSession.metadataSnapshot
         var existingClipByName: [String: AssetMetadata] = [:]
         var existingSkeletonAssociation: AssetHandle?
         for meta in metadataSnapshot where meta.type == .animationClip {
@@ -2994,25 +3290,31 @@ extension FbxImporter {
 #endif
         }
 
-        if resolvedSkeletonHandle == nil {
+        let fingerprintQuery = resolvedSkeletonHandle == nil
+            ? SkeletonFingerprintIndex.Query(source: meshInfo.skeletonInfo, clipInfos: meshInfo.clipInfos)
+            : nil
+        if fingerprintQuery != nil {
+            activeSession.syncSkeletonFingerprints(projectManager: projectManager)
+        }
+        if resolvedSkeletonHandle == nil, let fingerprintQuery {
             resolvedSkeletonHandle = resolveSkeletonFromImportedMeshMetadata(
                 metadataSnapshot: metadataSnapshot,
                 rootURL: rootURL,
                 sourceFolderPath: sourceFolder,
-                sourceSkeleton: meshInfo.skeletonInfo,
-                clipInfos: meshInfo.clipInfos
+                query: fingerprintQuery,
+                fingerprints: projectManager.skeletonFingerprints
             )
             if resolvedSkeletonHandle != nil {
                 skeletonResolutionSource = "sameFolderMeshMetadata"
             }
         }
-        if resolvedSkeletonHandle == nil {
+        if resolvedSkeletonHandle == nil, let fingerprintQuery {
             let candidates = compatibleSkeletonCandidates(
                 metadataSnapshot: metadataSnapshot,
                 rootURL: rootURL,
                 sourceFolderPath: sourceFolder,
-                sourceSkeleton: meshInfo.skeletonInfo,
-                clipInfos: meshInfo.clipInfos
+                query: fingerprintQuery,
+                fingerprints: projectManager.skeletonFingerprints
             )
             if let best = candidates.first {
                 if candidates.count == 1 {
@@ -3037,13 +3339,13 @@ extension FbxImporter {
             importScaleResolution = AnimationImportScaleResolution(factor: skeletonScale, source: "sameFolderSkeleton")
         }
         let importScaleApplied = importScaleResolution.factor
-        let targetSkeleton = resolvedSkeletonHandle.flatMap {
-            loadSkeletonAsset(handle: $0, metadataSnapshot: metadataSnapshot, rootURL: rootURL)
-        }
+        let targetSkeleton = resolvedSkeletonHandle.flatMap { activeSession.skeleton(handle: $0) }
         let remapResult = remapClipInfosToSkeleton(
             clipInfos: meshInfo.clipInfos,
             sourceSkeleton: meshInfo.skeletonInfo,
-            targetSkeleton: targetSkeleton
+            remapTable: resolvedSkeletonHandle.flatMap { handle in
+                activeSession.remapTable(source: meshInfo.skeletonInfo, targetHandle: handle)
+            }
         )
         let clipSourceInfos: [MeshAnimationClipScanInfo] = targetSkeleton == nil ? meshInfo.clipInfos : remapResult.clips
         let canonicalJointCount = meshInfo.skeletonInfo?.jointCount ?? 0
@@ -3065,7 +3367,7 @@ extension FbxImporter {
                     clipHandle = existing.handle
                 } else {
                     let candidate = clipRoot.appendingPathComponent("\(clipName).mcanim")
-                    if FileManager.default.fileExists(atPath: candidate.path) {
+                    if FileManager.default.fileExists(atPath: candidate.path) || activeSession.isReserved(candidate) {
                         let candidateMetaURL = AssetIO.metaURL(for: candidate)
                         let candidateRelativePath = PathUtils.relativePath(from: rootURL, to: candidate)
                         let candidateMeta = candidateRelativePath.flatMap { rel in
@@ -3076,7 +3378,7 @@ extension FbxImporter {
                             clipURL = candidate
                             clipHandle = loadHandle(from: candidateMetaURL) ?? AssetHandle()
                         } else {
-                            clipURL = meshUniqueFileURL(in: clipRoot, baseName: clipName, ext: "mcanim")
+                            clipURL = activeSession.uniqueClipURL(in: clipRoot, baseName: clipName)
                             clipHandle = loadHandle(from: AssetIO.metaURL(for: clipURL)) ?? AssetHandle()
                             if let candidateMeta {
                                 EngineLoggerContext.log(
@@ -3087,10 +3389,11 @@ extension FbxImporter {
                             }
                         }
                     } else {
-                        clipURL = meshUniqueFileURL(in: clipRoot, baseName: clipName, ext: "mcanim")
+                        clipURL = activeSession.uniqueClipURL(in: clipRoot, baseName: clipName)
                         clipHandle = loadHandle(from: AssetIO.metaURL(for: clipURL)) ?? AssetHandle()
                     }
                 }
+                activeSession.reserve(clipURL)
 
                 let clipAsset = AnimationClipAsset(
                     handle: clipHandle,
@@ -3099,7 +3402,10 @@ extension FbxImporter {
                     durationSeconds: clipInfo.durationSeconds,
                     tracks: clipInfo.tracks
                 )
-                _ = AnimationClipAssetSerializer.save(clipAsset, to: clipURL)
+                activeSession.enqueueClipWrite(clipAsset,
+                                               handle: clipHandle,
+                                               to: clipURL,
+                                               quantize: settings.boolValue("quantizeClipKeys", default: false))
 
                 let associationState: String
                 var associationReason = ""
@@ -3143,6 +3449,7 @@ extension FbxImporter {
                     lastModified: Date().timeIntervalSince1970
                 )
                 projectManager.saveMetadata(clipMeta, to: AssetIO.metaURL(for: clipURL))
+                activeSession.importedClipMetas.append(clipMeta)
                 clipHandles.append(clipHandle)
                 writtenPaths.append(clipRelativePath)
 #if DEBUG
@@ -3174,6 +3481,13 @@ extension FbxImporter {
 #endif
 
             guard let primary = clipHandles.first else { return false }
+            activeSession.graphRepairs.append(MeshImporter.GraphRepairImport(sourceFolderURL: sourceFolderURL,
+                                                                             sourceURL: sourceURL,
+                                                                             clipHandles: clipHandles,
+                                                                             clipInfos: clipSourceInfos))
+            if session == nil {
+                activeSession.finish(projectManager: projectManager)
+            }
             commitResult = ImportCommitResult(
                 primaryHandle: primary,
                 writtenPaths: writtenPaths,
@@ -3192,13 +3506,14 @@ extension FbxImporter {
     private static func compatibleSkeletonCandidates(metadataSnapshot: [AssetMetadata],
                                                      rootURL: URL,
                                                      sourceFolderPath: String,
-                                                     sourceSkeleton: MeshSkeletonScanInfo?,
-                                                     clipInfos: [MeshAnimationClipScanInfo]) -> [SkeletonAssociationCandidate] {
+                                                     query: SkeletonFingerprintIndex.Query,
+                                                     fingerprints: SkeletonFingerprintIndex) -> [SkeletonAssociationCandidate] {
+        let skeletonMetas = metadataSnapshot.filter { $0.type == .skeleton }
+        let metaByHandle = Dictionary(skeletonMetas.map { ($0.handle, $0) }, uniquingKeysWith: { first, _ in first })
         var candidates: [SkeletonAssociationCandidate] = []
-        for meta in metadataSnapshot where meta.type == .skeleton {
-            guard let skeleton = loadSkeletonAsset(handle: meta.handle, metadataSnapshot: metadataSnapshot, rootURL: rootURL) else { continue }
-            guard let compatibilityScore = skeletonCompatibilityScore(source: sourceSkeleton, clipInfos: clipInfos, candidate: skeleton) else { continue }
-            var score = compatibilityScore
+        for match in fingerprints.scores(for: query, handles: skeletonMetas.map(\.handle)) {
+            guard let meta = metaByHandle[match.handle] else { continue }
+            var score = match.score
             let assetURL = rootURL.appendingPathComponent(meta.sourcePath).standardizedFileURL
             if assetURL.deletingLastPathComponent().path == sourceFolderPath {
                 score += 0.05
@@ -3259,8 +3574,8 @@ extension FbxImporter {
     private static func resolveSkeletonFromImportedMeshMetadata(metadataSnapshot: [AssetMetadata],
                                                                 rootURL: URL,
                                                                 sourceFolderPath: String,
-                                                                sourceSkeleton: MeshSkeletonScanInfo?,
-                                                                clipInfos: [MeshAnimationClipScanInfo]) -> AssetHandle? {
+                                                                query: SkeletonFingerprintIndex.Query,
+                                                                fingerprints: SkeletonFingerprintIndex) -> AssetHandle? {
         let meshMetas = metadataSnapshot.filter { meta in
             guard meta.type == .model else { return false }
             guard meta.importSettings["importer"] == "FbxImporter" else { return false }
@@ -3269,15 +3584,12 @@ extension FbxImporter {
             return assetFolder == sourceFolderPath
         }
 
-        var ranked: [(handle: AssetHandle, score: Float)] = []
-        for meta in meshMetas {
+        let skeletonHandles: [AssetHandle] = meshMetas.compactMap { meta in
             guard let rawSkeleton = meta.importSettings["skeletonHandle"],
-                  let skeletonUUID = UUID(uuidString: rawSkeleton) else { continue }
-            let skeletonHandle = AssetHandle(rawValue: skeletonUUID)
-            guard let skeleton = loadSkeletonAsset(handle: skeletonHandle, metadataSnapshot: metadataSnapshot, rootURL: rootURL) else { continue }
-            guard let score = skeletonCompatibilityScore(source: sourceSkeleton, clipInfos: clipInfos, candidate: skeleton) else { continue }
-            ranked.append((handle: skeletonHandle, score: score))
+                  let skeletonUUID = UUID(uuidString: rawSkeleton) else { return nil }
+            return AssetHandle(rawValue: skeletonUUID)
         }
+        var ranked = fingerprints.scores(for: query, handles: skeletonHandles)
         ranked.sort { lhs, rhs in
             if lhs.score == rhs.score {
                 return lhs.handle.rawValue.uuidString < rhs.handle.rawValue.uuidString
@@ -3292,10 +3604,37 @@ extension FbxImporter {
         return (best.score - second.score) >= 0.05 ? best.handle : nil
     }
 
+    /// Source joint index -> target joint index, resolved by exact name first and then by a unique
+    /// canonical-name match. Built once per (source skeleton, target skeleton) pair.
+    fileprivate struct ClipRemapTable {
+        let sourceJointNames: [String]
+        let targetIndexBySourceIndex: [Int?]
+
+        init(sourceSkeleton: MeshSkeletonScanInfo, targetSkeleton: SkeletonAsset) {
+            var targetIndexByName: [String: Int] = [:]
+            var targetIndicesByCanonicalName: [String: [Int]] = [:]
+            targetIndexByName.reserveCapacity(targetSkeleton.joints.count)
+            targetIndicesByCanonicalName.reserveCapacity(targetSkeleton.joints.count)
+            for (index, joint) in targetSkeleton.joints.enumerated() {
+                if targetIndexByName[joint.name] == nil {
+                    targetIndexByName[joint.name] = index
+                }
+                let canonical = FbxImporter.canonicalJointName(joint.name)
+                guard !canonical.isEmpty else { continue }
+                targetIndicesByCanonicalName[canonical, default: []].append(index)
+            }
+            sourceJointNames = sourceSkeleton.joints.map(\.name)
+            targetIndexBySourceIndex = sourceJointNames.map { name in
+                let canonicalMatches = targetIndicesByCanonicalName[FbxImporter.canonicalJointName(name)] ?? []
+                return targetIndexByName[name] ?? (canonicalMatches.count == 1 ? canonicalMatches[0] : nil)
+            }
+        }
+    }
+
     private static func remapClipInfosToSkeleton(clipInfos: [MeshAnimationClipScanInfo],
                                                  sourceSkeleton: MeshSkeletonScanInfo?,
-                                                 targetSkeleton: SkeletonAsset?) -> (clips: [MeshAnimationClipScanInfo], diagnostics: ClipRemapDiagnostics) {
-        guard let sourceSkeleton, let targetSkeleton else {
+                                                 remapTable: ClipRemapTable?) -> (clips: [MeshAnimationClipScanInfo], diagnostics: ClipRemapDiagnostics) {
+        guard sourceSkeleton != nil, let remapTable else {
             let totalChannels = clipInfos.reduce(0) { $0 + $1.tracks.count }
             return (
                 clipInfos,
@@ -3303,18 +3642,6 @@ extension FbxImporter {
             )
         }
 
-        var targetIndexByName: [String: Int] = [:]
-        var targetIndicesByCanonicalName: [String: [Int]] = [:]
-        targetIndexByName.reserveCapacity(targetSkeleton.joints.count)
-        targetIndicesByCanonicalName.reserveCapacity(targetSkeleton.joints.count)
-        for (index, joint) in targetSkeleton.joints.enumerated() {
-            if targetIndexByName[joint.name] == nil {
-                targetIndexByName[joint.name] = index
-            }
-            let canonical = canonicalJointName(joint.name)
-            guard !canonical.isEmpty else { continue }
-            targetIndicesByCanonicalName[canonical, default: []].append(index)
-        }
         var remappedClips: [MeshAnimationClipScanInfo] = []
         remappedClips.reserveCapacity(clipInfos.count)
         var totalChannels = 0
@@ -3326,12 +3653,9 @@ extension FbxImporter {
             remappedTracks.reserveCapacity(clip.tracks.count)
             for track in clip.tracks {
                 totalChannels += 1
-                guard track.jointIndex >= 0, track.jointIndex < sourceSkeleton.joints.count else { continue }
-                let sourceJointName = sourceSkeleton.joints[track.jointIndex].name
-                let canonicalSourceJointName = canonicalJointName(sourceJointName)
-                let canonicalMatches = targetIndicesByCanonicalName[canonicalSourceJointName] ?? []
-                let canonicalResolved = canonicalMatches.count == 1 ? canonicalMatches[0] : nil
-                guard let targetJointIndex = targetIndexByName[sourceJointName] ?? canonicalResolved else {
+                guard track.jointIndex >= 0, track.jointIndex < remapTable.sourceJointNames.count else { continue }
+                guard let targetJointIndex = remapTable.targetIndexBySourceIndex[track.jointIndex] else {
+                    let sourceJointName = remapTable.sourceJointNames[track.jointIndex]
                     if !sourceJointName.isEmpty {
                         unmappedChannelNames.insert(sourceJointName)
                     }
@@ -3373,55 +3697,6 @@ extension FbxImporter {
         let skeletonURL = rootURL.appendingPathComponent(skeletonMeta.sourcePath).standardizedFileURL
         return SkeletonAssetSerializer.load(from: skeletonURL, fallbackHandle: handle)
     }
-
-    private static func skeletonCompatibilityScore(source: MeshSkeletonScanInfo?,
-                                                   clipInfos: [MeshAnimationClipScanInfo],
-                                                   candidate: SkeletonAsset) -> Float? {
-        guard let source else { return nil }
-        let sourceTrackJointIndices = Set(clipInfos.flatMap { $0.tracks.map(\.jointIndex) })
-        let sourceHierarchy = canonicalHierarchyEntries(from: source.joints, restrictedTo: sourceTrackJointIndices)
-        guard !sourceHierarchy.isEmpty else { return nil }
-        let candidateHierarchy = canonicalHierarchyEntries(from: candidate.joints, restrictedTo: nil)
-        guard !candidateHierarchy.isEmpty else { return nil }
-
-        var mappedCount = 0
-        var parentMatchedCount = 0
-        for (jointName, sourceParentName) in sourceHierarchy {
-            guard let candidateParentName = candidateHierarchy[jointName] else { continue }
-            mappedCount += 1
-            if sourceParentName == candidateParentName {
-                parentMatchedCount += 1
-            }
-        }
-
-        let coverage = Float(mappedCount) / Float(max(1, sourceHierarchy.count))
-        guard coverage >= 0.8 else { return nil }
-        let parentAgreement = mappedCount > 0 ? (Float(parentMatchedCount) / Float(mappedCount)) : 0
-        return (coverage * 0.85) + (parentAgreement * 0.15)
-    }
-
-    private static func canonicalHierarchyEntries(from joints: [SkeletonAsset.Joint],
-                                                  restrictedTo restrictedIndices: Set<Int>?) -> [String: String] {
-        var map: [String: String] = [:]
-        map.reserveCapacity(joints.count)
-        for (index, joint) in joints.enumerated() {
-            if let restrictedIndices, !restrictedIndices.contains(index) {
-                continue
-            }
-            let canonicalName = canonicalJointName(joint.name)
-            guard !canonicalName.isEmpty else { continue }
-            if map[canonicalName] != nil { continue }
-
-            let canonicalParent: String
-            if joint.parentIndex >= 0, joint.parentIndex < joints.count {
-                canonicalParent = canonicalJointName(joints[joint.parentIndex].name)
-            } else {
-                canonicalParent = ""
-            }
-            map[canonicalName] = canonicalParent
-        }
-        return map
-    }
 }
 
 private func commitSourceAsset(scan: ImportScanResult,
@@ -3619,10 +3894,11 @@ final class ImportController {
               let importer,
               let rootURL = projectManager.assetRootURL() else { return false }
         let resolver = AssetPathResolver(assetsRootURL: rootURL)
-        if let result = importer.commit(scan: scan,
-                                        settings: settings,
-                                        projectManager: projectManager,
-                                        resolver: resolver) {
+        // Importers write outputs, metadata and failure state through several mutations.
+        let imported = projectManager.performAssetMutationBatch {
+            importer.commit(scan: scan, settings: settings, projectManager: projectManager, resolver: resolver)
+        }
+        if let result = imported {
             commitResult = result
             commitAssetType = scan.assetType
             isOpen = false
@@ -3672,6 +3948,35 @@ final class ImportController {
         return false
     }
 
+    /// Imports every animation-only FBX directly inside `relativePath` with default settings, as one
+    /// batch. Returns the number of files that produced clips.
+    func importAnimationFolder(relativePath: String) -> Int {
+        guard let rootURL = projectManager.assetRootURL() else { return 0 }
+        let folderURL = rootURL.appendingPathComponent(relativePath, isDirectory: true)
+        guard let contents = try? FileManager.default.contentsOfDirectory(at: folderURL,
+                                                                         includingPropertiesForKeys: nil,
+                                                                         options: [.skipsHiddenFiles]) else { return 0 }
+        let fbxImporter = FbxImporter()
+        let sources = contents
+            .filter { fbxImporter.canImport($0) }
+            .sorted { $0.lastPathComponent < $1.lastPathComponent }
+        let requests = sources.compactMap { url -> (scan: ImportScanResult, settings: ImportSettings)? in
+            guard let scan = fbxImporter.scan(url), scan.assetType == .animationClip else { return nil }
+            return (scan: scan, settings: fbxImporter.defaultSettings(for: scan))
+        }
+        guard !requests.isEmpty else { return 0 }
+        let results = FbxImporter.commitAnimationOnlyFBXBatch(requests,
+                                                              projectManager: projectManager,
+                                                              resolver: AssetPathResolver(assetsRootURL: rootURL),
+                                                              importerId: fbxImporter.importerId,
+                                                              importerVersion: fbxImporter.importerVersion)
+        let imported = results.compactMap { $0 }
+        let clipCount = imported.reduce(0) { $0 + $1.writtenPaths.count }
+        logCenter.logInfo("Imported \(clipCount) animation clips from \(imported.count) of \(requests.count) FBX files in \(relativePath)",
+                          category: .assets)
+        return imported.count
+    }
+
     func sourceFilename() -> String {
         scanResult?.sourceURL.lastPathComponent ?? ""
     }
@@ -3807,7 +4112,11 @@ final class ImportController {
             allowedKeys = [
                 "importMaterials", "importTextures", "copyTextures",
                 "flipNormalY", "generateTangents", "scale",
-                "combineORM", "createPrefab", "createHierarchy"
+                "combineORM", "createPrefab", "createHierarchy",
+                "generateLODs", "lodRatios", "lodScreenSizes",
+                "generateMeshlets", "meshletMaxVertices", "meshletMaxTriangles",
+                "vertexQuantization",
+                "skinInfluences", "skinMinWeight", "skinRenormalize"
             ]
         default:
             allowedKeys = []
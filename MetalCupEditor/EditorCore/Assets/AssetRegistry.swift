@@ -19,10 +19,27 @@ final class AssetRegistry: AssetDatabase {
     private var watcher: DispatchSourceFileSystemObject?
     private var watcherDescriptor: Int32 = -1
 
+    /// Asset and meta file times seen when each path's metadata was last loaded.
+    private struct FileStamp: Equatable {
+        var asset: TimeInterval
+        var meta: TimeInterval
+    }
+    private var stampsByPath: [String: FileStamp] = [:]
+
+    // Self-mutation bookkeeping: watcher events raised by the editor's own writes are dropped
+    // while a mutation is open, and afterwards while the root listing still matches what the
+    // last self-mutation left behind.
+    private var selfMutationDepth: Int = 0
+    private var selfMutationFingerprint: [String: TimeInterval] = [:]
+    private(set) var watcherEventsSuppressed: UInt64 = 0
+    private(set) var watcherRescans: UInt64 = 0
+    private(set) var lastScanReloaded: Int = 0
+    private(set) var lastScanReused: Int = 0
+
     init(projectAssetRootURL: URL, logCenter: EngineLogger) {
         self.assetRootURL = projectAssetRootURL.standardizedFileURL
         self.logCenter = logCenter
-        scanAssets()
+        scanAssets(reusingUnchanged: false, forcedPaths: [])
     }
 
     deinit {
@@ -51,7 +68,23 @@ final class AssetRegistry: AssetDatabase {
     }
 
     func refresh() {
-        scanAssets()
+        scanAssets(reusingUnchanged: false, forcedPaths: [])
+    }
+
+    /// Reloads metadata only for paths whose asset or meta file time moved, plus `changedPaths`
+    /// (asset-root-relative). Removed files drop out and new files are picked up as usual.
+    func refreshIncremental(changedPaths: Set<String>) {
+        scanAssets(reusingUnchanged: true, forcedPaths: changedPaths)
+    }
+
+    func beginSelfMutation() {
+        selfMutationDepth += 1
+    }
+
+    func endSelfMutation() {
+        selfMutationDepth = max(0, selfMutationDepth - 1)
+        guard selfMutationDepth == 0 else { return }
+        selfMutationFingerprint = rootFingerprint()
     }
 
     func startWatching() {
@@ -65,8 +98,9 @@ final class AssetRegistry: AssetDatabase {
             queue: DispatchQueue.global(qos: .utility)
         )
         source.setEventHandler { [weak self] in
-            self?.scanAssets()
-            self?.onChange?()
+            DispatchQueue.main.async {
+                self?.handleWatcherEvent()
+            }
         }
         source.setCancelHandler { [weak self] in
             if let fd = self?.watcherDescriptor, fd >= 0 {
@@ -98,13 +132,43 @@ final class AssetRegistry: AssetDatabase {
         }
     }
 
-    private func scanAssets() {
+    private func handleWatcherEvent() {
+        if selfMutationDepth > 0 || rootFingerprint() == selfMutationFingerprint {
+            watcherEventsSuppressed &+= 1
+            return
+        }
+        watcherRescans &+= 1
+        scanAssets(reusingUnchanged: true, forcedPaths: [])
+        onChange?()
+    }
+
+    /// The watcher observes the root directory only, so its events can only reflect changes in
+    /// this listing.
+    private func rootFingerprint() -> [String: TimeInterval] {
+        let keys: [URLResourceKey] = [.contentModificationDateKey]
+        guard let items = try? FileManager.default.contentsOfDirectory(at: assetRootURL, includingPropertiesForKeys: keys) else { return [:] }
+        var fingerprint: [String: TimeInterval] = [:]
+        for item in items {
+            let modified = (try? item.resourceValues(forKeys: Set(keys)))?.contentModificationDate?.timeIntervalSince1970 ?? 0
+            fingerprint[item.lastPathComponent] = modified
+        }
+        return fingerprint
+    }
+
+    private func fileTime(_ path: String, _ fileManager: FileManager) -> TimeInterval {
+        (try? fileManager.attributesOfItem(atPath: path)[.modificationDate] as? Date)?.timeIntervalSince1970 ?? 0
+    }
+
+    private func scanAssets(reusingUnchanged: Bool, forcedPaths: Set<String>) {
         let fileManager = FileManager.default
         guard let enumerator = fileManager.enumerator(at: assetRootURL, includingPropertiesForKeys: nil) else { return }
 
         var newByHandle: [AssetHandle: AssetMetadata] = [:]
         var newByPath: [String: AssetMetadata] = [:]
         var newBySourceAbs: [String: AssetMetadata] = [:]
+        var newStamps: [String: FileStamp] = [:]
+        var reloaded = 0
+        var reused = 0
 
         for case let url as URL in enumerator {
             if url.hasDirectoryPath { continue }
@@ -115,14 +179,28 @@ final class AssetRegistry: AssetDatabase {
 
             guard let relativePath = PathUtils.relativePath(from: assetRootURL, to: url) else { continue }
             let metaURL = metaURLForAsset(assetURL: url, relativePath: relativePath)
-            let lastModified = (try? fileManager.attributesOfItem(atPath: url.path)[.modificationDate] as? Date)?.timeIntervalSince1970 ?? 0
-            let metadata = loadOrCreateMetadata(
-                for: url,
-                relativePath: relativePath,
-                metaURL: metaURL,
-                assetType: assetType,
-                lastModified: lastModified
-            )
+            let lastModified = fileTime(url.path, fileManager)
+            let stamp = FileStamp(asset: lastModified, meta: fileTime(metaURL.path, fileManager))
+            let metadata: AssetMetadata
+            if reusingUnchanged,
+               !forcedPaths.contains(relativePath),
+               stampsByPath[relativePath] == stamp,
+               let cached = metadataByPath[relativePath] {
+                metadata = cached
+                newStamps[relativePath] = stamp
+                reused += 1
+            } else {
+                metadata = loadOrCreateMetadata(
+                    for: url,
+                    relativePath: relativePath,
+                    metaURL: metaURL,
+                    assetType: assetType,
+                    lastModified: lastModified
+                )
+                // Loading may rewrite the meta file, so stamp it afterwards.
+                newStamps[relativePath] = FileStamp(asset: lastModified, meta: fileTime(metaURL.path, fileManager))
+                reloaded += 1
+            }
             newByHandle[metadata.handle] = metadata
             newByPath[relativePath] = metadata
             if let sourceAbs = metadata.importSettings["sourcePathAbs"], !sourceAbs.isEmpty {
@@ -133,6 +211,9 @@ final class AssetRegistry: AssetDatabase {
         metadataByHandle = newByHandle
         metadataByPath = newByPath
         metadataBySourcePathAbs = newBySourceAbs
+        stampsByPath = newStamps
+        lastScanReloaded = reloaded
+        lastScanReused = reused
     }
 
     private func loadOrCreateMetadata(for assetURL: URL, relativePath: String, metaURL: URL, assetType: AssetType, lastModified: TimeInterval) -> AssetMetadata {
@@ -65,6 +65,8 @@ struct ImportedFBXData {
     let importScaleFactor: Float
     let importScaleNormalizationMode: String
     let importScaleSource: String
+    /// Skin influence coverage line from the FBX SDK path; nil for Assimp and unskinned scenes.
+    var skinInfluenceReport: String? = nil
 }
 
 private struct BakedMeshVertexDocument: Codable {
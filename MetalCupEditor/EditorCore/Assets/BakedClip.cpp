@@ -0,0 +1,443 @@
+/// BakedClip.cpp
+/// Implements the baked clip writer, the key encodings and the memory-mapped reader.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BakedClip.h"
+
+/// Layout (little-endian, every block 16-byte aligned):
+///   header     48 bytes: magic, version, flags, duration, track count, source stamp, TOC offset, file size
+///   TOC        64 bytes per track, sorted by joint index: joint, then per channel {keys, encoding, offset}
+///   key blocks per channel: float times, then values in the channel's encoding
+/// A reader seeks with the TOC alone and touches a key block only when that channel is used.
+struct MCEBakedClip {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    uint64_t tocOffset = 0;
+    MCEBakedClipInfo info {};
+};
+
+namespace {
+
+constexpr char kMagic[8] = { 'M', 'C', 'E', 'C', 'L', 'I', 'P', 0 };
+constexpr size_t kHeaderSize = 48;
+constexpr size_t kTocEntrySize = 64;
+constexpr size_t kBlockAlign = 16;
+constexpr size_t kQuantizedVec3Header = 32;
+constexpr uint32_t kFlagQuantized = 1u;
+constexpr uint32_t kQuatComponentBits = 20;
+constexpr uint32_t kQuatComponentMax = (1u << kQuatComponentBits) - 1;
+constexpr float kSmallestThreeRange = 0.70710678f;
+
+size_t AlignUp(size_t value) {
+    return (value + kBlockAlign - 1) & ~(kBlockAlign - 1);
+}
+
+uint32_t ComponentCount(int32_t channel) {
+    return channel == MCEBakedClipChannelRotation ? 4 : 3;
+}
+
+size_t ValueBytes(int32_t encoding, uint32_t components, uint64_t keyCount) {
+    switch (encoding) {
+    case MCEBakedClipEncodingRaw: return static_cast<size_t>(keyCount) * components * sizeof(float);
+    case MCEBakedClipEncodingQuantizedVec3: return kQuantizedVec3Header + static_cast<size_t>(keyCount) * 3 * sizeof(uint16_t);
+    case MCEBakedClipEncodingQuantizedQuat: return static_cast<size_t>(keyCount) * sizeof(uint64_t);
+    default: return 0;
+    }
+}
+
+size_t BlockBytes(int32_t encoding, uint32_t components, uint64_t keyCount) {
+    if (keyCount == 0) { return 0; }
+    return AlignUp(static_cast<size_t>(keyCount) * sizeof(float)) + AlignUp(ValueBytes(encoding, components, keyCount));
+}
+
+template <typename T>
+void Put(std::vector<uint8_t> &bytes, size_t offset, T value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T Get(const uint8_t *bytes, size_t offset) {
+    T value;
+    std::memcpy(&value, bytes + offset, sizeof(T));
+    return value;
+}
+
+void EncodeQuantizedVec3(const float *values, uint32_t keyCount, uint8_t *out) {
+    float minimum[3] = { values[0], values[1], values[2] };
+    float maximum[3] = { values[0], values[1], values[2] };
+    for (uint32_t key = 1; key < keyCount; ++key) {
+        for (int c = 0; c < 3; ++c) {
+            minimum[c] = std::min(minimum[c], values[key * 3 + c]);
+            maximum[c] = std::max(maximum[c], values[key * 3 + c]);
+        }
+    }
+    float extent[3];
+    for (int c = 0; c < 3; ++c) { extent[c] = maximum[c] - minimum[c]; }
+    std::memcpy(out, minimum, sizeof(minimum));
+    std::memcpy(out + 12, extent, sizeof(extent));
+    uint8_t *keys = out + kQuantizedVec3Header;
+    for (uint32_t key = 0; key < keyCount; ++key) {
+        for (int c = 0; c < 3; ++c) {
+            const float unit = extent[c] > 0.0f ? (values[key * 3 + c] - minimum[c]) / extent[c] : 0.0f;
+            const uint16_t quantized = static_cast<uint16_t>(std::lround(std::min(1.0f, std::max(0.0f, unit)) * 65535.0f));
+            std::memcpy(keys + (key * 3 + c) * sizeof(uint16_t), &quantized, sizeof(uint16_t));
+        }
+    }
+}
+
+void DecodeQuantizedVec3(const uint8_t *block, uint32_t key, float *out) {
+    float minimum[3];
+    float extent[3];
+    std::memcpy(minimum, block, sizeof(minimum));
+    std::memcpy(extent, block + 12, sizeof(extent));
+    for (int c = 0; c < 3; ++c) {
+        const uint16_t quantized = Get<uint16_t>(block, kQuantizedVec3Header + (key * 3 + c) * sizeof(uint16_t));
+        out[c] = minimum[c] + (static_cast<float>(quantized) / 65535.0f) * extent[c];
+    }
+}
+
+/// Drops the largest component (recoverable from unit length) and stores the other three.
+uint64_t EncodeQuat(const float *q) {
+    float v[4] = { q[0], q[1], q[2], q[3] };
+    const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + v[3] * v[3]);
+    if (length < 1e-8f) {
+        v[0] = v[1] = v[2] = 0.0f;
+        v[3] = 1.0f;
+    } else {
+        for (float &c : v) { c /= length; }
+    }
+    uint32_t largest = 0;
+    for (uint32_t c = 1; c < 4; ++c) {
+        if (std::fabs(v[c]) > std::fabs(v[largest])) { largest = c; }
+    }
+    const float sign = v[largest] < 0.0f ? -1.0f : 1.0f;
+    uint64_t packed = largest;
+    uint32_t slot = 0;
+    for (uint32_t c = 0; c < 4; ++c) {
+        if (c == largest) { continue; }
+        const float unit = (v[c] * sign + kSmallestThreeRange) / (2.0f * kSmallestThreeRange);
+        const uint64_t quantized = static_cast<uint64_t>(std::lround(std::min(1.0f, std::max(0.0f, unit)) * kQuatComponentMax));
+        packed |= quantized << (2 + slot * kQuatComponentBits);
+        ++slot;
+    }
+    return packed;
+}
+
+void DecodeQuat(uint64_t packed, float *out) {
+    const uint32_t largest = static_cast<uint32_t>(packed & 3u);
+    float sum = 0.0f;
+    uint32_t slot = 0;
+    for (uint32_t c = 0; c < 4; ++c) {
+        if (c == largest) { continue; }
+        const uint64_t quantized = (packed >> (2 + slot * kQuatComponentBits)) & kQuatComponentMax;
+        out[c] = (static_cast<float>(quantized) / kQuatComponentMax) * (2.0f * kSmallestThreeRange) - kSmallestThreeRange;
+        sum += out[c] * out[c];
+        ++slot;
+    }
+    out[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+}
+
+struct ChannelRef {
+    uint32_t keyCount = 0;
+    int32_t encoding = MCEBakedClipEncodingRaw;
+    uint64_t offset = 0;
+};
+
+ChannelRef ReadChannel(const MCEBakedClip *clip, uint32_t trackIndex, int32_t channel) {
+    const size_t entry = clip->tocOffset + static_cast<size_t>(trackIndex) * kTocEntrySize + 8 + channel * 16;
+    ChannelRef ref;
+    ref.keyCount = Get<uint32_t>(clip->data, entry);
+    ref.encoding = static_cast<int32_t>(Get<uint32_t>(clip->data, entry + 4));
+    ref.offset = Get<uint64_t>(clip->data, entry + 8);
+    return ref;
+}
+
+void DecodeKey(const MCEBakedClip *clip, const ChannelRef &ref, int32_t channel, uint32_t key, float *out) {
+    const uint8_t *values = clip->data + ref.offset + AlignUp(static_cast<size_t>(ref.keyCount) * sizeof(float));
+    switch (ref.encoding) {
+    case MCEBakedClipEncodingQuantizedVec3:
+        DecodeQuantizedVec3(values, key, out);
+        break;
+    case MCEBakedClipEncodingQuantizedQuat:
+        DecodeQuat(Get<uint64_t>(values, key * sizeof(uint64_t)), out);
+        break;
+    default: {
+        const uint32_t components = ComponentCount(channel);
+        std::memcpy(out, values + static_cast<size_t>(key) * components * sizeof(float), components * sizeof(float));
+        break;
+    }
+    }
+}
+
+float KeyTime(const MCEBakedClip *clip, const ChannelRef &ref, uint32_t key) {
+    return Get<float>(clip->data, ref.offset + key * sizeof(float));
+}
+
+bool ValidChannel(const MCEBakedClip *clip, const ChannelRef &ref, int32_t channel) {
+    if (ref.keyCount == 0) { return true; }
+    const bool rotation = channel == MCEBakedClipChannelRotation;
+    const bool encodingOk = ref.encoding == MCEBakedClipEncodingRaw
+        || (rotation ? ref.encoding == MCEBakedClipEncodingQuantizedQuat : ref.encoding == MCEBakedClipEncodingQuantizedVec3);
+    if (!encodingOk || ref.keyCount > clip->size / sizeof(float) || ref.offset % kBlockAlign != 0) { return false; }
+    const size_t bytes = BlockBytes(ref.encoding, ComponentCount(channel), ref.keyCount);
+    return ref.offset <= clip->size && bytes <= clip->size - ref.offset;
+}
+
+bool WriteFile(const char *path, const std::vector<uint8_t> &bytes) {
+    const std::string temporaryPath = std::string(path) + ".tmp";
+    FILE *file = std::fopen(temporaryPath.c_str(), "wb");
+    if (!file) { return false; }
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok || std::rename(temporaryPath.c_str(), path) != 0) {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+}
+
+extern "C" uint32_t MCEBakedClipWrite(const MCEBakedClipDesc *desc, const char *outputPath, uint64_t *bytesWrittenOut) {
+    if (!desc || !outputPath || (desc->trackCount > 0 && !desc->tracks)) { return 0; }
+    const bool quantize = desc->quantize != 0;
+
+    std::vector<uint32_t> order(desc->trackCount);
+    for (uint32_t i = 0; i < desc->trackCount; ++i) { order[i] = i; }
+    std::stable_sort(order.begin(), order.end(), [desc](uint32_t a, uint32_t b) {
+        return desc->tracks[a].jointIndex < desc->tracks[b].jointIndex;
+    });
+
+    const size_t tocOffset = kHeaderSize;
+    size_t cursor = AlignUp(tocOffset + static_cast<size_t>(desc->trackCount) * kTocEntrySize);
+    std::vector<ChannelRef> refs(static_cast<size_t>(desc->trackCount) * MCEBakedClipChannelCount);
+    for (uint32_t slot = 0; slot < desc->trackCount; ++slot) {
+        const MCEBakedClipTrackDesc &track = desc->tracks[order[slot]];
+        for (int32_t channel = 0; channel < MCEBakedClipChannelCount; ++channel) {
+            const MCEBakedClipChannelDesc &source = track.channels[channel];
+            if (source.keyCount == 0) { continue; }
+            const uint32_t components = ComponentCount(channel);
+            if (!desc->times || !desc->values
+                || static_cast<uint64_t>(source.timeFirst) + source.keyCount > desc->timeCount
+                || static_cast<uint64_t>(source.valueFirst) + static_cast<uint64_t>(source.keyCount) * components > desc->valueCount) {
+                return 0;
+            }
+            const float *times = desc->times + source.timeFirst;
+            for (uint32_t key = 1; key < source.keyCount; ++key) {
+                if (!(times[key] >= times[key - 1])) { return 0; }
+            }
+            ChannelRef &ref = refs[static_cast<size_t>(slot) * MCEBakedClipChannelCount + channel];
+            ref.keyCount = source.keyCount;
+            ref.encoding = !quantize ? MCEBakedClipEncodingRaw
+                : (channel == MCEBakedClipChannelRotation ? MCEBakedClipEncodingQuantizedQuat : MCEBakedClipEncodingQuantizedVec3);
+            ref.offset = cursor;
+            cursor += BlockBytes(ref.encoding, components, ref.keyCount);
+        }
+    }
+
+    std::vector<uint8_t> bytes(cursor, 0);
+    std::memcpy(bytes.data(), kMagic, sizeof(kMagic));
+    Put<uint32_t>(bytes, 8, MCE_BAKED_CLIP_VERSION);
+    Put<uint32_t>(bytes, 12, quantize ? kFlagQuantized : 0u);
+    Put<float>(bytes, 16, desc->durationSeconds);
+    Put<uint32_t>(bytes, 20, desc->trackCount);
+    Put<uint64_t>(bytes, 24, desc->sourceStamp);
+    Put<uint64_t>(bytes, 32, tocOffset);
+    Put<uint64_t>(bytes, 40, static_cast<uint64_t>(bytes.size()));
+
+    for (uint32_t slot = 0; slot < desc->trackCount; ++slot) {
+        const MCEBakedClipTrackDesc &track = desc->tracks[order[slot]];
+        const size_t entry = tocOffset + static_cast<size_t>(slot) * kTocEntrySize;
+        Put<int32_t>(bytes, entry, track.jointIndex);
+        for (int32_t channel = 0; channel < MCEBakedClipChannelCount; ++channel) {
+            const ChannelRef &ref = refs[static_cast<size_t>(slot) * MCEBakedClipChannelCount + channel];
+            Put<uint32_t>(bytes, entry + 8 + channel * 16, ref.keyCount);
+            Put<uint32_t>(bytes, entry + 12 + channel * 16, static_cast<uint32_t>(ref.encoding));
+            Put<uint64_t>(bytes, entry + 16 + channel * 16, ref.offset);
+            if (ref.keyCount == 0) { continue; }
+
+            const MCEBakedClipChannelDesc &source = track.channels[channel];
+            const uint32_t components = ComponentCount(channel);
+            const float *values = desc->values + source.valueFirst;
+            std::memcpy(bytes.data() + ref.offset, desc->times + source.timeFirst, ref.keyCount * sizeof(float));
+            uint8_t *out = bytes.data() + ref.offset + AlignUp(static_cast<size_t>(ref.keyCount) * sizeof(float));
+            switch (ref.encoding) {
+            case MCEBakedClipEncodingQuantizedVec3:
+                EncodeQuantizedVec3(values, ref.keyCount, out);
+                break;
+            case MCEBakedClipEncodingQuantizedQuat:
+                for (uint32_t key = 0; key < ref.keyCount; ++key) {
+                    const uint64_t packed = EncodeQuat(values + key * 4);
+                    std::memcpy(out + key * sizeof(uint64_t), &packed, sizeof(uint64_t));
+                }
+                break;
+            default:
+                std::memcpy(out, values, static_cast<size_t>(ref.keyCount) * components * sizeof(float));
+                break;
+            }
+        }
+    }
+
+    if (!WriteFile(outputPath, bytes)) { return 0; }
+    if (bytesWrittenOut) { *bytesWrittenOut = bytes.size(); }
+    return 1;
+}
+
+extern "C" MCEBakedClip *MCEBakedClipOpen(const char *path) {
+    if (!path) { return nullptr; }
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) { return nullptr; }
+    struct stat status {};
+    if (fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(kHeaderSize)) {
+        close(fd);
+        return nullptr;
+    }
+    const size_t size = static_cast<size_t>(status.st_size);
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) { return nullptr; }
+
+    auto *clip = new MCEBakedClip();
+    clip->data = static_cast<const uint8_t *>(mapped);
+    clip->size = size;
+    MCEBakedClipInfo &info = clip->info;
+    info.version = Get<uint32_t>(clip->data, 8);
+    info.quantized = (Get<uint32_t>(clip->data, 12) & kFlagQuantized) != 0 ? 1u : 0u;
+    info.durationSeconds = Get<float>(clip->data, 16);
+    info.trackCount = Get<uint32_t>(clip->data, 20);
+    info.sourceStamp = Get<uint64_t>(clip->data, 24);
+    clip->tocOffset = Get<uint64_t>(clip->data, 32);
+    info.fileSize = Get<uint64_t>(clip->data, 40);
+
+    bool valid = std::memcmp(clip->data, kMagic, sizeof(kMagic)) == 0
+        && info.version == MCE_BAKED_CLIP_VERSION
+        && info.fileSize == size
+        && clip->tocOffset >= kHeaderSize
+        && clip->tocOffset <= size
+        && info.trackCount <= (size - clip->tocOffset) / kTocEntrySize;
+    for (uint32_t track = 0; valid && track < info.trackCount; ++track) {
+        for (int32_t channel = 0; valid && channel < MCEBakedClipChannelCount; ++channel) {
+            valid = ValidChannel(clip, ReadChannel(clip, track, channel), channel);
+        }
+    }
+    if (!valid) {
+        MCEBakedClipClose(clip);
+        return nullptr;
+    }
+    return clip;
+}
+
+extern "C" void MCEBakedClipClose(MCEBakedClip *clip) {
+    if (!clip) { return; }
+    munmap(const_cast<uint8_t *>(clip->data), clip->size);
+    delete clip;
+}
+
+extern "C" void MCEBakedClipGetInfo(const MCEBakedClip *clip, MCEBakedClipInfo *infoOut) {
+    if (!clip || !infoOut) { return; }
+    *infoOut = clip->info;
+}
+
+extern "C" uint32_t MCEBakedClipGetTrackInfo(const MCEBakedClip *clip, uint32_t trackIndex, MCEBakedClipTrackInfo *infoOut) {
+    if (!clip || !infoOut || trackIndex >= clip->info.trackCount) { return 0; }
+    infoOut->jointIndex = Get<int32_t>(clip->data, clip->tocOffset + static_cast<size_t>(trackIndex) * kTocEntrySize);
+    for (int32_t channel = 0; channel < MCEBakedClipChannelCount; ++channel) {
+        const ChannelRef ref = ReadChannel(clip, trackIndex, channel);
+        infoOut->keyCounts[channel] = ref.keyCount;
+        infoOut->encodings[channel] = ref.encoding;
+    }
+    return 1;
+}
+
+extern "C" int32_t MCEBakedClipFindTrack(const MCEBakedClip *clip, int32_t jointIndex) {
+    if (!clip) { return -1; }
+    uint32_t low = 0;
+    uint32_t high = clip->info.trackCount;
+    while (low < high) {
+        const uint32_t mid = low + (high - low) / 2;
+        const int32_t joint = Get<int32_t>(clip->data, clip->tocOffset + static_cast<size_t>(mid) * kTocEntrySize);
+        if (joint == jointIndex) { return static_cast<int32_t>(mid); }
+        if (joint < jointIndex) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+extern "C" uint32_t MCEBakedClipDecodeChannel(const MCEBakedClip *clip, uint32_t trackIndex, int32_t channel,
+                                              float *timesOut, float *valuesOut) {
+    if (!clip || trackIndex >= clip->info.trackCount || channel < 0 || channel >= MCEBakedClipChannelCount) { return 0; }
+    const ChannelRef ref = ReadChannel(clip, trackIndex, channel);
+    if (ref.keyCount == 0) { return 1; }
+    if (!timesOut || !valuesOut) { return 0; }
+    std::memcpy(timesOut, clip->data + ref.offset, static_cast<size_t>(ref.keyCount) * sizeof(float));
+    const uint32_t components = ComponentCount(channel);
+    for (uint32_t key = 0; key < ref.keyCount; ++key) {
+        DecodeKey(clip, ref, channel, key, valuesOut + static_cast<size_t>(key) * components);
+    }
+    return 1;
+}
+
+extern "C" uint32_t MCEBakedClipSampleChannel(const MCEBakedClip *clip, uint32_t trackIndex, int32_t channel,
+                                              float time, float *valueOut) {
+    if (!clip || !valueOut || trackIndex >= clip->info.trackCount || channel < 0 || channel >= MCEBakedClipChannelCount) { return 0; }
+    const ChannelRef ref = ReadChannel(clip, trackIndex, channel);
+    if (ref.keyCount == 0) { return 0; }
+
+    // First key strictly after `time`; everything before it is at or before the sample point.
+    uint32_t low = 0;
+    uint32_t high = ref.keyCount;
+    while (low < high) {
+        const uint32_t mid = low + (high - low) / 2;
+        if (KeyTime(clip, ref, mid) <= time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == 0 || low == ref.keyCount) {
+        DecodeKey(clip, ref, channel, low == 0 ? 0 : ref.keyCount - 1, valueOut);
+        return 1;
+    }
+
+    const uint32_t components = ComponentCount(channel);
+    float a[4];
+    float b[4];
+    DecodeKey(clip, ref, channel, low - 1, a);
+    DecodeKey(clip, ref, channel, low, b);
+    const float t0 = KeyTime(clip, ref, low - 1);
+    const float t1 = KeyTime(clip, ref, low);
+    const float alpha = t1 > t0 ? (time - t0) / (t1 - t0) : 0.0f;
+    if (channel == MCEBakedClipChannelRotation) {
+        const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        const float sign = dot < 0.0f ? -1.0f : 1.0f;
+        float length = 0.0f;
+        for (uint32_t c = 0; c < 4; ++c) {
+            valueOut[c] = a[c] + (b[c] * sign - a[c]) * alpha;
+            length += valueOut[c] * valueOut[c];
+        }
+        length = std::sqrt(length);
+        if (length > 1e-8f) {
+            for (uint32_t c = 0; c < 4; ++c) { valueOut[c] /= length; }
+        }
+        return 1;
+    }
+    for (uint32_t c = 0; c < components; ++c) {
+        valueOut[c] = a[c] + (b[c] - a[c]) * alpha;
+    }
+    return 1;
+}
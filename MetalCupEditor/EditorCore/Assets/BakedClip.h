@@ -0,0 +1,97 @@
+/// BakedClip.h
+/// Declares the binary baked animation clip container and its memory-mapped reader.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Bumped whenever the container layout or an encoding changes; older files are rejected.
+#define MCE_BAKED_CLIP_VERSION 1
+
+typedef enum {
+    MCEBakedClipChannelTranslation = 0,
+    MCEBakedClipChannelRotation = 1,
+    MCEBakedClipChannelScale = 2,
+    MCEBakedClipChannelCount = 3
+} MCEBakedClipChannel;
+
+typedef enum {
+    MCEBakedClipEncodingRaw = 0,
+    /// Vec3 keys as 16-bit fractions of the channel's bounding box.
+    MCEBakedClipEncodingQuantizedVec3 = 1,
+    /// Unit quaternions as smallest-three, 20 bits per component, one 64-bit word per key.
+    MCEBakedClipEncodingQuantizedQuat = 2
+} MCEBakedClipEncoding;
+
+/// One channel of a track in the writer's shared pools: `keyCount` times starting at `timeFirst`
+/// and `keyCount` vectors (3 floats, 4 for rotation) starting at float `valueFirst`.
+typedef struct {
+    uint32_t keyCount;
+    uint32_t timeFirst;
+    uint32_t valueFirst;
+} MCEBakedClipChannelDesc;
+
+typedef struct {
+    int32_t jointIndex;
+    MCEBakedClipChannelDesc channels[MCEBakedClipChannelCount];
+} MCEBakedClipTrackDesc;
+
+typedef struct {
+    float durationSeconds;
+    /// Opaque stamp of the document this was baked from; readers compare it to detect staleness.
+    uint64_t sourceStamp;
+    uint32_t quantize;
+    const MCEBakedClipTrackDesc *tracks;
+    uint32_t trackCount;
+    const float *times;
+    uint32_t timeCount;
+    const float *values;
+    uint32_t valueCount;
+} MCEBakedClipDesc;
+
+typedef struct {
+    uint32_t version;
+    uint32_t quantized;
+    float durationSeconds;
+    uint32_t trackCount;
+    uint64_t sourceStamp;
+    uint64_t fileSize;
+} MCEBakedClipInfo;
+
+typedef struct {
+    int32_t jointIndex;
+    uint32_t keyCounts[MCEBakedClipChannelCount];
+    int32_t encodings[MCEBakedClipChannelCount];
+} MCEBakedClipTrackInfo;
+
+typedef struct MCEBakedClip MCEBakedClip;
+
+/// Writes the container atomically. Tracks are stored sorted by joint index. Returns 0 on invalid
+/// input (unsorted key times, indices outside the pools) or I/O failure.
+uint32_t MCEBakedClipWrite(const MCEBakedClipDesc *desc, const char *outputPath, uint64_t *bytesWrittenOut);
+
+/// Maps the file and validates the header and track table; key blocks are not touched until a
+/// track is decoded or sampled. Returns NULL when the file is missing, truncated or another version.
+MCEBakedClip *MCEBakedClipOpen(const char *path);
+void MCEBakedClipClose(MCEBakedClip *clip);
+void MCEBakedClipGetInfo(const MCEBakedClip *clip, MCEBakedClipInfo *infoOut);
+uint32_t MCEBakedClipGetTrackInfo(const MCEBakedClip *clip, uint32_t trackIndex, MCEBakedClipTrackInfo *infoOut);
+/// Binary search over the sorted track table; -1 when the joint has no track.
+int32_t MCEBakedClipFindTrack(const MCEBakedClip *clip, int32_t jointIndex);
+/// Decodes one channel into caller buffers sized from the track info (3 or 4 floats per key).
+uint32_t MCEBakedClipDecodeChannel(const MCEBakedClip *clip, uint32_t trackIndex, int32_t channel,
+                                   float *timesOut, float *valuesOut);
+/// Interpolates one channel at `time`, decoding only the two bracketing keys. Rotations use a
+/// shortest-path normalized lerp. Returns 0 when the channel has no keys.
+uint32_t MCEBakedClipSampleChannel(const MCEBakedClip *clip, uint32_t trackIndex, int32_t channel,
+                                   float time, float *valueOut);
+
+#ifdef __cplusplus
+}
+#endif
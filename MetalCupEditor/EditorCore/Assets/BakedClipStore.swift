@@ -0,0 +1,180 @@
+/// BakedClipStore.swift
+/// Defines the baked animation clip cache and the header-only clip view it hands out.
+/// Created by Kaden Cringle.
+
+import Foundation
+import MetalCupEngine
+
+/// A baked clip mapped from disk. Opening validates the header and track table; key data is not read.
+final class BakedAnimationClip {
+    let durationSeconds: Float
+    fileprivate let sourceStamp: UInt64
+
+    private let clip: OpaquePointer
+
+    fileprivate init?(url: URL) {
+        guard let clip = url.withUnsafeFileSystemRepresentation({ path in path.flatMap { MCEBakedClipOpen($0) } }) else {
+            return nil
+        }
+        var info = MCEBakedClipInfo()
+        MCEBakedClipGetInfo(clip, &info)
+        self.clip = clip
+        self.durationSeconds = info.durationSeconds
+        self.sourceStamp = info.sourceStamp
+    }
+
+    deinit {
+        MCEBakedClipClose(clip)
+    }
+}
+
+/// Baked clips live under `<project cache>/BakedClips/<handle>.mcclip`, written next to every clip
+/// document the importers save. Each file carries a stamp of the document it was baked from, so a
+/// clip edited outside the importers is detected and rebaked instead of being served stale.
+final class BakedClipStore {
+    struct Stats {
+        var bakes: UInt64 = 0
+        var failures: UInt64 = 0
+        var opens: UInt64 = 0
+        var staleOpens: UInt64 = 0
+        var bytesWritten: UInt64 = 0
+    }
+
+    static let directoryName = "BakedClips"
+    /// Open views stay mapped; older views are dropped past this count.
+    private static let openClipLimit = 32
+
+    private let lock = NSLock()
+    private var cacheRoot: URL?
+    private var openClips: [AssetHandle: BakedAnimationClip] = [:]
+    private var openOrder: [AssetHandle] = []
+    private var stats = Stats()
+
+    func configure(cacheRoot: URL?) {
+        lock.lock()
+        defer { lock.unlock() }
+        self.cacheRoot = cacheRoot
+        openClips.removeAll()
+        openOrder.removeAll()
+        stats = Stats()
+    }
+
+    @discardableResult
+    func bake(_ clip: AnimationClipAsset, handle: AssetHandle, sourceURL: URL, quantize: Bool) -> Bool {
+        guard let outputURL = bakedURL(handle: handle), let stamp = Self.sourceStamp(for: sourceURL) else { return false }
+        var times: [Float] = []
+        var values: [Float] = []
+        var tracks: [MCEBakedClipTrackDesc] = []
+        tracks.reserveCapacity(clip.tracks.count)
+
+        func appendChannel<Key>(_ keys: [Key], time: (Key) -> Float, write: (Key) -> Void) -> MCEBakedClipChannelDesc {
+            let desc = MCEBakedClipChannelDesc(keyCount: UInt32(clamping: keys.count),
+                                               timeFirst: UInt32(clamping: times.count),
+                                               valueFirst: UInt32(clamping: values.count))
+            for key in keys.sorted(by: { time($0) < time($1) }) {
+                times.append(time(key))
+                write(key)
+            }
+            return desc
+        }
+
+        for track in clip.tracks {
+            let translation = appendChannel(track.translations, time: \.time) { key in
+                values.append(contentsOf: [key.value.x, key.value.y, key.value.z])
+            }
+            let rotation = appendChannel(track.rotations, time: \.time) { key in
+                values.append(contentsOf: [key.value.x, key.value.y, key.value.z, key.value.w])
+            }
+            let scale = appendChannel(track.scales, time: \.time) { key in
+                values.append(contentsOf: [key.value.x, key.value.y, key.value.z])
+            }
+            tracks.append(MCEBakedClipTrackDesc(jointIndex: Int32(clamping: track.jointIndex),
+                                                channels: (translation, rotation, scale)))
+        }
+
+        try? FileManager.default.createDirectory(at: outputURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+        var bytesWritten: UInt64 = 0
+        let ok = times.withUnsafeBufferPointer { timeBuffer in
+            values.withUnsafeBufferPointer { valueBuffer in
+                tracks.withUnsafeBufferPointer { trackBuffer -> UInt32 in
+                    var desc = MCEBakedClipDesc(durationSeconds: clip.durationSeconds,
+                                                sourceStamp: stamp,
+                                                quantize: quantize ? 1 : 0,
+                                                tracks: trackBuffer.baseAddress,
+                                                trackCount: UInt32(clamping: trackBuffer.count),
+                                                times: timeBuffer.baseAddress,
+                                                timeCount: UInt32(clamping: timeBuffer.count),
+                                                values: valueBuffer.baseAddress,
+                                                valueCount: UInt32(clamping: valueBuffer.count))
+                    return outputURL.withUnsafeFileSystemRepresentation { path in
+                        path.map { MCEBakedClipWrite(&desc, $0, &bytesWritten) } ?? 0
+                    }
+                }
+            }
+        }
+
+        lock.lock()
+        defer { lock.unlock() }
+        if ok != 0 {
+            stats.bakes += 1
+            stats.bytesWritten += bytesWritten
+            dropOpenClip(handle)
+        } else {
+            stats.failures += 1
+        }
+        return ok != 0
+    }
+
+    /// The baked view of `handle`, or nil when nothing is baked for the current `sourceURL` contents.
+    func clip(handle: AssetHandle, sourceURL: URL) -> BakedAnimationClip? {
+        guard let url = bakedURL(handle: handle), let stamp = Self.sourceStamp(for: sourceURL) else { return nil }
+        lock.lock()
+        if let cached = openClips[handle], cached.sourceStamp == stamp {
+            lock.unlock()
+            return cached
+        }
+        dropOpenClip(handle)
+        lock.unlock()
+
+        guard let opened = BakedAnimationClip(url: url) else { return nil }
+        lock.lock()
+        defer { lock.unlock() }
+        guard opened.sourceStamp == stamp else {
+            stats.staleOpens += 1
+            return nil
+        }
+        stats.opens += 1
+        openClips[handle] = opened
+        openOrder.append(handle)
+        if openOrder.count > Self.openClipLimit {
+            openClips.removeValue(forKey: openOrder.removeFirst())
+        }
+        return opened
+    }
+
+    func currentStats() -> Stats {
+        lock.lock()
+        defer { lock.unlock() }
+        return stats
+    }
+
+    private func bakedURL(handle: AssetHandle) -> URL? {
+        lock.lock()
+        defer { lock.unlock() }
+        return cacheRoot?
+            .appendingPathComponent(Self.directoryName, isDirectory: true)
+            .appendingPathComponent("\(handle.rawValue.uuidString).mcclip")
+    }
+
+    private func dropOpenClip(_ handle: AssetHandle) {
+        guard openClips.removeValue(forKey: handle) != nil else { return }
+        openOrder.removeAll { $0 == handle }
+    }
+
+    private static func sourceStamp(for url: URL) -> UInt64? {
+        guard let attributes = try? FileManager.default.attributesOfItem(atPath: url.path),
+              let modified = attributes[.modificationDate] as? Date else { return nil }
+        let size = (attributes[.size] as? NSNumber)?.uint64Value ?? 0
+        return UInt64(max(0, modified.timeIntervalSince1970 * 1_000_000)) ^ (size &* 0x9E37_79B9_7F4A_7C15)
+    }
+}
@@ -80,9 +80,15 @@ private func saveAnimationGraph(context: MCEContext, graph: AnimationGraphAsset,
         return AnimationGraphAssetSerializer.save(graph, to: url)
     }
     guard saved else { return false }
+    registerAnimationGraphRuntime(context: context, graph: graph)
+    refreshAssetSnapshotIfNeeded(context)
+    return true
+}
+
+private func registerAnimationGraphRuntime(context: MCEContext, graph: AnimationGraphAsset) {
     let compiled: CompiledAnimationGraph?
     switch AnimationGraphCompiler.compile(asset: graph, clipExists: { clipHandle in
-        context.engineContext.assets.animationClip(handle: clipHandle) != nil
+        animationClipExists(context: context, handle: clipHandle)
     }) {
     case let .success(result):
         compiled = result
@@ -90,14 +96,64 @@ private func saveAnimationGraph(context: MCEContext, graph: AnimationGraphAsset,
         compiled = nil
     }
     context.engineContext.assets.registerRuntimeAnimationGraph(handle: graph.handle, graph: graph, compiled: compiled)
+}
+
+/// Clip duration, memoized against the clip's recorded modification time. Only a clip the registry
+/// has rescanned since the last query goes back to the baked header.
+private func animationClipDuration(context: MCEContext, handle: AssetHandle) -> Float? {
+    refreshAssetSnapshotIfNeeded(context)
+    let store = context.clipDurationStore
+    let revision = context.assetSnapshotStore.revision
+    if let entry = store.entries[handle], entry.revision == revision {
+        return entry.duration
+    }
+    guard let metadata = context.assetSnapshotStore.snapshot.first(where: { $0.handle == handle }) else {
+        store.entries.removeValue(forKey: handle)
+        return loadAnimationClipDuration(context: context, handle: handle)
+    }
+    if let entry = store.entries[handle], entry.lastModified == metadata.lastModified {
+        store.entries[handle]?.revision = revision
+        return entry.duration
+    }
+    let duration = loadAnimationClipDuration(context: context, handle: handle)
+    store.entries[handle] = EditorClipDurationStore.Entry(lastModified: metadata.lastModified,
+                                                          revision: revision,
+                                                          duration: duration)
+    return duration
+}
+
+/// Clip duration from the baked clip header. A clip without a current bake (imported before the
+/// cache existed, or edited elsewhere) is loaded once through the engine and baked on the way, so
+/// later queries stay header-only; the decoded document answers this query even if that bake fails.
+private func loadAnimationClipDuration(context: MCEContext, handle: AssetHandle) -> Float? {
+    let projectManager = context.editorProjectManager
+    let sourceURL = projectManager.assetURL(for: handle)
+    if let sourceURL, let baked = projectManager.bakedClips.clip(handle: handle, sourceURL: sourceURL) {
+        return baked.durationSeconds
+    }
+    guard let clip = context.engineContext.assets.animationClip(handle: handle) else { return nil }
+    if let sourceURL {
+        projectManager.bakedClips.bake(clip, handle: handle, sourceURL: sourceURL, quantize: false)
+    }
+    return clip.durationSeconds
+}
+
+private func animationClipExists(context: MCEContext, handle: AssetHandle) -> Bool {
+    animationClipDuration(context: context, handle: handle) != nil
+}
+
+/// Re-registers a graph after its file was rewritten outside the bridge (undo/redo).
+func reloadAnimationGraphRuntime(context: MCEContext, handle: AssetHandle) {
+    guard let loaded = loadAnimationGraph(context: context, handle: handle) else { return }
+    registerAnimationGraphRuntime(context: context, graph: loaded.0)
     refreshAssetSnapshotIfNeeded(context)
-    return true
 }
 
 private func mutateAnimationGraph(context: MCEContext,
                                   handle: AssetHandle,
                                   mutation: (inout AnimationGraphAsset) -> Bool) -> Bool {
     guard var loaded = loadAnimationGraph(context: context, handle: handle) else { return false }
+    context.undoJournal.noteAssetWillChange(loaded.1, kind: .animationGraph(handle))
     let didMutate = mutation(&loaded.0)
     guard didMutate else { return false }
     return saveAnimationGraph(context: context, graph: loaded.0, url: loaded.1)
@@ -258,8 +314,8 @@ public func MCEEditorGetAnimationClipDuration(_ contextPtr: UnsafeRawPointer?,
     let clipHandleString = String(cString: clipHandle)
     guard let uuid = UUID(uuidString: clipHandleString) else { return 0 }
     let handle = AssetHandle(rawValue: uuid)
-    guard let clip = context.engineContext.assets.animationClip(handle: handle) else { return 0 }
-    durationOut?.pointee = max(0.0, clip.durationSeconds)
+    guard let duration = animationClipDuration(context: context, handle: handle) else { return 0 }
+    durationOut?.pointee = max(0.0, duration)
     return 1
 }
 
@@ -404,7 +460,7 @@ public func MCEEditorGetMaterialAsset(
     guard let uuid = UUID(uuidString: handleString) else { return 0 }
     let assetHandle = AssetHandle(rawValue: uuid)
     guard let context = resolveContext(contextPtr) else { return 0 }
-    guard let material = context.engineContext.assets.material(handle: assetHandle) else { return 0 }
+    guard let material = context.materialEditStore.material(for: assetHandle, context: context) else { return 0 }
 
     _ = writeCString(material.name, to: nameBuffer, max: nameBufferSize)
     version?.pointee = Int32(material.version)
@@ -466,6 +522,8 @@ public func MCEEditorSetMaterialAsset(
     guard let uuid = UUID(uuidString: handleString) else { return 0 }
     let assetHandle = AssetHandle(rawValue: uuid)
     guard let assetURL = context.editorProjectManager.assetURL(for: assetHandle) else { return 0 }
+    context.undoJournal.noteAssetWillChange(assetURL, kind: .material(assetHandle))
+    context.materialEditStore.discard(assetHandle)
 
     var material = context.engineContext.assets.material(handle: assetHandle)
         ?? MaterialAsset.default(handle: assetHandle, name: name != nil ? String(cString: name!) : "Material")
@@ -510,6 +568,74 @@ public func MCEEditorSetMaterialAsset(
     return 0
 }
 
+@_cdecl("MCEEditorPatchMaterialValues")
+public func MCEEditorPatchMaterialValues(_ contextPtr: UnsafeRawPointer?,
+                                         _ handle: UnsafePointer<CChar>?,
+                                         _ field: Int32,
+                                         _ values: UnsafePointer<Float>?,
+                                         _ valueCount: Int32) -> UInt32 {
+    guard let context = resolveContext(contextPtr),
+          let assetHandle = handleFromCString(handle),
+          let field = EditorMaterialEditStore.Field(rawValue: field),
+          let values else { return 0 }
+    return context.materialEditStore.setValues(field, values, count: Int(valueCount), handle: assetHandle, context: context) ? 1 : 0
+}
+
+@_cdecl("MCEEditorPatchMaterialTexture")
+public func MCEEditorPatchMaterialTexture(_ contextPtr: UnsafeRawPointer?,
+                                          _ handle: UnsafePointer<CChar>?,
+                                          _ slot: Int32,
+                                          _ textureHandle: UnsafePointer<CChar>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr),
+          let assetHandle = handleFromCString(handle),
+          let slot = EditorMaterialEditStore.TextureSlot(rawValue: slot) else { return 0 }
+    return context.materialEditStore.setTexture(slot, handleFromCString(textureHandle), handle: assetHandle, context: context) ? 1 : 0
+}
+
+@_cdecl("MCEEditorPatchMaterialName")
+public func MCEEditorPatchMaterialName(_ contextPtr: UnsafeRawPointer?,
+                                       _ handle: UnsafePointer<CChar>?,
+                                       _ name: UnsafePointer<CChar>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr),
+          let assetHandle = handleFromCString(handle),
+          let name else { return 0 }
+    return context.materialEditStore.setName(String(cString: name), handle: assetHandle, context: context) ? 1 : 0
+}
+
+/// Writes pending material edits. A null handle targets every material.
+@_cdecl("MCEEditorFlushMaterialEdits")
+public func MCEEditorFlushMaterialEdits(_ contextPtr: UnsafeRawPointer?,
+                                       _ handle: UnsafePointer<CChar>?) -> Int32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let assetHandle = handleFromCString(handle)
+    if handle != nil && assetHandle == nil { return 0 }
+    return Int32(context.materialEditStore.flush(context: context, handle: assetHandle))
+}
+
+/// Drops pending material edits without writing them.
+@_cdecl("MCEEditorRevertMaterialEdits")
+public func MCEEditorRevertMaterialEdits(_ contextPtr: UnsafeRawPointer?,
+                                        _ handle: UnsafePointer<CChar>?) {
+    guard let context = resolveContext(contextPtr),
+          let assetHandle = handleFromCString(handle) else { return }
+    context.materialEditStore.discard(assetHandle)
+}
+
+@_cdecl("MCEEditorGetMaterialEditStats")
+public func MCEEditorGetMaterialEditStats(_ contextPtr: UnsafeRawPointer?,
+                                          _ deltasApplied: UnsafeMutablePointer<UInt64>?,
+                                          _ writesPerformed: UnsafeMutablePointer<UInt64>?,
+                                          _ writesAvoided: UnsafeMutablePointer<UInt64>?,
+                                          _ pendingCount: UnsafeMutablePointer<Int32>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let store = context.materialEditStore
+    deltasApplied?.pointee = store.stats.deltasApplied
+    writesPerformed?.pointee = store.stats.writesPerformed
+    writesAvoided?.pointee = store.stats.writesAvoided
+    pendingCount?.pointee = Int32(store.pendingCount)
+    return 1
+}
+
 @_cdecl("MCEEditorGetAssetsRootPath")
 public func MCEEditorGetAssetsRootPath(_ contextPtr: UnsafeRawPointer?,
                                        _ buffer: UnsafeMutablePointer<CChar>?,
@@ -601,6 +727,132 @@ public func MCEEditorGetDirectoryEntry(_ contextPtr: UnsafeRawPointer?,
     return 1
 }
 
+/// direction 0 lists assets that use `handle`, 1 lists assets `handle` uses.
+@_cdecl("MCEEditorQueryAssetReferences")
+public func MCEEditorQueryAssetReferences(_ contextPtr: UnsafeRawPointer?,
+                                          _ handle: UnsafePointer<CChar>?,
+                                          _ direction: Int32,
+                                          _ transitive: UInt32) -> Int32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    context.assetReferenceStore.entries = []
+    guard let uuid = optionalUUID(from: handle) else { return 0 }
+    let assetHandle = AssetHandle(rawValue: uuid)
+    let graph = context.editorProjectManager.assetDependencies
+    let handles: Set<AssetHandle>
+    switch (direction, transitive != 0) {
+    case (0, false): handles = graph.directDependents(of: assetHandle)
+    case (0, true): handles = graph.transitiveDependents(of: [assetHandle])
+    case (_, false): handles = graph.directDependencies(of: assetHandle)
+    case (_, true): handles = graph.transitiveDependencies(of: [assetHandle])
+    }
+    refreshAssetSnapshotIfNeeded(context)
+    context.assetReferenceStore.entries = context.assetSnapshotStore.snapshot.filter {
+        $0.handle != assetHandle && handles.contains($0.handle)
+    }
+    return Int32(context.assetReferenceStore.entries.count)
+}
+
+@_cdecl("MCEEditorGetAssetReference")
+public func MCEEditorGetAssetReference(_ contextPtr: UnsafeRawPointer?,
+                                       _ index: Int32,
+                                       _ handleBuffer: UnsafeMutablePointer<CChar>?, _ handleBufferSize: Int32,
+                                       _ relativePathBuffer: UnsafeMutablePointer<CChar>?, _ relativePathBufferSize: Int32,
+                                       _ typeOut: UnsafeMutablePointer<Int32>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let idx = Int(index)
+    guard idx >= 0, idx < context.assetReferenceStore.entries.count else { return 0 }
+    let entry = context.assetReferenceStore.entries[idx]
+    _ = writeCString(entry.handle.rawValue.uuidString, to: handleBuffer, max: handleBufferSize)
+    _ = writeCString(entry.sourcePath, to: relativePathBuffer, max: relativePathBufferSize)
+    typeOut?.pointee = AssetTypes.code(for: entry.type)
+    return 1
+}
+
+@_cdecl("MCEEditorGetAssetDependencyStats")
+public func MCEEditorGetAssetDependencyStats(_ contextPtr: UnsafeRawPointer?,
+                                             _ nodeCount: UnsafeMutablePointer<Int32>?,
+                                             _ edgeCount: UnsafeMutablePointer<Int32>?,
+                                             _ lastChanged: UnsafeMutablePointer<Int32>?,
+                                             _ lastUpdateMs: UnsafeMutablePointer<Double>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let stats = context.editorProjectManager.assetDependencies.currentStats()
+    nodeCount?.pointee = Int32(clamping: stats.nodeCount)
+    edgeCount?.pointee = Int32(clamping: stats.edgeCount)
+    lastChanged?.pointee = Int32(clamping: stats.lastChanged)
+    lastUpdateMs?.pointee = stats.lastUpdateMs
+    return 1
+}
+
+@_cdecl("MCEEditorGetAssetMutationStats")
+public func MCEEditorGetAssetMutationStats(_ contextPtr: UnsafeRawPointer?,
+                                           _ mutations: UnsafeMutablePointer<UInt64>?,
+                                           _ registryUpdates: UnsafeMutablePointer<UInt64>?,
+                                           _ rescansAvoided: UnsafeMutablePointer<UInt64>?,
+                                           _ watcherEventsSuppressed: UnsafeMutablePointer<UInt64>?,
+                                           _ lastPathsReloaded: UnsafeMutablePointer<Int32>?,
+                                           _ lastUpdateMs: UnsafeMutablePointer<Double>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let stats = context.editorProjectManager.assetMutationStats
+    mutations?.pointee = stats.mutations
+    registryUpdates?.pointee = stats.registryUpdates
+    rescansAvoided?.pointee = stats.rescansAvoided
+    watcherEventsSuppressed?.pointee = context.editorProjectManager.assetWatcherStats().suppressed
+    lastPathsReloaded?.pointee = Int32(clamping: stats.lastPathsReloaded)
+    lastUpdateMs?.pointee = stats.lastUpdateMs
+    return 1
+}
+
+@_cdecl("MCEEditorGetTextureCookStats")
+public func MCEEditorGetTextureCookStats(_ contextPtr: UnsafeRawPointer?,
+                                         _ hits: UnsafeMutablePointer<UInt64>?,
+                                         _ cooks: UnsafeMutablePointer<UInt64>?,
+                                         _ failures: UnsafeMutablePointer<UInt64>?,
+                                         _ bytesWritten: UnsafeMutablePointer<UInt64>?,
+                                         _ lastCookMs: UnsafeMutablePointer<Double>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let stats = context.editorProjectManager.textureCookCache.currentStats()
+    hits?.pointee = stats.hits
+    cooks?.pointee = stats.cooks
+    failures?.pointee = stats.failures
+    bytesWritten?.pointee = stats.bytesWritten
+    lastCookMs?.pointee = stats.lastCookMs
+    return 1
+}
+
+@_cdecl("MCEEditorGetSkeletonIndexStats")
+public func MCEEditorGetSkeletonIndexStats(_ contextPtr: UnsafeRawPointer?,
+                                           _ entryCount: UnsafeMutablePointer<Int32>?,
+                                           _ skeletonsLoaded: UnsafeMutablePointer<Int32>?,
+                                           _ queries: UnsafeMutablePointer<Int32>?,
+                                           _ candidatesScored: UnsafeMutablePointer<Int32>?,
+                                           _ candidatesSkipped: UnsafeMutablePointer<Int32>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let stats = context.editorProjectManager.skeletonFingerprints.currentStats()
+    entryCount?.pointee = Int32(clamping: stats.entryCount)
+    skeletonsLoaded?.pointee = Int32(clamping: stats.skeletonsLoaded)
+    queries?.pointee = Int32(clamping: stats.queries)
+    candidatesScored?.pointee = Int32(clamping: stats.candidatesScored)
+    candidatesSkipped?.pointee = Int32(clamping: stats.candidatesSkipped)
+    return 1
+}
+
+@_cdecl("MCEEditorGetBakedClipStats")
+public func MCEEditorGetBakedClipStats(_ contextPtr: UnsafeRawPointer?,
+                                       _ bakes: UnsafeMutablePointer<UInt64>?,
+                                       _ failures: UnsafeMutablePointer<UInt64>?,
+                                       _ opens: UnsafeMutablePointer<UInt64>?,
+                                       _ staleOpens: UnsafeMutablePointer<UInt64>?,
+                                       _ bytesWritten: UnsafeMutablePointer<UInt64>?) -> UInt32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    let stats = context.editorProjectManager.bakedClips.currentStats()
+    bakes?.pointee = stats.bakes
+    failures?.pointee = stats.failures
+    opens?.pointee = stats.opens
+    staleOpens?.pointee = stats.staleOpens
+    bytesWritten?.pointee = stats.bytesWritten
+    return 1
+}
+
 @_cdecl("MCEEditorCreateFolder")
 public func MCEEditorCreateFolder(_ contextPtr: UnsafeRawPointer?,
                                   _ relativePath: UnsafePointer<CChar>?,
@@ -2459,7 +2711,7 @@ public func MCEEditorValidateAnimationGraph(_ contextPtr: UnsafeRawPointer?,
           let handle = animationGraphHandle(from: handle),
           let (graph, _) = loadAnimationGraph(context: context, handle: handle) else { return 0 }
     let result = AnimationGraphCompiler.compile(asset: graph) { clipHandle in
-        context.engineContext.assets.animationClip(handle: clipHandle) != nil
+        animationClipExists(context: context, handle: clipHandle)
     }
     switch result {
     case .success:
@@ -2587,6 +2839,14 @@ public func MCEImportCanReimportHandle(_ contextPtr: UnsafeRawPointer?,
     return (hasSource && isSupported) ? 1 : 0
 }
 
+@_cdecl("MCEImportAnimationFolder")
+public func MCEImportAnimationFolder(_ contextPtr: UnsafeRawPointer?,
+                                     _ relativePath: UnsafePointer<CChar>?) -> Int32 {
+    guard let context = resolveContext(contextPtr) else { return 0 }
+    guard let relativePath else { return 0 }
+    return Int32(context.importController.importAnimationFolder(relativePath: String(cString: relativePath)))
+}
+
 @_cdecl("MCEImportIsOpen")
 public func MCEImportIsOpen(_ contextPtr: UnsafeRawPointer?) -> UInt32 {
     guard let context = resolveContext(contextPtr) else { return 0 }
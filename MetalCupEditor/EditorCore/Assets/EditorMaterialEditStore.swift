@@ -0,0 +1,161 @@
+/// EditorMaterialEditStore.swift
+/// Holds in-flight material edits until they are saved or reverted.
+/// Created by Kaden Cringle.
+
+import Foundation
+import MetalCupEngine
+
+/// Field-level material edits land in a working copy per material. The working copy is a preview: the
+/// inspector reads through it, but the `.mcmat` is only written on an explicit save (the material
+/// editor's Save, Save All, or save-on-quit). Closing the editor without saving reverts it.
+final class EditorMaterialEditStore {
+    enum Field: Int32 {
+        case baseColor = 0
+        case metallic = 1
+        case roughness = 2
+        case ao = 3
+        case emissiveColor = 4
+        case emissiveIntensity = 5
+        case uvTiling = 6
+        case uvOffset = 7
+        case alphaMode = 8
+        case alphaCutoff = 9
+        case doubleSided = 10
+        case unlit = 11
+
+        var valueCount: Int {
+            switch self {
+            case .baseColor, .emissiveColor: return 3
+            case .uvTiling, .uvOffset: return 2
+            default: return 1
+            }
+        }
+    }
+
+    enum TextureSlot: Int32 {
+        case baseColor = 0
+        case normal = 1
+        case metalRoughness = 2
+        case metallic = 3
+        case roughness = 4
+        case ao = 5
+        case emissive = 6
+    }
+
+    struct Stats {
+        var deltasApplied: UInt64 = 0
+        var writesPerformed: UInt64 = 0
+        var writesAvoided: UInt64 = 0
+        var failedWrites: UInt64 = 0
+    }
+
+    private struct PendingEdit {
+        var material: MaterialAsset
+        var url: URL
+        var deltaCount: UInt64
+    }
+
+    private var pending: [AssetHandle: PendingEdit] = [:]
+    private(set) var stats = Stats()
+
+    var pendingCount: Int { pending.count }
+
+    /// Working copy when an edit is in flight, otherwise the engine's loaded material.
+    func material(for handle: AssetHandle, context: MCEContext) -> MaterialAsset? {
+        pending[handle]?.material ?? context.engineContext.assets.material(handle: handle)
+    }
+
+    func setValues(_ field: Field, _ values: UnsafePointer<Float>, count: Int, handle: AssetHandle, context: MCEContext) -> Bool {
+        guard count >= field.valueCount else { return false }
+        return edit(handle, context: context) { material in
+            switch field {
+            case .baseColor: material.baseColorFactor = SIMD3<Float>(values[0], values[1], values[2])
+            case .metallic: material.metallicFactor = values[0]
+            case .roughness: material.roughnessFactor = values[0]
+            case .ao: material.aoFactor = values[0]
+            case .emissiveColor: material.emissiveColor = SIMD3<Float>(values[0], values[1], values[2])
+            case .emissiveIntensity: material.emissiveIntensity = values[0]
+            case .uvTiling: material.uvTiling = SIMD2<Float>(values[0], values[1])
+            case .uvOffset: material.uvOffset = SIMD2<Float>(values[0], values[1])
+            case .alphaMode: material.alphaMode = MaterialAlphaModeCodes.mode(from: Int32(values[0]))
+            case .alphaCutoff: material.alphaCutoff = values[0]
+            case .doubleSided: material.doubleSided = values[0] != 0
+            case .unlit: material.unlit = values[0] != 0
+            }
+        }
+    }
+
+    func setTexture(_ slot: TextureSlot, _ texture: AssetHandle?, handle: AssetHandle, context: MCEContext) -> Bool {
+        edit(handle, context: context) { material in
+            switch slot {
+            case .baseColor: material.textures.baseColor = texture
+            case .normal: material.textures.normal = texture
+            case .metalRoughness: material.textures.metalRoughness = texture
+            case .metallic: material.textures.metallic = texture
+            case .roughness: material.textures.roughness = texture
+            case .ao: material.textures.ao = texture
+            case .emissive: material.textures.emissive = texture
+            }
+            material.textures.enforceMetalRoughnessRule()
+        }
+    }
+
+    func setName(_ name: String, handle: AssetHandle, context: MCEContext) -> Bool {
+        edit(handle, context: context) { material in
+            material.name = name
+        }
+    }
+
+    /// Drops the working copy, reverting the preview to the material on disk. A full-document save
+    /// also supersedes any in-flight deltas for that material.
+    func discard(_ handle: AssetHandle) {
+        pending.removeValue(forKey: handle)
+    }
+
+    /// Writes pending materials, or only `handle` when given. Returns the number of files written.
+    @discardableResult
+    func flush(context: MCEContext, handle: AssetHandle? = nil) -> Int {
+        guard !pending.isEmpty else { return 0 }
+        let ready = pending.filter { key, _ in handle == nil || key == handle }
+        guard !ready.isEmpty else { return 0 }
+        for key in ready.keys {
+            pending.removeValue(forKey: key)
+        }
+
+        var written = 0
+        let alertCenter = context.editorAlertCenter
+        _ = context.editorProjectManager.performAssetMutation {
+            for (key, edit) in ready {
+                // Journaled at the write, not at the first delta, so a reverted preview leaves no undo step.
+                context.undoJournal.noteAssetWillChange(edit.url, kind: .material(key))
+                if MaterialSerializer.save(edit.material, to: edit.url) {
+                    context.editorProjectManager.noteAssetPathChanged(edit.url)
+                    written += 1
+                    stats.writesAvoided &+= edit.deltaCount > 0 ? edit.deltaCount - 1 : 0
+                } else {
+                    stats.failedWrites &+= 1
+                    alertCenter.enqueueError("Failed to save material file.")
+                }
+            }
+            return written > 0
+        }
+        stats.writesPerformed &+= UInt64(written)
+        return written
+    }
+
+    private func edit(_ handle: AssetHandle, context: MCEContext, _ mutate: (inout MaterialAsset) -> Void) -> Bool {
+        var entry: PendingEdit
+        if let existing = pending[handle] {
+            entry = existing
+        } else {
+            guard let url = context.editorProjectManager.assetURL(for: handle),
+                  let material = context.engineContext.assets.material(handle: handle) else { return false }
+            entry = PendingEdit(material: material, url: url, deltaCount: 0)
+        }
+        mutate(&entry.material)
+        entry.deltaCount &+= 1
+        pending[handle] = entry
+        stats.deltasApplied &+= 1
+        return true
+    }
+}
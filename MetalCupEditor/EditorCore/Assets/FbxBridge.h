@@ -1,6 +1,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "SkinInfluenceSelector.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -76,6 +78,16 @@ typedef struct {
     float *jointWeights;
 } MCEFbxMeshDTO;
 
+/// One scene node whose geometry was extracted; its material buckets are the MCEFbxMeshDTO entries.
+typedef struct {
+    char *name;
+    int32_t polygonCount;
+    int32_t triangleCount;
+    bool triangulated;
+    float triangulateMilliseconds;
+    float extractMilliseconds;
+} MCEFbxSourceMeshStatsDTO;
+
 typedef struct {
     char *name;
     float baseColorR;
@@ -115,9 +127,20 @@ typedef struct {
     MCEFbxMaterialDTO *materials;
     float importScaleFactor;
     char *importScaleSource;
+    int32_t sourceMeshCount;
+    MCEFbxSourceMeshStatsDTO *sourceMeshes;
+    /// Threads that took part in mesh extraction, the wall time of that parallel section, and the
+    /// whole mesh pass including triangulation and the copy into the DTOs.
+    int32_t meshExtractWorkers;
+    float meshExtractMilliseconds;
+    float meshTotalMilliseconds;
+    /// Influence coverage over every skinned mesh's control points.
+    MCESkinInfluenceCoverage skinCoverage;
 } MCEFbxSceneDTO;
 
+/// `skinSettings` may be NULL for MCESkinInfluenceDefaultSettings().
 bool MCEFbxExtractScene(const char *path,
+                        const MCESkinInfluenceSettings *skinSettings,
                         MCEFbxSceneDTO *outScene,
                         char *errorBuffer,
                         int32_t errorBufferSize);
@@ -6,6 +6,7 @@
 #include <string>
 
 bool MCEFbxSkeletonExtractor_Extract(const char *path,
+                                     const MCESkinInfluenceSettings *skinSettings,
                                      MCEFbxSceneDTO *outScene,
                                      std::string &errorMessage);
 bool MCEFbxAnimationExtractor_Extract(const char *path,
@@ -25,6 +26,7 @@ static void MCEFbxWriteError(char *buffer, int32_t size, const std::string &erro
 }
 
 bool MCEFbxExtractScene(const char *path,
+                        const MCESkinInfluenceSettings *skinSettings,
                         MCEFbxSceneDTO *outScene,
                         char *errorBuffer,
                         int32_t errorBufferSize) {
@@ -36,7 +38,7 @@ bool MCEFbxExtractScene(const char *path,
     std::memset(outScene, 0, sizeof(MCEFbxSceneDTO));
 
     std::string errorMessage;
-    if (!MCEFbxSkeletonExtractor_Extract(path, outScene, errorMessage)) {
+    if (!MCEFbxSkeletonExtractor_Extract(path, skinSettings, outScene, errorMessage)) {
         MCEFbxWriteError(errorBuffer, errorBufferSize, errorMessage);
         return false;
     }
@@ -112,6 +114,14 @@ void MCEFbxFreeScene(MCEFbxSceneDTO *scene) {
     scene->meshes = nullptr;
     scene->meshCount = 0;
 
+    for (int32_t sourceIndex = 0; sourceIndex < scene->sourceMeshCount; ++sourceIndex) {
+        std::free(scene->sourceMeshes[sourceIndex].name);
+        scene->sourceMeshes[sourceIndex].name = nullptr;
+    }
+    std::free(scene->sourceMeshes);
+    scene->sourceMeshes = nullptr;
+    scene->sourceMeshCount = 0;
+
     for (int32_t materialIndex = 0; materialIndex < scene->materialCount; ++materialIndex) {
         MCEFbxMaterialDTO &material = scene->materials[materialIndex];
         std::free(material.name);
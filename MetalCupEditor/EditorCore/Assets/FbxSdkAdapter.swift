@@ -5,8 +5,10 @@ import MetalCupEngine
 enum FbxSdkAdapter {
     private static var loggedActiveBridge = false
 
-    static func scanFBX(url: URL, suggestedName: String) -> ImportedFBXData? {
-        if let scene = extractScene(url: url) {
+    static func scanFBX(url: URL,
+                        suggestedName: String,
+                        skinInfluences: MCESkinInfluenceSettings = MCESkinInfluenceDefaultSettings()) -> ImportedFBXData? {
+        if let scene = extractScene(url: url, skinInfluences: skinInfluences) {
             if !loggedActiveBridge {
                 loggedActiveBridge = true
                 EngineLoggerContext.log("FBX SDK bridge active", level: .info, category: .assets)
@@ -32,6 +34,23 @@ enum FbxSdkAdapter {
             )
             let materials = convertMaterials(scene.materials, sourceURL: url)
             let meshes = applyTranslationScale(to: convertMeshes(scene.meshes), factor: scaleFactor)
+            let skinInfluenceReport = scene.skinCoverage.skinnedVertexCount > 0
+                ? skinInfluenceSummary(scene.skinCoverage, settings: skinInfluences)
+                : nil
+            if let skinInfluenceReport {
+                EngineLoggerContext.log(
+                    "FBX skin influences \(skinInfluenceReport) source=\(url.lastPathComponent)",
+                    level: .info,
+                    category: .assets
+                )
+            }
+            if !scene.meshExtraction.sources.isEmpty {
+                EngineLoggerContext.log(
+                    "FBX mesh extraction \(scene.meshExtraction.summary()) source=\(url.lastPathComponent)",
+                    level: .info,
+                    category: .assets
+                )
+            }
 
             let hasMeshes = !meshes.isEmpty
             let hasClips = !clips.isEmpty
@@ -80,7 +99,8 @@ enum FbxSdkAdapter {
                 warnings: warnings,
                 importScaleFactor: scaleFactor,
                 importScaleNormalizationMode: scaleSource,
-                importScaleSource: scaleSource
+                importScaleSource: scaleSource,
+                skinInfluenceReport: skinInfluenceReport
             )
         }
 
@@ -104,8 +124,15 @@ enum FbxSdkAdapter {
 
     static func writeBakedMeshAsset(from data: ImportedFBXData,
                                     name: String,
-                                    to url: URL) -> Bool {
-        guard !data.meshes.isEmpty else { return false }
+                                    to url: URL,
+                                    options: MeshBakeOptions = MeshBakeOptions()) -> MeshBakeReport? {
+        guard !data.meshes.isEmpty else { return nil }
+
+        // Submeshes are processed independently, so the bake stages run up front across workers.
+        let stageOutputs = EditorJobs.parallelMap(count: data.meshes.count, grain: 1) { meshIndex in
+            MeshBakeStages.run(mesh: data.meshes[meshIndex], options: options)
+        }
+        var report = MeshBakeReport()
 
         var bakedVertices: [FbxBakedMeshVertexDocument] = []
         bakedVertices.reserveCapacity(data.meshes.reduce(0) { $0 + $1.positions.count })
@@ -113,7 +140,7 @@ enum FbxSdkAdapter {
         bakedSubmeshes.reserveCapacity(data.meshes.count)
         var hasSkinning = false
 
-        for mesh in data.meshes {
+        for (meshIndex, mesh) in data.meshes.enumerated() {
             let baseVertex = bakedVertices.count
             let vertexCount = mesh.positions.count
             hasSkinning = hasSkinning || mesh.hasSkinning
@@ -139,11 +166,29 @@ enum FbxSdkAdapter {
             }
 
             let adjustedIndices = mesh.indices.map { UInt32(baseVertex) + $0 }
+            let stageOutput = stageOutputs[meshIndex]
+            let lods = stageOutput.lods.map { level in
+                FbxBakedMeshLODDocument(
+                    ratio: level.targetRatio,
+                    screenSize: level.screenSize,
+                    error: level.error,
+                    indices: level.indices.map { UInt32(baseVertex) + $0 }
+                )
+            }
+            report.append(stageOutput.report)
             bakedSubmeshes.append(
                 FbxBakedMeshSubmeshDocument(
                     name: mesh.name,
                     materialIndex: mesh.materialIndex,
-                    indices: adjustedIndices
+                    indices: adjustedIndices,
+                    lods: lods.isEmpty ? nil : lods,
+                    meshlets: stageOutput.meshlets.map { FbxBakedMeshletsDocument($0, baseVertex: UInt32(baseVertex)) },
+                    quantizedVertices: stageOutput.quantized.map {
+                        FbxBakedMeshQuantizedVerticesDocument($0,
+                                                              profile: options.vertexQuantizationProfile,
+                                                              firstVertex: UInt32(baseVertex),
+                                                              vertexCount: UInt32(vertexCount))
+                    }
                 )
             )
         }
@@ -160,14 +205,14 @@ enum FbxSdkAdapter {
         do {
             let encoded = try encoder.encode(document)
             try encoded.write(to: url, options: .atomic)
-            return true
+            return report
         } catch {
             EngineLoggerContext.log(
                 "Failed to write baked FBX mesh path=\(url.path): \(error.localizedDescription)",
                 level: .error,
                 category: .assets
             )
-            return false
+            return nil
         }
     }
 
@@ -256,6 +301,115 @@ private struct FbxBakedMeshSubmeshDocument: Codable {
     let name: String
     let materialIndex: Int
     let indices: [UInt32]
+    /// Coarser index buffers over the same vertices, finest first. Absent when LODs are disabled.
+    var lods: [FbxBakedMeshLODDocument]? = nil
+    var meshlets: FbxBakedMeshletsDocument? = nil
+    var quantizedVertices: FbxBakedMeshQuantizedVerticesDocument? = nil
+}
+
+/// A packed copy of the submesh's vertex range (`firstVertex` onwards) in the layout described by
+/// the offsets. Bit counts of 0 mean the attribute stays float; attributes the source lacked are
+/// absent from `attributes` and keep the float stream's defaults.
+private struct FbxBakedMeshQuantizedVerticesDocument: Codable {
+    let profile: String
+    let firstVertex: UInt32
+    let vertexCount: UInt32
+    let stride: UInt32
+    let attributes: UInt32
+    let positionBits: UInt32
+    let normalBits: UInt32
+    let tangentBits: UInt32
+    let halfUVs: Bool
+    let weightBits: UInt32
+    let jointIndexBytes: UInt32
+    let positionOffset: UInt32
+    let normalOffset: UInt32
+    let tangentOffset: UInt32
+    let uvOffset: UInt32
+    let jointOffset: UInt32
+    let weightOffset: UInt32
+    let positionMin: [Float]
+    let positionScale: [Float]
+    let data: Data
+
+    init(_ quantized: MeshBakeStages.QuantizedVertices, profile: String, firstVertex: UInt32, vertexCount: UInt32) {
+        let layout = quantized.layout
+        self.profile = profile
+        self.firstVertex = firstVertex
+        self.vertexCount = vertexCount
+        stride = layout.stride
+        attributes = layout.attributes
+        positionBits = layout.encoding.positionBits
+        normalBits = layout.encoding.normalBits
+        tangentBits = layout.encoding.tangentBits
+        halfUVs = layout.encoding.halfUVs != 0
+        weightBits = layout.encoding.weightBits
+        jointIndexBytes = layout.jointIndexBytes
+        positionOffset = layout.positionOffset
+        normalOffset = layout.normalOffset
+        tangentOffset = layout.tangentOffset
+        uvOffset = layout.uvOffset
+        jointOffset = layout.jointOffset
+        weightOffset = layout.weightOffset
+        positionMin = [layout.positionMin.0, layout.positionMin.1, layout.positionMin.2]
+        positionScale = [layout.positionScale.0, layout.positionScale.1, layout.positionScale.2]
+        data = quantized.data
+    }
+}
+
+private struct FbxBakedMeshLODDocument: Codable {
+    let ratio: Float
+    let screenSize: Float
+    let error: Float
+    let indices: [UInt32]
+}
+
+/// Meshlets over the full-resolution indices. `vertices` index the mesh vertex array; `triangles`
+/// holds three meshlet-local bytes per triangle.
+private struct FbxBakedMeshletsDocument: Codable {
+    let maxVertices: UInt32
+    let maxTriangles: UInt32
+    let vertices: [UInt32]
+    let triangles: [UInt8]
+    let meshlets: [FbxBakedMeshletDocument]
+
+    init(_ set: MeshBakeStages.MeshletSet, baseVertex: UInt32) {
+        maxVertices = set.maxVertices
+        maxTriangles = set.maxTriangles
+        vertices = set.vertices.map { baseVertex + $0 }
+        triangles = set.triangles
+        meshlets = zip(set.meshlets, set.bounds).map { FbxBakedMeshletDocument(meshlet: $0.0, bounds: $0.1) }
+    }
+}
+
+/// A back-face test passes for the whole meshlet when
+/// `dot(normalize(coneApex - eye), coneAxis) >= coneCutoff`; a cutoff of 1 never passes.
+private struct FbxBakedMeshletDocument: Codable {
+    let vertexOffset: UInt32
+    let vertexCount: UInt32
+    let triangleOffset: UInt32
+    let triangleCount: UInt32
+    let center: [Float]
+    let radius: Float
+    let boundsMin: [Float]
+    let boundsMax: [Float]
+    let coneApex: [Float]
+    let coneAxis: [Float]
+    let coneCutoff: Float
+
+    init(meshlet: MCEMeshlet, bounds: MCEMeshletBounds) {
+        vertexOffset = meshlet.vertexOffset
+        vertexCount = meshlet.vertexCount
+        triangleOffset = meshlet.triangleOffset
+        triangleCount = meshlet.triangleCount
+        center = [bounds.center.0, bounds.center.1, bounds.center.2]
+        radius = bounds.radius
+        boundsMin = [bounds.boundsMin.0, bounds.boundsMin.1, bounds.boundsMin.2]
+        boundsMax = [bounds.boundsMax.0, bounds.boundsMax.1, bounds.boundsMax.2]
+        coneApex = [bounds.coneApex.0, bounds.coneApex.1, bounds.coneApex.2]
+        coneAxis = [bounds.coneAxis.0, bounds.coneAxis.1, bounds.coneAxis.2]
+        coneCutoff = bounds.coneCutoff
+    }
 }
 
 private struct FbxBakedMeshDocument: Codable {
@@ -342,6 +496,41 @@ private extension FbxSdkAdapter {
         let emissiveTextureEmbedded: Bool
     }
 
+    struct SceneSourceMeshStats {
+        let name: String
+        let polygonCount: Int
+        let triangleCount: Int
+        let triangulated: Bool
+        let triangulateMilliseconds: Float
+        let extractMilliseconds: Float
+    }
+
+    struct SceneMeshExtractionStats {
+        let sources: [SceneSourceMeshStats]
+        let workers: Int
+        let extractMilliseconds: Float
+        let totalMilliseconds: Float
+
+        /// One line for the import log: totals, then the slowest source meshes first.
+        func summary(limit: Int = 8) -> String {
+            let summed = sources.reduce(Float(0)) { $0 + $1.extractMilliseconds }
+            let triangulated = sources.filter(\.triangulated).count
+            var line = String(
+                format: "meshes=%d triangulated=%d workers=%d extract=%.2fms (summed %.2fms) total=%.2fms",
+                sources.count, triangulated, workers, extractMilliseconds, summed, totalMilliseconds
+            )
+            let slowest = sources.sorted { $0.extractMilliseconds > $1.extractMilliseconds }.prefix(limit)
+            if !slowest.isEmpty {
+                let entries = slowest.map { source in
+                    let milliseconds = source.triangulateMilliseconds + source.extractMilliseconds
+                    return "\(source.name)(\(source.triangleCount) tris \(String(format: "%.2f", milliseconds))ms)"
+                }
+                line += " slowest: " + entries.joined(separator: ", ")
+            }
+            return line
+        }
+    }
+
     struct Scene {
         let joints: [SceneJointDTO]
         let clips: [SceneClipDTO]
@@ -349,6 +538,8 @@ private extension FbxSdkAdapter {
         let materials: [SceneMaterialDTO]
         let importScaleFactor: Float
         let importScaleSource: String
+        let meshExtraction: SceneMeshExtractionStats
+        let skinCoverage: MCESkinInfluenceCoverage
     }
 
     struct JointNameRepairStats {
@@ -371,11 +562,13 @@ private extension FbxSdkAdapter {
         let collisions: Int
     }
 
-    static func extractScene(url: URL) -> Scene? {
+    static func extractScene(url: URL,
+                             skinInfluences: MCESkinInfluenceSettings = MCESkinInfluenceDefaultSettings()) -> Scene? {
         var dto = MCEFbxSceneDTO()
         var errorBuffer = [CChar](repeating: 0, count: 1024)
+        var skinSettings = skinInfluences
         let ok = url.path.withCString { cPath in
-            MCEFbxExtractScene(cPath, &dto, &errorBuffer, Int32(errorBuffer.count))
+            MCEFbxExtractScene(cPath, &skinSettings, &dto, &errorBuffer, Int32(errorBuffer.count))
         }
         guard ok else {
             return nil
@@ -552,16 +745,69 @@ private extension FbxSdkAdapter {
             }
         }()
 
+        let sourceMeshes: [SceneSourceMeshStats] = {
+            guard dto.sourceMeshCount > 0, let sourcePtr = dto.sourceMeshes else { return [] }
+            return (0..<Int(dto.sourceMeshCount)).map { sourceIndex in
+                let src = sourcePtr[sourceIndex]
+                return SceneSourceMeshStats(
+                    name: decodeCStringLossy(src.name).value,
+                    polygonCount: Int(src.polygonCount),
+                    triangleCount: Int(src.triangleCount),
+                    triangulated: src.triangulated,
+                    triangulateMilliseconds: src.triangulateMilliseconds,
+                    extractMilliseconds: src.extractMilliseconds
+                )
+            }
+        }()
+
         return Scene(
             joints: joints,
             clips: clips,
             meshes: meshes,
             materials: materials,
             importScaleFactor: dto.importScaleFactor,
-            importScaleSource: decodeCStringLossy(dto.importScaleSource).value
+            importScaleSource: decodeCStringLossy(dto.importScaleSource).value,
+            meshExtraction: SceneMeshExtractionStats(
+                sources: sourceMeshes,
+                workers: Int(dto.meshExtractWorkers),
+                extractMilliseconds: dto.meshExtractMilliseconds,
+                totalMilliseconds: dto.meshTotalMilliseconds
+            ),
+            skinCoverage: dto.skinCoverage
         )
     }
 
+    /// Reads `skinInfluences` (1, 2, 4 or 8), `skinMinWeight` and `skinRenormalize` ("sum" or "none").
+    static func skinInfluenceSettings(from settings: ImportSettings) -> MCESkinInfluenceSettings {
+        var result = MCESkinInfluenceDefaultSettings()
+        if let count = settings.values["skinInfluences"].flatMap({ UInt32($0) }), [1, 2, 4, 8].contains(count) {
+            result.maxInfluences = count
+        }
+        if let minWeight = settings.values["skinMinWeight"].flatMap({ Float($0) }), minWeight >= 0, minWeight < 1 {
+            result.minWeight = minWeight
+        }
+        if settings.values["skinRenormalize"]?.lowercased() == "none" {
+            result.renormalize = UInt32(MCESkinRenormalizeNone.rawValue)
+        }
+        return result
+    }
+
+    /// Coverage per K, so LOD and crowd meshes can pick the cheapest skinning path that loses nothing.
+    static func skinInfluenceSummary(_ coverage: MCESkinInfluenceCoverage, settings: MCESkinInfluenceSettings) -> String {
+        let skinned = max(Int(coverage.skinnedVertexCount), 1)
+        let covered = withUnsafeBytes(of: coverage.coveredByK) { Array($0.bindMemory(to: UInt32.self)) }
+        let dropped = withUnsafeBytes(of: coverage.maxDroppedWeightByK) { Array($0.bindMemory(to: Float.self)) }
+        let levels = [1, 2, 4, 8].enumerated().map { level, k in
+            String(format: "k%d=%.1f%%/%.3f", k, Double(covered[level]) * 100.0 / Double(skinned), dropped[level])
+        }
+        let average = Double(coverage.keptInfluences) / Double(skinned)
+        return String(
+            format: "k=%u minWeight=%.3f skinned=%u/%u avg=%.2f max=%u pruned=%llu merged=%llu ",
+            min(settings.maxInfluences, 4), settings.minWeight, coverage.skinnedVertexCount, coverage.vertexCount,
+            average, coverage.maxInfluences, coverage.prunedInfluences, coverage.mergedInfluences
+        ) + levels.joined(separator: " ")
+    }
+
     static func convertJoints(_ joints: [SceneJointDTO]) -> JointConversionResult {
         var stats = JointNameRepairStats()
         var usedNames: [String: Int] = [:]
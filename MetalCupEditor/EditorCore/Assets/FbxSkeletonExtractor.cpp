@@ -1,8 +1,8 @@
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
-#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "FbxBridge.h"
+#include "SkinInfluenceSelector.h"
+#include "../Services/EditorJobs.h"
 
 #if __has_include(<fbxsdk.h>)
 #include <fbxsdk.h>
@@ -23,14 +25,22 @@ namespace {
 
 #if MCE_HAS_FBXSDK
 
+using Clock = std::chrono::steady_clock;
+
 struct JointBuildRecord {
     FbxNode *node;
     int32_t parentIndex;
 };
 
-struct VertexInfluence {
-    int32_t jointIndex;
-    double weight;
+/// Joint slots per vertex in the mesh DTO streams.
+constexpr uint32_t kSkinStreamInfluences = 4;
+
+/// Selected influences per control point, kSkinStreamInfluences wide. A control point with no
+/// influence has a zero first weight.
+struct ControlPointSkin {
+    std::vector<uint16_t> joints;
+    std::vector<float> weights;
+    MCESkinInfluenceCoverage coverage {};
 };
 
 static char *CopyCString(const std::string &value) {
@@ -116,38 +126,52 @@ static void BuildAnimatedNodeSet(FbxScene *scene, std::set<FbxNode *> &animatedN
     }
 }
 
-static FbxVector4 ResolveTangent(FbxMesh *mesh,
-                                 int polygonIndex,
-                                 int polygonVertexIndex,
-                                 int controlPointIndex) {
-    if (mesh == nullptr || mesh->GetElementTangentCount() <= 0) {
-        return FbxVector4(1.0, 0.0, 0.0, 0.0);
-    }
-    FbxGeometryElementTangent *tangentElement = mesh->GetElementTangent(0);
-    if (tangentElement == nullptr) {
-        return FbxVector4(1.0, 0.0, 0.0, 0.0);
-    }
-    int tangentIndex = 0;
-    if (tangentElement->GetMappingMode() == FbxGeometryElement::eByControlPoint) {
-        tangentIndex = controlPointIndex;
-    } else if (tangentElement->GetMappingMode() == FbxGeometryElement::eByPolygonVertex) {
-        tangentIndex = mesh->GetTextureUVIndex(polygonIndex, polygonVertexIndex);
-    } else {
-        return FbxVector4(1.0, 0.0, 0.0, 0.0);
-    }
-    if (tangentElement->GetReferenceMode() == FbxGeometryElement::eIndexToDirect) {
-        const auto &indexArray = tangentElement->GetIndexArray();
-        if (tangentIndex < 0 || tangentIndex >= indexArray.GetCount()) {
-            return FbxVector4(1.0, 0.0, 0.0, 0.0);
-        }
-        tangentIndex = indexArray.GetAt(tangentIndex);
-    }
-    const auto &directArray = tangentElement->GetDirectArray();
-    if (tangentIndex < 0 || tangentIndex >= directArray.GetCount()) {
-        return FbxVector4(1.0, 0.0, 0.0, 0.0);
-    }
-    return directArray.GetAt(tangentIndex);
-}
+/// Resolves one layer element (normals, tangents, UVs) for a polygon vertex. The element lookup,
+/// mapping and reference modes are read once per mesh instead of once per vertex.
+template <typename ElementType, typename ValueType>
+class LayerElementReader {
+public:
+    explicit LayerElementReader(const ElementType *element) {
+        if (element == nullptr) {
+            return;
+        }
+        const FbxLayerElement::EMappingMode mapping = element->GetMappingMode();
+        const FbxLayerElement::EReferenceMode reference = element->GetReferenceMode();
+        if (mapping != FbxLayerElement::eByControlPoint && mapping != FbxLayerElement::eByPolygonVertex) {
+            return;
+        }
+        if (reference != FbxLayerElement::eDirect && reference != FbxLayerElement::eIndexToDirect) {
+            return;
+        }
+        _byControlPoint = mapping == FbxLayerElement::eByControlPoint;
+        _direct = &element->GetDirectArray();
+        _indices = reference == FbxLayerElement::eIndexToDirect ? &element->GetIndexArray() : nullptr;
+    }
+
+    /// `polygonVertexIndex` is the vertex's position in the mesh-wide polygon vertex array.
+    bool Read(int controlPointIndex, int polygonVertexIndex, ValueType &out) const {
+        if (_direct == nullptr) {
+            return false;
+        }
+        int index = _byControlPoint ? controlPointIndex : polygonVertexIndex;
+        if (_indices != nullptr) {
+            if (index < 0 || index >= _indices->GetCount()) {
+                return false;
+            }
+            index = _indices->GetAt(index);
+        }
+        if (index < 0 || index >= _direct->GetCount()) {
+            return false;
+        }
+        out = _direct->GetAt(index);
+        return true;
+    }
+
+private:
+    const FbxLayerElementArrayTemplate<ValueType> *_direct = nullptr;
+    const FbxLayerElementArrayTemplate<int> *_indices = nullptr;
+    bool _byControlPoint = false;
+};
 
 static void BuildDeformerNodeSet(FbxScene *scene, std::set<FbxNode *> &deformerNodes) {
     if (scene == nullptr) {
@@ -498,17 +522,45 @@ static void FillMaterialDTOs(FbxScene *scene, MCEFbxSceneDTO *outScene) {
     }
 }
 
+/// Falls back to the defaults for anything the selector would reject. The DTO streams hold four
+/// joints, so K = 8 is clamped here and only shows up in the coverage report.
+static MCESkinInfluenceSettings ResolveSkinSettings(const MCESkinInfluenceSettings *requested) {
+    MCESkinInfluenceSettings settings = MCESkinInfluenceDefaultSettings();
+    if (requested == nullptr) {
+        return settings;
+    }
+    const uint32_t k = requested->maxInfluences;
+    if (k == 1 || k == 2 || k == 4 || k == 8) {
+        settings.maxInfluences = std::min(k, kSkinStreamInfluences);
+    }
+    if (requested->minWeight >= 0.0f && requested->minWeight < 1.0f) {
+        settings.minWeight = requested->minWeight;
+    }
+    if (requested->renormalize == MCESkinRenormalizeNone) {
+        settings.renormalize = MCESkinRenormalizeNone;
+    }
+    return settings;
+}
+
 static void GatherControlPointInfluences(FbxMesh *mesh,
                                          const std::unordered_map<std::string, int32_t> &jointIndexByName,
-                                         std::vector<std::vector<VertexInfluence>> &outInfluences) {
+                                         const MCESkinInfluenceSettings &skinSettings,
+                                         ControlPointSkin &outSkin) {
+    outSkin = ControlPointSkin {};
     if (mesh == nullptr) {
         return;
     }
     const int controlPointCount = mesh->GetControlPointsCount();
-    outInfluences.clear();
-    outInfluences.resize(static_cast<size_t>(std::max(controlPointCount, 0)));
-
     const int skinCount = mesh->GetDeformerCount(FbxDeformer::eSkin);
+    if (controlPointCount <= 0 || skinCount <= 0) {
+        return;
+    }
+
+    struct ClusterInfluences {
+        int32_t jointIndex;
+        FbxCluster *cluster;
+    };
+    std::vector<ClusterInfluences> clusters;
     for (int skinIndex = 0; skinIndex < skinCount; ++skinIndex) {
         FbxSkin *skin = static_cast<FbxSkin *>(mesh->GetDeformer(skinIndex, FbxDeformer::eSkin));
         if (skin == nullptr) {
@@ -524,42 +576,52 @@ static void GatherControlPointInfluences(FbxMesh *mesh,
             if (jointIt == jointIndexByName.end()) {
                 continue;
             }
-            const int32_t jointIndex = jointIt->second;
-            const int *cpIndices = cluster->GetControlPointIndices();
-            const double *cpWeights = cluster->GetControlPointWeights();
-            const int cpCount = cluster->GetControlPointIndicesCount();
-            for (int cpOffset = 0; cpOffset < cpCount; ++cpOffset) {
-                const int cpIndex = cpIndices[cpOffset];
-                if (cpIndex < 0 || cpIndex >= controlPointCount) {
-                    continue;
-                }
-                const double weight = cpWeights[cpOffset];
-                if (weight <= 0.0) {
-                    continue;
-                }
-                outInfluences[static_cast<size_t>(cpIndex)].push_back(VertexInfluence { jointIndex, weight });
-            }
+            clusters.push_back(ClusterInfluences { jointIt->second, cluster });
         }
     }
 
-    for (size_t cpIndex = 0; cpIndex < outInfluences.size(); ++cpIndex) {
-        std::vector<VertexInfluence> &influences = outInfluences[cpIndex];
-        std::sort(influences.begin(), influences.end(), [](const VertexInfluence &lhs, const VertexInfluence &rhs) {
-            return lhs.weight > rhs.weight;
-        });
-        if (influences.size() > 4) {
-            influences.resize(4);
-        }
-        double weightSum = 0.0;
-        for (const VertexInfluence &influence : influences) {
-            weightSum += influence.weight;
+    // Clusters list control points per joint; the selector wants influences per control point, so
+    // count first and then scatter into one flat array.
+    const size_t pointCount = static_cast<size_t>(controlPointCount);
+    std::vector<uint32_t> offsets(pointCount + 1, 0);
+    for (const ClusterInfluences &entry : clusters) {
+        const int *cpIndices = entry.cluster->GetControlPointIndices();
+        const int cpCount = entry.cluster->GetControlPointIndicesCount();
+        for (int cpOffset = 0; cpOffset < cpCount; ++cpOffset) {
+            const int cpIndex = cpIndices[cpOffset];
+            if (cpIndex >= 0 && cpIndex < controlPointCount) {
+                ++offsets[static_cast<size_t>(cpIndex) + 1];
+            }
         }
-        if (weightSum > 0.0) {
-            for (VertexInfluence &influence : influences) {
-                influence.weight /= weightSum;
+    }
+    for (size_t cpIndex = 0; cpIndex < pointCount; ++cpIndex) {
+        offsets[cpIndex + 1] += offsets[cpIndex];
+    }
+    std::vector<int32_t> joints(offsets[pointCount]);
+    std::vector<float> weights(offsets[pointCount]);
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const ClusterInfluences &entry : clusters) {
+        const int *cpIndices = entry.cluster->GetControlPointIndices();
+        const double *cpWeights = entry.cluster->GetControlPointWeights();
+        const int cpCount = entry.cluster->GetControlPointIndicesCount();
+        for (int cpOffset = 0; cpOffset < cpCount; ++cpOffset) {
+            const int cpIndex = cpIndices[cpOffset];
+            if (cpIndex < 0 || cpIndex >= controlPointCount) {
+                continue;
             }
+            const uint32_t slot = cursor[static_cast<size_t>(cpIndex)]++;
+            joints[slot] = entry.jointIndex;
+            weights[slot] = static_cast<float>(cpWeights[cpOffset]);
         }
     }
+
+    const MCESkinInfluenceSource source { offsets.data(), joints.data(), weights.data(), static_cast<uint32_t>(pointCount) };
+    outSkin.joints.resize(pointCount * kSkinStreamInfluences);
+    outSkin.weights.resize(pointCount * kSkinStreamInfluences);
+    if (MCESkinSelectInfluences(&source, &skinSettings, outSkin.joints.data(), outSkin.weights.data(),
+                                kSkinStreamInfluences, &outSkin.coverage) == 0) {
+        outSkin = ControlPointSkin {};
+    }
 }
 
 static int MaterialIndexForPolygon(FbxMesh *mesh, int polygonIndex) {
@@ -598,169 +660,338 @@ struct MeshBucket {
     bool hasSkinning = false;
 };
 
-static void FillMeshDTOs(FbxScene *scene,
-                         const std::unordered_map<std::string, int32_t> &jointIndexByName,
-                         MCEFbxSceneDTO *outScene) {
-    if (scene == nullptr) {
-        outScene->meshCount = 0;
-        outScene->meshes = nullptr;
-        return;
+struct SourceMesh {
+    FbxNode *node = nullptr;
+    /// Index of the first source node that references the same FbxMesh; that one is extracted
+    /// and this one takes a copy of its buckets.
+    size_t extractedFrom = 0;
+    std::vector<MeshBucket> buckets;
+    int polygonCount = 0;
+    int triangleCount = 0;
+    bool triangulated = false;
+    double triangulateMilliseconds = 0.0;
+    double extractMilliseconds = 0.0;
+    MCESkinInfluenceCoverage skinCoverage {};
+};
+
+static bool HasTriangulatableGeometry(FbxNode *node) {
+    return node->GetMesh() != nullptr || node->GetNurbs() != nullptr ||
+        node->GetNurbsSurface() != nullptr || node->GetPatch() != nullptr;
+}
+
+/// Depth-first, children in order: the same order the recursive walk used, so bucket order and
+/// therefore submesh order stay stable across imports.
+static void CollectMeshNodes(FbxNode *root, std::vector<SourceMesh> &outMeshes) {
+    std::vector<FbxNode *> stack;
+    if (root != nullptr) {
+        stack.push_back(root);
     }
+    while (!stack.empty()) {
+        FbxNode *node = stack.back();
+        stack.pop_back();
+        if (node == nullptr) {
+            continue;
+        }
+        if (HasTriangulatableGeometry(node)) {
+            SourceMesh source;
+            source.node = node;
+            outMeshes.push_back(std::move(source));
+        }
+        for (int childIndex = node->GetChildCount() - 1; childIndex >= 0; --childIndex) {
+            stack.push_back(node->GetChild(childIndex));
+        }
+    }
+}
 
-    std::vector<MeshBucket> buckets;
-    FbxNode *root = scene->GetRootNode();
-    if (root == nullptr) {
-        outScene->meshCount = 0;
-        outScene->meshes = nullptr;
-        return;
+/// Triangulates only the geometry that will be extracted. The converter mutates the scene, so this
+/// stays on the calling thread; a mesh shared by several nodes is converted once.
+static void TriangulateMeshNodes(FbxManager *manager, std::vector<SourceMesh> &meshes) {
+    FbxGeometryConverter geometryConverter(manager);
+    std::set<FbxNodeAttribute *> converted;
+    for (SourceMesh &source : meshes) {
+        const auto start = Clock::now();
+        FbxMesh *mesh = source.node->GetMesh();
+        FbxNodeAttribute *attribute = mesh != nullptr ? static_cast<FbxNodeAttribute *>(mesh) : source.node->GetNodeAttribute();
+        const bool needsConversion = mesh == nullptr || !mesh->IsTriangleMesh();
+        if (attribute != nullptr && needsConversion && converted.insert(attribute).second) {
+            source.triangulated = geometryConverter.Triangulate(attribute, true) != nullptr;
+        }
+        source.triangulateMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
     }
+}
 
-    std::function<void(FbxNode *)> traverse = [&](FbxNode *node) {
-        if (node == nullptr) {
-            return;
+/// Bucket names follow the owning node, so instances of a shared mesh stay distinguishable.
+static void NameBuckets(FbxNode *node, std::vector<MeshBucket> &buckets) {
+    const std::string nodeName = NodeName(node);
+    for (MeshBucket &bucket : buckets) {
+        bucket.name = nodeName.empty() ? "Mesh" : nodeName;
+        if (bucket.materialIndex > 0 || buckets.size() > 1) {
+            bucket.name += "_mat" + std::to_string(bucket.materialIndex);
         }
-        FbxMesh *mesh = node->GetMesh();
-        if (mesh != nullptr) {
-            const int polygonCount = mesh->GetPolygonCount();
-            FbxStringList uvSetNames;
-            mesh->GetUVSetNames(uvSetNames);
-            const char *uvSetName = uvSetNames.GetCount() > 0 ? uvSetNames.GetStringAt(0) : nullptr;
+    }
+}
 
-            std::vector<std::vector<VertexInfluence>> influences;
-            GatherControlPointInfluences(mesh, jointIndexByName, influences);
+/// Groups source nodes by the FbxMesh they reference, after triangulation has settled which mesh
+/// each node points at. Returns the first node of each group, in node order.
+static std::vector<uint32_t> AssignMeshExtractions(std::vector<SourceMesh> &sources) {
+    std::unordered_map<FbxMesh *, size_t> firstByMesh;
+    std::vector<uint32_t> extracted;
+    for (size_t sourceIndex = 0; sourceIndex < sources.size(); ++sourceIndex) {
+        SourceMesh &source = sources[sourceIndex];
+        FbxMesh *mesh = source.node->GetMesh();
+        const auto inserted = firstByMesh.emplace(mesh, sourceIndex);
+        source.extractedFrom = mesh != nullptr ? inserted.first->second : sourceIndex;
+        if (source.extractedFrom == sourceIndex) {
+            extracted.push_back(static_cast<uint32_t>(sourceIndex));
+        }
+    }
+    return extracted;
+}
 
-            std::map<int, MeshBucket> localBuckets;
-            const FbxVector4 *controlPoints = mesh->GetControlPoints();
+/// Reads one source mesh into per-material buckets. Only reads the scene, and each FbxMesh is read
+/// by exactly one call, so distinct meshes can be extracted concurrently once triangulation is done.
+static void ExtractSourceMesh(const std::unordered_map<std::string, int32_t> &jointIndexByName,
+                              const MCESkinInfluenceSettings &skinSettings,
+                              SourceMesh &source) {
+    const auto start = Clock::now();
+    FbxNode *node = source.node;
+    FbxMesh *mesh = node->GetMesh();
+    if (mesh == nullptr) {
+        return;
+    }
+    const int polygonCount = mesh->GetPolygonCount();
+    source.polygonCount = polygonCount;
+
+    // First pass: bucket slot per polygon and triangle count per material, so every stream is
+    // reserved once. Slots follow ascending material index.
+    std::vector<int32_t> slotByPolygon(static_cast<size_t>(std::max(polygonCount, 0)), -1);
+    std::map<int, size_t> trianglesByMaterial;
+    for (int polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex) {
+        if (mesh->GetPolygonSize(polygonIndex) != 3) {
+            continue;
+        }
+        const int materialIndex = MaterialIndexForPolygon(mesh, polygonIndex);
+        slotByPolygon[static_cast<size_t>(polygonIndex)] = materialIndex;
+        ++trianglesByMaterial[materialIndex];
+    }
 
-            for (int polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex) {
-                const int polygonSize = mesh->GetPolygonSize(polygonIndex);
-                if (polygonSize != 3) {
-                    continue;
-                }
-                int materialIndex = MaterialIndexForPolygon(mesh, polygonIndex);
-                MeshBucket &bucket = localBuckets[materialIndex];
-                if (bucket.name.empty()) {
-                    const std::string nodeName = NodeName(node);
-                    bucket.name = nodeName.empty() ? "Mesh" : nodeName;
-                    bucket.materialIndex = materialIndex;
-                }
+    std::unordered_map<int, int32_t> slotByMaterial;
+    std::vector<MeshBucket> &buckets = source.buckets;
+    buckets.reserve(trianglesByMaterial.size());
+    for (const auto &entry : trianglesByMaterial) {
+        const size_t vertexCount = entry.second * 3;
+        slotByMaterial[entry.first] = static_cast<int32_t>(buckets.size());
+        MeshBucket bucket;
+        bucket.materialIndex = entry.first;
+        bucket.positions.reserve(vertexCount * 3);
+        bucket.normals.reserve(vertexCount * 3);
+        bucket.tangents.reserve(vertexCount * 3);
+        bucket.uv0.reserve(vertexCount * 2);
+        bucket.indices.reserve(vertexCount);
+        bucket.jointIndices.reserve(vertexCount * 4);
+        bucket.jointWeights.reserve(vertexCount * 4);
+        buckets.push_back(std::move(bucket));
+        source.triangleCount += static_cast<int>(entry.second);
+    }
+    for (int32_t &slot : slotByPolygon) {
+        if (slot >= 0) {
+            slot = slotByMaterial[slot];
+        }
+    }
 
-                for (int polygonVertex = 0; polygonVertex < 3; ++polygonVertex) {
-                    const int controlPointIndex = mesh->GetPolygonVertex(polygonIndex, polygonVertex);
-                    if (controlPointIndex < 0 || controlPoints == nullptr) {
-                        continue;
-                    }
-                    const FbxVector4 p = controlPoints[controlPointIndex];
-                    bucket.positions.push_back(static_cast<float>(p[0]));
-                    bucket.positions.push_back(static_cast<float>(p[1]));
-                    bucket.positions.push_back(static_cast<float>(p[2]));
-
-                    FbxVector4 n(0.0, 1.0, 0.0, 0.0);
-                    if (mesh->GetPolygonVertexNormal(polygonIndex, polygonVertex, n)) {
-                        bucket.normals.push_back(static_cast<float>(n[0]));
-                        bucket.normals.push_back(static_cast<float>(n[1]));
-                        bucket.normals.push_back(static_cast<float>(n[2]));
-                    } else {
-                        bucket.normals.push_back(0.0f);
-                        bucket.normals.push_back(1.0f);
-                        bucket.normals.push_back(0.0f);
-                    }
-
-                    FbxVector4 t = ResolveTangent(mesh, polygonIndex, polygonVertex, controlPointIndex);
-                    bucket.tangents.push_back(static_cast<float>(t[0]));
-                    bucket.tangents.push_back(static_cast<float>(t[1]));
-                    bucket.tangents.push_back(static_cast<float>(t[2]));
-
-                    FbxVector2 uv(0.0, 0.0);
-                    bool unmapped = false;
-                    if (uvSetName != nullptr) {
-                        mesh->GetPolygonVertexUV(polygonIndex, polygonVertex, uvSetName, uv, unmapped);
-                    }
-                    bucket.uv0.push_back(static_cast<float>(uv[0]));
-                    bucket.uv0.push_back(static_cast<float>(uv[1]));
-
-                    uint16_t jointIndices[4] = {0, 0, 0, 0};
-                    float jointWeights[4] = {1.0f, 0.0f, 0.0f, 0.0f};
-                    if (controlPointIndex >= 0 && controlPointIndex < static_cast<int>(influences.size())) {
-                        const std::vector<VertexInfluence> &cpInfluences = influences[static_cast<size_t>(controlPointIndex)];
-                        if (!cpInfluences.empty()) {
-                            bucket.hasSkinning = true;
-                            for (size_t influenceIndex = 0; influenceIndex < cpInfluences.size() && influenceIndex < 4; ++influenceIndex) {
-                                jointIndices[influenceIndex] = static_cast<uint16_t>(std::max(0, cpInfluences[influenceIndex].jointIndex));
-                                jointWeights[influenceIndex] = static_cast<float>(cpInfluences[influenceIndex].weight);
-                            }
-                        }
-                    }
-                    bucket.jointIndices.insert(bucket.jointIndices.end(), jointIndices, jointIndices + 4);
-                    bucket.jointWeights.insert(bucket.jointWeights.end(), jointWeights, jointWeights + 4);
-
-                    const uint32_t index = static_cast<uint32_t>(bucket.positions.size() / 3 - 1);
-                    bucket.indices.push_back(index);
-                }
+    FbxStringList uvSetNames;
+    mesh->GetUVSetNames(uvSetNames);
+    const char *uvSetName = uvSetNames.GetCount() > 0 ? uvSetNames.GetStringAt(0) : nullptr;
+    const LayerElementReader<FbxGeometryElementNormal, FbxVector4> normalReader(mesh->GetElementNormal(0));
+    const LayerElementReader<FbxGeometryElementTangent, FbxVector4> tangentReader(
+        mesh->GetElementTangentCount() > 0 ? mesh->GetElementTangent(0) : nullptr);
+    const LayerElementReader<FbxGeometryElementUV, FbxVector2> uvReader(
+        uvSetName != nullptr ? mesh->GetElementUV(uvSetName) : nullptr);
+
+    ControlPointSkin skin;
+    GatherControlPointInfluences(mesh, jointIndexByName, skinSettings, skin);
+    source.skinCoverage = skin.coverage;
+    const size_t skinnedPointCount = skin.weights.size() / kSkinStreamInfluences;
+
+    const FbxVector4 *controlPoints = mesh->GetControlPoints();
+
+    for (int polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex) {
+        const int32_t slot = slotByPolygon[static_cast<size_t>(polygonIndex)];
+        if (slot < 0) {
+            continue;
+        }
+        MeshBucket &bucket = buckets[static_cast<size_t>(slot)];
+        const int polygonStart = mesh->GetPolygonVertexIndex(polygonIndex);
+
+        for (int polygonVertex = 0; polygonVertex < 3; ++polygonVertex) {
+            const int controlPointIndex = mesh->GetPolygonVertex(polygonIndex, polygonVertex);
+            if (controlPointIndex < 0 || controlPoints == nullptr) {
+                continue;
             }
+            const int polygonVertexIndex = polygonStart + polygonVertex;
+            const FbxVector4 p = controlPoints[controlPointIndex];
+            bucket.positions.push_back(static_cast<float>(p[0]));
+            bucket.positions.push_back(static_cast<float>(p[1]));
+            bucket.positions.push_back(static_cast<float>(p[2]));
+
+            FbxVector4 n(0.0, 1.0, 0.0, 0.0);
+            if (!normalReader.Read(controlPointIndex, polygonVertexIndex, n)) {
+                n = FbxVector4(0.0, 1.0, 0.0, 0.0);
+            }
+            bucket.normals.push_back(static_cast<float>(n[0]));
+            bucket.normals.push_back(static_cast<float>(n[1]));
+            bucket.normals.push_back(static_cast<float>(n[2]));
 
-            for (auto &entry : localBuckets) {
-                MeshBucket &bucket = entry.second;
-                if (bucket.materialIndex > 0 || localBuckets.size() > 1) {
-                    bucket.name += "_mat" + std::to_string(bucket.materialIndex);
-                }
-                buckets.push_back(bucket);
+            FbxVector4 t(1.0, 0.0, 0.0, 0.0);
+            if (!tangentReader.Read(controlPointIndex, polygonVertexIndex, t)) {
+                t = FbxVector4(1.0, 0.0, 0.0, 0.0);
+            }
+            bucket.tangents.push_back(static_cast<float>(t[0]));
+            bucket.tangents.push_back(static_cast<float>(t[1]));
+            bucket.tangents.push_back(static_cast<float>(t[2]));
+
+            FbxVector2 uv(0.0, 0.0);
+            if (!uvReader.Read(controlPointIndex, polygonVertexIndex, uv)) {
+                uv = FbxVector2(0.0, 0.0);
+            }
+            bucket.uv0.push_back(static_cast<float>(uv[0]));
+            bucket.uv0.push_back(static_cast<float>(uv[1]));
+
+            const size_t skinOffset = static_cast<size_t>(controlPointIndex) * kSkinStreamInfluences;
+            if (static_cast<size_t>(controlPointIndex) < skinnedPointCount && skin.weights[skinOffset] > 0.0f) {
+                bucket.hasSkinning = true;
+                bucket.jointIndices.insert(bucket.jointIndices.end(), skin.joints.begin() + skinOffset,
+                                           skin.joints.begin() + skinOffset + kSkinStreamInfluences);
+                bucket.jointWeights.insert(bucket.jointWeights.end(), skin.weights.begin() + skinOffset,
+                                           skin.weights.begin() + skinOffset + kSkinStreamInfluences);
+            } else {
+                const uint16_t jointIndices[kSkinStreamInfluences] = {0, 0, 0, 0};
+                const float jointWeights[kSkinStreamInfluences] = {1.0f, 0.0f, 0.0f, 0.0f};
+                bucket.jointIndices.insert(bucket.jointIndices.end(), jointIndices, jointIndices + kSkinStreamInfluences);
+                bucket.jointWeights.insert(bucket.jointWeights.end(), jointWeights, jointWeights + kSkinStreamInfluences);
             }
-        }
 
-        const int childCount = node->GetChildCount();
-        for (int childIndex = 0; childIndex < childCount; ++childIndex) {
-            traverse(node->GetChild(childIndex));
+            const uint32_t index = static_cast<uint32_t>(bucket.positions.size() / 3 - 1);
+            bucket.indices.push_back(index);
         }
-    };
+    }
 
-    traverse(root);
+    NameBuckets(node, buckets);
+    source.extractMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
 
-    outScene->meshCount = static_cast<int32_t>(buckets.size());
-    if (buckets.empty()) {
-        outScene->meshes = nullptr;
-        return;
+template <typename T>
+static T *CopyStream(const std::vector<T> &stream) {
+    if (stream.empty()) {
+        return nullptr;
     }
+    T *memory = static_cast<T *>(std::malloc(sizeof(T) * stream.size()));
+    if (memory != nullptr) {
+        std::memcpy(memory, stream.data(), sizeof(T) * stream.size());
+    }
+    return memory;
+}
 
-    outScene->meshes = static_cast<MCEFbxMeshDTO *>(std::calloc(buckets.size(), sizeof(MCEFbxMeshDTO)));
-    for (size_t meshIndex = 0; meshIndex < buckets.size(); ++meshIndex) {
-        const MeshBucket &bucket = buckets[meshIndex];
-        MCEFbxMeshDTO &dto = outScene->meshes[meshIndex];
-        dto.name = CopyCString(bucket.name);
-        dto.materialIndex = bucket.materialIndex;
-        dto.vertexCount = static_cast<int32_t>(bucket.positions.size() / 3);
-        dto.indexCount = static_cast<int32_t>(bucket.indices.size());
-        dto.hasSkinning = bucket.hasSkinning;
+static void FillMeshDTOs(FbxManager *manager,
+                         FbxScene *scene,
+                         const std::unordered_map<std::string, int32_t> &jointIndexByName,
+                         const MCESkinInfluenceSettings &skinSettings,
+                         MCEFbxSceneDTO *outScene) {
+    outScene->meshCount = 0;
+    outScene->meshes = nullptr;
+    if (scene == nullptr || scene->GetRootNode() == nullptr) {
+        return;
+    }
 
-        if (!bucket.positions.empty()) {
-            dto.positions = static_cast<float *>(std::malloc(sizeof(float) * bucket.positions.size()));
-            std::memcpy(dto.positions, bucket.positions.data(), sizeof(float) * bucket.positions.size());
-        }
-        if (!bucket.normals.empty()) {
-            dto.normals = static_cast<float *>(std::malloc(sizeof(float) * bucket.normals.size()));
-            std::memcpy(dto.normals, bucket.normals.data(), sizeof(float) * bucket.normals.size());
+    const auto start = Clock::now();
+    std::vector<SourceMesh> sources;
+    CollectMeshNodes(scene->GetRootNode(), sources);
+    TriangulateMeshNodes(manager, sources);
+
+    // Nodes instancing one FbxMesh would otherwise read the same SDK objects from several workers,
+    // and the SDK does not promise that its lazy accessors are safe for that. Each mesh is extracted
+    // once and its instances copy the buckets afterwards. Each worker writes only its own
+    // SourceMesh; merging below walks them in node order, so the result does not depend on scheduling.
+    const std::vector<uint32_t> extracted = AssignMeshExtractions(sources);
+    const auto extractStart = Clock::now();
+    EditorJobs::ParallelFor(static_cast<uint32_t>(extracted.size()), 1, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            ExtractSourceMesh(jointIndexByName, skinSettings, sources[extracted[i]]);
         }
-        if (!bucket.tangents.empty()) {
-            dto.tangents = static_cast<float *>(std::malloc(sizeof(float) * bucket.tangents.size()));
-            std::memcpy(dto.tangents, bucket.tangents.data(), sizeof(float) * bucket.tangents.size());
-        }
-        if (!bucket.uv0.empty()) {
-            dto.uv0 = static_cast<float *>(std::malloc(sizeof(float) * bucket.uv0.size()));
-            std::memcpy(dto.uv0, bucket.uv0.data(), sizeof(float) * bucket.uv0.size());
+    });
+    for (size_t sourceIndex = 0; sourceIndex < sources.size(); ++sourceIndex) {
+        SourceMesh &source = sources[sourceIndex];
+        if (source.extractedFrom == sourceIndex) {
+            continue;
         }
-        if (!bucket.indices.empty()) {
-            dto.indices = static_cast<uint32_t *>(std::malloc(sizeof(uint32_t) * bucket.indices.size()));
-            std::memcpy(dto.indices, bucket.indices.data(), sizeof(uint32_t) * bucket.indices.size());
+        const SourceMesh &original = sources[source.extractedFrom];
+        source.buckets = original.buckets;
+        source.polygonCount = original.polygonCount;
+        source.triangleCount = original.triangleCount;
+        source.skinCoverage = original.skinCoverage;
+        NameBuckets(source.node, source.buckets);
+    }
+    outScene->meshExtractMilliseconds = static_cast<float>(
+        std::chrono::duration<double, std::milli>(Clock::now() - extractStart).count());
+    outScene->meshExtractWorkers = static_cast<int32_t>(std::min<size_t>(EditorJobs::WorkerCount(), extracted.size()));
+
+    std::vector<MeshBucket> buckets;
+    size_t bucketCount = 0;
+    for (const SourceMesh &source : sources) {
+        bucketCount += source.buckets.size();
+    }
+    buckets.reserve(bucketCount);
+    for (SourceMesh &source : sources) {
+        MCESkinInfluenceCoverageMerge(&outScene->skinCoverage, &source.skinCoverage);
+        for (MeshBucket &bucket : source.buckets) {
+            buckets.push_back(std::move(bucket));
         }
-        if (!bucket.jointIndices.empty()) {
-            dto.jointIndices = static_cast<uint16_t *>(std::malloc(sizeof(uint16_t) * bucket.jointIndices.size()));
-            std::memcpy(dto.jointIndices, bucket.jointIndices.data(), sizeof(uint16_t) * bucket.jointIndices.size());
+        source.buckets.clear();
+    }
+
+    if (!sources.empty()) {
+        outScene->sourceMeshes = static_cast<MCEFbxSourceMeshStatsDTO *>(
+            std::calloc(sources.size(), sizeof(MCEFbxSourceMeshStatsDTO)));
+        if (outScene->sourceMeshes != nullptr) {
+            outScene->sourceMeshCount = static_cast<int32_t>(sources.size());
+            for (size_t sourceIndex = 0; sourceIndex < sources.size(); ++sourceIndex) {
+                const SourceMesh &source = sources[sourceIndex];
+                MCEFbxSourceMeshStatsDTO &stats = outScene->sourceMeshes[sourceIndex];
+                const std::string nodeName = NodeName(source.node);
+                stats.name = CopyCString(nodeName.empty() ? "Mesh" : nodeName);
+                stats.polygonCount = source.polygonCount;
+                stats.triangleCount = source.triangleCount;
+                stats.triangulated = source.triangulated;
+                stats.triangulateMilliseconds = static_cast<float>(source.triangulateMilliseconds);
+                stats.extractMilliseconds = static_cast<float>(source.extractMilliseconds);
+            }
         }
-        if (!bucket.jointWeights.empty()) {
-            dto.jointWeights = static_cast<float *>(std::malloc(sizeof(float) * bucket.jointWeights.size()));
-            std::memcpy(dto.jointWeights, bucket.jointWeights.data(), sizeof(float) * bucket.jointWeights.size());
+    }
+
+    if (!buckets.empty()) {
+        outScene->meshes = static_cast<MCEFbxMeshDTO *>(std::calloc(buckets.size(), sizeof(MCEFbxMeshDTO)));
+        if (outScene->meshes != nullptr) {
+            outScene->meshCount = static_cast<int32_t>(buckets.size());
+            for (size_t meshIndex = 0; meshIndex < buckets.size(); ++meshIndex) {
+                const MeshBucket &bucket = buckets[meshIndex];
+                MCEFbxMeshDTO &dto = outScene->meshes[meshIndex];
+                dto.name = CopyCString(bucket.name);
+                dto.materialIndex = bucket.materialIndex;
+                dto.vertexCount = static_cast<int32_t>(bucket.positions.size() / 3);
+                dto.indexCount = static_cast<int32_t>(bucket.indices.size());
+                dto.hasSkinning = bucket.hasSkinning;
+                dto.positions = CopyStream(bucket.positions);
+                dto.normals = CopyStream(bucket.normals);
+                dto.tangents = CopyStream(bucket.tangents);
+                dto.uv0 = CopyStream(bucket.uv0);
+                dto.indices = CopyStream(bucket.indices);
+                dto.jointIndices = CopyStream(bucket.jointIndices);
+                dto.jointWeights = CopyStream(bucket.jointWeights);
+            }
         }
     }
+    outScene->meshTotalMilliseconds = static_cast<float>(
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count());
 }
 
 #endif
@@ -768,6 +999,7 @@ static void FillMeshDTOs(FbxScene *scene,
 } // namespace
 
 bool MCEFbxSkeletonExtractor_Extract(const char *path,
+                                     const MCESkinInfluenceSettings *skinSettings,
                                      MCEFbxSceneDTO *outScene,
                                      std::string &errorMessage) {
     if (path == nullptr || outScene == nullptr) {
@@ -786,6 +1018,14 @@ bool MCEFbxSkeletonExtractor_Extract(const char *path,
     outScene->materials = nullptr;
     outScene->importScaleFactor = 1.0f;
     outScene->importScaleSource = nullptr;
+    outScene->sourceMeshCount = 0;
+    outScene->sourceMeshes = nullptr;
+    outScene->meshExtractWorkers = 0;
+    outScene->meshExtractMilliseconds = 0.0f;
+    outScene->meshTotalMilliseconds = 0.0f;
+    outScene->skinCoverage = MCESkinInfluenceCoverage {};
+
+    const MCESkinInfluenceSettings resolvedSkinSettings = ResolveSkinSettings(skinSettings);
 
     FbxManager *manager = FbxManager::Create();
     if (manager == nullptr) {
@@ -824,9 +1064,6 @@ bool MCEFbxSkeletonExtractor_Extract(const char *path,
         return false;
     }
 
-    FbxGeometryConverter geometryConverter(manager);
-    geometryConverter.Triangulate(scene, true);
-
     const FbxSystemUnit sceneUnit = scene->GetGlobalSettings().GetSystemUnit();
     double conversionFactor = sceneUnit.GetConversionFactorTo(FbxSystemUnit::m);
     if (!std::isfinite(conversionFactor) || conversionFactor <= 0.0) {
@@ -859,7 +1096,7 @@ bool MCEFbxSkeletonExtractor_Extract(const char *path,
     }
 
     FillMaterialDTOs(scene, outScene);
-    FillMeshDTOs(scene, jointIndexByName, outScene);
+    FillMeshDTOs(manager, scene, jointIndexByName, resolvedSkinSettings, outScene);
 
     scene->Destroy();
     importer->Destroy();
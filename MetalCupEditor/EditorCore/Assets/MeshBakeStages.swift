@@ -0,0 +1,370 @@
+/// MeshBakeStages.swift
+/// Defines the optional processing stages run on each submesh while a baked mesh is written.
+/// Created by Kaden Cringle.
+
+import Foundation
+import simd
+
+/// Bake options read from a model's import settings. Every stage defaults off, so a plain import
+/// writes the same document it always has.
+struct MeshBakeOptions {
+    static let defaultLODRatios: [Float] = [0.5, 0.25, 0.125]
+    /// "balanced" keeps directions within ~0.05 degrees; "compact" trades ~0.7 degrees for two more
+    /// bytes per direction. Both store 16-bit positions, half UVs and 8-bit weights.
+    static let vertexQuantizationProfiles: [String: MCEVertexQuantizeSettings] = [
+        "balanced": MCEVertexQuantizeSettings(positionBits: 16, normalBits: 16, tangentBits: 16, halfUVs: 1, weightBits: 8),
+        "compact": MCEVertexQuantizeSettings(positionBits: 16, normalBits: 8, tangentBits: 8, halfUVs: 1, weightBits: 8)
+    ]
+
+    var lodRatios: [Float] = []
+    var lodScreenSizes: [Float] = []
+    /// Zero when meshlets are not generated.
+    var meshletMaxVertices: UInt32 = 0
+    var meshletMaxTriangles: UInt32 = 0
+    var vertexQuantizationProfile = "none"
+    var vertexQuantization: MCEVertexQuantizeSettings?
+
+    init() {}
+
+    init(settings: ImportSettings) {
+        let profile = settings.values["vertexQuantization"]?.lowercased() ?? "none"
+        if let quantization = Self.vertexQuantizationProfiles[profile] {
+            vertexQuantizationProfile = profile
+            vertexQuantization = quantization
+        }
+        if settings.boolValue("generateMeshlets", default: false) {
+            let vertices = settings.values["meshletMaxVertices"].flatMap { UInt32($0) } ?? 64
+            let triangles = settings.values["meshletMaxTriangles"].flatMap { UInt32($0) } ?? 124
+            meshletMaxVertices = min(max(vertices, 3), UInt32(MCE_MESHLET_MAX_VERTICES_LIMIT))
+            meshletMaxTriangles = min(max(triangles, 1), UInt32(MCE_MESHLET_MAX_TRIANGLES_LIMIT))
+        }
+        if settings.boolValue("generateLODs", default: false) {
+            let ratios = Self.parseList(settings.values["lodRatios"]).filter { $0 > 0 && $0 < 1 }
+            lodRatios = (ratios.isEmpty ? Self.defaultLODRatios : ratios).sorted(by: >)
+            // A level is used while the mesh covers at least this fraction of the screen height;
+            // missing thresholds follow the triangle ratio.
+            let screenSizes = Self.parseList(settings.values["lodScreenSizes"])
+            lodScreenSizes = lodRatios.indices.map { index in
+                index < screenSizes.count ? max(0, screenSizes[index]) : lodRatios[index]
+            }
+        }
+    }
+
+    private static func parseList(_ raw: String?) -> [Float] {
+        (raw ?? "").split(separator: ",").compactMap { Float($0.trimmingCharacters(in: .whitespaces)) }
+    }
+}
+
+/// Per-stage numbers gathered while baking, logged after import and kept in the model's metadata.
+struct MeshBakeReport {
+    struct LODEntry {
+        let submesh: String
+        let level: Int
+        let targetRatio: Float
+        let sourceTriangles: Int
+        let triangles: Int
+        let error: Float
+        let milliseconds: Double
+    }
+
+    struct MeshletEntry {
+        let submesh: String
+        let meshlets: Int
+        let averageVertices: Float
+        let averageTriangles: Float
+        /// Share of meshlets whose normal cone is narrow enough to ever be back-face culled.
+        let cullableCones: Float
+        let milliseconds: Double
+    }
+
+    struct QuantizationEntry {
+        let submesh: String
+        let profile: String
+        let report: MCEVertexQuantizeReport
+    }
+
+    var lods: [LODEntry] = []
+    var meshlets: [MeshletEntry] = []
+    var quantization: [QuantizationEntry] = []
+
+    mutating func append(_ other: MeshBakeReport) {
+        lods.append(contentsOf: other.lods)
+        meshlets.append(contentsOf: other.meshlets)
+        quantization.append(contentsOf: other.quantization)
+    }
+
+    /// One line per LOD: `submesh#level tris/source (achieved ratio) err=<fraction of diagonal> ms`.
+    func lodSummary() -> String {
+        lods.map { entry in
+            let achieved = entry.sourceTriangles > 0 ? Float(entry.triangles) / Float(entry.sourceTriangles) : 0
+            return String(format: "%@#%d %d/%d (%.3f of %.3f) err=%.5f %.1fms",
+                          entry.submesh, entry.level, entry.triangles, entry.sourceTriangles,
+                          achieved, entry.targetRatio, entry.error, entry.milliseconds)
+        }.joined(separator: ";")
+    }
+
+    /// One line per submesh: `submesh meshlets (avg verts/avg tris) cones=<cullable share> ms`.
+    func meshletSummary() -> String {
+        meshlets.map { entry in
+            String(format: "%@ %d (%.1fv/%.1ft) cones=%.2f %.1fms",
+                   entry.submesh, entry.meshlets, entry.averageVertices, entry.averageTriangles,
+                   entry.cullableCones, entry.milliseconds)
+        }.joined(separator: ";")
+    }
+
+    /// Whole-asset totals: bytes before and after, then the worst error of each attribute over all
+    /// submeshes (position relative to the submesh AABB diagonal, directions in degrees).
+    func quantizationSummary() -> String {
+        guard let profile = quantization.first?.profile else { return "" }
+        let reports = quantization.map(\.report)
+        let sourceBytes = reports.reduce(UInt64(0)) { $0 + $1.sourceBytes }
+        let quantizedBytes = reports.reduce(UInt64(0)) { $0 + $1.quantizedBytes }
+        let saved = sourceBytes > 0 ? 100.0 * (1.0 - Double(quantizedBytes) / Double(sourceBytes)) : 0
+        return String(format: "%@ %llu->%llu bytes (%.1f%% saved) pos=%.2e normal=%.3fdeg tangent=%.3fdeg uv=%.2e weight=%.4f",
+                      profile, sourceBytes, quantizedBytes, saved,
+                      reports.map(\.maxPositionErrorRelative).max() ?? 0,
+                      reports.map(\.maxNormalErrorDegrees).max() ?? 0,
+                      reports.map(\.maxTangentErrorDegrees).max() ?? 0,
+                      reports.map(\.maxUVError).max() ?? 0,
+                      reports.map(\.maxWeightError).max() ?? 0)
+    }
+}
+
+/// Flattened copies of one submesh's streams in the tightly packed layout the C stages read.
+/// SIMD3 arrays are padded to 16 bytes per element, so they cannot be handed over directly.
+final class MeshBakeStreams {
+    let vertexCount: Int
+    let positions: [Float]
+    let normals: [Float]?
+    let tangents: [Float]?
+    let uvs: [Float]?
+    let jointIndices: [UInt16]?
+    let jointWeights: [Float]?
+    let indices: [UInt32]
+
+    init(mesh: ImportedMeshData) {
+        vertexCount = mesh.positions.count
+        positions = mesh.positions.flatMap { [$0.x, $0.y, $0.z] }
+        normals = mesh.hasNormals ? mesh.normals.flatMap { [$0.x, $0.y, $0.z] } : nil
+        tangents = mesh.hasTangents ? mesh.tangents.flatMap { [$0.x, $0.y, $0.z] } : nil
+        uvs = mesh.hasUVs ? mesh.uv0.flatMap { [$0.x, $0.y] } : nil
+        let skinned = mesh.hasSkinning
+            && mesh.jointIndices.count == mesh.positions.count
+            && mesh.jointWeights.count == mesh.positions.count
+        jointIndices = skinned ? mesh.jointIndices.flatMap { [$0.x, $0.y, $0.z, $0.w] } : nil
+        jointWeights = skinned ? mesh.jointWeights.flatMap { [$0.x, $0.y, $0.z, $0.w] } : nil
+        indices = mesh.indices
+    }
+
+    func simplify(settings: MCEMeshSimplifySettings, indices source: [UInt32]) -> (indices: [UInt32], result: MCEMeshSimplifyResult)? {
+        var settings = settings
+        var result = MCEMeshSimplifyResult()
+        var output = [UInt32](repeating: 0, count: source.count)
+        let ok = withOptional(normals) { normalPointer in
+            withOptional(uvs) { uvPointer in
+                withOptional(jointIndices) { jointIndexPointer in
+                    withOptional(jointWeights) { jointWeightPointer in
+                        positions.withUnsafeBufferPointer { positionBuffer in
+                            source.withUnsafeBufferPointer { indexBuffer -> UInt32 in
+                                var input = MCEMeshSimplifyInput(positions: positionBuffer.baseAddress,
+                                                                 normals: normalPointer,
+                                                                 uvs: uvPointer,
+                                                                 jointIndices: jointIndexPointer,
+                                                                 jointWeights: jointWeightPointer,
+                                                                 vertexCount: UInt32(clamping: vertexCount),
+                                                                 indices: indexBuffer.baseAddress,
+                                                                 indexCount: UInt32(clamping: indexBuffer.count))
+                                return MCEMeshSimplify(&input, &settings, &output, &result)
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        guard ok != 0 else { return nil }
+        output.removeSubrange(Int(result.indexCount)...)
+        return (output, result)
+    }
+
+    func buildMeshlets(maxVertices: UInt32, maxTriangles: UInt32) -> MeshBakeStages.MeshletSet? {
+        let bound = Int(MCEMeshletBuildBound(UInt32(clamping: indices.count), maxVertices, maxTriangles))
+        var meshlets = [MCEMeshlet](repeating: MCEMeshlet(), count: bound)
+        var vertices = [UInt32](repeating: 0, count: bound * Int(maxVertices))
+        var triangles = [UInt8](repeating: 0, count: bound * Int(maxTriangles) * 3)
+        var bounds = [MCEMeshletBounds](repeating: MCEMeshletBounds(), count: bound)
+        var settings = MCEMeshletSettings(maxVertices: maxVertices,
+                                          maxTriangles: maxTriangles,
+                                          coneWeight: MeshBakeStages.meshletConeWeight)
+        var result = MCEMeshletBuildResult()
+        let ok = positions.withUnsafeBufferPointer { positionBuffer in
+            indices.withUnsafeBufferPointer { indexBuffer in
+                MCEMeshletBuild(positionBuffer.baseAddress, UInt32(clamping: vertexCount),
+                                indexBuffer.baseAddress, UInt32(clamping: indexBuffer.count),
+                                &settings, &meshlets, &vertices, &triangles, &bounds, &result)
+            }
+        }
+        guard ok != 0 else { return nil }
+        let meshletCount = Int(result.meshletCount)
+        meshlets.removeSubrange(meshletCount...)
+        bounds.removeSubrange(meshletCount...)
+        vertices.removeSubrange(Int(result.vertexCount)...)
+        triangles.removeSubrange((Int(result.triangleCount) * 3)...)
+        return MeshBakeStages.MeshletSet(maxVertices: maxVertices,
+                                         maxTriangles: maxTriangles,
+                                         meshlets: meshlets,
+                                         bounds: bounds,
+                                         vertices: vertices,
+                                         triangles: triangles,
+                                         milliseconds: result.milliseconds)
+    }
+
+    func quantize(settings: MCEVertexQuantizeSettings) -> MeshBakeStages.QuantizedVertices? {
+        var settings = settings
+        var layout = MCEVertexQuantizedLayout()
+        var report = MCEVertexQuantizeReport()
+        let packed: Data? = withOptional(normals) { normalPointer in
+            withOptional(tangents) { tangentPointer in
+                withOptional(uvs) { uvPointer in
+                    withOptional(jointIndices) { jointIndexPointer in
+                        withOptional(jointWeights) { jointWeightPointer in
+                            positions.withUnsafeBufferPointer { positionBuffer -> Data? in
+                                var streams = MCEVertexStreams(positions: positionBuffer.baseAddress,
+                                                               normals: normalPointer,
+                                                               tangents: tangentPointer,
+                                                               uvs: uvPointer,
+                                                               jointIndices: jointIndexPointer,
+                                                               jointWeights: jointWeightPointer,
+                                                               vertexCount: UInt32(clamping: vertexCount))
+                                let size = MCEVertexQuantizeLayout(&streams, &settings, nil)
+                                guard size > 0 else { return nil }
+                                var data = Data(count: size)
+                                let ok = data.withUnsafeMutableBytes { buffer in
+                                    MCEVertexQuantize(&streams, &settings, buffer.baseAddress, buffer.count, &layout, &report)
+                                }
+                                return ok != 0 ? data : nil
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        guard let packed else { return nil }
+        return MeshBakeStages.QuantizedVertices(layout: layout, data: packed, report: report)
+    }
+
+    private func withOptional<Element, Result>(_ array: [Element]?, _ body: (UnsafePointer<Element>?) -> Result) -> Result {
+        guard let array else { return body(nil) }
+        return array.withUnsafeBufferPointer { body($0.baseAddress) }
+    }
+}
+
+enum MeshBakeStages {
+    struct LODLevel {
+        let targetRatio: Float
+        let screenSize: Float
+        let error: Float
+        let indices: [UInt32]
+    }
+
+    struct MeshletSet {
+        let maxVertices: UInt32
+        let maxTriangles: UInt32
+        let meshlets: [MCEMeshlet]
+        let bounds: [MCEMeshletBounds]
+        /// Submesh-local vertex indices referenced by `MCEMeshlet.vertexOffset`.
+        let vertices: [UInt32]
+        let triangles: [UInt8]
+        let milliseconds: Double
+    }
+
+    struct QuantizedVertices {
+        let layout: MCEVertexQuantizedLayout
+        let data: Data
+        let report: MCEVertexQuantizeReport
+    }
+
+    /// Everything the enabled stages produced for one submesh.
+    struct SubmeshOutput {
+        var lods: [LODLevel] = []
+        var meshlets: MeshletSet?
+        var quantized: QuantizedVertices?
+        var report = MeshBakeReport()
+    }
+
+    /// Slightly favours coplanar triangles so more cones stay narrow enough to cull.
+    static let meshletConeWeight: Float = 0.25
+
+    static func run(mesh: ImportedMeshData, options: MeshBakeOptions) -> SubmeshOutput {
+        var output = SubmeshOutput()
+        guard !options.lodRatios.isEmpty || options.meshletMaxVertices > 0 || options.vertexQuantization != nil else {
+            return output
+        }
+        let streams = MeshBakeStreams(mesh: mesh)
+        let lodChain = buildLODs(streams: streams, name: mesh.name, options: options)
+        output.lods = lodChain.levels
+        output.report.lods = lodChain.report
+        if options.meshletMaxVertices > 0, !streams.indices.isEmpty,
+           let meshlets = streams.buildMeshlets(maxVertices: options.meshletMaxVertices,
+                                                maxTriangles: options.meshletMaxTriangles) {
+            output.meshlets = meshlets
+            let count = meshlets.meshlets.count
+            let cullable = meshlets.bounds.filter { $0.coneCutoff < 1 }.count
+            output.report.meshlets = [MeshBakeReport.MeshletEntry(
+                submesh: mesh.name,
+                meshlets: count,
+                averageVertices: count > 0 ? Float(meshlets.vertices.count) / Float(count) : 0,
+                averageTriangles: count > 0 ? Float(meshlets.triangles.count / 3) / Float(count) : 0,
+                cullableCones: count > 0 ? Float(cullable) / Float(count) : 0,
+                milliseconds: meshlets.milliseconds
+            )]
+        }
+        if let settings = options.vertexQuantization, streams.vertexCount > 0,
+           let quantized = streams.quantize(settings: settings) {
+            output.quantized = quantized
+            output.report.quantization = [MeshBakeReport.QuantizationEntry(submesh: mesh.name,
+                                                                           profile: options.vertexQuantizationProfile,
+                                                                           report: quantized.report)]
+        }
+        return output
+    }
+
+    /// Attribute costs, as a fraction of the bounding-box diagonal per unit of change: a normal
+    /// turning 90 degrees weighs like ~3% drift, a bone swap like ~10%.
+    static let lodSimplifySettings = MCEMeshSimplifySettings(targetRatio: 1,
+                                                             maxError: 0,
+                                                             normalWeight: 0.02,
+                                                             uvWeight: 0.02,
+                                                             skinWeight: 0.05)
+
+    /// Simplifies each level from the full-resolution indices so errors do not compound down the
+    /// chain. A level that no longer removes triangles ends the chain.
+    static func buildLODs(streams: MeshBakeStreams,
+                          name: String,
+                          options: MeshBakeOptions) -> (levels: [LODLevel], report: [MeshBakeReport.LODEntry]) {
+        let sourceTriangles = streams.indices.count / 3
+        guard !options.lodRatios.isEmpty, sourceTriangles > 1 else { return ([], []) }
+        var levels: [LODLevel] = []
+        var report: [MeshBakeReport.LODEntry] = []
+        var previousTriangles = sourceTriangles
+        for (index, ratio) in options.lodRatios.enumerated() {
+            var settings = lodSimplifySettings
+            settings.targetRatio = ratio
+            guard let simplified = streams.simplify(settings: settings, indices: streams.indices) else { break }
+            let triangles = simplified.indices.count / 3
+            guard triangles > 0, triangles < previousTriangles else { break }
+            previousTriangles = triangles
+            levels.append(LODLevel(targetRatio: ratio,
+                                   screenSize: options.lodScreenSizes[index],
+                                   error: simplified.result.error,
+                                   indices: simplified.indices))
+            report.append(MeshBakeReport.LODEntry(submesh: name,
+                                                  level: index + 1,
+                                                  targetRatio: ratio,
+                                                  sourceTriangles: sourceTriangles,
+                                                  triangles: triangles,
+                                                  error: simplified.result.error,
+                                                  milliseconds: simplified.result.milliseconds))
+        }
+        return (levels, report)
+    }
+}
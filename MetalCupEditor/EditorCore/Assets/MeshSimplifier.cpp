@@ -0,0 +1,426 @@
+/// MeshSimplifier.cpp
+/// Implements half-edge collapse simplification driven by quadric error with attribute costs.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "MeshSimplifier.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Border edges are held by a plane through the edge perpendicular to its face; the weight keeps
+/// silhouettes and open seams from drifting before interior detail is gone.
+constexpr double kBorderWeight = 10.0;
+/// A collapse may rotate a neighbouring face's normal by at most ~78 degrees.
+constexpr double kMinNormalAgreement = 0.2;
+constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+
+struct Vec3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+};
+
+Vec3 Sub(const Vec3 &a, const Vec3 &b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+Vec3 Cross(const Vec3 &a, const Vec3 &b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+double Dot(const Vec3 &a, const Vec3 &b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+double Length(const Vec3 &a) { return std::sqrt(Dot(a, a)); }
+
+/// Weighted sum of squared plane distances, with the total weight kept alongside so the error can
+/// be read back as a weighted mean. Plane weights (area, squared edge length) then only set the
+/// planes' relative influence, and the error stays a squared distance in the asset's own units.
+struct Quadric {
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0, c = 0;
+    double weight = 0;
+
+    static Quadric Plane(const Vec3 &n, double d, double weight) {
+        Quadric q;
+        q.a00 = n.x * n.x * weight; q.a01 = n.x * n.y * weight; q.a02 = n.x * n.z * weight;
+        q.a11 = n.y * n.y * weight; q.a12 = n.y * n.z * weight; q.a22 = n.z * n.z * weight;
+        q.b0 = n.x * d * weight; q.b1 = n.y * d * weight; q.b2 = n.z * d * weight;
+        q.c = d * d * weight;
+        q.weight = weight;
+        return q;
+    }
+
+    void Add(const Quadric &o) {
+        a00 += o.a00; a01 += o.a01; a02 += o.a02; a11 += o.a11; a12 += o.a12; a22 += o.a22;
+        b0 += o.b0; b1 += o.b1; b2 += o.b2; c += o.c;
+        weight += o.weight;
+    }
+
+    double Evaluate(const Vec3 &p) const {
+        const double error = p.x * (a00 * p.x + a01 * p.y + a02 * p.z)
+            + p.y * (a01 * p.x + a11 * p.y + a12 * p.z)
+            + p.z * (a02 * p.x + a12 * p.y + a22 * p.z)
+            + 2.0 * (b0 * p.x + b1 * p.y + b2 * p.z) + c;
+        return weight > 0.0 ? std::max(0.0, error) / weight : 0.0;
+    }
+};
+
+struct Candidate {
+    double cost;
+    uint32_t from;
+    uint32_t to;
+    bool operator>(const Candidate &o) const { return cost > o.cost; }
+};
+
+struct PositionKey {
+    uint32_t bits[3];
+    bool operator==(const PositionKey &o) const { return std::memcmp(bits, o.bits, sizeof(bits)) == 0; }
+};
+
+struct PositionKeyHash {
+    size_t operator()(const PositionKey &key) const {
+        uint64_t h = 0xCBF29CE484222325ull;
+        for (uint32_t bits : key.bits) { h = (h ^ bits) * 0x100000001B3ull; }
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+};
+
+uint64_t EdgeKey(uint32_t a, uint32_t b) {
+    return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+}
+
+class Simplifier {
+public:
+    Simplifier(const MCEMeshSimplifyInput &input, const MCEMeshSimplifySettings &settings)
+        : input_(input), settings_(settings) {}
+
+    uint32_t Run(uint32_t *indicesOut, MCEMeshSimplifyResult &result) {
+        Weld();
+        BuildTriangles();
+        const double extentSq = ExtentSquared();
+        attributeScale_ = extentSq;
+        BuildQuadrics();
+
+        const uint32_t initial = aliveTriangles_;
+        const uint32_t target = std::max<uint32_t>(1, static_cast<uint32_t>(std::floor(initial * std::max(0.0f, settings_.targetRatio))));
+        const double maxCost = settings_.maxError > 0.0f ? static_cast<double>(settings_.maxError) * settings_.maxError * extentSq : 0.0;
+        double worstCost = 0.0;
+        uint32_t collapses = 0;
+
+        while (aliveTriangles_ > target && !heap_.empty()) {
+            const Candidate top = heap_.top();
+            heap_.pop();
+            if (!alive_[top.from] || !alive_[top.to]) { continue; }
+            const double cost = Cost(top.from, top.to);
+            if (!std::isfinite(cost)) { continue; }
+            if (cost > top.cost * 1.0001 + 1e-30) {
+                heap_.push({ cost, top.from, top.to });
+                continue;
+            }
+            if (maxCost > 0.0 && cost > maxCost) { break; }
+            if (!Collapse(top.from, top.to)) { continue; }
+            worstCost = std::max(worstCost, cost);
+            ++collapses;
+        }
+
+        uint32_t written = 0;
+        for (size_t t = 0; t < triangles_.size(); ++t) {
+            if (!triangleAlive_[t]) { continue; }
+            for (uint32_t corner : triangles_[t]) { indicesOut[written++] = corner; }
+        }
+        result.indexCount = written;
+        result.collapses = collapses;
+        result.error = extentSq > 0.0 ? static_cast<float>(std::sqrt(worstCost / extentSq)) : 0.0f;
+        return 1;
+    }
+
+private:
+    const MCEMeshSimplifyInput &input_;
+    const MCEMeshSimplifySettings &settings_;
+
+    std::vector<uint32_t> rep_;
+    std::vector<std::vector<uint32_t>> wedges_;
+    std::vector<std::array<uint32_t, 3>> triangles_;
+    std::vector<uint8_t> triangleAlive_;
+    std::vector<std::vector<uint32_t>> trianglesOf_;
+    std::vector<Quadric> quadrics_;
+    std::vector<uint8_t> border_;
+    std::vector<uint8_t> alive_;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> heap_;
+    uint32_t aliveTriangles_ = 0;
+    double attributeScale_ = 0.0;
+    mutable std::vector<std::pair<uint32_t, uint32_t>> scratchMapping_;
+
+    Vec3 Position(uint32_t vertex) const {
+        const float *p = input_.positions + static_cast<size_t>(vertex) * 3;
+        return { p[0], p[1], p[2] };
+    }
+
+    /// Vertices that share a position are one topological vertex; each keeps its own attributes
+    /// as a wedge, which is how UV and hard-normal seams stay intact.
+    void Weld() {
+        rep_.assign(input_.vertexCount, kInvalid);
+        wedges_.assign(input_.vertexCount, {});
+        alive_.assign(input_.vertexCount, 0);
+        std::unordered_map<PositionKey, uint32_t, PositionKeyHash> firstByPosition;
+        firstByPosition.reserve(input_.vertexCount);
+        for (uint32_t v = 0; v < input_.vertexCount; ++v) {
+            PositionKey key {};
+            for (int c = 0; c < 3; ++c) {
+                const float value = input_.positions[static_cast<size_t>(v) * 3 + c] + 0.0f;
+                std::memcpy(&key.bits[c], &value, sizeof(float));
+            }
+            const auto inserted = firstByPosition.emplace(key, v);
+            rep_[v] = inserted.first->second;
+            wedges_[rep_[v]].push_back(v);
+        }
+    }
+
+    void BuildTriangles() {
+        trianglesOf_.assign(input_.vertexCount, {});
+        triangles_.reserve(input_.indexCount / 3);
+        for (uint32_t i = 0; i + 2 < input_.indexCount; i += 3) {
+            const std::array<uint32_t, 3> corners { input_.indices[i], input_.indices[i + 1], input_.indices[i + 2] };
+            const uint32_t a = rep_[corners[0]], b = rep_[corners[1]], c = rep_[corners[2]];
+            if (a == b || b == c || a == c) { continue; }
+            const uint32_t id = static_cast<uint32_t>(triangles_.size());
+            triangles_.push_back(corners);
+            for (uint32_t r : { a, b, c }) {
+                trianglesOf_[r].push_back(id);
+                alive_[r] = 1;
+            }
+        }
+        triangleAlive_.assign(triangles_.size(), 1);
+        aliveTriangles_ = static_cast<uint32_t>(triangles_.size());
+    }
+
+    double ExtentSquared() const {
+        Vec3 lo { std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+        Vec3 hi { -lo.x, -lo.y, -lo.z };
+        for (uint32_t v = 0; v < input_.vertexCount; ++v) {
+            const Vec3 p = Position(v);
+            lo = { std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z) };
+            hi = { std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z) };
+        }
+        const Vec3 d = Sub(hi, lo);
+        return input_.vertexCount > 0 ? Dot(d, d) : 0.0;
+    }
+
+    void BuildQuadrics() {
+        quadrics_.assign(input_.vertexCount, Quadric());
+        border_.assign(input_.vertexCount, 0);
+        std::unordered_map<uint64_t, uint32_t> edgeUse;
+        edgeUse.reserve(triangles_.size() * 2);
+        for (const auto &tri : triangles_) {
+            const Vec3 p0 = Position(tri[0]), p1 = Position(tri[1]), p2 = Position(tri[2]);
+            const Vec3 n = Cross(Sub(p1, p0), Sub(p2, p0));
+            const double length = Length(n);
+            if (length > 0.0) {
+                const Vec3 unit { n.x / length, n.y / length, n.z / length };
+                const Quadric plane = Quadric::Plane(unit, -Dot(unit, p0), length * 0.5);
+                for (uint32_t corner : tri) { quadrics_[rep_[corner]].Add(plane); }
+            }
+            for (int e = 0; e < 3; ++e) { ++edgeUse[EdgeKey(rep_[tri[e]], rep_[tri[(e + 1) % 3]])]; }
+        }
+        for (const auto &tri : triangles_) {
+            const Vec3 p0 = Position(tri[0]), p1 = Position(tri[1]), p2 = Position(tri[2]);
+            const Vec3 faceNormal = Cross(Sub(p1, p0), Sub(p2, p0));
+            for (int e = 0; e < 3; ++e) {
+                const uint32_t a = rep_[tri[e]], b = rep_[tri[(e + 1) % 3]];
+                if (edgeUse[EdgeKey(a, b)] != 1) { continue; }
+                border_[a] = border_[b] = 1;
+                const Vec3 pa = Position(a), edge = Sub(Position(b), pa);
+                const Vec3 n = Cross(edge, faceNormal);
+                const double length = Length(n);
+                if (length <= 0.0) { continue; }
+                const Vec3 unit { n.x / length, n.y / length, n.z / length };
+                const Quadric constraint = Quadric::Plane(unit, -Dot(unit, pa), Dot(edge, edge) * kBorderWeight);
+                quadrics_[a].Add(constraint);
+                quadrics_[b].Add(constraint);
+            }
+        }
+        for (const auto &entry : edgeUse) {
+            const uint32_t a = static_cast<uint32_t>(entry.first >> 32), b = static_cast<uint32_t>(entry.first);
+            for (const auto &edge : { std::make_pair(a, b), std::make_pair(b, a) }) {
+                const double cost = Cost(edge.first, edge.second);
+                if (std::isfinite(cost)) { heap_.push({ cost, edge.first, edge.second }); }
+            }
+        }
+    }
+
+    int CornerOf(const std::array<uint32_t, 3> &tri, uint32_t r) const {
+        for (int c = 0; c < 3; ++c) {
+            if (rep_[tri[c]] == r) { return c; }
+        }
+        return -1;
+    }
+
+    /// Maps each wedge of `from` to the wedge of `to` it will become. Every wedge must be reached
+    /// through a triangle on the collapsing edge, or the collapse would smear attributes across a seam.
+    bool WedgeMap(uint32_t from, uint32_t to, std::vector<std::pair<uint32_t, uint32_t>> &mapping) const {
+        mapping.clear();
+        for (uint32_t t : trianglesOf_[from]) {
+            if (!triangleAlive_[t]) { continue; }
+            const auto &tri = triangles_[t];
+            const int fc = CornerOf(tri, from), tc = CornerOf(tri, to);
+            if (fc < 0 || tc < 0) { continue; }
+            const uint32_t fw = tri[fc], tw = tri[tc];
+            auto existing = std::find_if(mapping.begin(), mapping.end(), [fw](const auto &p) { return p.first == fw; });
+            if (existing == mapping.end()) {
+                mapping.emplace_back(fw, tw);
+            } else if (existing->second != tw) {
+                return false;
+            }
+        }
+        if (mapping.empty()) { return false; }
+        for (uint32_t t : trianglesOf_[from]) {
+            if (!triangleAlive_[t]) { continue; }
+            const int fc = CornerOf(triangles_[t], from);
+            if (fc < 0) { continue; }
+            const uint32_t fw = triangles_[t][fc];
+            if (std::none_of(mapping.begin(), mapping.end(), [fw](const auto &p) { return p.first == fw; })) { return false; }
+        }
+        return true;
+    }
+
+    double AttributeDistanceSquared(uint32_t a, uint32_t b) const {
+        double total = 0.0;
+        if (input_.normals && settings_.normalWeight > 0.0f) {
+            const float *na = input_.normals + static_cast<size_t>(a) * 3, *nb = input_.normals + static_cast<size_t>(b) * 3;
+            double d = 0.0;
+            for (int c = 0; c < 3; ++c) { d += (na[c] - nb[c]) * (na[c] - nb[c]); }
+            total += d * settings_.normalWeight * settings_.normalWeight;
+        }
+        if (input_.uvs && settings_.uvWeight > 0.0f) {
+            const float *ua = input_.uvs + static_cast<size_t>(a) * 2, *ub = input_.uvs + static_cast<size_t>(b) * 2;
+            const double d = (ua[0] - ub[0]) * (ua[0] - ub[0]) + (ua[1] - ub[1]) * (ua[1] - ub[1]);
+            total += d * settings_.uvWeight * settings_.uvWeight;
+        }
+        if (input_.jointIndices && input_.jointWeights && settings_.skinWeight > 0.0f) {
+            // L1 distance between the two influence sets, matched by joint index.
+            const uint16_t *ja = input_.jointIndices + static_cast<size_t>(a) * 4, *jb = input_.jointIndices + static_cast<size_t>(b) * 4;
+            const float *wa = input_.jointWeights + static_cast<size_t>(a) * 4, *wb = input_.jointWeights + static_cast<size_t>(b) * 4;
+            double d = 0.0;
+            for (int i = 0; i < 4; ++i) {
+                double other = 0.0;
+                for (int k = 0; k < 4; ++k) { if (jb[k] == ja[i]) { other += wb[k]; } }
+                d += std::fabs(wa[i] - other);
+            }
+            for (int k = 0; k < 4; ++k) {
+                bool shared = false;
+                for (int i = 0; i < 4; ++i) { shared = shared || ja[i] == jb[k]; }
+                if (!shared) { d += std::fabs(wb[k]); }
+            }
+            total += d * d * settings_.skinWeight * settings_.skinWeight;
+        }
+        return total;
+    }
+
+    double Cost(uint32_t from, uint32_t to) const {
+        if (border_[from] && !border_[to]) { return std::numeric_limits<double>::infinity(); }
+        if (!WedgeMap(from, to, scratchMapping_)) { return std::numeric_limits<double>::infinity(); }
+        double attribute = 0.0;
+        for (const auto &pair : scratchMapping_) { attribute = std::max(attribute, AttributeDistanceSquared(pair.first, pair.second)); }
+        return quadrics_[from].Evaluate(Position(to)) + attribute * attributeScale_;
+    }
+
+    void Neighbors(uint32_t r, std::vector<uint32_t> &out) const {
+        out.clear();
+        for (uint32_t t : trianglesOf_[r]) {
+            if (!triangleAlive_[t] || CornerOf(triangles_[t], r) < 0) { continue; }
+            for (uint32_t corner : triangles_[t]) {
+                const uint32_t n = rep_[corner];
+                if (n != r && std::find(out.begin(), out.end(), n) == out.end()) { out.push_back(n); }
+            }
+        }
+    }
+
+    bool Collapse(uint32_t from, uint32_t to) {
+        std::vector<std::pair<uint32_t, uint32_t>> mapping;
+        if (!WedgeMap(from, to, mapping)) { return false; }
+
+        // Link condition: the only shared neighbours may be the apexes of the triangles on the edge,
+        // otherwise the collapse pinches the surface into a non-manifold fan.
+        std::vector<uint32_t> fromNeighbors, toNeighbors;
+        Neighbors(from, fromNeighbors);
+        Neighbors(to, toNeighbors);
+        uint32_t shared = 0, edgeTriangles = 0;
+        for (uint32_t n : fromNeighbors) {
+            if (std::find(toNeighbors.begin(), toNeighbors.end(), n) != toNeighbors.end()) { ++shared; }
+        }
+        const Vec3 target = Position(to);
+        for (uint32_t t : trianglesOf_[from]) {
+            if (!triangleAlive_[t]) { continue; }
+            const auto &tri = triangles_[t];
+            const int fc = CornerOf(tri, from);
+            if (fc < 0) { continue; }
+            if (CornerOf(tri, to) >= 0) {
+                ++edgeTriangles;
+                continue;
+            }
+            const Vec3 p0 = Position(tri[0]), p1 = Position(tri[1]), p2 = Position(tri[2]);
+            const Vec3 before = Cross(Sub(p1, p0), Sub(p2, p0));
+            Vec3 moved[3] = { p0, p1, p2 };
+            moved[fc] = target;
+            const Vec3 after = Cross(Sub(moved[1], moved[0]), Sub(moved[2], moved[0]));
+            const double lengths = Length(before) * Length(after);
+            if (lengths <= 0.0 || Dot(before, after) < kMinNormalAgreement * lengths) { return false; }
+        }
+        if (shared > edgeTriangles) { return false; }
+
+        std::vector<uint32_t> &toTriangles = trianglesOf_[to];
+        for (uint32_t t : trianglesOf_[from]) {
+            if (!triangleAlive_[t]) { continue; }
+            auto &tri = triangles_[t];
+            const int fc = CornerOf(tri, from);
+            if (fc < 0) { continue; }
+            if (CornerOf(tri, to) >= 0) {
+                triangleAlive_[t] = 0;
+                --aliveTriangles_;
+                continue;
+            }
+            for (const auto &pair : mapping) {
+                if (pair.first == tri[fc]) {
+                    tri[fc] = pair.second;
+                    break;
+                }
+            }
+            toTriangles.push_back(t);
+        }
+        trianglesOf_[from].clear();
+        toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(), [this, to](uint32_t t) {
+            return !triangleAlive_[t] || CornerOf(triangles_[t], to) < 0;
+        }), toTriangles.end());
+        for (uint32_t wedge : wedges_[from]) { rep_[wedge] = to; }
+        alive_[from] = 0;
+        quadrics_[to].Add(quadrics_[from]);
+
+        Neighbors(to, toNeighbors);
+        for (uint32_t n : toNeighbors) {
+            for (const auto &edge : { std::make_pair(n, to), std::make_pair(to, n) }) {
+                const double cost = Cost(edge.first, edge.second);
+                if (std::isfinite(cost)) { heap_.push({ cost, edge.first, edge.second }); }
+            }
+        }
+        return true;
+    }
+};
+
+}
+
+extern "C" uint32_t MCEMeshSimplify(const MCEMeshSimplifyInput *input, const MCEMeshSimplifySettings *settings,
+                                    uint32_t *indicesOut, MCEMeshSimplifyResult *resultOut) {
+    if (!input || !settings || !indicesOut || !input->positions || !input->indices || input->indexCount % 3 != 0) { return 0; }
+    for (uint32_t i = 0; i < input->indexCount; ++i) {
+        if (input->indices[i] >= input->vertexCount) { return 0; }
+    }
+    const auto start = Clock::now();
+    MCEMeshSimplifyResult result {};
+    Simplifier simplifier(*input, *settings);
+    if (!simplifier.Run(indicesOut, result)) { return 0; }
+    result.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (resultOut) { *resultOut = result; }
+    return 1;
+}
@@ -0,0 +1,54 @@
+/// MeshSimplifier.h
+/// Declares the quadric-error mesh simplifier used to build import-time LOD chains.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// One submesh. Attribute streams are optional (NULL) and indexed like `positions`.
+typedef struct {
+    const float *positions;
+    const float *normals;
+    const float *uvs;
+    const uint16_t *jointIndices;
+    const float *jointWeights;
+    uint32_t vertexCount;
+    const uint32_t *indices;
+    uint32_t indexCount;
+} MCEMeshSimplifyInput;
+
+/// Attribute weights convert an attribute change into an equivalent geometric error, as a fraction
+/// of the mesh's bounding-box diagonal per unit of change (unit normal delta, UV delta, summed
+/// skin-weight delta).
+typedef struct {
+    float targetRatio;
+    /// Stop before any collapse whose error exceeds this fraction of the diagonal; 0 disables.
+    float maxError;
+    float normalWeight;
+    float uvWeight;
+    float skinWeight;
+} MCEMeshSimplifySettings;
+
+typedef struct {
+    uint32_t indexCount;
+    uint32_t collapses;
+    /// Largest accepted collapse error, as a fraction of the bounding-box diagonal.
+    float error;
+    double milliseconds;
+} MCEMeshSimplifyResult;
+
+/// Writes a reduced index buffer over the same vertices into `indicesOut` (capacity: the input
+/// index count). Vertices are only ever merged onto existing vertices, so every LOD shares the
+/// submesh's vertex buffer. Returns 0 on invalid input.
+uint32_t MCEMeshSimplify(const MCEMeshSimplifyInput *input, const MCEMeshSimplifySettings *settings,
+                         uint32_t *indicesOut, MCEMeshSimplifyResult *resultOut);
+
+#ifdef __cplusplus
+}
+#endif
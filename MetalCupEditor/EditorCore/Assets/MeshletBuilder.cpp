@@ -0,0 +1,653 @@
+/// MeshletBuilder.cpp
+/// Implements greedy meshlet partitioning, meshlet culling bounds and the culling benchmark.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "MeshletBuilder.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+constexpr uint8_t kNotLocal = 0xFF;
+/// Cones wider than ~84 degrees reject almost nothing, so they are stored as never-cull.
+constexpr float kMinConeSpread = 0.1f;
+constexpr uint32_t kTreeLeafSize = 8;
+
+struct Vec3 {
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+};
+
+Vec3 Add(const Vec3 &a, const Vec3 &b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+Vec3 Sub(const Vec3 &a, const Vec3 &b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+Vec3 Scale(const Vec3 &a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+Vec3 Cross(const Vec3 &a, const Vec3 &b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+float Dot(const Vec3 &a, const Vec3 &b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+float Length(const Vec3 &a) { return std::sqrt(Dot(a, a)); }
+Vec3 Normalize(const Vec3 &a) {
+    const float length = Length(a);
+    return length > 0.0f ? Scale(a, 1.0f / length) : Vec3 {};
+}
+float Component(const Vec3 &a, int axis) { return axis == 0 ? a.x : (axis == 1 ? a.y : a.z); }
+Vec3 Load(const float *positions, uint32_t index) {
+    return { positions[index * 3 + 0], positions[index * 3 + 1], positions[index * 3 + 2] };
+}
+void Store(float *out, const Vec3 &v) {
+    out[0] = v.x;
+    out[1] = v.y;
+    out[2] = v.z;
+}
+
+/// Triangle centroids for restarting a meshlet next to the previous one once its neighbourhood is
+/// used up. Nodes count their remaining triangles so exhausted regions are skipped.
+class CentroidTree {
+public:
+    explicit CentroidTree(const std::vector<Vec3> &points) : points_(points), leafOf_(points.size(), kInvalid) {
+        items_.resize(points.size());
+        for (uint32_t i = 0; i < items_.size(); ++i) { items_[i] = i; }
+        if (!items_.empty()) { Build(0, static_cast<uint32_t>(items_.size()), kInvalid); }
+    }
+
+    void Remove(uint32_t item) {
+        for (uint32_t node = leafOf_[item]; node != kInvalid; node = nodes_[node].parent) {
+            nodes_[node].alive -= 1;
+        }
+    }
+
+    uint32_t Nearest(const Vec3 &point, const std::vector<uint8_t> &emitted) const {
+        uint32_t best = kInvalid;
+        float bestDistance = std::numeric_limits<float>::max();
+        if (!nodes_.empty()) { Search(0, point, emitted, best, bestDistance); }
+        return best;
+    }
+
+private:
+    struct Node {
+        uint32_t first = 0;
+        uint32_t count = 0;
+        uint32_t alive = 0;
+        uint32_t parent = kInvalid;
+        uint32_t left = kInvalid;
+        uint32_t right = kInvalid;
+        int axis = -1;
+        float split = 0.0f;
+    };
+
+    uint32_t Build(uint32_t first, uint32_t count, uint32_t parent) {
+        const uint32_t index = static_cast<uint32_t>(nodes_.size());
+        nodes_.push_back({});
+        nodes_[index].first = first;
+        nodes_[index].count = count;
+        nodes_[index].alive = count;
+        nodes_[index].parent = parent;
+        if (count <= kTreeLeafSize) {
+            for (uint32_t i = first; i < first + count; ++i) { leafOf_[items_[i]] = index; }
+            return index;
+        }
+        Vec3 lo = points_[items_[first]];
+        Vec3 hi = lo;
+        for (uint32_t i = first; i < first + count; ++i) {
+            const Vec3 &p = points_[items_[i]];
+            lo = { std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z) };
+            hi = { std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z) };
+        }
+        const Vec3 extent = Sub(hi, lo);
+        const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+        const uint32_t half = count / 2;
+        std::nth_element(items_.begin() + first, items_.begin() + first + half, items_.begin() + first + count,
+                         [this, axis](uint32_t a, uint32_t b) { return Component(points_[a], axis) < Component(points_[b], axis); });
+        nodes_[index].axis = axis;
+        nodes_[index].split = Component(points_[items_[first + half]], axis);
+        const uint32_t left = Build(first, half, index);
+        const uint32_t right = Build(first + half, count - half, index);
+        nodes_[index].left = left;
+        nodes_[index].right = right;
+        return index;
+    }
+
+    void Search(uint32_t index, const Vec3 &point, const std::vector<uint8_t> &emitted, uint32_t &best, float &bestDistance) const {
+        const Node &node = nodes_[index];
+        if (node.alive == 0) { return; }
+        if (node.axis < 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                const uint32_t item = items_[i];
+                if (emitted[item]) { continue; }
+                const Vec3 delta = Sub(points_[item], point);
+                const float distance = Dot(delta, delta);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = item;
+                }
+            }
+            return;
+        }
+        const float delta = Component(point, node.axis) - node.split;
+        const uint32_t nearSide = delta <= 0.0f ? node.left : node.right;
+        const uint32_t farSide = delta <= 0.0f ? node.right : node.left;
+        Search(nearSide, point, emitted, best, bestDistance);
+        if (delta * delta < bestDistance) { Search(farSide, point, emitted, best, bestDistance); }
+    }
+
+    const std::vector<Vec3> &points_;
+    std::vector<uint32_t> items_;
+    std::vector<uint32_t> leafOf_;
+    std::vector<Node> nodes_;
+};
+
+void ComputeBounds(const float *positions, const uint32_t *vertices, const uint8_t *triangles,
+                   uint32_t vertexCount, uint32_t triangleCount, MCEMeshletBounds &bounds) {
+    Vec3 lo = Load(positions, vertices[0]);
+    Vec3 hi = lo;
+    for (uint32_t i = 1; i < vertexCount; ++i) {
+        const Vec3 p = Load(positions, vertices[i]);
+        lo = { std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z) };
+        hi = { std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z) };
+    }
+    auto enclosingRadius = [&](const Vec3 &center) {
+        float radius = 0.0f;
+        for (uint32_t i = 0; i < vertexCount; ++i) { radius = std::max(radius, Length(Sub(Load(positions, vertices[i]), center))); }
+        return radius;
+    };
+
+    // Ritter's sphere, kept only when tighter than the box's circumscribed sphere.
+    auto farthestFrom = [&](const Vec3 &origin) {
+        Vec3 farthest = origin;
+        float best = -1.0f;
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const Vec3 p = Load(positions, vertices[i]);
+            const Vec3 delta = Sub(p, origin);
+            if (Dot(delta, delta) > best) {
+                best = Dot(delta, delta);
+                farthest = p;
+            }
+        }
+        return farthest;
+    };
+    const Vec3 a = farthestFrom(Load(positions, vertices[0]));
+    const Vec3 b = farthestFrom(a);
+    Vec3 center = Scale(Add(a, b), 0.5f);
+    float radius = Length(Sub(b, a)) * 0.5f;
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        const Vec3 p = Load(positions, vertices[i]);
+        const float distance = Length(Sub(p, center));
+        if (distance > radius) {
+            const float grown = (radius + distance) * 0.5f;
+            center = Add(center, Scale(Sub(p, center), (grown - radius) / distance));
+            radius = grown;
+        }
+    }
+    radius = enclosingRadius(center);
+    const Vec3 boxCenter = Scale(Add(lo, hi), 0.5f);
+    const float boxRadius = enclosingRadius(boxCenter);
+    if (boxRadius < radius) {
+        center = boxCenter;
+        radius = boxRadius;
+    }
+
+    Vec3 normalSum;
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        const Vec3 p0 = Load(positions, vertices[triangles[t * 3 + 0]]);
+        const Vec3 p1 = Load(positions, vertices[triangles[t * 3 + 1]]);
+        const Vec3 p2 = Load(positions, vertices[triangles[t * 3 + 2]]);
+        normalSum = Add(normalSum, Normalize(Cross(Sub(p1, p0), Sub(p2, p0))));
+    }
+    const Vec3 axis = Normalize(normalSum);
+    float minAgreement = 1.0f;
+    float apexOffset = 0.0f;
+    for (uint32_t t = 0; t < triangleCount && Length(axis) > 0.0f; ++t) {
+        const Vec3 p0 = Load(positions, vertices[triangles[t * 3 + 0]]);
+        const Vec3 p1 = Load(positions, vertices[triangles[t * 3 + 1]]);
+        const Vec3 p2 = Load(positions, vertices[triangles[t * 3 + 2]]);
+        const Vec3 normal = Normalize(Cross(Sub(p1, p0), Sub(p2, p0)));
+        if (Length(normal) == 0.0f) { continue; }
+        const float agreement = Dot(axis, normal);
+        minAgreement = std::min(minAgreement, agreement);
+        if (agreement > 0.0f) {
+            // Pull the apex back until it lies behind every triangle's plane.
+            apexOffset = std::max(apexOffset, Dot(Sub(center, p0), normal) / agreement);
+        }
+    }
+
+    Store(bounds.center, center);
+    bounds.radius = radius;
+    Store(bounds.boundsMin, lo);
+    Store(bounds.boundsMax, hi);
+    if (Length(axis) == 0.0f || minAgreement <= kMinConeSpread) {
+        Store(bounds.coneApex, center);
+        Store(bounds.coneAxis, Vec3 {});
+        bounds.coneCutoff = 1.0f;
+    } else {
+        Store(bounds.coneApex, Sub(center, Scale(axis, apexOffset)));
+        Store(bounds.coneAxis, axis);
+        bounds.coneCutoff = std::sqrt(std::max(0.0f, 1.0f - minAgreement * minAgreement));
+    }
+}
+
+/// Grows one meshlet at a time from the triangles touching its vertices, preferring ones that add no
+/// new vertex (or would otherwise be stranded), then the closest and best-aligned.
+class MeshletPartitioner {
+public:
+    MeshletPartitioner(const float *positions, uint32_t vertexCount, const uint32_t *indices, uint32_t indexCount,
+                       const MCEMeshletSettings &settings)
+        : positions_(positions), settings_(settings), local_(vertexCount, kNotLocal) {
+        for (uint32_t i = 0; i + 2 < indexCount; i += 3) {
+            const std::array<uint32_t, 3> triangle { indices[i], indices[i + 1], indices[i + 2] };
+            if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2]) { continue; }
+            triangles_.push_back(triangle);
+        }
+        const uint32_t triangleCount = static_cast<uint32_t>(triangles_.size());
+        centroids_.resize(triangleCount);
+        normals_.resize(triangleCount);
+        double areaSum = 0.0;
+        for (uint32_t t = 0; t < triangleCount; ++t) {
+            const Vec3 p0 = Load(positions, triangles_[t][0]);
+            const Vec3 p1 = Load(positions, triangles_[t][1]);
+            const Vec3 p2 = Load(positions, triangles_[t][2]);
+            const Vec3 cross = Cross(Sub(p1, p0), Sub(p2, p0));
+            centroids_[t] = Scale(Add(Add(p0, p1), p2), 1.0f / 3.0f);
+            normals_[t] = Normalize(cross);
+            areaSum += 0.5 * Length(cross);
+        }
+        const double averageArea = triangleCount > 0 ? areaSum / triangleCount : 0.0;
+        expectedRadius_ = static_cast<float>(std::sqrt(averageArea * settings.maxTriangles) * 0.5);
+
+        adjacencyOffsets_.assign(vertexCount + 1, 0);
+        for (const auto &triangle : triangles_) {
+            for (uint32_t v : triangle) { adjacencyOffsets_[v + 1] += 1; }
+        }
+        for (uint32_t v = 0; v < vertexCount; ++v) { adjacencyOffsets_[v + 1] += adjacencyOffsets_[v]; }
+        liveCounts_.assign(vertexCount, 0);
+        adjacency_.resize(adjacencyOffsets_[vertexCount]);
+        for (uint32_t t = 0; t < triangleCount; ++t) {
+            for (uint32_t v : triangles_[t]) { adjacency_[adjacencyOffsets_[v] + liveCounts_[v]++] = t; }
+        }
+        emitted_.assign(triangleCount, 0);
+    }
+
+    void Run(MCEMeshlet *meshletsOut, uint32_t *verticesOut, uint8_t *trianglesOut, MCEMeshletBounds *boundsOut,
+             MCEMeshletBuildResult &result) {
+        meshletsOut_ = meshletsOut;
+        verticesOut_ = verticesOut;
+        trianglesOut_ = trianglesOut;
+        boundsOut_ = boundsOut;
+        CentroidTree tree(centroids_);
+        for (uint32_t remaining = static_cast<uint32_t>(triangles_.size()); remaining > 0; --remaining) {
+            uint32_t next = BestAdjacent();
+            if (next == kInvalid) {
+                next = current_.triangleCount > 0 ? tree.Nearest(MeshletCenter(), emitted_) : 0;
+            }
+            if (!Fits(next)) { Close(); }
+            Append(next);
+            tree.Remove(next);
+        }
+        Close();
+        result.meshletCount = meshletCount_;
+        result.vertexCount = vertexOffset_;
+        result.triangleCount = triangleOffset_ / 3;
+    }
+
+private:
+    struct Current {
+        uint32_t vertexCount = 0;
+        uint32_t triangleCount = 0;
+        Vec3 centroidSum;
+        Vec3 normalSum;
+    };
+
+    Vec3 MeshletCenter() const {
+        return current_.triangleCount > 0 ? Scale(current_.centroidSum, 1.0f / static_cast<float>(current_.triangleCount)) : Vec3 {};
+    }
+
+    uint32_t NewVertices(uint32_t t) const {
+        const auto &triangle = triangles_[t];
+        return (local_[triangle[0]] == kNotLocal) + (local_[triangle[1]] == kNotLocal) + (local_[triangle[2]] == kNotLocal);
+    }
+
+    bool Fits(uint32_t t) const {
+        return current_.triangleCount < settings_.maxTriangles
+            && current_.vertexCount + NewVertices(t) <= settings_.maxVertices;
+    }
+
+    uint32_t BestAdjacent() const {
+        uint32_t best = kInvalid;
+        uint32_t bestPriority = kInvalid;
+        float bestScore = std::numeric_limits<float>::max();
+        const Vec3 center = MeshletCenter();
+        const Vec3 axis = Normalize(current_.normalSum);
+        const uint32_t *vertices = verticesOut_ + vertexOffset_;
+        for (uint32_t i = 0; i < current_.vertexCount; ++i) {
+            const uint32_t v = vertices[i];
+            for (uint32_t k = 0; k < liveCounts_[v]; ++k) {
+                const uint32_t t = adjacency_[adjacencyOffsets_[v] + k];
+                const auto &triangle = triangles_[t];
+                uint32_t priority = NewVertices(t);
+                // A triangle whose vertex has no other live triangle would cost a whole vertex in a
+                // later meshlet, so it goes now.
+                if (liveCounts_[triangle[0]] == 1 || liveCounts_[triangle[1]] == 1 || liveCounts_[triangle[2]] == 1) { priority = 0; }
+                if (priority > bestPriority) { continue; }
+                const float distance = Length(Sub(centroids_[t], center));
+                const float cone = std::max(1e-3f, 1.0f - Dot(normals_[t], axis) * settings_.coneWeight);
+                const float spread = expectedRadius_ > 0.0f ? distance / expectedRadius_ : 0.0f;
+                const float score = (1.0f + spread * (1.0f - settings_.coneWeight)) * cone;
+                if (priority < bestPriority || score < bestScore) {
+                    best = t;
+                    bestPriority = priority;
+                    bestScore = score;
+                }
+            }
+        }
+        return best;
+    }
+
+    void Append(uint32_t t) {
+        uint8_t *triangleOut = trianglesOut_ + triangleOffset_ + current_.triangleCount * 3;
+        for (int corner = 0; corner < 3; ++corner) {
+            const uint32_t v = triangles_[t][corner];
+            if (local_[v] == kNotLocal) {
+                local_[v] = static_cast<uint8_t>(current_.vertexCount);
+                verticesOut_[vertexOffset_ + current_.vertexCount++] = v;
+            }
+            triangleOut[corner] = local_[v];
+            uint32_t *list = adjacency_.data() + adjacencyOffsets_[v];
+            uint32_t &live = liveCounts_[v];
+            for (uint32_t k = 0; k < live; ++k) {
+                if (list[k] == t) {
+                    list[k] = list[live - 1];
+                    live -= 1;
+                    break;
+                }
+            }
+        }
+        current_.triangleCount += 1;
+        current_.centroidSum = Add(current_.centroidSum, centroids_[t]);
+        current_.normalSum = Add(current_.normalSum, normals_[t]);
+        emitted_[t] = 1;
+    }
+
+    void Close() {
+        if (current_.triangleCount == 0) { return; }
+        MCEMeshlet &meshlet = meshletsOut_[meshletCount_];
+        meshlet.vertexOffset = vertexOffset_;
+        meshlet.triangleOffset = triangleOffset_;
+        meshlet.vertexCount = current_.vertexCount;
+        meshlet.triangleCount = current_.triangleCount;
+        if (boundsOut_) {
+            ComputeBounds(positions_, verticesOut_ + vertexOffset_, trianglesOut_ + triangleOffset_,
+                          current_.vertexCount, current_.triangleCount, boundsOut_[meshletCount_]);
+        }
+        for (uint32_t i = 0; i < current_.vertexCount; ++i) { local_[verticesOut_[vertexOffset_ + i]] = kNotLocal; }
+        meshletCount_ += 1;
+        vertexOffset_ += current_.vertexCount;
+        triangleOffset_ += current_.triangleCount * 3;
+        current_ = Current {};
+    }
+
+    const float *positions_;
+    MCEMeshletSettings settings_;
+    std::vector<std::array<uint32_t, 3>> triangles_;
+    std::vector<Vec3> centroids_;
+    std::vector<Vec3> normals_;
+    std::vector<uint32_t> adjacencyOffsets_;
+    std::vector<uint32_t> adjacency_;
+    std::vector<uint32_t> liveCounts_;
+    std::vector<uint8_t> emitted_;
+    std::vector<uint8_t> local_;
+    float expectedRadius_ = 0.0f;
+
+    MCEMeshlet *meshletsOut_ = nullptr;
+    uint32_t *verticesOut_ = nullptr;
+    uint8_t *trianglesOut_ = nullptr;
+    MCEMeshletBounds *boundsOut_ = nullptr;
+    Current current_;
+    uint32_t meshletCount_ = 0;
+    uint32_t vertexOffset_ = 0;
+    uint32_t triangleOffset_ = 0;
+};
+
+struct BenchmarkMesh {
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+
+    uint32_t AddVertex(const Vec3 &p) {
+        positions.insert(positions.end(), { p.x, p.y, p.z });
+        return static_cast<uint32_t>(positions.size() / 3 - 1);
+    }
+
+    /// Quads over a (columns + 1) x (rows + 1) vertex grid starting at `base`, wrapping columns when asked.
+    void AddGridIndices(uint32_t base, uint32_t columns, uint32_t rows, bool wrapColumns) {
+        const uint32_t stride = wrapColumns ? columns : columns + 1;
+        for (uint32_t r = 0; r < rows; ++r) {
+            for (uint32_t c = 0; c < columns; ++c) {
+                const uint32_t c1 = wrapColumns ? (c + 1) % columns : c + 1;
+                const uint32_t a = base + r * stride + c;
+                const uint32_t b = base + r * stride + c1;
+                const uint32_t d = base + (r + 1) * stride + c;
+                const uint32_t e = base + (r + 1) * stride + c1;
+                indices.insert(indices.end(), { a, d, b, b, d, e });
+            }
+        }
+    }
+};
+
+constexpr const char *kBenchmarkMeshNames[] = { "sphere", "terrain", "torus", "scatter" };
+constexpr int32_t kBenchmarkMeshCount = static_cast<int32_t>(sizeof(kBenchmarkMeshNames) / sizeof(kBenchmarkMeshNames[0]));
+constexpr float kPi = 3.14159265358979f;
+
+BenchmarkMesh MakeBenchmarkMesh(int32_t kind) {
+    BenchmarkMesh mesh;
+    switch (kind) {
+    case 0: {
+        const uint32_t rings = 96;
+        const uint32_t segments = 192;
+        for (uint32_t r = 1; r < rings; ++r) {
+            const float phi = kPi * static_cast<float>(r) / rings;
+            for (uint32_t s = 0; s < segments; ++s) {
+                const float theta = 2.0f * kPi * static_cast<float>(s) / segments;
+                mesh.AddVertex({ std::sin(phi) * std::cos(theta), std::cos(phi), -std::sin(phi) * std::sin(theta) });
+            }
+        }
+        mesh.AddGridIndices(0, segments, rings - 2, true);
+        const uint32_t top = mesh.AddVertex({ 0.0f, 1.0f, 0.0f });
+        const uint32_t bottom = mesh.AddVertex({ 0.0f, -1.0f, 0.0f });
+        const uint32_t lastRing = (rings - 2) * segments;
+        for (uint32_t s = 0; s < segments; ++s) {
+            const uint32_t s1 = (s + 1) % segments;
+            mesh.indices.insert(mesh.indices.end(), { top, s, s1, bottom, lastRing + s1, lastRing + s });
+        }
+        break;
+    }
+    case 1: {
+        const uint32_t cells = 160;
+        for (uint32_t z = 0; z <= cells; ++z) {
+            for (uint32_t x = 0; x <= cells; ++x) {
+                const float u = static_cast<float>(x) / cells * 2.0f - 1.0f;
+                const float v = static_cast<float>(z) / cells * 2.0f - 1.0f;
+                const float height = 0.12f * std::sin(u * 5.0f) * std::cos(v * 4.0f) + 0.05f * std::sin((u + v) * 13.0f);
+                mesh.AddVertex({ u, height, v });
+            }
+        }
+        mesh.AddGridIndices(0, cells, cells, false);
+        break;
+    }
+    case 2: {
+        const uint32_t major = 192;
+        const uint32_t minor = 64;
+        for (uint32_t i = 0; i <= major; ++i) {
+            const float a = 2.0f * kPi * static_cast<float>(i % major) / major;
+            for (uint32_t j = 0; j < minor; ++j) {
+                const float b = 2.0f * kPi * static_cast<float>(j) / minor;
+                const float ring = 1.0f + 0.35f * std::cos(b);
+                mesh.AddVertex({ ring * std::cos(a), 0.35f * std::sin(b), -ring * std::sin(a) });
+            }
+        }
+        // Rows run along the major circle; the duplicated last row closes it with a seam.
+        mesh.AddGridIndices(0, minor, major, true);
+        break;
+    }
+    default: {
+        // Disconnected, randomly oriented quads: every meshlet has to restart through the tree.
+        uint32_t state = 0x9E3779B9u;
+        auto random = [&state]() {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<float>(state >> 8) / static_cast<float>(1u << 24) * 2.0f - 1.0f;
+        };
+        for (uint32_t q = 0; q < 8192; ++q) {
+            const Vec3 center { random(), random(), random() };
+            const Vec3 tangent = Normalize({ random(), random(), random() + 2.0f });
+            const Vec3 bitangent = Scale(Normalize(Cross(tangent, Normalize({ random() + 2.0f, random(), random() }))), 0.03f);
+            const Vec3 edge = Scale(tangent, 0.03f);
+            const uint32_t a = mesh.AddVertex(Sub(Sub(center, edge), bitangent));
+            const uint32_t b = mesh.AddVertex(Sub(Add(center, edge), bitangent));
+            const uint32_t c = mesh.AddVertex(Add(Sub(center, edge), bitangent));
+            const uint32_t d = mesh.AddVertex(Add(Add(center, edge), bitangent));
+            mesh.indices.insert(mesh.indices.end(), { a, c, b, b, c, d });
+        }
+        break;
+    }
+    }
+    return mesh;
+}
+
+MCEMeshletBenchmarkResult MeasureCulling(const BenchmarkMesh &mesh) {
+    MCEMeshletBenchmarkResult result {};
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.positions.size() / 3);
+    const uint32_t indexCount = static_cast<uint32_t>(mesh.indices.size());
+    const MCEMeshletSettings settings { 64, 124, 0.25f };
+    const uint32_t bound = MCEMeshletBuildBound(indexCount, settings.maxVertices, settings.maxTriangles);
+    std::vector<MCEMeshlet> meshlets(bound);
+    std::vector<uint32_t> meshletVertices(static_cast<size_t>(bound) * settings.maxVertices);
+    std::vector<uint8_t> meshletTriangles(static_cast<size_t>(bound) * settings.maxTriangles * 3);
+    std::vector<MCEMeshletBounds> bounds(bound);
+    MCEMeshletBuildResult build {};
+    if (!MCEMeshletBuild(mesh.positions.data(), vertexCount, mesh.indices.data(), indexCount, &settings, meshlets.data(),
+                         meshletVertices.data(), meshletTriangles.data(), bounds.data(), &build)) {
+        return result;
+    }
+    result.triangleCount = build.triangleCount;
+    result.meshletCount = build.meshletCount;
+    result.buildMilliseconds = build.milliseconds;
+    if (build.meshletCount == 0) { return result; }
+    result.averageVertices = static_cast<float>(build.vertexCount) / build.meshletCount;
+    result.averageTriangles = static_cast<float>(build.triangleCount) / build.meshletCount;
+    for (uint32_t m = 0; m < build.meshletCount; ++m) {
+        result.maxMeshletVertices = std::max(result.maxMeshletVertices, meshlets[m].vertexCount);
+        result.maxMeshletTriangles = std::max(result.maxMeshletTriangles, meshlets[m].triangleCount);
+    }
+
+    Vec3 lo = Load(mesh.positions.data(), 0);
+    Vec3 hi = lo;
+    for (uint32_t i = 1; i < vertexCount; ++i) {
+        const Vec3 p = Load(mesh.positions.data(), i);
+        lo = { std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z) };
+        hi = { std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z) };
+    }
+    const Vec3 meshCenter = Scale(Add(lo, hi), 0.5f);
+    const float viewDistance = 3.0f * Length(Sub(hi, lo)) * 0.5f;
+
+    constexpr uint32_t kViews = 64;
+    uint64_t backfacing = 0, coneCulled = 0, outside = 0, sphereCulled = 0, boxCulled = 0;
+    for (uint32_t view = 0; view < kViews; ++view) {
+        // Fibonacci sphere around the mesh; the half-space test stands in for one frustum plane.
+        const float y = 1.0f - 2.0f * (static_cast<float>(view) + 0.5f) / kViews;
+        const float ring = std::sqrt(std::max(0.0f, 1.0f - y * y));
+        const float theta = static_cast<float>(view) * kPi * (3.0f - std::sqrt(5.0f));
+        const Vec3 direction { ring * std::cos(theta), y, ring * std::sin(theta) };
+        const Vec3 eye = Add(meshCenter, Scale(direction, viewDistance));
+
+        for (uint32_t m = 0; m < build.meshletCount; ++m) {
+            const MCEMeshlet &meshlet = meshlets[m];
+            const MCEMeshletBounds &b = bounds[m];
+            const Vec3 apex { b.coneApex[0], b.coneApex[1], b.coneApex[2] };
+            const Vec3 axis { b.coneAxis[0], b.coneAxis[1], b.coneAxis[2] };
+            const bool coneRejects = Dot(Normalize(Sub(apex, eye)), axis) >= b.coneCutoff;
+            const Vec3 sphereCenter { b.center[0], b.center[1], b.center[2] };
+            const bool sphereRejects = Dot(direction, Sub(sphereCenter, meshCenter)) < -b.radius;
+            const Vec3 farCorner { direction.x >= 0.0f ? b.boundsMax[0] : b.boundsMin[0],
+                                   direction.y >= 0.0f ? b.boundsMax[1] : b.boundsMin[1],
+                                   direction.z >= 0.0f ? b.boundsMax[2] : b.boundsMin[2] };
+            const bool boxRejects = Dot(direction, Sub(farCorner, meshCenter)) < 0.0f;
+            coneCulled += coneRejects ? meshlet.triangleCount : 0;
+            sphereCulled += sphereRejects ? meshlet.triangleCount : 0;
+            boxCulled += boxRejects ? meshlet.triangleCount : 0;
+
+            for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+                const uint8_t *local = &meshletTriangles[meshlet.triangleOffset + t * 3];
+                const Vec3 p0 = Load(mesh.positions.data(), meshletVertices[meshlet.vertexOffset + local[0]]);
+                const Vec3 p1 = Load(mesh.positions.data(), meshletVertices[meshlet.vertexOffset + local[1]]);
+                const Vec3 p2 = Load(mesh.positions.data(), meshletVertices[meshlet.vertexOffset + local[2]]);
+                const Vec3 toEye = Sub(eye, p0);
+                const float facing = Dot(Normalize(Cross(Sub(p1, p0), Sub(p2, p0))), toEye);
+                backfacing += facing <= 0.0f ? 1 : 0;
+                if (coneRejects && facing > 1e-4f * Length(toEye)) { result.coneViolations += 1; }
+                const bool triangleOutside = Dot(direction, Sub(p0, meshCenter)) < 0.0f
+                    && Dot(direction, Sub(p1, meshCenter)) < 0.0f
+                    && Dot(direction, Sub(p2, meshCenter)) < 0.0f;
+                outside += triangleOutside ? 1 : 0;
+            }
+        }
+    }
+    const double samples = static_cast<double>(build.triangleCount) * kViews;
+    result.backfacingIdeal = static_cast<float>(backfacing / samples);
+    result.coneCulled = static_cast<float>(coneCulled / samples);
+    result.outsideIdeal = static_cast<float>(outside / samples);
+    result.sphereCulled = static_cast<float>(sphereCulled / samples);
+    result.boxCulled = static_cast<float>(boxCulled / samples);
+    return result;
+}
+
+}
+
+extern "C" uint32_t MCEMeshletBuildBound(uint32_t indexCount, uint32_t maxVertices, uint32_t maxTriangles) {
+    if (maxVertices < 3 || maxTriangles == 0) { return 0; }
+    // A meshlet is only closed when the next triangle would overflow it, so each closed meshlet
+    // holds more than maxVertices - 3 vertices or exactly maxTriangles triangles.
+    const uint64_t triangles = indexCount / 3;
+    const uint64_t byVertices = (static_cast<uint64_t>(indexCount) + maxVertices - 3) / (maxVertices - 2);
+    const uint64_t byTriangles = (triangles + maxTriangles - 1) / maxTriangles;
+    return static_cast<uint32_t>(std::min<uint64_t>(byVertices + byTriangles + 1, std::numeric_limits<uint32_t>::max()));
+}
+
+extern "C" uint32_t MCEMeshletBuild(const float *positions, uint32_t vertexCount,
+                                    const uint32_t *indices, uint32_t indexCount,
+                                    const MCEMeshletSettings *settings,
+                                    MCEMeshlet *meshletsOut, uint32_t *meshletVerticesOut, uint8_t *meshletTrianglesOut,
+                                    MCEMeshletBounds *boundsOut, MCEMeshletBuildResult *resultOut) {
+    if (!positions || !indices || !settings || !meshletsOut || !meshletVerticesOut || !meshletTrianglesOut
+        || indexCount % 3 != 0
+        || settings->maxVertices < 3 || settings->maxVertices > MCE_MESHLET_MAX_VERTICES_LIMIT
+        || settings->maxTriangles == 0 || settings->maxTriangles > MCE_MESHLET_MAX_TRIANGLES_LIMIT) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < indexCount; ++i) {
+        if (indices[i] >= vertexCount) { return 0; }
+    }
+    const auto start = Clock::now();
+    MCEMeshletSettings clamped = *settings;
+    clamped.coneWeight = std::clamp(clamped.coneWeight, 0.0f, 1.0f);
+    MCEMeshletBuildResult result {};
+    MeshletPartitioner partitioner(positions, vertexCount, indices, indexCount, clamped);
+    partitioner.Run(meshletsOut, meshletVerticesOut, meshletTrianglesOut, boundsOut, result);
+    result.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (resultOut) { *resultOut = result; }
+    return 1;
+}
+
+extern "C" int32_t MCEMeshletRunBenchmark(MCEMeshletBenchmarkResult *resultsOut, int32_t capacity) {
+    if (!resultsOut || capacity <= 0) { return 0; }
+    int32_t written = 0;
+    for (int32_t kind = 0; kind < kBenchmarkMeshCount && written < capacity; ++kind) {
+        resultsOut[written++] = MeasureCulling(MakeBenchmarkMesh(kind));
+    }
+    return written;
+}
+
+extern "C" const char *MCEMeshletBenchmarkMeshName(int32_t index) {
+    return index >= 0 && index < kBenchmarkMeshCount ? kBenchmarkMeshNames[index] : "unknown";
+}
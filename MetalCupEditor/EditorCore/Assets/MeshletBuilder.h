@@ -0,0 +1,94 @@
+/// MeshletBuilder.h
+/// Declares meshlet partitioning of index buffers and the per-meshlet bounds used for cluster culling.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MCE_MESHLET_MAX_VERTICES_LIMIT 255
+#define MCE_MESHLET_MAX_TRIANGLES_LIMIT 512
+
+typedef struct {
+    /// At most MCE_MESHLET_MAX_VERTICES_LIMIT, so local triangle indices fit in a byte.
+    uint32_t maxVertices;
+    uint32_t maxTriangles;
+    /// 0 groups triangles by proximity only; towards 1 it favours triangles facing the same way,
+    /// which narrows normal cones at the cost of rounder clusters.
+    float coneWeight;
+} MCEMeshletSettings;
+
+/// `vertexOffset` indexes the meshlet vertex array, whose entries are indices into the source
+/// vertex buffer. `triangleOffset` indexes the meshlet triangle array, three local bytes per triangle.
+typedef struct {
+    uint32_t vertexOffset;
+    uint32_t triangleOffset;
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+} MCEMeshlet;
+
+/// A meshlet is entirely back-facing for a camera at `eye` when
+/// `dot(normalize(coneApex - eye), coneAxis) >= coneCutoff`. Meshlets whose normals spread too far
+/// to ever pass have a zero axis and a cutoff of 1.
+typedef struct {
+    float center[3];
+    float radius;
+    float boundsMin[3];
+    float boundsMax[3];
+    float coneApex[3];
+    float coneAxis[3];
+    float coneCutoff;
+} MCEMeshletBounds;
+
+typedef struct {
+    uint32_t meshletCount;
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+    double milliseconds;
+} MCEMeshletBuildResult;
+
+/// Upper bound on the meshlets produced for `indexCount` indices; size the meshlet and bounds arrays
+/// with it, the vertex array with `bound * maxVertices` and the triangle array with
+/// `bound * maxTriangles * 3`.
+uint32_t MCEMeshletBuildBound(uint32_t indexCount, uint32_t maxVertices, uint32_t maxTriangles);
+
+/// Partitions a triangle list into meshlets, each a connected, spatially compact group where
+/// possible. Degenerate triangles are dropped. Returns 0 on invalid input or limits.
+uint32_t MCEMeshletBuild(const float *positions, uint32_t vertexCount,
+                         const uint32_t *indices, uint32_t indexCount,
+                         const MCEMeshletSettings *settings,
+                         MCEMeshlet *meshletsOut, uint32_t *meshletVerticesOut, uint8_t *meshletTrianglesOut,
+                         MCEMeshletBounds *boundsOut, MCEMeshletBuildResult *resultOut);
+
+typedef struct {
+    uint32_t triangleCount;
+    uint32_t meshletCount;
+    float averageVertices;
+    float averageTriangles;
+    /// Fractions of (triangle, view) pairs. "Ideal" is what per-triangle tests would reject.
+    float backfacingIdeal;
+    float coneCulled;
+    float outsideIdeal;
+    float sphereCulled;
+    float boxCulled;
+    /// Triangles a cone test rejected although they faced the camera; anything but 0 is a bug.
+    uint32_t coneViolations;
+    /// Largest meshlet built, for checking against the 64-vertex / 124-triangle limits.
+    uint32_t maxMeshletVertices;
+    uint32_t maxMeshletTriangles;
+    double buildMilliseconds;
+} MCEMeshletBenchmarkResult;
+
+/// Builds 64-vertex / 124-triangle meshlets for a set of generated meshes and measures cone and
+/// bounds culling against per-triangle tests from 64 surrounding views. Returns the number written.
+int32_t MCEMeshletRunBenchmark(MCEMeshletBenchmarkResult *resultsOut, int32_t capacity);
+const char *MCEMeshletBenchmarkMeshName(int32_t index);
+
+#ifdef __cplusplus
+}
+#endif
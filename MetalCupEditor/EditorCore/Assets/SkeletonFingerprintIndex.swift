@@ -0,0 +1,284 @@
+/// SkeletonFingerprintIndex.swift
+/// Defines the persistent skeleton fingerprint index used to match animation-only imports.
+/// Created by Kaden Cringle.
+
+import Foundation
+import MetalCupEngine
+
+/// One fingerprint per skeleton asset: the canonical joint-name set, hashed child -> parent edges
+/// and a MinHash sketch of the names. Matching an animation-only FBX scores these fingerprints
+/// instead of reloading and re-canonicalizing every skeleton in the project. Entries are keyed by
+/// the skeleton file's modification time and persisted under the project cache.
+final class SkeletonFingerprintIndex {
+    struct Fingerprint: Codable {
+        var sourcePath: String
+        var fileTime: TimeInterval
+        var jointNames: Set<String>
+        var edgeHashes: Set<UInt64>
+        var minHash: [UInt64]
+    }
+
+    /// The source side of a match: joints that carry animation tracks, canonicalized once.
+    struct Query {
+        fileprivate let entries: [(name: String, edgeHash: UInt64)]
+        fileprivate let minHash: [UInt64]
+
+        init?(source: MeshSkeletonScanInfo?, clipInfos: [MeshAnimationClipScanInfo]) {
+            guard let source else { return nil }
+            let trackedIndices = Set(clipInfos.flatMap { $0.tracks.map(\.jointIndex) })
+            var seen = Set<String>()
+            var entries: [(name: String, edgeHash: UInt64)] = []
+            for (index, joint) in source.joints.enumerated() where trackedIndices.contains(index) {
+                let name = SkeletonFingerprintIndex.canonicalJointName(joint.name)
+                guard !name.isEmpty, seen.insert(name).inserted else { continue }
+                let parent = joint.parentIndex >= 0 && joint.parentIndex < source.joints.count
+                    ? SkeletonFingerprintIndex.canonicalJointName(source.joints[joint.parentIndex].name)
+                    : ""
+                entries.append((name: name, edgeHash: SkeletonFingerprintIndex.edgeHash(child: name, parent: parent)))
+            }
+            guard !entries.isEmpty else { return nil }
+            self.entries = entries
+            self.minHash = SkeletonFingerprintIndex.sketch(of: seen)
+        }
+    }
+
+    struct Stats {
+        var entryCount: Int = 0
+        var skeletonsLoaded: Int = 0
+        var queries: Int = 0
+        var candidatesScored: Int = 0
+        var candidatesSkipped: Int = 0
+    }
+
+    private struct Document: Codable {
+        var version: Int
+        var entries: [String: Fingerprint]
+    }
+
+    private static let documentVersion = 1
+    private static let fileName = "SkeletonFingerprints.json"
+    private static let sketchSize = 64
+    /// z-score of the sketch's upper confidence bound. A candidate is skipped only when even that
+    /// bound is below the match threshold, which wrongly drops a true match well under 0.01% of the
+    /// time at 64 slots, however lopsided the joint counts are.
+    private static let prefilterConfidence: Float = 4
+    private static let minimumCoverage: Float = 0.8
+
+    private let lock = NSLock()
+    private var entries: [AssetHandle: Fingerprint] = [:]
+    private var documentURL: URL?
+    private var stats = Stats()
+
+    static func canonicalJointName(_ raw: String) -> String {
+        let trimmed = raw.trimmingCharacters(in: .whitespacesAndNewlines)
+        guard !trimmed.isEmpty else { return "" }
+        var normalized = trimmed.replacingOccurrences(of: "\\", with: "/")
+        if let lastPath = normalized.split(separator: "/").last {
+            normalized = String(lastPath)
+        }
+        if let lastNode = normalized.split(separator: "|").last {
+            normalized = String(lastNode)
+        }
+        if let namespaceSplit = normalized.split(separator: ":").last {
+            normalized = String(namespaceSplit)
+        }
+        return normalized.lowercased()
+    }
+
+    func load(cacheRoot: URL?) {
+        lock.lock()
+        defer { lock.unlock() }
+        entries.removeAll()
+        stats = Stats()
+        documentURL = cacheRoot?.appendingPathComponent(Self.fileName)
+        guard let documentURL,
+              let data = try? Data(contentsOf: documentURL),
+              let document = try? JSONDecoder().decode(Document.self, from: data),
+              document.version == Self.documentVersion else {
+            return
+        }
+        for (key, fingerprint) in document.entries {
+            guard let uuid = UUID(uuidString: key) else { continue }
+            entries[AssetHandle(rawValue: uuid)] = fingerprint
+        }
+        stats.entryCount = entries.count
+    }
+
+    /// Called when a skeleton is written so the next match does not have to read it back.
+    func record(skeleton: SkeletonAsset, handle: AssetHandle, sourcePath: String, fileURL: URL) {
+        let fingerprint = Self.fingerprint(of: skeleton, sourcePath: sourcePath, fileTime: Self.fileTime(fileURL))
+        lock.lock()
+        entries[handle] = fingerprint
+        stats.entryCount = entries.count
+        lock.unlock()
+        save()
+    }
+
+    /// Drops entries for removed skeletons and refingerprints those whose file changed on disk.
+    func sync(metadataSnapshot: [AssetMetadata], rootURL: URL) {
+        let skeletons = metadataSnapshot.filter { $0.type == .skeleton }
+        lock.lock()
+        let known = Set(skeletons.map(\.handle))
+        var changed = false
+        for handle in entries.keys where !known.contains(handle) {
+            entries.removeValue(forKey: handle)
+            changed = true
+        }
+        let stale = skeletons.compactMap { meta -> (AssetMetadata, URL, TimeInterval)? in
+            let url = rootURL.appendingPathComponent(meta.sourcePath).standardizedFileURL
+            let time = Self.fileTime(url)
+            if let entry = entries[meta.handle], entry.fileTime == time, entry.sourcePath == meta.sourcePath {
+                return nil
+            }
+            return (meta, url, time)
+        }
+        lock.unlock()
+
+        var loaded: [(AssetHandle, Fingerprint)] = []
+        for (meta, url, time) in stale {
+            guard let skeleton = SkeletonAssetSerializer.load(from: url, fallbackHandle: meta.handle) else { continue }
+            loaded.append((meta.handle, Self.fingerprint(of: skeleton, sourcePath: meta.sourcePath, fileTime: time)))
+        }
+
+        lock.lock()
+        for (handle, fingerprint) in loaded {
+            entries[handle] = fingerprint
+        }
+        stats.skeletonsLoaded += loaded.count
+        stats.entryCount = entries.count
+        changed = changed || !loaded.isEmpty
+        lock.unlock()
+        if changed {
+            save()
+        }
+    }
+
+    /// Compatibility scores for `handles`, with the same coverage and parent-agreement weighting the
+    /// importer has always used. Handles without a fingerprint or below 80% coverage are left out.
+    func scores(for query: Query, handles: [AssetHandle]) -> [(handle: AssetHandle, score: Float)] {
+        lock.lock()
+        defer { lock.unlock() }
+        stats.queries += 1
+        var results: [(handle: AssetHandle, score: Float)] = []
+        for handle in handles {
+            guard let candidate = entries[handle], !candidate.jointNames.isEmpty else { continue }
+            if Self.coverageUpperBound(query: query, candidate: candidate) < Self.minimumCoverage {
+                stats.candidatesSkipped += 1
+                continue
+            }
+            stats.candidatesScored += 1
+            var mappedCount = 0
+            var parentMatchedCount = 0
+            for entry in query.entries where candidate.jointNames.contains(entry.name) {
+                mappedCount += 1
+                if candidate.edgeHashes.contains(entry.edgeHash) {
+                    parentMatchedCount += 1
+                }
+            }
+            let coverage = Float(mappedCount) / Float(query.entries.count)
+            guard coverage >= Self.minimumCoverage else { continue }
+            let parentAgreement = mappedCount > 0 ? Float(parentMatchedCount) / Float(mappedCount) : 0
+            results.append((handle: handle, score: (coverage * 0.85) + (parentAgreement * 0.15)))
+        }
+        return results
+    }
+
+    func currentStats() -> Stats {
+        lock.lock()
+        defer { lock.unlock() }
+        return stats
+    }
+
+    private func save() {
+        lock.lock()
+        let url = documentURL
+        var document = Document(version: Self.documentVersion, entries: [:])
+        for (handle, fingerprint) in entries {
+            document.entries[handle.rawValue.uuidString] = fingerprint
+        }
+        lock.unlock()
+        guard let url, let data = try? JSONEncoder().encode(document) else { return }
+        try? FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+        try? data.write(to: url, options: [.atomic])
+    }
+
+    private static func fingerprint(of skeleton: SkeletonAsset, sourcePath: String, fileTime: TimeInterval) -> Fingerprint {
+        var names = Set<String>()
+        var edges = Set<UInt64>()
+        for joint in skeleton.joints {
+            let name = canonicalJointName(joint.name)
+            guard !name.isEmpty, names.insert(name).inserted else { continue }
+            let parent = joint.parentIndex >= 0 && joint.parentIndex < skeleton.joints.count
+                ? canonicalJointName(skeleton.joints[joint.parentIndex].name)
+                : ""
+            edges.insert(edgeHash(child: name, parent: parent))
+        }
+        return Fingerprint(sourcePath: sourcePath,
+                           fileTime: fileTime,
+                           jointNames: names,
+                           edgeHashes: edges,
+                           minHash: sketch(of: names))
+    }
+
+    /// Upper confidence bound of the Jaccard similarity from matching sketch slots (Wilson score
+    /// interval), converted to the share of the query's joints that the candidate could contain.
+    /// A candidate much larger than the query has a small true Jaccard even at full coverage, so
+    /// the point estimate alone would reject real matches.
+    private static func coverageUpperBound(query: Query, candidate: Fingerprint) -> Float {
+        guard query.minHash.count == candidate.minHash.count, !query.minHash.isEmpty else { return 1 }
+        let matches = zip(query.minHash, candidate.minHash).reduce(0) { $0 + ($1.0 == $1.1 ? 1 : 0) }
+        let slots = Float(query.minHash.count)
+        let estimate = Float(matches) / slots
+        let z2 = prefilterConfidence * prefilterConfidence
+        let spread = prefilterConfidence * (estimate * (1 - estimate) / slots + z2 / (4 * slots * slots)).squareRoot()
+        let jaccard = min(1, (estimate + z2 / (2 * slots) + spread) / (1 + z2 / slots))
+        let querySize = Float(query.entries.count)
+        let intersection = jaccard * (querySize + Float(candidate.jointNames.count)) / (1 + jaccard)
+        return intersection / querySize
+    }
+
+    private static func sketch(of names: Set<String>) -> [UInt64] {
+        var slots = [UInt64](repeating: stableHashMask, count: sketchSize)
+        for name in names {
+            let base = stableHash(name)
+            for slot in 0..<sketchSize {
+                let value = mix(base ^ (0x9E37_79B9_7F4A_7C15 &* UInt64(slot + 1))) & stableHashMask
+                if value < slots[slot] {
+                    slots[slot] = value
+                }
+            }
+        }
+        return slots
+    }
+
+    private static func edgeHash(child: String, parent: String) -> UInt64 {
+        stableHash(child + "\u{0}" + parent)
+    }
+
+    /// Hashes are persisted, so they cannot use the per-process seeded `Hasher`. They are kept to
+    /// 53 bits so JSON round-trips them exactly.
+    private static let stableHashMask: UInt64 = (1 << 53) - 1
+
+    private static func stableHash(_ text: String) -> UInt64 {
+        var hash: UInt64 = 0xCBF2_9CE4_8422_2325
+        for byte in text.utf8 {
+            hash = (hash ^ UInt64(byte)) &* 0x0000_0100_0000_01B3
+        }
+        return mix(hash) & stableHashMask
+    }
+
+    private static func mix(_ value: UInt64) -> UInt64 {
+        var x = value
+        x ^= x >> 33
+        x = x &* 0xFF51_AFD7_ED55_8CCD
+        x ^= x >> 33
+        x = x &* 0xC4CE_B9FE_1A85_EC53
+        x ^= x >> 33
+        return x
+    }
+
+    private static func fileTime(_ url: URL) -> TimeInterval {
+        let attributes = try? FileManager.default.attributesOfItem(atPath: url.path)
+        return (attributes?[.modificationDate] as? Date)?.timeIntervalSince1970 ?? 0
+    }
+}
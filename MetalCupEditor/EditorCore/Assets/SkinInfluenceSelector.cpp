@@ -0,0 +1,285 @@
+/// SkinInfluenceSelector.cpp
+/// Implements top-K skin influence selection, its coverage report and the synthetic-skin benchmark.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "SkinInfluenceSelector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kCoverageK[MCE_SKIN_COVERAGE_LEVELS] = { 1, 2, 4, 8 };
+
+struct Influence {
+    int32_t joint = 0;
+    float weight = 0.0f;
+};
+
+/// Strongest first; equal weights fall back to the joint index so the order never depends on the
+/// order clusters were authored in.
+bool StrongerFirst(const Influence &a, const Influence &b) {
+    if (a.weight != b.weight) { return a.weight > b.weight; }
+    return a.joint < b.joint;
+}
+
+bool ByJoint(const Influence &a, const Influence &b) {
+    return a.joint < b.joint;
+}
+
+/// Vertices carry a handful of influences, where insertion sort beats std::sort comfortably.
+template <typename Less>
+void InsertionSort(std::vector<Influence> &influences, Less less) {
+    for (size_t i = 1; i < influences.size(); ++i) {
+        const Influence value = influences[i];
+        size_t j = i;
+        for (; j > 0 && less(value, influences[j - 1]); --j) { influences[j] = influences[j - 1]; }
+        influences[j] = value;
+    }
+}
+
+bool IsValidK(uint32_t k) {
+    return k == 1 || k == 2 || k == 4 || k == 8;
+}
+
+class InfluenceSelector {
+public:
+    InfluenceSelector(const MCESkinInfluenceSource &source, const MCESkinInfluenceSettings &settings,
+                      MCESkinInfluenceCoverage &coverage)
+        : _source(source), _settings(settings), _coverage(coverage) {}
+
+    void SelectVertex(uint32_t vertex, uint16_t *joints, float *weights, uint32_t stride) {
+        std::fill(joints, joints + stride, static_cast<uint16_t>(0));
+        std::fill(weights, weights + stride, 0.0f);
+
+        float total = 0.0f;
+        float prunedWeight = 0.0f;
+        const uint32_t kept = Prepare(vertex, total, prunedWeight);
+        if (kept == 0) { return; }
+
+        ++_coverage.skinnedVertexCount;
+        _coverage.keptInfluences += kept;
+        _coverage.maxInfluences = std::max(_coverage.maxInfluences, kept);
+
+        // `_scratch` is strongest first, so the tail beyond K is exactly what K drops.
+        float tail = 0.0f;
+        uint32_t tailStart = kept;
+        for (int32_t level = MCE_SKIN_COVERAGE_LEVELS - 1; level >= 0; --level) {
+            const uint32_t k = kCoverageK[level];
+            for (; tailStart > k; --tailStart) { tail += _scratch[tailStart - 1].weight; }
+            if (kept <= k) { ++_coverage.coveredByK[level]; }
+            const float dropped = (tail + prunedWeight) / total;
+            _coverage.maxDroppedWeightByK[level] = std::max(_coverage.maxDroppedWeightByK[level], dropped);
+        }
+
+        const uint32_t count = std::min(kept, _settings.maxInfluences);
+        float keptSum = 0.0f;
+        for (uint32_t i = 0; i < count; ++i) { keptSum += _scratch[i].weight; }
+        const float scale = _settings.renormalize == MCESkinRenormalizeNone ? 1.0f : 1.0f / keptSum;
+        for (uint32_t i = 0; i < count; ++i) {
+            joints[i] = static_cast<uint16_t>(_scratch[i].joint);
+            weights[i] = _scratch[i].weight * scale;
+        }
+    }
+
+private:
+    /// Leaves the vertex's merged, thresholded influences in `_scratch`, strongest first, and
+    /// returns how many there are.
+    uint32_t Prepare(uint32_t vertex, float &total, float &prunedWeight) {
+        _scratch.clear();
+        const uint32_t begin = _source.offsets[vertex];
+        const uint32_t end = std::max(begin, _source.offsets[vertex + 1]);
+        for (uint32_t i = begin; i < end; ++i) {
+            const int32_t joint = _source.joints[i];
+            const float weight = _source.weights[i];
+            if (joint < 0 || joint > std::numeric_limits<uint16_t>::max() || !(weight > 0.0f) || !std::isfinite(weight)) {
+                continue;
+            }
+            _scratch.push_back({ joint, weight });
+        }
+        if (_scratch.empty()) { return 0; }
+
+        // Several skins or clusters may bind the same joint; they act as one influence.
+        InsertionSort(_scratch, ByJoint);
+        size_t merged = 0;
+        for (size_t i = 1; i < _scratch.size(); ++i) {
+            if (_scratch[i].joint == _scratch[merged].joint) {
+                _scratch[merged].weight += _scratch[i].weight;
+                ++_coverage.mergedInfluences;
+            } else {
+                _scratch[++merged] = _scratch[i];
+            }
+        }
+        _scratch.resize(merged + 1);
+        InsertionSort(_scratch, StrongerFirst);
+
+        total = 0.0f;
+        for (const Influence &influence : _scratch) { total += influence.weight; }
+        const float threshold = _settings.minWeight * total;
+        size_t keep = 1;
+        while (keep < _scratch.size() && _scratch[keep].weight >= threshold) { ++keep; }
+        for (size_t i = keep; i < _scratch.size(); ++i) { prunedWeight += _scratch[i].weight; }
+        _coverage.prunedInfluences += _scratch.size() - keep;
+        _scratch.resize(keep);
+        return static_cast<uint32_t>(keep);
+    }
+
+    const MCESkinInfluenceSource &_source;
+    const MCESkinInfluenceSettings &_settings;
+    MCESkinInfluenceCoverage &_coverage;
+    std::vector<Influence> _scratch;
+};
+
+// Benchmark ---------------------------------------------------------------------------------------
+
+constexpr const char *kBenchmarkSkinNames[] = { "rigid", "limb", "facial", "ties" };
+constexpr int32_t kBenchmarkSkinCount = static_cast<int32_t>(sizeof(kBenchmarkSkinNames) / sizeof(kBenchmarkSkinNames[0]));
+constexpr uint32_t kBenchmarkVertices = 1u << 16;
+constexpr uint32_t kBenchmarkJoints = 96;
+constexpr float kBenchmarkMinWeight = 0.01f;
+
+struct Random {
+    uint32_t state;
+    uint32_t NextUInt() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+    float NextFloat() { return static_cast<float>(NextUInt()) / static_cast<float>(1u << 24); }
+};
+
+struct BenchmarkSkin {
+    std::vector<uint32_t> offsets { 0 };
+    std::vector<int32_t> joints;
+    std::vector<float> weights;
+
+    void Add(int32_t joint, float weight) {
+        joints.push_back(joint);
+        weights.push_back(weight);
+    }
+    void EndVertex() { offsets.push_back(static_cast<uint32_t>(joints.size())); }
+};
+
+/// rigid: one joint per vertex. limb: a chain where each vertex blends the joints around its
+/// position with a Gaussian falloff, 2-5 influences. facial: 6-14 influences from overlapping
+/// regions with a long tail of tiny weights. ties: equal weights and joints bound twice.
+BenchmarkSkin MakeBenchmarkSkin(int32_t kind) {
+    BenchmarkSkin skin;
+    Random random { 0x5EEDu + static_cast<uint32_t>(kind) };
+    for (uint32_t vertex = 0; vertex < kBenchmarkVertices; ++vertex) {
+        switch (kind) {
+        case 0:
+            skin.Add(static_cast<int32_t>(random.NextUInt() % kBenchmarkJoints), 1.0f);
+            break;
+        case 1: {
+            const float position = random.NextFloat() * static_cast<float>(kBenchmarkJoints - 1);
+            const float spread = 0.35f + random.NextFloat() * 0.5f;
+            const int32_t nearest = static_cast<int32_t>(std::lround(position));
+            for (int32_t joint = std::max(0, nearest - 2); joint <= std::min<int32_t>(kBenchmarkJoints - 1, nearest + 2); ++joint) {
+                const float distance = (static_cast<float>(joint) - position) / spread;
+                const float weight = std::exp(-0.5f * distance * distance);
+                if (weight > 1.0e-3f) { skin.Add(joint, weight); }
+            }
+            break;
+        }
+        case 2: {
+            const uint32_t count = 6 + random.NextUInt() % 9;
+            float weight = 1.0f;
+            for (uint32_t i = 0; i < count; ++i) {
+                skin.Add(static_cast<int32_t>(random.NextUInt() % kBenchmarkJoints), weight * (0.5f + random.NextFloat()));
+                weight *= 0.45f;
+            }
+            break;
+        }
+        default: {
+            const uint32_t count = 4 + random.NextUInt() % 5;
+            const int32_t base = static_cast<int32_t>(random.NextUInt() % (kBenchmarkJoints - 8));
+            for (uint32_t i = 0; i < count; ++i) {
+                skin.Add(base + static_cast<int32_t>(i), 0.25f);
+            }
+            skin.Add(base, 0.25f);
+            break;
+        }
+        }
+        skin.EndVertex();
+    }
+    return skin;
+}
+
+MCESkinInfluenceBenchmarkResult MeasureSelection(const BenchmarkSkin &skin) {
+    MCESkinInfluenceBenchmarkResult result {};
+    result.vertexCount = static_cast<uint32_t>(skin.offsets.size() - 1);
+    result.sourceInfluences = skin.joints.size();
+    const MCESkinInfluenceSource source { skin.offsets.data(), skin.joints.data(), skin.weights.data(), result.vertexCount };
+    std::vector<uint16_t> joints(static_cast<size_t>(result.vertexCount) * MCE_SKIN_MAX_INFLUENCES);
+    std::vector<float> weights(joints.size());
+    for (int32_t level = 0; level < MCE_SKIN_COVERAGE_LEVELS; ++level) {
+        const MCESkinInfluenceSettings settings { kCoverageK[level], kBenchmarkMinWeight, MCESkinRenormalizeSum };
+        MCESkinInfluenceCoverage coverage {};
+        MCESkinSelectInfluences(&source, &settings, joints.data(), weights.data(), kCoverageK[level], &coverage);
+        result.selectMilliseconds[level] = coverage.milliseconds;
+        result.coverage = coverage;
+    }
+    return result;
+}
+
+} // namespace
+
+extern "C" MCESkinInfluenceSettings MCESkinInfluenceDefaultSettings(void) {
+    return MCESkinInfluenceSettings { 4, 0.0f, MCESkinRenormalizeSum };
+}
+
+extern "C" uint32_t MCESkinSelectInfluences(const MCESkinInfluenceSource *source, const MCESkinInfluenceSettings *settings,
+                                            uint16_t *jointsOut, float *weightsOut, uint32_t outStride,
+                                            MCESkinInfluenceCoverage *coverageOut) {
+    if (coverageOut) { *coverageOut = MCESkinInfluenceCoverage {}; }
+    if (!source || !settings || !jointsOut || !weightsOut || source->vertexCount == 0) { return 0; }
+    if (!source->offsets || (source->offsets[source->vertexCount] > 0 && (!source->joints || !source->weights))) { return 0; }
+    if (!IsValidK(settings->maxInfluences) || outStride < settings->maxInfluences) { return 0; }
+    if (!(settings->minWeight >= 0.0f && settings->minWeight < 1.0f)) { return 0; }
+    if (settings->renormalize != MCESkinRenormalizeSum && settings->renormalize != MCESkinRenormalizeNone) { return 0; }
+
+    const auto start = Clock::now();
+    MCESkinInfluenceCoverage coverage {};
+    coverage.vertexCount = source->vertexCount;
+    InfluenceSelector selector(*source, *settings, coverage);
+    for (uint32_t vertex = 0; vertex < source->vertexCount; ++vertex) {
+        const size_t offset = static_cast<size_t>(vertex) * outStride;
+        selector.SelectVertex(vertex, jointsOut + offset, weightsOut + offset, outStride);
+    }
+    coverage.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (coverageOut) { *coverageOut = coverage; }
+    return source->vertexCount;
+}
+
+extern "C" void MCESkinInfluenceCoverageMerge(MCESkinInfluenceCoverage *into, const MCESkinInfluenceCoverage *from) {
+    if (!into || !from) { return; }
+    into->vertexCount += from->vertexCount;
+    into->skinnedVertexCount += from->skinnedVertexCount;
+    for (int32_t level = 0; level < MCE_SKIN_COVERAGE_LEVELS; ++level) {
+        into->coveredByK[level] += from->coveredByK[level];
+        into->maxDroppedWeightByK[level] = std::max(into->maxDroppedWeightByK[level], from->maxDroppedWeightByK[level]);
+    }
+    into->maxInfluences = std::max(into->maxInfluences, from->maxInfluences);
+    into->keptInfluences += from->keptInfluences;
+    into->prunedInfluences += from->prunedInfluences;
+    into->mergedInfluences += from->mergedInfluences;
+    into->milliseconds += from->milliseconds;
+}
+
+extern "C" int32_t MCESkinInfluenceRunBenchmark(MCESkinInfluenceBenchmarkResult *resultsOut, int32_t capacity) {
+    if (!resultsOut || capacity <= 0) { return 0; }
+    int32_t written = 0;
+    for (int32_t kind = 0; kind < kBenchmarkSkinCount && written < capacity; ++kind) {
+        resultsOut[written++] = MeasureSelection(MakeBenchmarkSkin(kind));
+    }
+    return written;
+}
+
+extern "C" const char *MCESkinInfluenceBenchmarkSkinName(int32_t index) {
+    return index >= 0 && index < kBenchmarkSkinCount ? kBenchmarkSkinNames[index] : "unknown";
+}
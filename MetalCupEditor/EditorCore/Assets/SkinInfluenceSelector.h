@@ -0,0 +1,85 @@
+/// SkinInfluenceSelector.h
+/// Declares top-K skin influence selection with weight pruning, renormalization and a coverage report.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MCE_SKIN_MAX_INFLUENCES 8
+/// Coverage is reported for K = 1, 2, 4 and 8, in that order.
+#define MCE_SKIN_COVERAGE_LEVELS 4
+
+typedef enum {
+    /// Kept weights are divided by their sum.
+    MCESkinRenormalizeSum = 0,
+    /// Kept weights are written as authored; whatever was dropped is simply lost.
+    MCESkinRenormalizeNone = 1,
+} MCESkinRenormalizeMode;
+
+typedef struct {
+    /// 1, 2, 4 or 8.
+    uint32_t maxInfluences;
+    /// Influences below this share of the vertex's total weight are dropped. The strongest one is
+    /// always kept, so a vertex never loses its skinning to the threshold.
+    float minWeight;
+    uint32_t renormalize;
+} MCESkinInfluenceSettings;
+
+/// Four influences, no threshold, sum renormalization: what FBX import has always produced.
+MCESkinInfluenceSettings MCESkinInfluenceDefaultSettings(void);
+
+/// Influences of vertex `v` are entries [offsets[v], offsets[v + 1]) of `joints` / `weights`. A joint
+/// listed more than once has its weights summed; negative joints and non-positive weights are ignored.
+typedef struct {
+    const uint32_t *offsets;
+    const int32_t *joints;
+    const float *weights;
+    uint32_t vertexCount;
+} MCESkinInfluenceSource;
+
+typedef struct {
+    uint32_t vertexCount;
+    uint32_t skinnedVertexCount;
+    /// Skinned vertices whose influences, after the threshold, fit in K = 1, 2, 4, 8 without loss.
+    uint32_t coveredByK[MCE_SKIN_COVERAGE_LEVELS];
+    /// Largest share of one vertex's weight that K = 1, 2, 4, 8 would discard, threshold included.
+    float maxDroppedWeightByK[MCE_SKIN_COVERAGE_LEVELS];
+    uint32_t maxInfluences;
+    uint64_t keptInfluences;
+    uint64_t prunedInfluences;
+    uint64_t mergedInfluences;
+    double milliseconds;
+} MCESkinInfluenceCoverage;
+
+/// Writes `outStride` (>= maxInfluences) joint/weight slots per vertex, strongest first; ties go to
+/// the lower joint index. Unused slots and unskinned vertices are joint 0 with weight 0. Returns the
+/// vertex count, or 0 on invalid input. `coverageOut` may be NULL.
+uint32_t MCESkinSelectInfluences(const MCESkinInfluenceSource *source, const MCESkinInfluenceSettings *settings,
+                                 uint16_t *jointsOut, float *weightsOut, uint32_t outStride,
+                                 MCESkinInfluenceCoverage *coverageOut);
+
+/// Folds `from` into `into`, e.g. to report a whole scene from its meshes.
+void MCESkinInfluenceCoverageMerge(MCESkinInfluenceCoverage *into, const MCESkinInfluenceCoverage *from);
+
+typedef struct {
+    uint32_t vertexCount;
+    uint64_t sourceInfluences;
+    /// At a 1% threshold.
+    MCESkinInfluenceCoverage coverage;
+    /// Selection time for K = 1, 2, 4, 8.
+    double selectMilliseconds[MCE_SKIN_COVERAGE_LEVELS];
+} MCESkinInfluenceBenchmarkResult;
+
+/// Selects influences for a set of generated skins at every K. Returns the number written.
+int32_t MCESkinInfluenceRunBenchmark(MCESkinInfluenceBenchmarkResult *resultsOut, int32_t capacity);
+const char *MCESkinInfluenceBenchmarkSkinName(int32_t index);
+
+#ifdef __cplusplus
+}
+#endif
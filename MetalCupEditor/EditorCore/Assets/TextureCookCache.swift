@@ -0,0 +1,164 @@
+/// TextureCookCache.swift
+/// Defines the cooked-texture cache used by the texture importer.
+/// Created by Kaden Cringle.
+
+import CoreGraphics
+import Foundation
+import ImageIO
+
+/// Cooked payloads live under `<project cache>/CookedTextures/<sourceHash>-<settingsHash>.ktx`.
+/// The key covers the source bytes, every setting that affects the output, and the cooker version,
+/// so a hit never needs validation and stale entries are simply never looked up again.
+final class TextureCookCache {
+    struct Stats {
+        var hits: UInt64 = 0
+        var cooks: UInt64 = 0
+        var failures: UInt64 = 0
+        var bytesWritten: UInt64 = 0
+        var lastCookMs: Double = 0
+        var lastFormat: String = ""
+    }
+
+    enum Outcome {
+        case cached(key: String, format: String)
+        case cooked(key: String, format: String, mipCount: Int)
+        case failure(String)
+    }
+
+    static let directoryName = "CookedTextures"
+
+    private let lock = NSLock()
+    private var stats = Stats()
+
+    static func cookedURL(key: String, cacheRoot: URL) -> URL {
+        cacheRoot
+            .appendingPathComponent(directoryName, isDirectory: true)
+            .appendingPathComponent("\(key).ktx")
+    }
+
+    /// Normal maps keep two channels (Z is rebuilt in the shader), single masks keep one, packed
+    /// masks need independent channels, and color picks BC1/BC3 from its actual alpha.
+    static func format(forSemantic semantic: String, settings: ImportSettings) -> MCETextureCookFormat {
+        if settings.values["compression"]?.lowercased() == "none" {
+            return MCETextureCookFormatRGBA8
+        }
+        switch semantic.lowercased() {
+        case "normal":
+            return MCETextureCookFormatBC5
+        case "roughness", "metallic", "occlusion", "ao", "height":
+            return MCETextureCookFormatBC4
+        case "orm":
+            return MCETextureCookFormatBC7
+        default:
+            return MCETextureCookFormatColorAuto
+        }
+    }
+
+    func cook(sourceURL: URL, semantic: String, srgb: Bool, settings: ImportSettings, cacheRoot: URL) -> Outcome {
+        let start = CFAbsoluteTimeGetCurrent()
+        let format = Self.format(forSemantic: semantic, settings: settings)
+        let isNormal = semantic.lowercased() == "normal"
+        var cookSettings = MCETextureCookSettings(
+            format: Int32(format.rawValue),
+            srgb: srgb && !isNormal ? 1 : 0,
+            generateMips: settings.boolValue("mipmaps", default: true) ? 1 : 0,
+            normalMap: isNormal ? 1 : 0,
+            flipNormalY: isNormal && settings.boolValue("flipNormalY", default: false) ? 1 : 0,
+            premultipliedAlpha: 1
+        )
+
+        let sourceHash = sourceURL.withUnsafeFileSystemRepresentation { path in
+            path.map { MCETextureCookHashFile($0, 0) } ?? 0
+        }
+        guard sourceHash != 0 else { return record(.failure("Unable to read \(sourceURL.lastPathComponent)")) }
+        let descriptor = "v\(MCE_TEXTURE_COOKER_VERSION)|\(cookSettings.format)|srgb=\(cookSettings.srgb)"
+            + "|mips=\(cookSettings.generateMips)|normal=\(cookSettings.normalMap)|flipY=\(cookSettings.flipNormalY)"
+        let settingsHash = descriptor.utf8CString.withUnsafeBufferPointer { buffer in
+            MCETextureCookHashBytes(buffer.baseAddress, buffer.count - 1, 0)
+        }
+        let key = String(format: "%016llx-%016llx", sourceHash, settingsHash)
+        let outputURL = Self.cookedURL(key: key, cacheRoot: cacheRoot)
+
+        if FileManager.default.fileExists(atPath: outputURL.path) {
+            var info = MCETextureHeaderInfo()
+            let probed = outputURL.withUnsafeFileSystemRepresentation { path in
+                path.map { MCETextureProbeFile($0, &info) } ?? 0
+            }
+            if probed != 0 {
+                let cachedFormat = withUnsafeBytes(of: info.format) { raw in
+                    String(cString: raw.bindMemory(to: CChar.self).baseAddress!)
+                }
+                return record(.cached(key: key, format: cachedFormat))
+            }
+            try? FileManager.default.removeItem(at: outputURL)
+        }
+
+        guard let source = CGImageSourceCreateWithURL(sourceURL as CFURL, nil),
+              let image = CGImageSourceCreateImageAtIndex(source, 0, nil) else {
+            return record(.failure("Unable to decode \(sourceURL.lastPathComponent)"))
+        }
+        let width = image.width
+        let height = image.height
+        // Drawing in the image's own RGB space keeps authored values; masks and normals must not
+        // be color-matched.
+        let colorSpace = (image.colorSpace?.model == .rgb ? image.colorSpace : nil)
+            ?? CGColorSpace(name: CGColorSpace.sRGB)!
+        var texels = [UInt8](repeating: 0, count: width * height * 4)
+        let drawn = texels.withUnsafeMutableBytes { buffer -> Bool in
+            guard let context = CGContext(data: buffer.baseAddress,
+                                          width: width,
+                                          height: height,
+                                          bitsPerComponent: 8,
+                                          bytesPerRow: width * 4,
+                                          space: colorSpace,
+                                          bitmapInfo: CGImageAlphaInfo.premultipliedLast.rawValue) else {
+                return false
+            }
+            context.interpolationQuality = .none
+            context.draw(image, in: CGRect(x: 0, y: 0, width: width, height: height))
+            return true
+        }
+        guard drawn else { return record(.failure("Unable to create bitmap context")) }
+
+        do {
+            try FileManager.default.createDirectory(at: outputURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+        } catch {
+            return record(.failure("Unable to create cook cache: \(error.localizedDescription)"))
+        }
+        var result = MCETextureCookResult()
+        let ok = outputURL.withUnsafeFileSystemRepresentation { path -> UInt32 in
+            guard let path else { return 0 }
+            return MCETextureCookRGBA8(texels, UInt32(width), UInt32(height), &cookSettings, path, &result)
+        }
+        guard ok != 0 else { return record(.failure("Cook failed for \(sourceURL.lastPathComponent)")) }
+
+        lock.lock()
+        stats.bytesWritten += result.bytesWritten
+        stats.lastCookMs = (CFAbsoluteTimeGetCurrent() - start) * 1000.0
+        lock.unlock()
+        let cookedFormat = String(cString: MCETextureCookFormatName(result.format))
+        return record(.cooked(key: key, format: cookedFormat, mipCount: Int(result.mipCount)))
+    }
+
+    func currentStats() -> Stats {
+        lock.lock()
+        defer { lock.unlock() }
+        return stats
+    }
+
+    private func record(_ outcome: Outcome) -> Outcome {
+        lock.lock()
+        defer { lock.unlock() }
+        switch outcome {
+        case .cached(_, let format):
+            stats.hits += 1
+            stats.lastFormat = format
+        case .cooked(_, let format, _):
+            stats.cooks += 1
+            stats.lastFormat = format
+        case .failure:
+            stats.failures += 1
+        }
+        return outcome
+    }
+}
@@ -0,0 +1,598 @@
+/// TextureCooker.cpp
+/// Implements mip generation, BC block encoders and the KTX writer for cooked textures.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TextureCooker.h"
+#include "../Services/EditorJobs.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kBlockRowGrain = 4;
+constexpr uint32_t kTexelRowGrain = 16;
+
+/// Working-space texels: linear color, signed normal vectors, or raw mask values.
+struct Level {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<float> texels;
+};
+
+struct BlockTexels {
+    uint8_t rgba[16][4];
+};
+
+const std::array<float, 256> &SRGBDecodeTable() {
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> values {};
+        for (int i = 0; i < 256; ++i) {
+            const float c = static_cast<float>(i) / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+uint8_t ToUnorm8(float value) {
+    return static_cast<uint8_t>(std::lround(std::min(1.0f, std::max(0.0f, value)) * 255.0f));
+}
+
+uint8_t LinearToSRGB8(float linear) {
+    const float c = std::min(1.0f, std::max(0.0f, linear));
+    return ToUnorm8(c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+}
+
+void Normalize3(float *v) {
+    const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length > 1e-6f) {
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    } else {
+        v[0] = 0.0f;
+        v[1] = 0.0f;
+        v[2] = 1.0f;
+    }
+}
+
+Level BuildBaseLevel(const uint8_t *rgba, uint32_t width, uint32_t height, const MCETextureCookSettings &settings) {
+    Level level;
+    level.width = width;
+    level.height = height;
+    level.texels.resize(static_cast<size_t>(width) * height * 4);
+    const std::array<float, 256> &decode = SRGBDecodeTable();
+    EditorJobs::ParallelFor(height, kTexelRowGrain, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t y = begin; y < end; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+                const size_t index = (static_cast<size_t>(y) * width + x) * 4;
+                uint8_t texel[4] = { rgba[index], rgba[index + 1], rgba[index + 2], rgba[index + 3] };
+                if (settings.premultipliedAlpha && texel[3] > 0 && texel[3] < 255) {
+                    for (int c = 0; c < 3; ++c) {
+                        texel[c] = static_cast<uint8_t>(std::min(255, (texel[c] * 255 + texel[3] / 2) / texel[3]));
+                    }
+                }
+                float *out = &level.texels[index];
+                if (settings.normalMap) {
+                    for (int c = 0; c < 3; ++c) { out[c] = static_cast<float>(texel[c]) / 127.5f - 1.0f; }
+                    if (settings.flipNormalY) { out[1] = -out[1]; }
+                    Normalize3(out);
+                } else if (settings.srgb) {
+                    for (int c = 0; c < 3; ++c) { out[c] = decode[texel[c]]; }
+                } else {
+                    for (int c = 0; c < 3; ++c) { out[c] = static_cast<float>(texel[c]) / 255.0f; }
+                }
+                out[3] = static_cast<float>(texel[3]) / 255.0f;
+            }
+        }
+    });
+    return level;
+}
+
+/// 2x2 box filter in working space. Color is alpha-weighted so transparent texels do not bleed
+/// into their neighbours; normals are renormalized after averaging.
+Level Downsample(const Level &source, bool normalMap) {
+    Level level;
+    level.width = std::max(1u, source.width / 2);
+    level.height = std::max(1u, source.height / 2);
+    level.texels.resize(static_cast<size_t>(level.width) * level.height * 4);
+    EditorJobs::ParallelFor(level.height, kTexelRowGrain, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t y = begin; y < end; ++y) {
+            const uint32_t y0 = std::min(y * 2, source.height - 1);
+            const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+            for (uint32_t x = 0; x < level.width; ++x) {
+                const uint32_t x0 = std::min(x * 2, source.width - 1);
+                const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+                const float *taps[4] = {
+                    &source.texels[(static_cast<size_t>(y0) * source.width + x0) * 4],
+                    &source.texels[(static_cast<size_t>(y0) * source.width + x1) * 4],
+                    &source.texels[(static_cast<size_t>(y1) * source.width + x0) * 4],
+                    &source.texels[(static_cast<size_t>(y1) * source.width + x1) * 4],
+                };
+                float *out = &level.texels[(static_cast<size_t>(y) * level.width + x) * 4];
+                float alphaSum = 0.0f;
+                float weighted[3] = {};
+                float plain[3] = {};
+                for (const float *tap : taps) {
+                    alphaSum += tap[3];
+                    for (int c = 0; c < 3; ++c) {
+                        weighted[c] += tap[c] * tap[3];
+                        plain[c] += tap[c];
+                    }
+                }
+                for (int c = 0; c < 3; ++c) {
+                    out[c] = (!normalMap && alphaSum > 1e-4f) ? weighted[c] / alphaSum : plain[c] * 0.25f;
+                }
+                out[3] = alphaSum * 0.25f;
+                if (normalMap) { Normalize3(out); }
+            }
+        }
+    });
+    return level;
+}
+
+std::vector<uint8_t> EncodeLevel(const Level &level, const MCETextureCookSettings &settings) {
+    std::vector<uint8_t> rgba(level.texels.size());
+    for (size_t i = 0; i < level.texels.size(); i += 4) {
+        for (size_t c = 0; c < 3; ++c) {
+            const float value = level.texels[i + c];
+            if (settings.normalMap) {
+                rgba[i + c] = ToUnorm8(value * 0.5f + 0.5f);
+            } else {
+                rgba[i + c] = settings.srgb ? LinearToSRGB8(value) : ToUnorm8(value);
+            }
+        }
+        rgba[i + 3] = ToUnorm8(level.texels[i + 3]);
+    }
+    return rgba;
+}
+
+void LoadBlock(const uint8_t *rgba, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, BlockTexels &block) {
+    for (uint32_t row = 0; row < 4; ++row) {
+        const uint32_t y = std::min(blockY * 4 + row, height - 1);
+        for (uint32_t column = 0; column < 4; ++column) {
+            const uint32_t x = std::min(blockX * 4 + column, width - 1);
+            std::memcpy(block.rgba[row * 4 + column], &rgba[(static_cast<size_t>(y) * width + x) * 4], 4);
+        }
+    }
+}
+
+/// Endpoints of the block's principal axis over the first `channels` components.
+void PrincipalEndpoints(const BlockTexels &block, int channels, float low[4], float high[4]) {
+    float mean[4] = {};
+    for (const uint8_t *texel : block.rgba) {
+        for (int c = 0; c < channels; ++c) { mean[c] += texel[c]; }
+    }
+    for (int c = 0; c < channels; ++c) { mean[c] /= 16.0f; }
+
+    float covariance[4][4] = {};
+    float minimum[4] = { 255, 255, 255, 255 };
+    float maximum[4] = {};
+    for (const uint8_t *texel : block.rgba) {
+        float d[4];
+        for (int c = 0; c < channels; ++c) {
+            d[c] = texel[c] - mean[c];
+            minimum[c] = std::min(minimum[c], static_cast<float>(texel[c]));
+            maximum[c] = std::max(maximum[c], static_cast<float>(texel[c]));
+        }
+        for (int i = 0; i < channels; ++i) {
+            for (int j = 0; j < channels; ++j) { covariance[i][j] += d[i] * d[j]; }
+        }
+    }
+
+    float axis[4] = {};
+    for (int c = 0; c < channels; ++c) { axis[c] = maximum[c] - minimum[c]; }
+    for (int iteration = 0; iteration < 6; ++iteration) {
+        float next[4] = {};
+        for (int i = 0; i < channels; ++i) {
+            for (int j = 0; j < channels; ++j) { next[i] += covariance[i][j] * axis[j]; }
+        }
+        float length = 0.0f;
+        for (int c = 0; c < channels; ++c) { length += next[c] * next[c]; }
+        if (length < 1e-12f) { break; }
+        length = std::sqrt(length);
+        for (int c = 0; c < channels; ++c) { axis[c] = next[c] / length; }
+    }
+    float axisLength = 0.0f;
+    for (int c = 0; c < channels; ++c) { axisLength += axis[c] * axis[c]; }
+    if (axisLength < 1e-12f) {
+        for (int c = 0; c < channels; ++c) { low[c] = high[c] = mean[c]; }
+        return;
+    }
+    axisLength = std::sqrt(axisLength);
+    for (int c = 0; c < channels; ++c) { axis[c] /= axisLength; }
+
+    float tMin = 0.0f;
+    float tMax = 0.0f;
+    for (const uint8_t *texel : block.rgba) {
+        float t = 0.0f;
+        for (int c = 0; c < channels; ++c) { t += (texel[c] - mean[c]) * axis[c]; }
+        tMin = std::min(tMin, t);
+        tMax = std::max(tMax, t);
+    }
+    for (int c = 0; c < channels; ++c) {
+        low[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * tMin));
+        high[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * tMax));
+    }
+}
+
+int Distance(const uint8_t *a, const int *b, int channels) {
+    int total = 0;
+    for (int c = 0; c < channels; ++c) {
+        const int d = static_cast<int>(a[c]) - b[c];
+        total += d * d;
+    }
+    return total;
+}
+
+uint16_t Pack565(const float *color) {
+    const uint16_t r = static_cast<uint16_t>(std::lround(color[0] * 31.0f / 255.0f));
+    const uint16_t g = static_cast<uint16_t>(std::lround(color[1] * 63.0f / 255.0f));
+    const uint16_t b = static_cast<uint16_t>(std::lround(color[2] * 31.0f / 255.0f));
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void Unpack565(uint16_t packed, int *color) {
+    const int r = (packed >> 11) & 31;
+    const int g = (packed >> 5) & 63;
+    const int b = packed & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+void EncodeBC1(const BlockTexels &block, uint8_t *out) {
+    float low[4];
+    float high[4];
+    PrincipalEndpoints(block, 3, low, high);
+    uint16_t color0 = Pack565(high);
+    uint16_t color1 = Pack565(low);
+    if (color0 < color1) { std::swap(color0, color1); }
+
+    uint32_t indices = 0;
+    if (color0 != color1) {
+        int palette[4][3];
+        Unpack565(color0, palette[0]);
+        Unpack565(color1, palette[1]);
+        for (int c = 0; c < 3; ++c) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        for (int i = 0; i < 16; ++i) {
+            uint32_t best = 0;
+            int bestDistance = Distance(block.rgba[i], palette[0], 3);
+            for (uint32_t candidate = 1; candidate < 4; ++candidate) {
+                const int distance = Distance(block.rgba[i], palette[candidate], 3);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = candidate;
+                }
+            }
+            indices |= best << (2 * i);
+        }
+    }
+    out[0] = static_cast<uint8_t>(color0);
+    out[1] = static_cast<uint8_t>(color0 >> 8);
+    out[2] = static_cast<uint8_t>(color1);
+    out[3] = static_cast<uint8_t>(color1 >> 8);
+    for (int i = 0; i < 4; ++i) { out[4 + i] = static_cast<uint8_t>(indices >> (8 * i)); }
+}
+
+/// Eight-value mode only (first endpoint larger), which covers the full range of the block.
+void EncodeBC4(const BlockTexels &block, int channel, uint8_t *out) {
+    uint8_t low = 255;
+    uint8_t high = 0;
+    for (const uint8_t *texel : block.rgba) {
+        low = std::min(low, texel[channel]);
+        high = std::max(high, texel[channel]);
+    }
+    uint64_t bits = 0;
+    if (high > low) {
+        const float scale = 7.0f / static_cast<float>(high - low);
+        for (int i = 0; i < 16; ++i) {
+            const int step = static_cast<int>(std::lround((high - block.rgba[i][channel]) * scale));
+            const uint64_t index = step == 0 ? 0 : step == 7 ? 1 : static_cast<uint64_t>(step + 1);
+            bits |= index << (3 * i);
+        }
+    }
+    out[0] = high;
+    out[1] = low;
+    for (int i = 0; i < 6; ++i) { out[2 + i] = static_cast<uint8_t>(bits >> (8 * i)); }
+}
+
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t *out) : _out(out) { std::memset(_out, 0, 16); }
+    void Write(uint32_t value, uint32_t count) {
+        for (uint32_t i = 0; i < count; ++i, ++_position) {
+            if ((value >> i) & 1u) { _out[_position / 8] |= static_cast<uint8_t>(1u << (_position % 8)); }
+        }
+    }
+
+private:
+    uint8_t *_out;
+    uint32_t _position = 0;
+};
+
+/// BC7 mode 6: one subset, RGBA endpoints with per-endpoint p-bits and 4-bit indices. Keeps
+/// packed channels (ORM) independent, which BC1's shared 565 endpoints cannot.
+void EncodeBC7(const BlockTexels &block, uint8_t *out) {
+    static const int kWeights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+    float endpoints[2][4];
+    PrincipalEndpoints(block, 4, endpoints[0], endpoints[1]);
+
+    uint32_t quantized[2][4];
+    uint32_t pbits[2];
+    int reconstructed[2][4];
+    for (int e = 0; e < 2; ++e) {
+        float bestError = 1e30f;
+        for (uint32_t p = 0; p < 2; ++p) {
+            float error = 0.0f;
+            uint32_t candidate[4];
+            for (int c = 0; c < 4; ++c) {
+                const long q = std::lround((endpoints[e][c] - static_cast<float>(p)) * 0.5f);
+                candidate[c] = static_cast<uint32_t>(std::min(127L, std::max(0L, q)));
+                const float delta = static_cast<float>(candidate[c] * 2 + p) - endpoints[e][c];
+                error += delta * delta;
+            }
+            if (error < bestError) {
+                bestError = error;
+                pbits[e] = p;
+                std::memcpy(quantized[e], candidate, sizeof(candidate));
+            }
+        }
+        for (int c = 0; c < 4; ++c) { reconstructed[e][c] = static_cast<int>(quantized[e][c] * 2 + pbits[e]); }
+    }
+
+    int palette[16][4];
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            palette[i][c] = ((64 - kWeights[i]) * reconstructed[0][c] + kWeights[i] * reconstructed[1][c] + 32) >> 6;
+        }
+    }
+    uint32_t indices[16];
+    for (int i = 0; i < 16; ++i) {
+        uint32_t best = 0;
+        int bestDistance = Distance(block.rgba[i], palette[0], 4);
+        for (uint32_t candidate = 1; candidate < 16; ++candidate) {
+            const int distance = Distance(block.rgba[i], palette[candidate], 4);
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                best = candidate;
+            }
+        }
+        indices[i] = best;
+    }
+    // The anchor index is stored with its top bit implied zero.
+    if (indices[0] & 8u) {
+        std::swap(quantized[0], quantized[1]);
+        std::swap(pbits[0], pbits[1]);
+        for (uint32_t &index : indices) { index = 15u - index; }
+    }
+
+    BitWriter writer(out);
+    writer.Write(1u << 6, 7);
+    for (int c = 0; c < 4; ++c) {
+        writer.Write(quantized[0][c], 7);
+        writer.Write(quantized[1][c], 7);
+    }
+    writer.Write(pbits[0], 1);
+    writer.Write(pbits[1], 1);
+    writer.Write(indices[0], 3);
+    for (int i = 1; i < 16; ++i) { writer.Write(indices[i], 4); }
+}
+
+uint32_t BlockBytes(int32_t format) {
+    switch (format) {
+    case MCETextureCookFormatBC1:
+    case MCETextureCookFormatBC4:
+        return 8;
+    default:
+        return 16;
+    }
+}
+
+std::vector<uint8_t> CompressLevel(const std::vector<uint8_t> &rgba, uint32_t width, uint32_t height, int32_t format) {
+    if (format == MCETextureCookFormatRGBA8) { return rgba; }
+    const uint32_t blocksX = (width + 3) / 4;
+    const uint32_t blocksY = (height + 3) / 4;
+    const uint32_t blockBytes = BlockBytes(format);
+    std::vector<uint8_t> payload(static_cast<size_t>(blocksX) * blocksY * blockBytes);
+    EditorJobs::ParallelFor(blocksY, kBlockRowGrain, [&](uint32_t begin, uint32_t end) {
+        BlockTexels block;
+        for (uint32_t by = begin; by < end; ++by) {
+            for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                LoadBlock(rgba.data(), width, height, bx, by, block);
+                uint8_t *out = &payload[(static_cast<size_t>(by) * blocksX + bx) * blockBytes];
+                switch (format) {
+                case MCETextureCookFormatBC1: EncodeBC1(block, out); break;
+                case MCETextureCookFormatBC3: EncodeBC4(block, 3, out); EncodeBC1(block, out + 8); break;
+                case MCETextureCookFormatBC4: EncodeBC4(block, 0, out); break;
+                case MCETextureCookFormatBC5: EncodeBC4(block, 0, out); EncodeBC4(block, 1, out + 8); break;
+                case MCETextureCookFormatBC7: EncodeBC7(block, out); break;
+                default: break;
+                }
+            }
+        }
+    });
+    return payload;
+}
+
+struct KTXFormat {
+    uint32_t glType;
+    uint32_t glTypeSize;
+    uint32_t glFormat;
+    uint32_t glInternalFormat;
+    uint32_t glBaseInternalFormat;
+};
+
+KTXFormat KTXFormatFor(int32_t format, bool srgb) {
+    constexpr uint32_t kRed = 0x1903;
+    constexpr uint32_t kRG = 0x8227;
+    constexpr uint32_t kRGB = 0x1907;
+    constexpr uint32_t kRGBA = 0x1908;
+    switch (format) {
+    case MCETextureCookFormatBC1: return { 0, 1, 0, srgb ? 0x8C4Cu : 0x83F0u, kRGB };
+    case MCETextureCookFormatBC3: return { 0, 1, 0, srgb ? 0x8C4Fu : 0x83F3u, kRGBA };
+    case MCETextureCookFormatBC4: return { 0, 1, 0, 0x8DBBu, kRed };
+    case MCETextureCookFormatBC5: return { 0, 1, 0, 0x8DBDu, kRG };
+    case MCETextureCookFormatBC7: return { 0, 1, 0, srgb ? 0x8E8Du : 0x8E8Cu, kRGBA };
+    default: return { 0x1401, 1, kRGBA, srgb ? 0x8C43u : 0x8058u, kRGBA };
+    }
+}
+
+void AppendLE32(std::vector<uint8_t> &bytes, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) { bytes.push_back(static_cast<uint8_t>(value >> shift)); }
+}
+
+bool WriteKTX(const char *path, int32_t format, bool srgb, uint32_t width, uint32_t height,
+              const std::vector<std::vector<uint8_t>> &levels, uint64_t &bytesWritten) {
+    static const uint8_t kIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+    const KTXFormat ktx = KTXFormatFor(format, srgb);
+    std::vector<uint8_t> header(kIdentifier, kIdentifier + 12);
+    for (uint32_t value : { 0x04030201u, ktx.glType, ktx.glTypeSize, ktx.glFormat, ktx.glInternalFormat,
+                            ktx.glBaseInternalFormat, width, height, 0u, 0u, 1u,
+                            static_cast<uint32_t>(levels.size()), 0u }) {
+        AppendLE32(header, value);
+    }
+
+    const std::string temporaryPath = std::string(path) + ".tmp";
+    FILE *file = std::fopen(temporaryPath.c_str(), "wb");
+    if (!file) { return false; }
+    bool ok = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+    bytesWritten = header.size();
+    for (const std::vector<uint8_t> &level : levels) {
+        if (!ok) { break; }
+        std::vector<uint8_t> size;
+        AppendLE32(size, static_cast<uint32_t>(level.size()));
+        ok = std::fwrite(size.data(), 1, size.size(), file) == size.size()
+            && std::fwrite(level.data(), 1, level.size(), file) == level.size();
+        bytesWritten += size.size() + level.size();
+    }
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok || std::rename(temporaryPath.c_str(), path) != 0) {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+uint64_t Mix64(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+struct StreamHash {
+    uint64_t state;
+    uint64_t length = 0;
+
+    explicit StreamHash(uint64_t seed) : state(seed ^ 0x9E3779B97F4A7C15ull) {}
+
+    void Append(const uint8_t *bytes, size_t count) {
+        size_t offset = 0;
+        for (; offset + 8 <= count; offset += 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes + offset, 8);
+            state = (state ^ Mix64(word)) * 0x100000001B3ull + 0x52DCE729ull;
+        }
+        uint64_t tail = 0;
+        for (size_t i = 0; offset + i < count; ++i) { tail |= static_cast<uint64_t>(bytes[offset + i]) << (8 * i); }
+        state = (state ^ Mix64(tail ^ count)) * 0x100000001B3ull;
+        length += count;
+    }
+
+    uint64_t Finish() const { return Mix64(state ^ length); }
+};
+
+}
+
+extern "C" uint32_t MCETextureCookRGBA8(const uint8_t *rgba, uint32_t width, uint32_t height,
+                                        const MCETextureCookSettings *settings, const char *outputPath,
+                                        MCETextureCookResult *resultOut) {
+    if (!rgba || width == 0 || height == 0 || !settings || !outputPath) { return 0; }
+    MCETextureCookSettings resolved = *settings;
+    if (resolved.normalMap) { resolved.srgb = 0; }
+    if (resolved.format == MCETextureCookFormatColorAuto) {
+        bool opaque = true;
+        const size_t texelCount = static_cast<size_t>(width) * height;
+        for (size_t i = 0; i < texelCount && opaque; ++i) { opaque = rgba[i * 4 + 3] == 255; }
+        resolved.format = opaque ? MCETextureCookFormatBC1 : MCETextureCookFormatBC3;
+    }
+    if (resolved.format < MCETextureCookFormatRGBA8 || resolved.format > MCETextureCookFormatBC7) { return 0; }
+
+    const auto mipStart = Clock::now();
+    std::vector<Level> levels;
+    levels.push_back(BuildBaseLevel(rgba, width, height, resolved));
+    while (resolved.generateMips && (levels.back().width > 1 || levels.back().height > 1)) {
+        levels.push_back(Downsample(levels.back(), resolved.normalMap != 0));
+    }
+    const auto compressStart = Clock::now();
+
+    std::vector<std::vector<uint8_t>> payloads;
+    payloads.reserve(levels.size());
+    for (const Level &level : levels) {
+        payloads.push_back(CompressLevel(EncodeLevel(level, resolved), level.width, level.height, resolved.format));
+    }
+    const auto compressEnd = Clock::now();
+
+    uint64_t bytesWritten = 0;
+    if (!WriteKTX(outputPath, resolved.format, resolved.srgb != 0, width, height, payloads, bytesWritten)) { return 0; }
+    if (resultOut) {
+        resultOut->format = resolved.format;
+        resultOut->width = width;
+        resultOut->height = height;
+        resultOut->mipCount = static_cast<uint32_t>(levels.size());
+        resultOut->bytesWritten = bytesWritten;
+        resultOut->mipMilliseconds = std::chrono::duration<double, std::milli>(compressStart - mipStart).count();
+        resultOut->compressMilliseconds = std::chrono::duration<double, std::milli>(compressEnd - compressStart).count();
+    }
+    return 1;
+}
+
+extern "C" uint64_t MCETextureCookHashBytes(const void *bytes, size_t length, uint64_t seed) {
+    StreamHash hash(seed);
+    if (bytes && length > 0) { hash.Append(static_cast<const uint8_t *>(bytes), length); }
+    return hash.Finish();
+}
+
+extern "C" uint64_t MCETextureCookHashFile(const char *path, uint64_t seed) {
+    if (!path) { return 0; }
+    FILE *file = std::fopen(path, "rb");
+    if (!file) { return 0; }
+    StreamHash hash(seed);
+    std::vector<uint8_t> chunk(1 << 20);
+    size_t read = 0;
+    while ((read = std::fread(chunk.data(), 1, chunk.size(), file)) > 0) {
+        hash.Append(chunk.data(), read);
+    }
+    const bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+    return failed ? 0 : hash.Finish();
+}
+
+extern "C" const char *MCETextureCookFormatName(int32_t format) {
+    switch (format) {
+    case MCETextureCookFormatRGBA8: return "rgba8";
+    case MCETextureCookFormatBC1: return "bc1";
+    case MCETextureCookFormatBC3: return "bc3";
+    case MCETextureCookFormatBC4: return "bc4";
+    case MCETextureCookFormatBC5: return "bc5";
+    case MCETextureCookFormatBC7: return "bc7";
+    case MCETextureCookFormatColorAuto: return "auto";
+    default: return "unknown";
+    }
+}
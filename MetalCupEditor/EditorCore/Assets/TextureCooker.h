@@ -0,0 +1,62 @@
+/// TextureCooker.h
+/// Declares the CPU texture cook stage: mip generation, block compression and KTX output.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Bumped whenever cooked output changes for the same input; part of every cache key.
+#define MCE_TEXTURE_COOKER_VERSION 1
+
+typedef enum {
+    MCETextureCookFormatRGBA8 = 0,
+    MCETextureCookFormatBC1 = 1,
+    MCETextureCookFormatBC3 = 2,
+    MCETextureCookFormatBC4 = 3,
+    MCETextureCookFormatBC5 = 4,
+    MCETextureCookFormatBC7 = 5,
+    /// Resolves to BC1 when every texel is opaque, BC3 otherwise.
+    MCETextureCookFormatColorAuto = 6
+} MCETextureCookFormat;
+
+typedef struct {
+    int32_t format;
+    /// RGB is sRGB-encoded: mips are filtered in linear space and the output is tagged sRGB.
+    uint32_t srgb;
+    uint32_t generateMips;
+    /// Treat RGB as a tangent-space normal: renormalize every texel of every level.
+    uint32_t normalMap;
+    uint32_t flipNormalY;
+    /// Input RGB is premultiplied by alpha (CoreGraphics bitmap contexts).
+    uint32_t premultipliedAlpha;
+} MCETextureCookSettings;
+
+typedef struct {
+    int32_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t mipCount;
+    uint64_t bytesWritten;
+    double mipMilliseconds;
+    double compressMilliseconds;
+} MCETextureCookResult;
+
+/// Cooks tightly packed RGBA8 texels into a KTX file at `outputPath` (written atomically).
+/// Returns 0 on invalid input or I/O failure.
+uint32_t MCETextureCookRGBA8(const uint8_t *rgba, uint32_t width, uint32_t height,
+                             const MCETextureCookSettings *settings, const char *outputPath,
+                             MCETextureCookResult *resultOut);
+uint64_t MCETextureCookHashBytes(const void *bytes, size_t length, uint64_t seed);
+/// Hashes the file contents in chunks; returns 0 when the file cannot be read.
+uint64_t MCETextureCookHashFile(const char *path, uint64_t seed);
+const char *MCETextureCookFormatName(int32_t format);
+
+#ifdef __cplusplus
+}
+#endif
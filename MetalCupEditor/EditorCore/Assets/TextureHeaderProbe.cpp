@@ -0,0 +1,682 @@
+/// TextureHeaderProbe.cpp
+/// Implements portable header parsers for the texture containers the editor imports.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TextureHeaderProbe.h"
+
+namespace {
+
+constexpr size_t kMaxProbeBytes = 64 * 1024;
+// Well past any GPU texture limit; larger header dimensions are treated as corrupt.
+constexpr int64_t kMaxDimension = 1 << 16;
+
+struct ByteView {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+
+    bool Has(size_t offset, size_t count) const { return offset <= size && count <= size - offset; }
+    uint8_t U8(size_t offset) const { return data[offset]; }
+    uint16_t LE16(size_t offset) const { return static_cast<uint16_t>(data[offset] | (data[offset + 1] << 8)); }
+    uint16_t BE16(size_t offset) const { return static_cast<uint16_t>((data[offset] << 8) | data[offset + 1]); }
+    uint32_t LE32(size_t offset) const {
+        return static_cast<uint32_t>(data[offset]) | (static_cast<uint32_t>(data[offset + 1]) << 8)
+            | (static_cast<uint32_t>(data[offset + 2]) << 16) | (static_cast<uint32_t>(data[offset + 3]) << 24);
+    }
+    uint32_t BE32(size_t offset) const {
+        return (static_cast<uint32_t>(data[offset]) << 24) | (static_cast<uint32_t>(data[offset + 1]) << 16)
+            | (static_cast<uint32_t>(data[offset + 2]) << 8) | static_cast<uint32_t>(data[offset + 3]);
+    }
+    bool Matches(size_t offset, const char *text, size_t count) const {
+        return Has(offset, count) && std::memcmp(data + offset, text, count) == 0;
+    }
+};
+
+void Reset(MCETextureHeaderInfo &info, MCETextureContainer container) {
+    std::memset(&info, 0, sizeof(info));
+    info.container = container;
+    info.depth = 1;
+    info.mipCount = 1;
+    info.arraySize = 1;
+    info.faceCount = 1;
+}
+
+void SetFormat(MCETextureHeaderInfo &info, const char *format) {
+    std::snprintf(info.format, sizeof(info.format), "%s", format);
+}
+
+// Header dimensions are computed in 64 bits so a hostile header cannot overflow them.
+bool NarrowDimension(int64_t value, uint32_t &out) {
+    if (value <= 0 || value > kMaxDimension) { return false; }
+    out = static_cast<uint32_t>(value);
+    return true;
+}
+
+uint32_t FullMipCount(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size >>= 1) { ++levels; }
+    return levels;
+}
+
+// Block-compressed and packed formats shared by the KTX, KTX2 and DDS tables.
+struct FormatDescriptor {
+    uint32_t code;
+    const char *name;
+    uint32_t channels;
+    uint32_t bitDepth;
+    bool isFloat;
+    bool compressed;
+    MCETextureColorSpace colorSpace;
+};
+
+bool ApplyDescriptor(MCETextureHeaderInfo &info, const FormatDescriptor *table, size_t count, uint32_t code) {
+    for (size_t i = 0; i < count; ++i) {
+        if (table[i].code != code) { continue; }
+        SetFormat(info, table[i].name);
+        info.channelCount = table[i].channels;
+        info.bitDepth = table[i].bitDepth;
+        info.isFloat = table[i].isFloat ? 1 : 0;
+        info.isBlockCompressed = table[i].compressed ? 1 : 0;
+        info.colorSpace = table[i].colorSpace;
+        return true;
+    }
+    return false;
+}
+
+constexpr MCETextureColorSpace kSRGB = MCETextureColorSpaceSRGB;
+constexpr MCETextureColorSpace kLinear = MCETextureColorSpaceLinear;
+constexpr MCETextureColorSpace kAny = MCETextureColorSpaceUnknown;
+
+const FormatDescriptor kGLFormats[] = {
+    { 0x8058, "rgba8", 4, 8, false, false, kAny },
+    { 0x8C43, "rgba8", 4, 8, false, false, kSRGB },
+    { 0x8051, "rgb8", 3, 8, false, false, kAny },
+    { 0x8C41, "rgb8", 3, 8, false, false, kSRGB },
+    { 0x881A, "rgba16f", 4, 16, true, false, kLinear },
+    { 0x8814, "rgba32f", 4, 32, true, false, kLinear },
+    { 0x83F0, "bc1", 3, 8, false, true, kAny },
+    { 0x83F1, "bc1", 4, 8, false, true, kAny },
+    { 0x8C4C, "bc1", 3, 8, false, true, kSRGB },
+    { 0x8C4D, "bc1", 4, 8, false, true, kSRGB },
+    { 0x83F2, "bc2", 4, 8, false, true, kAny },
+    { 0x83F3, "bc3", 4, 8, false, true, kAny },
+    { 0x8C4F, "bc3", 4, 8, false, true, kSRGB },
+    { 0x8DBB, "bc4", 1, 8, false, true, kLinear },
+    { 0x8DBD, "bc5", 2, 8, false, true, kLinear },
+    { 0x8E8F, "bc6h", 3, 16, true, true, kLinear },
+    { 0x8E8C, "bc7", 4, 8, false, true, kAny },
+    { 0x8E8D, "bc7", 4, 8, false, true, kSRGB },
+};
+
+const FormatDescriptor kVkFormats[] = {
+    { 37, "rgba8", 4, 8, false, false, kLinear },
+    { 43, "rgba8", 4, 8, false, false, kSRGB },
+    { 9, "r8", 1, 8, false, false, kLinear },
+    { 16, "rg8", 2, 8, false, false, kLinear },
+    { 97, "rgba16f", 4, 16, true, false, kLinear },
+    { 109, "rgba32f", 4, 32, true, false, kLinear },
+    { 122, "rgb9e5", 3, 16, true, false, kLinear },
+    { 131, "bc1", 3, 8, false, true, kLinear },
+    { 132, "bc1", 3, 8, false, true, kSRGB },
+    { 133, "bc1", 4, 8, false, true, kLinear },
+    { 134, "bc1", 4, 8, false, true, kSRGB },
+    { 137, "bc3", 4, 8, false, true, kLinear },
+    { 138, "bc3", 4, 8, false, true, kSRGB },
+    { 139, "bc4", 1, 8, false, true, kLinear },
+    { 141, "bc5", 2, 8, false, true, kLinear },
+    { 143, "bc6h", 3, 16, true, true, kLinear },
+    { 145, "bc7", 4, 8, false, true, kLinear },
+    { 146, "bc7", 4, 8, false, true, kSRGB },
+};
+
+const FormatDescriptor kDXGIFormats[] = {
+    { 28, "rgba8", 4, 8, false, false, kLinear },
+    { 29, "rgba8", 4, 8, false, false, kSRGB },
+    { 87, "bgra8", 4, 8, false, false, kLinear },
+    { 91, "bgra8", 4, 8, false, false, kSRGB },
+    { 61, "r8", 1, 8, false, false, kLinear },
+    { 49, "rg8", 2, 8, false, false, kLinear },
+    { 10, "rgba16f", 4, 16, true, false, kLinear },
+    { 2, "rgba32f", 4, 32, true, false, kLinear },
+    { 67, "rgb9e5", 3, 16, true, false, kLinear },
+    { 71, "bc1", 4, 8, false, true, kLinear },
+    { 72, "bc1", 4, 8, false, true, kSRGB },
+    { 74, "bc2", 4, 8, false, true, kLinear },
+    { 75, "bc2", 4, 8, false, true, kSRGB },
+    { 77, "bc3", 4, 8, false, true, kLinear },
+    { 78, "bc3", 4, 8, false, true, kSRGB },
+    { 80, "bc4", 1, 8, false, true, kLinear },
+    { 83, "bc5", 2, 8, false, true, kLinear },
+    { 95, "bc6h", 3, 16, true, true, kLinear },
+    { 96, "bc6h", 3, 16, true, true, kLinear },
+    { 98, "bc7", 4, 8, false, true, kLinear },
+    { 99, "bc7", 4, 8, false, true, kSRGB },
+};
+
+bool ProbePNG(const ByteView &view, MCETextureHeaderInfo &info) {
+    static const uint8_t kSignature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    if (!view.Has(0, 33) || std::memcmp(view.data, kSignature, 8) != 0 || !view.Matches(12, "IHDR", 4)) { return false; }
+    Reset(info, MCETextureContainerPNG);
+    info.width = view.BE32(16);
+    info.height = view.BE32(20);
+    info.bitDepth = view.U8(24);
+    const uint8_t colorType = view.U8(25);
+    bool hasTransparency = false;
+
+    // Ancillary chunks before the first IDAT carry the color space and palette alpha.
+    size_t offset = 33;
+    while (view.Has(offset, 8)) {
+        const uint32_t length = view.BE32(offset);
+        if (view.Matches(offset + 4, "IDAT", 4) || view.Matches(offset + 4, "IEND", 4)) { break; }
+        if (view.Matches(offset + 4, "sRGB", 4) || view.Matches(offset + 4, "iCCP", 4)) {
+            info.colorSpace = MCETextureColorSpaceSRGB;
+        } else if (view.Matches(offset + 4, "gAMA", 4) && view.Has(offset + 8, 4)
+                   && info.colorSpace == MCETextureColorSpaceUnknown) {
+            const uint32_t gamma = view.BE32(offset + 8);
+            if (gamma == 100000) {
+                info.colorSpace = MCETextureColorSpaceLinear;
+            } else if (gamma >= 45000 && gamma <= 46000) {
+                info.colorSpace = MCETextureColorSpaceSRGB;
+            }
+        } else if (view.Matches(offset + 4, "tRNS", 4)) {
+            hasTransparency = true;
+        }
+        if (length > view.size) { break; }
+        offset += 12 + static_cast<size_t>(length);
+    }
+
+    switch (colorType) {
+    case 0: info.channelCount = hasTransparency ? 2 : 1; break;
+    case 2: info.channelCount = hasTransparency ? 4 : 3; break;
+    case 3: info.channelCount = hasTransparency ? 4 : 3; info.bitDepth = 8; break;
+    case 4: info.channelCount = 2; break;
+    case 6: info.channelCount = 4; break;
+    default: return false;
+    }
+    static const char *kNames[] = { "", "r", "rg", "rgb", "rgba" };
+    SetFormat(info, (std::string(kNames[info.channelCount]) + std::to_string(info.bitDepth)).c_str());
+    return info.width > 0 && info.height > 0;
+}
+
+bool ProbeJPEG(const ByteView &view, MCETextureHeaderInfo &info) {
+    if (!view.Has(0, 4) || view.U8(0) != 0xFF || view.U8(1) != 0xD8) { return false; }
+    size_t offset = 2;
+    while (view.Has(offset, 4)) {
+        if (view.U8(offset) != 0xFF) { return false; }
+        const uint8_t marker = view.U8(offset + 1);
+        if (marker == 0xFF) { offset += 1; continue; }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) { offset += 2; continue; }
+        if (marker == 0xD9 || marker == 0xDA) { return false; }
+        const uint16_t length = view.BE16(offset + 2);
+        const bool isFrame = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+        if (isFrame) {
+            if (!view.Has(offset + 4, 6)) { return false; }
+            Reset(info, MCETextureContainerJPEG);
+            info.bitDepth = view.U8(offset + 4);
+            info.height = view.BE16(offset + 5);
+            info.width = view.BE16(offset + 7);
+            info.channelCount = view.U8(offset + 9);
+            // Baseline JPEG (JFIF/EXIF) is sRGB unless tagged otherwise; CMYK is left unknown.
+            info.colorSpace = info.channelCount == 4 ? MCETextureColorSpaceUnknown : MCETextureColorSpaceSRGB;
+            SetFormat(info, info.channelCount == 1 ? "r8" : info.channelCount == 4 ? "cmyk8" : "rgb8");
+            return info.width > 0 && info.height > 0;
+        }
+        offset += 2 + static_cast<size_t>(length);
+    }
+    return false;
+}
+
+bool ProbeBMP(const ByteView &view, MCETextureHeaderInfo &info) {
+    if (!view.Has(0, 30) || !view.Matches(0, "BM", 2)) { return false; }
+    const uint32_t dibSize = view.LE32(14);
+    if (dibSize < 12) { return false; }
+    Reset(info, MCETextureContainerBMP);
+    uint32_t bitCount = 0;
+    if (dibSize == 12) {
+        info.width = view.LE16(18);
+        info.height = view.LE16(20);
+        bitCount = view.LE16(24);
+    } else {
+        // Negative height marks a top-down image; widths are never legitimately negative but are
+        // tolerated the same way.
+        const int64_t width = static_cast<int32_t>(view.LE32(18));
+        const int64_t height = static_cast<int32_t>(view.LE32(22));
+        if (!NarrowDimension(width < 0 ? -width : width, info.width)
+            || !NarrowDimension(height < 0 ? -height : height, info.height)) {
+            return false;
+        }
+        bitCount = view.LE16(28);
+    }
+    info.channelCount = bitCount == 32 ? 4 : 3;
+    info.bitDepth = 8;
+    info.colorSpace = MCETextureColorSpaceSRGB;
+    SetFormat(info, info.channelCount == 4 ? "rgba8" : "rgb8");
+    return info.width > 0 && info.height > 0;
+}
+
+bool ProbeHDR(const ByteView &view, MCETextureHeaderInfo &info) {
+    if (!view.Matches(0, "#?RADIANCE", 10) && !view.Matches(0, "#?RGBE", 6)) { return false; }
+    const char *text = reinterpret_cast<const char *>(view.data);
+    size_t offset = 0;
+    bool headerEnded = false;
+    while (offset < view.size) {
+        const void *newline = std::memchr(text + offset, '\n', view.size - offset);
+        if (!newline) { return false; }
+        const size_t end = static_cast<size_t>(static_cast<const char *>(newline) - text);
+        if (headerEnded) {
+            // Resolution line, e.g. "-Y 4096 +X 8192".
+            const std::string line(text + offset, end - offset);
+            char yAxis[3] = {};
+            char xAxis[3] = {};
+            unsigned height = 0;
+            unsigned width = 0;
+            if (std::sscanf(line.c_str(), "%2s %u %2s %u", yAxis, &height, xAxis, &width) != 4) { return false; }
+            if (yAxis[1] == 'X') { std::swap(width, height); }
+            Reset(info, MCETextureContainerHDR);
+            info.width = width;
+            info.height = height;
+            info.channelCount = 3;
+            info.bitDepth = 32;
+            info.isFloat = 1;
+            info.colorSpace = MCETextureColorSpaceLinear;
+            SetFormat(info, "rgbe");
+            return width > 0 && height > 0;
+        }
+        if (end == offset) { headerEnded = true; }
+        offset = end + 1;
+    }
+    return false;
+}
+
+bool ProbeEXR(const ByteView &view, MCETextureHeaderInfo &info) {
+    if (!view.Has(0, 8) || view.LE32(0) != 20000630u) { return false; }
+    Reset(info, MCETextureContainerEXR);
+    info.colorSpace = MCETextureColorSpaceLinear;
+    info.isFloat = 1;
+    const uint32_t version = view.LE32(4);
+    const bool tiled = (version & 0x200) != 0;
+    bool haveWindow = false;
+    uint32_t levelMode = 0;
+
+    // Attributes: name\0 type\0 int32 size, value; the header ends with an empty name.
+    size_t offset = 8;
+    while (view.Has(offset, 1) && view.U8(offset) != 0) {
+        const void *nameEnd = std::memchr(view.data + offset, 0, view.size - offset);
+        if (!nameEnd) { return false; }
+        const std::string name(reinterpret_cast<const char *>(view.data + offset));
+        offset = static_cast<size_t>(static_cast<const uint8_t *>(nameEnd) - view.data) + 1;
+        const void *typeEnd = offset < view.size ? std::memchr(view.data + offset, 0, view.size - offset) : nullptr;
+        if (!typeEnd) { return false; }
+        offset = static_cast<size_t>(static_cast<const uint8_t *>(typeEnd) - view.data) + 1;
+        if (!view.Has(offset, 4)) { return false; }
+        const uint32_t size = view.LE32(offset);
+        offset += 4;
+        if (!view.Has(offset, size)) { return false; }
+
+        if (name == "dataWindow" && size >= 16) {
+            const int64_t xMin = static_cast<int32_t>(view.LE32(offset));
+            const int64_t yMin = static_cast<int32_t>(view.LE32(offset + 4));
+            const int64_t xMax = static_cast<int32_t>(view.LE32(offset + 8));
+            const int64_t yMax = static_cast<int32_t>(view.LE32(offset + 12));
+            if (!NarrowDimension(xMax - xMin + 1, info.width) || !NarrowDimension(yMax - yMin + 1, info.height)) {
+                return false;
+            }
+            haveWindow = true;
+        } else if (name == "channels") {
+            size_t channel = offset;
+            const size_t end = offset + size;
+            while (channel < end && view.U8(channel) != 0) {
+                const void *channelNameEnd = std::memchr(view.data + channel, 0, end - channel);
+                if (!channelNameEnd) { break; }
+                channel = static_cast<size_t>(static_cast<const uint8_t *>(channelNameEnd) - view.data) + 1;
+                if (channel + 16 > end) { break; }
+                const uint32_t pixelType = view.LE32(channel);
+                info.bitDepth = std::max(info.bitDepth, pixelType == 1 ? 16u : 32u);
+                info.channelCount += 1;
+                channel += 16;
+            }
+        } else if (name == "tiles" && size >= 9) {
+            levelMode = view.U8(offset + 8) & 0x0F;
+        }
+        offset += size;
+    }
+    if (!haveWindow || info.channelCount == 0) { return false; }
+    if (tiled && levelMode == 1) {
+        info.mipCount = FullMipCount(info.width, info.height);
+    }
+    static const char *kNames[] = { "", "r", "rg", "rgb", "rgba" };
+    const uint32_t shown = std::min(info.channelCount, 4u);
+    SetFormat(info, (std::string(kNames[shown]) + (info.bitDepth == 16 ? "16f" : "32f")).c_str());
+    return info.width > 0 && info.height > 0;
+}
+
+bool ProbeKTX(const ByteView &view, MCETextureHeaderInfo &info) {
+    static const uint8_t kIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+    if (!view.Has(0, 64) || std::memcmp(view.data, kIdentifier, 12) != 0) { return false; }
+    const bool swapped = view.LE32(12) != 0x04030201u;
+    auto read = [&](size_t offset) { return swapped ? view.BE32(offset) : view.LE32(offset); };
+    Reset(info, MCETextureContainerKTX);
+    const uint32_t internalFormat = read(28);
+    info.width = read(36);
+    info.height = std::max(1u, read(40));
+    info.depth = std::max(1u, read(44));
+    info.arraySize = std::max(1u, read(48));
+    info.faceCount = std::max(1u, read(52));
+    const uint32_t mips = read(56);
+    info.mipCount = mips == 0 ? FullMipCount(info.width, info.height) : mips;
+    if (!ApplyDescriptor(info, kGLFormats, sizeof(kGLFormats) / sizeof(kGLFormats[0]), internalFormat)) {
+        char name[24];
+        std::snprintf(name, sizeof(name), "gl:0x%04X", internalFormat);
+        SetFormat(info, name);
+    }
+    return info.width > 0;
+}
+
+bool ProbeKTX2(const ByteView &view, MCETextureHeaderInfo &info) {
+    static const uint8_t kIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+    if (!view.Has(0, 48) || std::memcmp(view.data, kIdentifier, 12) != 0) { return false; }
+    Reset(info, MCETextureContainerKTX2);
+    const uint32_t vkFormat = view.LE32(12);
+    info.width = view.LE32(20);
+    info.height = std::max(1u, view.LE32(24));
+    info.depth = std::max(1u, view.LE32(28));
+    info.arraySize = std::max(1u, view.LE32(32));
+    info.faceCount = std::max(1u, view.LE32(36));
+    const uint32_t levels = view.LE32(40);
+    info.mipCount = levels == 0 ? FullMipCount(info.width, info.height) : levels;
+    if (vkFormat == 0) {
+        // Supercompressed (Basis) payloads carry their format in the data format descriptor.
+        SetFormat(info, "basis");
+        info.isBlockCompressed = 1;
+    } else if (!ApplyDescriptor(info, kVkFormats, sizeof(kVkFormats) / sizeof(kVkFormats[0]), vkFormat)) {
+        char name[24];
+        std::snprintf(name, sizeof(name), "vk:%u", vkFormat);
+        SetFormat(info, name);
+    }
+    return info.width > 0;
+}
+
+bool ProbeDDS(const ByteView &view, MCETextureHeaderInfo &info) {
+    if (!view.Has(0, 128) || !view.Matches(0, "DDS ", 4) || view.LE32(4) != 124) { return false; }
+    Reset(info, MCETextureContainerDDS);
+    info.height = view.LE32(12);
+    info.width = view.LE32(16);
+    info.depth = std::max(1u, view.LE32(24));
+    info.mipCount = std::max(1u, view.LE32(28));
+    const uint32_t pixelFlags = view.LE32(80);
+    const uint32_t caps2 = view.LE32(112);
+    if (caps2 & 0x200) { info.faceCount = 6; }
+
+    if ((pixelFlags & 0x4) != 0) {
+        if (view.Matches(84, "DX10", 4)) {
+            if (!view.Has(128, 20)) { return false; }
+            const uint32_t dxgiFormat = view.LE32(128);
+            if (view.LE32(136) & 0x4) { info.faceCount = 6; }
+            info.arraySize = std::max(1u, view.LE32(140));
+            if (!ApplyDescriptor(info, kDXGIFormats, sizeof(kDXGIFormats) / sizeof(kDXGIFormats[0]), dxgiFormat)) {
+                char name[24];
+                std::snprintf(name, sizeof(name), "dxgi:%u", dxgiFormat);
+                SetFormat(info, name);
+            }
+        } else {
+            struct FourCC { const char *code; const char *name; uint32_t channels; };
+            static const FourCC kFourCCs[] = {
+                { "DXT1", "bc1", 4 }, { "DXT3", "bc2", 4 }, { "DXT5", "bc3", 4 },
+                { "ATI1", "bc4", 1 }, { "BC4U", "bc4", 1 }, { "ATI2", "bc5", 2 }, { "BC5U", "bc5", 2 },
+            };
+            bool known = false;
+            for (const FourCC &entry : kFourCCs) {
+                if (!view.Matches(84, entry.code, 4)) { continue; }
+                SetFormat(info, entry.name);
+                info.channelCount = entry.channels;
+                info.bitDepth = 8;
+                info.isBlockCompressed = 1;
+                known = true;
+                break;
+            }
+            if (!known) {
+                char name[24];
+                std::snprintf(name, sizeof(name), "fourcc:%.4s", reinterpret_cast<const char *>(view.data + 84));
+                SetFormat(info, name);
+            }
+        }
+    } else {
+        const uint32_t bitCount = view.LE32(88);
+        const bool hasAlpha = (pixelFlags & 0x1) != 0 && view.LE32(104) != 0;
+        info.bitDepth = 8;
+        info.channelCount = bitCount >= 32 || hasAlpha ? 4 : bitCount == 24 ? 3 : bitCount == 16 ? 2 : 1;
+        static const char *kNames[] = { "", "r8", "rg8", "rgb8", "rgba8" };
+        SetFormat(info, kNames[info.channelCount]);
+    }
+    return info.width > 0 && info.height > 0;
+}
+
+// TGA has no magic number, so it is tried last and validated field by field.
+bool ProbeTGA(const ByteView &view, MCETextureHeaderInfo &info) {
+    if (!view.Has(0, 18)) { return false; }
+    const uint8_t colorMapType = view.U8(1);
+    const uint8_t imageType = view.U8(2);
+    const uint8_t pixelDepth = view.U8(16);
+    const uint8_t alphaBits = view.U8(17) & 0x0F;
+    const bool validType = imageType == 1 || imageType == 2 || imageType == 3
+        || imageType == 9 || imageType == 10 || imageType == 11;
+    const bool validDepth = pixelDepth == 8 || pixelDepth == 15 || pixelDepth == 16 || pixelDepth == 24 || pixelDepth == 32;
+    if (colorMapType > 1 || !validType || !validDepth) { return false; }
+    Reset(info, MCETextureContainerTGA);
+    info.width = view.LE16(12);
+    info.height = view.LE16(14);
+    info.bitDepth = 8;
+    if (imageType == 3 || imageType == 11) {
+        info.channelCount = 1;
+    } else if (imageType == 1 || imageType == 9) {
+        info.channelCount = view.U8(7) == 32 ? 4 : 3;
+    } else {
+        info.channelCount = pixelDepth == 32 || alphaBits > 0 ? 4 : 3;
+    }
+    info.colorSpace = MCETextureColorSpaceSRGB;
+    static const char *kNames[] = { "", "r8", "rg8", "rgb8", "rgba8" };
+    SetFormat(info, kNames[info.channelCount]);
+    return info.width > 0 && info.height > 0;
+}
+
+void AppendLE32(std::vector<uint8_t> &bytes, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) { bytes.push_back(static_cast<uint8_t>(value >> shift)); }
+}
+
+void AppendBE32(std::vector<uint8_t> &bytes, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) { bytes.push_back(static_cast<uint8_t>(value >> shift)); }
+}
+
+void AppendText(std::vector<uint8_t> &bytes, const char *text, bool terminate) {
+    bytes.insert(bytes.end(), text, text + std::strlen(text));
+    if (terminate) { bytes.push_back(0); }
+}
+
+/// Builds a minimal but well-formed header (plus some payload bytes) for each container.
+std::vector<uint8_t> MakeBenchmarkHeader(MCETextureContainer container, uint32_t size) {
+    std::vector<uint8_t> bytes;
+    switch (container) {
+    case MCETextureContainerPNG: {
+        const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+        bytes.assign(signature, signature + 8);
+        AppendBE32(bytes, 13);
+        AppendText(bytes, "IHDR", false);
+        AppendBE32(bytes, size);
+        AppendBE32(bytes, size);
+        bytes.insert(bytes.end(), { 8, 6, 0, 0, 0 });
+        AppendBE32(bytes, 0);
+        AppendBE32(bytes, 1);
+        AppendText(bytes, "sRGB", false);
+        bytes.push_back(0);
+        AppendBE32(bytes, 0);
+        AppendBE32(bytes, 0);
+        AppendText(bytes, "IDAT", false);
+        break;
+    }
+    case MCETextureContainerJPEG: {
+        bytes = { 0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10 };
+        AppendText(bytes, "JFIF", true);
+        bytes.insert(bytes.end(), { 1, 1, 0, 0, 1, 0, 1, 0, 0 });
+        bytes.insert(bytes.end(), { 0xFF, 0xC0, 0x00, 0x11, 8,
+                                    static_cast<uint8_t>(size >> 8), static_cast<uint8_t>(size),
+                                    static_cast<uint8_t>(size >> 8), static_cast<uint8_t>(size), 3 });
+        break;
+    }
+    case MCETextureContainerTGA:
+        bytes = { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                  static_cast<uint8_t>(size), static_cast<uint8_t>(size >> 8),
+                  static_cast<uint8_t>(size), static_cast<uint8_t>(size >> 8), 32, 8 };
+        break;
+    case MCETextureContainerBMP:
+        bytes = { 'B', 'M' };
+        AppendLE32(bytes, 0);
+        AppendLE32(bytes, 0);
+        AppendLE32(bytes, 54);
+        AppendLE32(bytes, 40);
+        AppendLE32(bytes, size);
+        AppendLE32(bytes, size);
+        bytes.insert(bytes.end(), { 1, 0, 32, 0 });
+        break;
+    case MCETextureContainerHDR: {
+        const std::string text = "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\nEXPOSURE=1.0\n\n-Y "
+            + std::to_string(size / 2) + " +X " + std::to_string(size) + "\n";
+        AppendText(bytes, text.c_str(), false);
+        break;
+    }
+    case MCETextureContainerEXR: {
+        AppendLE32(bytes, 20000630u);
+        AppendLE32(bytes, 2);
+        AppendText(bytes, "channels", true);
+        AppendText(bytes, "chlist", true);
+        AppendLE32(bytes, 4 * 18 + 1);
+        for (const char *channel : { "A", "B", "G", "R" }) {
+            AppendText(bytes, channel, true);
+            AppendLE32(bytes, 1);
+            AppendLE32(bytes, 0);
+            AppendLE32(bytes, 1);
+            AppendLE32(bytes, 1);
+        }
+        bytes.push_back(0);
+        AppendText(bytes, "compression", true);
+        AppendText(bytes, "compression", true);
+        AppendLE32(bytes, 1);
+        bytes.push_back(3);
+        AppendText(bytes, "dataWindow", true);
+        AppendText(bytes, "box2i", true);
+        AppendLE32(bytes, 16);
+        AppendLE32(bytes, 0);
+        AppendLE32(bytes, 0);
+        AppendLE32(bytes, size - 1);
+        AppendLE32(bytes, size / 2 - 1);
+        bytes.push_back(0);
+        break;
+    }
+    case MCETextureContainerKTX: {
+        const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+        bytes.assign(identifier, identifier + 12);
+        for (uint32_t value : { 0x04030201u, 0u, 1u, 0u, 0x8E8Du, 0x1908u, size, size, 0u, 0u, 1u, 0u, 0u }) {
+            AppendLE32(bytes, value);
+        }
+        break;
+    }
+    case MCETextureContainerKTX2: {
+        const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+        bytes.assign(identifier, identifier + 12);
+        for (uint32_t value : { 146u, 1u, size, size, 0u, 0u, 1u, 14u, 0u }) {
+            AppendLE32(bytes, value);
+        }
+        break;
+    }
+    case MCETextureContainerDDS: {
+        AppendText(bytes, "DDS ", false);
+        bytes.resize(128, 0);
+        std::vector<uint8_t> fields;
+        AppendLE32(fields, 124);
+        AppendLE32(fields, 0x000A1007);
+        AppendLE32(fields, size);
+        AppendLE32(fields, size);
+        std::copy(fields.begin(), fields.end(), bytes.begin() + 4);
+        bytes[28] = 14;
+        bytes[76] = 32;
+        bytes[80] = 0x4;
+        std::memcpy(bytes.data() + 84, "DX10", 4);
+        AppendLE32(bytes, 98);
+        AppendLE32(bytes, 3);
+        AppendLE32(bytes, 0);
+        AppendLE32(bytes, 1);
+        AppendLE32(bytes, 0);
+        break;
+    }
+    default:
+        break;
+    }
+    // Stand-in payload so probes see realistic buffer sizes.
+    bytes.resize(bytes.size() + 4096, 0x5A);
+    return bytes;
+}
+
+}
+
+extern "C" uint32_t MCETextureProbeHeader(const uint8_t *bytes, size_t length, MCETextureHeaderInfo *infoOut) {
+    if (!bytes || !infoOut) { return 0; }
+    const ByteView view { bytes, length };
+    MCETextureHeaderInfo info {};
+    const bool ok = ProbePNG(view, info) || ProbeJPEG(view, info) || ProbeKTX2(view, info) || ProbeKTX(view, info)
+        || ProbeDDS(view, info) || ProbeEXR(view, info) || ProbeHDR(view, info) || ProbeBMP(view, info)
+        || ProbeTGA(view, info);
+    if (!ok) { return 0; }
+    *infoOut = info;
+    return 1;
+}
+
+extern "C" uint32_t MCETextureProbeFile(const char *path, MCETextureHeaderInfo *infoOut) {
+    if (!path || !infoOut) { return 0; }
+    FILE *file = std::fopen(path, "rb");
+    if (!file) { return 0; }
+    std::vector<uint8_t> buffer(kMaxProbeBytes);
+    const size_t read = std::fread(buffer.data(), 1, buffer.size(), file);
+    std::fclose(file);
+    return MCETextureProbeHeader(buffer.data(), read, infoOut);
+}
+
+extern "C" const char *MCETextureContainerName(int32_t container) {
+    static const char *kNames[] = { "Unknown", "PNG", "JPEG", "TGA", "BMP", "HDR", "EXR", "KTX", "KTX2", "DDS" };
+    if (container < 0 || container >= MCETextureContainerCount) { return kNames[0]; }
+    return kNames[container];
+}
+
+extern "C" const char *MCETextureInternalPixelFormatName(uint32_t srgb, uint32_t bitDepth, uint32_t channelCount) {
+    // Metal has no three-channel formats, so RGB sources are expanded to RGBA.
+    if (bitDepth > 8) {
+        return channelCount >= 3 ? "rgba16Float" : "r16Float";
+    }
+    if (channelCount >= 3) { return srgb ? "rgba8Unorm_srgb" : "rgba8Unorm"; }
+    if (channelCount == 2) { return "rg8Unorm"; }
+    return "r8Unorm";
+}
+
+extern "C" int32_t MCETextureProbeRunBenchmark(uint32_t iterations, int32_t *containersOut, double *nanosecondsOut, int32_t capacity) {
+    if (!containersOut || !nanosecondsOut || capacity <= 0) { return 0; }
+    iterations = std::max(1u, iterations);
+    int32_t written = 0;
+    for (int32_t container = MCETextureContainerPNG; container < MCETextureContainerCount && written < capacity; ++container) {
+        const std::vector<uint8_t> bytes = MakeBenchmarkHeader(static_cast<MCETextureContainer>(container), 8192);
+        MCETextureHeaderInfo info {};
+        uint32_t hits = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; ++i) {
+            hits += MCETextureProbeHeader(bytes.data(), bytes.size(), &info);
+        }
+        const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        containersOut[written] = hits == iterations && info.container == container ? container : -container;
+        nanosecondsOut[written] = elapsed / static_cast<double>(iterations);
+        written += 1;
+    }
+    return written;
+}
@@ -0,0 +1,67 @@
+/// TextureHeaderProbe.h
+/// Declares the header-only texture probe used by the texture importer.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    MCETextureContainerUnknown = 0,
+    MCETextureContainerPNG = 1,
+    MCETextureContainerJPEG = 2,
+    MCETextureContainerTGA = 3,
+    MCETextureContainerBMP = 4,
+    MCETextureContainerHDR = 5,
+    MCETextureContainerEXR = 6,
+    MCETextureContainerKTX = 7,
+    MCETextureContainerKTX2 = 8,
+    MCETextureContainerDDS = 9,
+    MCETextureContainerCount = 10
+} MCETextureContainer;
+
+typedef enum {
+    MCETextureColorSpaceUnknown = 0,
+    MCETextureColorSpaceSRGB = 1,
+    MCETextureColorSpaceLinear = 2
+} MCETextureColorSpace;
+
+typedef struct {
+    int32_t container;
+    int32_t colorSpace;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+    uint32_t mipCount;
+    uint32_t arraySize;
+    uint32_t faceCount;
+    uint32_t channelCount;
+    /// Bits per channel; 16/32 for half/float sources.
+    uint32_t bitDepth;
+    uint32_t isFloat;
+    uint32_t isBlockCompressed;
+    /// Short pixel format name, e.g. "rgba8", "bc7", "rgbe".
+    char format[24];
+} MCETextureHeaderInfo;
+
+/// Parses the container header in `bytes`. Never decodes pixel data. Returns 0 for unknown or
+/// truncated headers.
+uint32_t MCETextureProbeHeader(const uint8_t *bytes, size_t length, MCETextureHeaderInfo *infoOut);
+/// Reads at most the first 64 KB of `path` and probes it.
+uint32_t MCETextureProbeFile(const char *path, MCETextureHeaderInfo *infoOut);
+const char *MCETextureContainerName(int32_t container);
+/// Metal internal pixel format name for an uncompressed source; RGB sources map to RGBA formats.
+const char *MCETextureInternalPixelFormatName(uint32_t srgb, uint32_t bitDepth, uint32_t channelCount);
+
+/// Probes a generated corpus (one header per container, 8K dimensions) `iterations` times.
+/// Writes the container and mean nanoseconds per probe for each; returns the number written.
+int32_t MCETextureProbeRunBenchmark(uint32_t iterations, int32_t *containersOut, double *nanosecondsOut, int32_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
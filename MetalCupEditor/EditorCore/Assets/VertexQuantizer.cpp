@@ -0,0 +1,423 @@
+/// VertexQuantizer.cpp
+/// Implements AABB-relative positions, octahedral directions, half UVs and sum-preserving weights.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include "VertexQuantizer.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float kRadiansToDegrees = 57.2957795f;
+
+uint32_t Align(uint32_t offset, uint32_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+template <typename T>
+void Write(uint8_t *base, uint32_t offset, T value) {
+    std::memcpy(base + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T Read(const uint8_t *base, uint32_t offset) {
+    T value;
+    std::memcpy(&value, base + offset, sizeof(T));
+    return value;
+}
+
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t magnitude = bits & 0x7FFFFFFFu;
+    if (magnitude >= 0x7F800000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+    }
+    if (magnitude >= 0x477FF000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (magnitude < 0x38800000u) {
+        // Subnormal half: shift the implicit-one mantissa into place, rounding to nearest even.
+        if (magnitude < 0x33000000u) { return static_cast<uint16_t>(sign); }
+        const uint32_t exponent = magnitude >> 23;
+        const uint32_t mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+        const uint32_t shift = 126u - exponent;
+        uint32_t half = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u))) { half += 1u; }
+        return static_cast<uint16_t>(sign | half);
+    }
+    uint32_t half = (magnitude - 0x38000000u) >> 13;
+    const uint32_t remainder = magnitude & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) { half += 1u; }
+    return static_cast<uint16_t>(sign | half);
+}
+
+float HalfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits;
+    if (exponent == 0) {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    }
+    if (exponent == 31) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float SignNotZero(float value) { return value < 0.0f ? -1.0f : 1.0f; }
+
+void OctDecode(float u, float v, float *out) {
+    float x = u;
+    float y = v;
+    const float z = 1.0f - std::fabs(u) - std::fabs(v);
+    if (z < 0.0f) {
+        x = (1.0f - std::fabs(v)) * SignNotZero(u);
+        y = (1.0f - std::fabs(u)) * SignNotZero(v);
+    }
+    const float length = std::sqrt(x * x + y * y + z * z);
+    out[0] = x / length;
+    out[1] = y / length;
+    out[2] = z / length;
+}
+
+float Dot3(const float *a, const float *b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+/// Octahedral snorm pair. Of the four neighbouring lattice points the one decoding closest to the
+/// source direction wins, which roughly halves the worst-case error of plain rounding.
+void OctEncode(const float *direction, uint32_t bits, int32_t &qu, int32_t &qv) {
+    const float maxValue = static_cast<float>((1 << (bits - 1)) - 1);
+    float n[3] = { direction[0], direction[1], direction[2] };
+    const float length = std::sqrt(Dot3(n, n));
+    if (length <= 0.0f) {
+        qu = 0;
+        qv = 0;
+        return;
+    }
+    for (float &component : n) { component /= length; }
+    const float l1 = std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]);
+    float u = n[0] / l1;
+    float v = n[1] / l1;
+    if (n[2] < 0.0f) {
+        const float foldedU = (1.0f - std::fabs(v)) * SignNotZero(u);
+        const float foldedV = (1.0f - std::fabs(u)) * SignNotZero(v);
+        u = foldedU;
+        v = foldedV;
+    }
+    const float fu = std::floor(u * maxValue);
+    const float fv = std::floor(v * maxValue);
+    float bestDot = -2.0f;
+    for (int i = 0; i < 4; ++i) {
+        const float cu = std::clamp(fu + static_cast<float>(i & 1), -maxValue, maxValue);
+        const float cv = std::clamp(fv + static_cast<float>(i >> 1), -maxValue, maxValue);
+        float decoded[3];
+        OctDecode(cu / maxValue, cv / maxValue, decoded);
+        const float dot = Dot3(decoded, n);
+        if (dot > bestDot) {
+            bestDot = dot;
+            qu = static_cast<int32_t>(cu);
+            qv = static_cast<int32_t>(cv);
+        }
+    }
+}
+
+/// Largest-remainder rounding to 1/255 steps so the stored weights sum to exactly 255; ties go
+/// to the lower influence slot.
+void QuantizeWeights(const float *weights, uint8_t *out) {
+    float normalized[4];
+    float sum = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        normalized[i] = std::max(0.0f, weights[i]);
+        sum += normalized[i];
+    }
+    if (sum <= 0.0f) {
+        out[0] = 255;
+        out[1] = out[2] = out[3] = 0;
+        return;
+    }
+    int32_t total = 0;
+    float remainders[4];
+    for (int i = 0; i < 4; ++i) {
+        const float scaled = normalized[i] / sum * 255.0f;
+        const int32_t base = static_cast<int32_t>(std::floor(scaled));
+        out[i] = static_cast<uint8_t>(base);
+        remainders[i] = scaled - static_cast<float>(base);
+        total += base;
+    }
+    for (int32_t missing = 255 - total; missing > 0; --missing) {
+        int best = 0;
+        for (int i = 1; i < 4; ++i) {
+            if (remainders[i] > remainders[best]) { best = i; }
+        }
+        out[best] = static_cast<uint8_t>(out[best] + 1);
+        remainders[best] = -1.0f;
+    }
+}
+
+bool ValidSettings(const MCEVertexQuantizeSettings &settings) {
+    const bool positionOK = settings.positionBits == 0 || (settings.positionBits >= 8 && settings.positionBits <= 16);
+    auto directionOK = [](uint32_t bits) { return bits == 0 || bits == 8 || bits == 16; };
+    return positionOK && directionOK(settings.normalBits) && directionOK(settings.tangentBits)
+        && (settings.weightBits == 0 || settings.weightBits == 8);
+}
+
+void ComputeLayout(const MCEVertexStreams &streams, const MCEVertexQuantizeSettings &settings,
+                   MCEVertexQuantizedLayout &layout) {
+    layout = {};
+    layout.encoding = settings;
+    uint32_t offset = 0;
+    auto place = [&offset](uint32_t size, uint32_t alignment) {
+        offset = Align(offset, alignment);
+        const uint32_t placed = offset;
+        offset += size;
+        return placed;
+    };
+    auto directionSize = [](uint32_t bits) { return bits == 0 ? 12u : (bits == 16 ? 4u : 2u); };
+    auto directionAlignment = [](uint32_t bits) { return bits == 0 ? 4u : (bits == 16 ? 2u : 1u); };
+
+    layout.attributes |= MCEVertexAttributePosition;
+    layout.positionOffset = settings.positionBits ? place(8, 2) : place(12, 4);
+    if (streams.normals) {
+        layout.attributes |= MCEVertexAttributeNormal;
+        layout.normalOffset = place(directionSize(settings.normalBits), directionAlignment(settings.normalBits));
+    }
+    if (streams.tangents) {
+        layout.attributes |= MCEVertexAttributeTangent;
+        layout.tangentOffset = place(directionSize(settings.tangentBits), directionAlignment(settings.tangentBits));
+    }
+    if (streams.uvs) {
+        layout.attributes |= MCEVertexAttributeUV;
+        layout.uvOffset = settings.halfUVs ? place(4, 2) : place(8, 4);
+    }
+    if (streams.jointIndices) {
+        // Joint indices are exact either way; a byte each is enough for skeletons under 256 joints.
+        uint16_t maxJoint = 0;
+        for (uint32_t i = 0; i < streams.vertexCount * 4; ++i) { maxJoint = std::max(maxJoint, streams.jointIndices[i]); }
+        layout.attributes |= MCEVertexAttributeJoints;
+        layout.jointIndexBytes = maxJoint < 256 ? 1 : 2;
+        layout.jointOffset = place(4 * layout.jointIndexBytes, layout.jointIndexBytes);
+    }
+    if (streams.jointWeights) {
+        layout.attributes |= MCEVertexAttributeWeights;
+        layout.weightOffset = settings.weightBits ? place(4, 1) : place(16, 4);
+    }
+    layout.stride = Align(offset, 4);
+
+    float lo[3] = { streams.positions[0], streams.positions[1], streams.positions[2] };
+    float hi[3] = { lo[0], lo[1], lo[2] };
+    for (uint32_t v = 1; v < streams.vertexCount; ++v) {
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = std::min(lo[axis], streams.positions[v * 3 + axis]);
+            hi[axis] = std::max(hi[axis], streams.positions[v * 3 + axis]);
+        }
+    }
+    const float levels = settings.positionBits ? static_cast<float>((1u << settings.positionBits) - 1u) : 1.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        layout.positionMin[axis] = settings.positionBits ? lo[axis] : 0.0f;
+        layout.positionScale[axis] = settings.positionBits ? (hi[axis] - lo[axis]) / levels : 1.0f;
+    }
+}
+
+void EncodeDirection(uint8_t *vertex, uint32_t offset, uint32_t bits, const float *direction) {
+    if (bits == 0) {
+        std::memcpy(vertex + offset, direction, sizeof(float) * 3);
+        return;
+    }
+    int32_t qu = 0;
+    int32_t qv = 0;
+    OctEncode(direction, bits, qu, qv);
+    if (bits == 16) {
+        Write<int16_t>(vertex, offset, static_cast<int16_t>(qu));
+        Write<int16_t>(vertex, offset + 2, static_cast<int16_t>(qv));
+    } else {
+        Write<int8_t>(vertex, offset, static_cast<int8_t>(qu));
+        Write<int8_t>(vertex, offset + 1, static_cast<int8_t>(qv));
+    }
+}
+
+void DecodeDirection(const uint8_t *vertex, uint32_t offset, uint32_t bits, float *out) {
+    if (bits == 0) {
+        std::memcpy(out, vertex + offset, sizeof(float) * 3);
+        return;
+    }
+    if (bits == 16) {
+        OctDecode(Read<int16_t>(vertex, offset) / 32767.0f, Read<int16_t>(vertex, offset + 2) / 32767.0f, out);
+    } else {
+        OctDecode(Read<int8_t>(vertex, offset) / 127.0f, Read<int8_t>(vertex, offset + 1) / 127.0f, out);
+    }
+}
+
+float AngleDegrees(const float *decoded, const float *source) {
+    const float length = std::sqrt(Dot3(source, source) * Dot3(decoded, decoded));
+    if (length <= 0.0f) { return 0.0f; }
+    return std::acos(std::clamp(Dot3(decoded, source) / length, -1.0f, 1.0f)) * kRadiansToDegrees;
+}
+
+}
+
+extern "C" size_t MCEVertexQuantizeLayout(const MCEVertexStreams *streams, const MCEVertexQuantizeSettings *settings,
+                                          MCEVertexQuantizedLayout *layoutOut) {
+    if (!streams || !settings || !streams->positions || streams->vertexCount == 0 || !ValidSettings(*settings)) { return 0; }
+    MCEVertexQuantizedLayout layout;
+    ComputeLayout(*streams, *settings, layout);
+    if (layoutOut) { *layoutOut = layout; }
+    return static_cast<size_t>(layout.stride) * streams->vertexCount;
+}
+
+extern "C" void MCEVertexDequantize(const void *data, const MCEVertexQuantizedLayout *layout, uint32_t vertex,
+                                    float *positionOut, float *normalOut, float *tangentOut, float *uvOut,
+                                    uint16_t *jointIndicesOut, float *jointWeightsOut) {
+    if (!data || !layout) { return; }
+    const uint8_t *base = static_cast<const uint8_t *>(data) + static_cast<size_t>(vertex) * layout->stride;
+    if (positionOut) {
+        if (layout->encoding.positionBits == 0) {
+            std::memcpy(positionOut, base + layout->positionOffset, sizeof(float) * 3);
+        } else {
+            for (int axis = 0; axis < 3; ++axis) {
+                const float q = static_cast<float>(Read<uint16_t>(base, layout->positionOffset + axis * 2));
+                positionOut[axis] = layout->positionMin[axis] + q * layout->positionScale[axis];
+            }
+        }
+    }
+    if (normalOut && (layout->attributes & MCEVertexAttributeNormal)) {
+        DecodeDirection(base, layout->normalOffset, layout->encoding.normalBits, normalOut);
+    }
+    if (tangentOut && (layout->attributes & MCEVertexAttributeTangent)) {
+        DecodeDirection(base, layout->tangentOffset, layout->encoding.tangentBits, tangentOut);
+    }
+    if (uvOut && (layout->attributes & MCEVertexAttributeUV)) {
+        if (!layout->encoding.halfUVs) {
+            std::memcpy(uvOut, base + layout->uvOffset, sizeof(float) * 2);
+        } else {
+            uvOut[0] = HalfToFloat(Read<uint16_t>(base, layout->uvOffset));
+            uvOut[1] = HalfToFloat(Read<uint16_t>(base, layout->uvOffset + 2));
+        }
+    }
+    if (jointIndicesOut && (layout->attributes & MCEVertexAttributeJoints)) {
+        for (int i = 0; i < 4; ++i) {
+            jointIndicesOut[i] = layout->jointIndexBytes == 1
+                ? base[layout->jointOffset + i]
+                : Read<uint16_t>(base, layout->jointOffset + i * 2);
+        }
+    }
+    if (jointWeightsOut && (layout->attributes & MCEVertexAttributeWeights)) {
+        if (layout->encoding.weightBits == 0) {
+            std::memcpy(jointWeightsOut, base + layout->weightOffset, sizeof(float) * 4);
+        } else {
+            for (int i = 0; i < 4; ++i) { jointWeightsOut[i] = base[layout->weightOffset + i] / 255.0f; }
+        }
+    }
+}
+
+extern "C" uint32_t MCEVertexQuantize(const MCEVertexStreams *streams, const MCEVertexQuantizeSettings *settings,
+                                      void *out, size_t outCapacity,
+                                      MCEVertexQuantizedLayout *layoutOut, MCEVertexQuantizeReport *reportOut) {
+    MCEVertexQuantizedLayout layout;
+    const size_t size = MCEVertexQuantizeLayout(streams, settings, &layout);
+    if (size == 0 || !out || outCapacity < size) { return 0; }
+    const auto start = Clock::now();
+    uint8_t *bytes = static_cast<uint8_t *>(out);
+    std::memset(bytes, 0, size);
+    const MCEVertexStreams &s = *streams;
+
+    for (uint32_t v = 0; v < s.vertexCount; ++v) {
+        uint8_t *vertex = bytes + static_cast<size_t>(v) * layout.stride;
+        const float *position = s.positions + v * 3;
+        if (settings->positionBits) {
+            const float levels = static_cast<float>((1u << settings->positionBits) - 1u);
+            for (int axis = 0; axis < 3; ++axis) {
+                const float scale = layout.positionScale[axis];
+                const float q = scale > 0.0f ? std::round((position[axis] - layout.positionMin[axis]) / scale) : 0.0f;
+                Write<uint16_t>(vertex, layout.positionOffset + axis * 2, static_cast<uint16_t>(std::clamp(q, 0.0f, levels)));
+            }
+        } else {
+            std::memcpy(vertex + layout.positionOffset, position, sizeof(float) * 3);
+        }
+        if (s.normals) { EncodeDirection(vertex, layout.normalOffset, settings->normalBits, s.normals + v * 3); }
+        if (s.tangents) { EncodeDirection(vertex, layout.tangentOffset, settings->tangentBits, s.tangents + v * 3); }
+        if (s.uvs) {
+            if (settings->halfUVs) {
+                Write<uint16_t>(vertex, layout.uvOffset, FloatToHalf(s.uvs[v * 2]));
+                Write<uint16_t>(vertex, layout.uvOffset + 2, FloatToHalf(s.uvs[v * 2 + 1]));
+            } else {
+                std::memcpy(vertex + layout.uvOffset, s.uvs + v * 2, sizeof(float) * 2);
+            }
+        }
+        if (s.jointIndices) {
+            for (int i = 0; i < 4; ++i) {
+                const uint16_t joint = s.jointIndices[v * 4 + i];
+                if (layout.jointIndexBytes == 1) {
+                    vertex[layout.jointOffset + i] = static_cast<uint8_t>(joint);
+                } else {
+                    Write<uint16_t>(vertex, layout.jointOffset + i * 2, joint);
+                }
+            }
+        }
+        if (s.jointWeights) {
+            if (settings->weightBits) {
+                QuantizeWeights(s.jointWeights + v * 4, vertex + layout.weightOffset);
+            } else {
+                std::memcpy(vertex + layout.weightOffset, s.jointWeights + v * 4, sizeof(float) * 4);
+            }
+        }
+    }
+
+    MCEVertexQuantizeReport report {};
+    float diagonal = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        float lo = s.positions[axis];
+        float hi = lo;
+        for (uint32_t v = 1; v < s.vertexCount; ++v) {
+            lo = std::min(lo, s.positions[v * 3 + axis]);
+            hi = std::max(hi, s.positions[v * 3 + axis]);
+        }
+        diagonal += (hi - lo) * (hi - lo);
+    }
+    diagonal = std::sqrt(diagonal);
+    for (uint32_t v = 0; v < s.vertexCount; ++v) {
+        float position[3], normal[3], tangent[3], uv[2], weights[4];
+        MCEVertexDequantize(bytes, &layout, v, position, normal, tangent, uv, nullptr, weights);
+        for (int axis = 0; axis < 3; ++axis) {
+            report.maxPositionError = std::max(report.maxPositionError, std::fabs(position[axis] - s.positions[v * 3 + axis]));
+        }
+        if (s.normals) { report.maxNormalErrorDegrees = std::max(report.maxNormalErrorDegrees, AngleDegrees(normal, s.normals + v * 3)); }
+        if (s.tangents) { report.maxTangentErrorDegrees = std::max(report.maxTangentErrorDegrees, AngleDegrees(tangent, s.tangents + v * 3)); }
+        if (s.uvs) {
+            for (int i = 0; i < 2; ++i) { report.maxUVError = std::max(report.maxUVError, std::fabs(uv[i] - s.uvs[v * 2 + i])); }
+        }
+        if (s.jointWeights) {
+            const float *source = s.jointWeights + v * 4;
+            float sum = 0.0f;
+            for (int i = 0; i < 4; ++i) { sum += std::max(0.0f, source[i]); }
+            for (int i = 0; i < 4; ++i) {
+                const float expected = sum > 0.0f ? std::max(0.0f, source[i]) / sum : (i == 0 ? 1.0f : 0.0f);
+                report.maxWeightError = std::max(report.maxWeightError, std::fabs(weights[i] - expected));
+            }
+        }
+    }
+    report.maxPositionErrorRelative = diagonal > 0.0f ? report.maxPositionError / diagonal : 0.0f;
+    // The float baseline is the baked document's vertex: tangents carry a w component there.
+    const uint64_t sourceStride = 12
+        + (s.normals ? 12 : 0) + (s.tangents ? 16 : 0) + (s.uvs ? 8 : 0)
+        + (s.jointIndices ? 8 : 0) + (s.jointWeights ? 16 : 0);
+    report.sourceBytes = sourceStride * s.vertexCount;
+    report.quantizedBytes = size;
+    report.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (layoutOut) { *layoutOut = layout; }
+    if (reportOut) { *reportOut = report; }
+    return 1;
+}
@@ -0,0 +1,98 @@
+/// VertexQuantizer.h
+/// Declares interleaved vertex quantization for baked meshes and its error/size report.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Float source streams for one submesh; any stream may be NULL and is then left out of the
+/// packed layout. Positions, normals and tangents are xyz triples; skin streams are four per vertex.
+typedef struct {
+    const float *positions;
+    const float *normals;
+    const float *tangents;
+    const float *uvs;
+    const uint16_t *jointIndices;
+    const float *jointWeights;
+    uint32_t vertexCount;
+} MCEVertexStreams;
+
+/// A zero field keeps that attribute as 32-bit floats.
+typedef struct {
+    /// 8-16: unsigned offsets within the submesh AABB, stored as uint16 x4.
+    uint32_t positionBits;
+    /// 8 or 16: octahedral snorm x2 for normals and tangents.
+    uint32_t normalBits;
+    uint32_t tangentBits;
+    /// Nonzero: UVs as IEEE half x2.
+    uint32_t halfUVs;
+    /// 8: unorm8 x4 weights whose integer sum is exactly 255.
+    uint32_t weightBits;
+} MCEVertexQuantizeSettings;
+
+enum {
+    MCEVertexAttributePosition = 1u << 0,
+    MCEVertexAttributeNormal = 1u << 1,
+    MCEVertexAttributeTangent = 1u << 2,
+    MCEVertexAttributeUV = 1u << 3,
+    MCEVertexAttributeJoints = 1u << 4,
+    MCEVertexAttributeWeights = 1u << 5,
+};
+
+/// Byte offsets are only meaningful for attributes present in `attributes`; `encoding` says how each
+/// one is stored. A position decodes as `positionMin + q * positionScale`; joints are uint8 x4 when
+/// `jointIndexBytes` is 1.
+typedef struct {
+    MCEVertexQuantizeSettings encoding;
+    uint32_t attributes;
+    uint32_t stride;
+    uint32_t positionOffset;
+    uint32_t normalOffset;
+    uint32_t tangentOffset;
+    uint32_t uvOffset;
+    uint32_t jointOffset;
+    uint32_t weightOffset;
+    uint32_t jointIndexBytes;
+    float positionMin[3];
+    float positionScale[3];
+} MCEVertexQuantizedLayout;
+
+typedef struct {
+    /// Largest per-component position error, absolute and as a fraction of the AABB diagonal.
+    float maxPositionError;
+    float maxPositionErrorRelative;
+    float maxNormalErrorDegrees;
+    float maxTangentErrorDegrees;
+    float maxUVError;
+    /// Against the source weights normalized to sum to one.
+    float maxWeightError;
+    uint64_t sourceBytes;
+    uint64_t quantizedBytes;
+    double milliseconds;
+} MCEVertexQuantizeReport;
+
+/// Fills the layout for `streams` under `settings` and returns the packed size in bytes, or 0 when
+/// the settings are invalid.
+size_t MCEVertexQuantizeLayout(const MCEVertexStreams *streams, const MCEVertexQuantizeSettings *settings,
+                               MCEVertexQuantizedLayout *layoutOut);
+
+/// Packs every vertex into `out` (at least the size returned by MCEVertexQuantizeLayout), then
+/// decodes it again to measure the error. Returns 0 on invalid input or a short buffer.
+uint32_t MCEVertexQuantize(const MCEVertexStreams *streams, const MCEVertexQuantizeSettings *settings,
+                           void *out, size_t outCapacity,
+                           MCEVertexQuantizedLayout *layoutOut, MCEVertexQuantizeReport *reportOut);
+
+/// Decodes one packed vertex into float attributes; any output may be NULL.
+void MCEVertexDequantize(const void *data, const MCEVertexQuantizedLayout *layout, uint32_t vertex,
+                         float *positionOut, float *normalOut, float *tangentOut, float *uvOut,
+                         uint16_t *jointIndicesOut, float *jointWeightsOut);
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,7 +19,7 @@ enum EditorAssetReferenceResolver {
             let prefab = try PrefabSerializer.load(from: url)
             guard let scene = context.bridgeServices.activeScene() else { return 0 }
             let created = scene.instantiate(prefab: prefab, prefabHandle: prefabHandleValue)
-            EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+            EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
             if let first = created.first {
                 return EditorBridgeInternals.cStringWrite(first.id.uuidString, to: outId, max: outIdSize)
             }
@@ -0,0 +1,396 @@
+import Foundation
+import MetalCupEngine
+import simd
+
+/// Per-(entity, component) stamps for block reads. Each pair remembers the bytes it last handed out, and
+/// a read that produces the same bytes keeps the old stamp. A caller holding that stamp gets `unchanged`
+/// even while play or simulate advances the scene revision every frame, and switching the selection back
+/// and forth between entities does not invalidate either entity's stamp.
+final class EditorComponentBlockStamps {
+    private struct Key: Hashable {
+        var high: UInt64
+        var low: UInt64
+        var type: Int32
+    }
+
+    private struct Entry {
+        var sceneRevision: UInt64
+        var stamp: UInt64
+        var bytes: [UInt8]
+    }
+
+    /// The inspector only reads the primary selection, so a handful of entries covers recent selections.
+    /// Past this the table is dropped; stamps keep advancing, so a dropped entry can never match again.
+    private static let maxEntries = 64
+
+    private var entries: [Key: Entry] = [:]
+    private var nextStamp: UInt64 = 0
+
+    /// True when `knownStamp` is still this component's stamp and the scene has not moved since it was taken,
+    /// so the component does not need to be read at all.
+    func isCurrent(type: Int32, handle: MCEEntityHandle, knownStamp: UInt64, sceneRevision: UInt64) -> Bool {
+        guard knownStamp != 0,
+              let entry = entries[Key(high: handle.high, low: handle.low, type: type)] else { return false }
+        return entry.stamp == knownStamp && entry.sceneRevision == sceneRevision
+    }
+
+    /// Records a fresh read and returns its stamp. The stamp only advances when the bytes change.
+    func stamp(type: Int32, handle: MCEEntityHandle, sceneRevision: UInt64, bytes: UnsafeRawBufferPointer) -> UInt64 {
+        let key = Key(high: handle.high, low: handle.low, type: type)
+        if var entry = entries[key], entry.bytes.elementsEqual(bytes) {
+            entry.sceneRevision = sceneRevision
+            entries[key] = entry
+            return entry.stamp
+        }
+        if entries[key] == nil && entries.count >= Self.maxEntries {
+            entries.removeAll(keepingCapacity: true)
+        }
+        nextStamp &+= 1
+        entries[key] = Entry(sceneRevision: sceneRevision, stamp: nextStamp, bytes: Array(bytes))
+        return nextStamp
+    }
+}
+
+/// Fixed-layout component blocks for the inspector. A read returns the whole component in one call,
+/// stamped per entity and component (see EditorComponentBlockStamps); a write applies only the fields
+/// named in a dirty mask to every target entity and notifies the scene once.
+enum EditorComponentBlocks {
+    private enum BlockComponentType: Int32 {
+        case transform = 1
+        case light = 3
+        case camera = 6
+        case rigidbody = 7
+        case collider = 8
+    }
+
+    /// Shapes carried by MCEColliderBlockBridge. The dirty mask of a collider commit has one bit per shape.
+    static let colliderShapeCapacity = 8
+
+    enum GetResult: UInt32 {
+        case missing = 0
+        case written = 1
+        case unchanged = 2
+    }
+
+    enum TransformField: UInt32 {
+        case positionX = 0, positionY, positionZ
+        case rotationX, rotationY, rotationZ
+        case scaleX, scaleY, scaleZ
+    }
+
+    enum CameraField: UInt32 {
+        case projectionType = 0, fovDegrees, orthoSize, nearPlane, farPlane, isPrimary, exposureEV
+    }
+
+    enum LightField: UInt32 {
+        case type = 0, color, brightness, range, innerCos, outerCos, direction, castsShadows
+    }
+
+    enum RigidbodyField: UInt32 {
+        case isEnabled = 0, motionType, mass, friction, restitution, linearDamping, angularDamping
+        case gravityFactor, allowSleeping, ccdEnabled, collisionLayer
+    }
+
+    private static let emptyColliderShapeBlock = MCEColliderShapeBlockBridge(
+        isEnabled: 0, shapeType: 0, boxX: 0, boxY: 0, boxZ: 0,
+        sphereRadius: 0, capsuleHalfHeight: 0, capsuleRadius: 0,
+        offsetX: 0, offsetY: 0, offsetZ: 0, rotationX: 0, rotationY: 0, rotationZ: 0,
+        isTrigger: 0, hasLayerOverride: 0, layerOverride: 0
+    )
+
+    private static func colliderShapeBlock(_ shape: ColliderShape) -> MCEColliderShapeBlockBridge {
+        MCEColliderShapeBlockBridge(
+            isEnabled: shape.isEnabled ? 1 : 0,
+            shapeType: Int32(shape.shapeType.rawValue),
+            boxX: shape.boxHalfExtents.x, boxY: shape.boxHalfExtents.y, boxZ: shape.boxHalfExtents.z,
+            sphereRadius: shape.sphereRadius,
+            capsuleHalfHeight: shape.capsuleHalfHeight,
+            capsuleRadius: shape.capsuleRadius,
+            offsetX: shape.offset.x, offsetY: shape.offset.y, offsetZ: shape.offset.z,
+            rotationX: shape.rotationOffset.x, rotationY: shape.rotationOffset.y, rotationZ: shape.rotationOffset.z,
+            isTrigger: shape.isTrigger ? 1 : 0,
+            hasLayerOverride: shape.collisionLayerOverride != nil ? 1 : 0,
+            layerOverride: shape.collisionLayerOverride ?? 0
+        )
+    }
+
+    private static func isDirty<F: RawRepresentable>(_ mask: UInt32, _ field: F) -> Bool where F.RawValue == UInt32 {
+        (mask >> field.rawValue) & 1 != 0
+    }
+
+    static func getBlock(_ contextPtr: UnsafeRawPointer?,
+                         _ handle: MCEEntityHandle,
+                         _ componentType: Int32,
+                         _ knownRevision: UInt64,
+                         _ blockOut: UnsafeMutableRawPointer?,
+                         _ blockSize: Int32,
+                         _ revisionOut: UnsafeMutablePointer<UInt64>?) -> UInt32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let type = BlockComponentType(rawValue: componentType) else { return GetResult.missing.rawValue }
+        // Removals and entity swaps also advance the scene revision, so a current stamp means the caller's copy is too.
+        let sceneRevision = context.bridgeServices.componentRevision
+        let stamps = context.componentBlockStamps
+        if stamps.isCurrent(type: componentType, handle: handle, knownStamp: knownRevision, sceneRevision: sceneRevision) {
+            revisionOut?.pointee = knownRevision
+            return GetResult.unchanged.rawValue
+        }
+        revisionOut?.pointee = 0
+        guard let blockOut,
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let entity = EditorEntityHandleQueries.entityValue(handle, context: context) else { return GetResult.missing.rawValue }
+        switch type {
+        case .transform:
+            guard Int(blockSize) == MemoryLayout<MCETransformBlockBridge>.size,
+                  let transform = ecs.get(TransformComponent.self, for: entity) else { return GetResult.missing.rawValue }
+            let euler = TransformMath.eulerFromQuaternionXYZ(transform.rotation)
+            blockOut.assumingMemoryBound(to: MCETransformBlockBridge.self).pointee = MCETransformBlockBridge(
+                positionX: transform.position.x, positionY: transform.position.y, positionZ: transform.position.z,
+                rotationX: euler.x, rotationY: euler.y, rotationZ: euler.z,
+                scaleX: transform.scale.x, scaleY: transform.scale.y, scaleZ: transform.scale.z
+            )
+        case .camera:
+            guard Int(blockSize) == MemoryLayout<MCECameraBlockBridge>.size,
+                  let camera = ecs.get(CameraComponent.self, for: entity) else { return GetResult.missing.rawValue }
+            blockOut.assumingMemoryBound(to: MCECameraBlockBridge.self).pointee = MCECameraBlockBridge(
+                projectionType: Int32(camera.projectionType.rawValue),
+                fovDegrees: camera.fovDegrees,
+                orthoSize: camera.orthoSize,
+                nearPlane: camera.nearPlane,
+                farPlane: camera.farPlane,
+                isPrimary: camera.isPrimary ? 1 : 0,
+                isEditor: camera.isEditor ? 1 : 0,
+                exposureEV: camera.exposureEV
+            )
+        case .light:
+            guard Int(blockSize) == MemoryLayout<MCELightBlockBridge>.size,
+                  let light = ecs.get(LightComponent.self, for: entity) else { return GetResult.missing.rawValue }
+            let lightType: Int32
+            switch light.type {
+            case .spot: lightType = 1
+            case .directional: lightType = 2
+            default: lightType = 0
+            }
+            let direction: SIMD3<Float>
+            if (light.type == .directional || light.type == .spot),
+               let transform = ecs.get(TransformComponent.self, for: entity) {
+                direction = TransformMath.directionalLightDirection(from: transform.rotation)
+            } else {
+                direction = light.direction
+            }
+            blockOut.assumingMemoryBound(to: MCELightBlockBridge.self).pointee = MCELightBlockBridge(
+                type: lightType,
+                colorX: light.data.color.x, colorY: light.data.color.y, colorZ: light.data.color.z,
+                brightness: light.data.brightness,
+                range: light.range,
+                innerCos: light.innerConeCos,
+                outerCos: light.outerConeCos,
+                directionX: direction.x, directionY: direction.y, directionZ: direction.z,
+                castsShadows: light.castsShadows ? 1 : 0
+            )
+        case .rigidbody:
+            guard Int(blockSize) == MemoryLayout<MCERigidbodyBlockBridge>.size,
+                  let rigidbody = ecs.get(RigidbodyComponent.self, for: entity) else { return GetResult.missing.rawValue }
+            blockOut.assumingMemoryBound(to: MCERigidbodyBlockBridge.self).pointee = MCERigidbodyBlockBridge(
+                isEnabled: rigidbody.isEnabled ? 1 : 0,
+                motionType: Int32(rigidbody.motionType.rawValue),
+                mass: rigidbody.mass,
+                friction: rigidbody.friction,
+                restitution: rigidbody.restitution,
+                linearDamping: rigidbody.linearDamping,
+                angularDamping: rigidbody.angularDamping,
+                gravityFactor: rigidbody.gravityFactor,
+                allowSleeping: rigidbody.allowSleeping ? 1 : 0,
+                ccdEnabled: rigidbody.ccdEnabled ? 1 : 0,
+                collisionLayer: rigidbody.collisionLayer
+            )
+        case .collider:
+            guard Int(blockSize) == MemoryLayout<MCEColliderBlockBridge>.size,
+                  let collider = ecs.get(ColliderComponent.self, for: entity) else { return GetResult.missing.rawValue }
+            let shapes = collider.allShapes()
+            let out = blockOut.assumingMemoryBound(to: MCEColliderBlockBridge.self)
+            out.pointee.shapeCount = Int32(shapes.count)
+            // Unused slots are zeroed so the byte comparison below only sees real shape data.
+            withUnsafeMutableBytes(of: &out.pointee.shapes) { raw in
+                let slots = raw.bindMemory(to: MCEColliderShapeBlockBridge.self)
+                for slot in 0..<slots.count {
+                    slots[slot] = slot < shapes.count ? colliderShapeBlock(shapes[slot]) : emptyColliderShapeBlock
+                }
+            }
+        }
+        // Play and simulate advance the scene revision every frame; comparing bytes keeps the stamp for
+        // components the runtime did not touch.
+        let stamp = stamps.stamp(type: componentType, handle: handle, sceneRevision: sceneRevision,
+                                 bytes: UnsafeRawBufferPointer(start: blockOut, count: Int(blockSize)))
+        revisionOut?.pointee = stamp
+        return stamp == knownRevision ? GetResult.unchanged.rawValue : GetResult.written.rawValue
+    }
+
+    /// Applies the masked fields of `block` to each entity. Returns the number of entities updated.
+    static func commitBlock(_ contextPtr: UnsafeRawPointer?,
+                            _ handles: UnsafePointer<MCEEntityHandle>?,
+                            _ handleCount: Int32,
+                            _ componentType: Int32,
+                            _ block: UnsafeRawPointer?,
+                            _ blockSize: Int32,
+                            _ dirtyMask: UInt32) -> Int32 {
+        guard dirtyMask != 0,
+              let context = EditorBridgeInternals.contextValue(contextPtr),
+              !context.bridgeServices.isPlaying,
+              let scene = context.bridgeServices.activeScene(),
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let handles, handleCount > 0,
+              let block,
+              let type = BlockComponentType(rawValue: componentType) else { return 0 }
+        var applied: Int32 = 0
+        switch type {
+        case .transform:
+            guard !context.bridgeServices.isSimulating,
+                  Int(blockSize) == MemoryLayout<MCETransformBlockBridge>.size else { return 0 }
+            let input = block.assumingMemoryBound(to: MCETransformBlockBridge.self).pointee
+            for index in 0..<Int(handleCount) {
+                guard let entity = EditorEntityHandleQueries.entityValue(handles[index], context: context),
+                      let current = ecs.get(TransformComponent.self, for: entity) else { continue }
+                var position = current.position
+                var euler = TransformMath.eulerFromQuaternionXYZ(current.rotation)
+                var scale = current.scale
+                if isDirty(dirtyMask, TransformField.positionX) { position.x = input.positionX }
+                if isDirty(dirtyMask, TransformField.positionY) { position.y = input.positionY }
+                if isDirty(dirtyMask, TransformField.positionZ) { position.z = input.positionZ }
+                if isDirty(dirtyMask, TransformField.rotationX) { euler.x = input.rotationX }
+                if isDirty(dirtyMask, TransformField.rotationY) { euler.y = input.rotationY }
+                if isDirty(dirtyMask, TransformField.rotationZ) { euler.z = input.rotationZ }
+                if isDirty(dirtyMask, TransformField.scaleX) { scale.x = input.scaleX }
+                if isDirty(dirtyMask, TransformField.scaleY) { scale.y = input.scaleY }
+                if isDirty(dirtyMask, TransformField.scaleZ) { scale.z = input.scaleZ }
+                let transform = TransformComponent(position: position,
+                                                   rotation: TransformMath.quaternionFromEulerXYZ(euler),
+                                                   scale: scale)
+                _ = scene.transformAuthority.setLocalTransform(entity: entity, transform: transform, source: .editor)
+                applied += 1
+            }
+        case .camera:
+            guard Int(blockSize) == MemoryLayout<MCECameraBlockBridge>.size else { return 0 }
+            let input = block.assumingMemoryBound(to: MCECameraBlockBridge.self).pointee
+            for index in 0..<Int(handleCount) {
+                guard let entity = EditorEntityHandleQueries.entityValue(handles[index], context: context),
+                      var camera = ecs.get(CameraComponent.self, for: entity) else { continue }
+                if isDirty(dirtyMask, CameraField.projectionType) {
+                    camera.projectionType = ProjectionType(rawValue: UInt32(max(0, input.projectionType))) ?? .perspective
+                }
+                if isDirty(dirtyMask, CameraField.fovDegrees) { camera.fovDegrees = input.fovDegrees }
+                if isDirty(dirtyMask, CameraField.orthoSize) { camera.orthoSize = input.orthoSize }
+                if isDirty(dirtyMask, CameraField.nearPlane) { camera.nearPlane = input.nearPlane }
+                if isDirty(dirtyMask, CameraField.farPlane) { camera.farPlane = input.farPlane }
+                if isDirty(dirtyMask, CameraField.isPrimary) { camera.isPrimary = input.isPrimary != 0 }
+                if isDirty(dirtyMask, CameraField.exposureEV) {
+                    camera.autoExposureEnabled = false
+                    camera.exposureEV = min(max(input.exposureEV, -16.0), 16.0)
+                }
+                ecs.add(camera, to: entity)
+                if isDirty(dirtyMask, CameraField.isPrimary) && camera.isPrimary && !camera.isEditor {
+                    EditorBridgeInternals.setPrimaryCameraValue(ecs: ecs, entity: entity)
+                }
+                applied += 1
+            }
+        case .light:
+            guard Int(blockSize) == MemoryLayout<MCELightBlockBridge>.size else { return 0 }
+            let input = block.assumingMemoryBound(to: MCELightBlockBridge.self).pointee
+            for index in 0..<Int(handleCount) {
+                guard let entity = EditorEntityHandleQueries.entityValue(handles[index], context: context),
+                      var light = ecs.get(LightComponent.self, for: entity) else { continue }
+                if isDirty(dirtyMask, LightField.type) {
+                    switch input.type {
+                    case 1: light.type = .spot
+                    case 2: light.type = .directional
+                    default: light.type = .point
+                    }
+                }
+                if isDirty(dirtyMask, LightField.color) {
+                    light.data.color = SIMD3<Float>(input.colorX, input.colorY, input.colorZ)
+                }
+                if isDirty(dirtyMask, LightField.brightness) { light.data.brightness = max(0.0, input.brightness) }
+                if isDirty(dirtyMask, LightField.range) { light.range = max(0.0, input.range) }
+                if isDirty(dirtyMask, LightField.innerCos) { light.innerConeCos = input.innerCos }
+                if isDirty(dirtyMask, LightField.outerCos) { light.outerConeCos = input.outerCos }
+                if isDirty(dirtyMask, LightField.direction) {
+                    let requested = SIMD3<Float>(input.directionX, input.directionY, input.directionZ)
+                    if light.type != .directional && light.type != .spot {
+                        light.direction = requested
+                    } else if var transform = ecs.get(TransformComponent.self, for: entity),
+                              simd_length_squared(requested) > 0.000001 {
+                        transform.rotation = TransformMath.rotationForDirectionalLight(direction: simd_normalize(requested))
+                        _ = scene.transformAuthority.setLocalTransform(entity: entity, transform: transform, source: .editor)
+                    }
+                }
+                if isDirty(dirtyMask, LightField.castsShadows) { light.castsShadows = input.castsShadows != 0 }
+                ecs.add(light, to: entity)
+                if ecs.has(PrefabInstanceComponent.self, entity) {
+                    var overrides = ecs.get(PrefabOverrideComponent.self, for: entity) ?? PrefabOverrideComponent()
+                    overrides.overridden.insert(.light)
+                    ecs.add(overrides, to: entity)
+                }
+                applied += 1
+            }
+        case .rigidbody:
+            guard Int(blockSize) == MemoryLayout<MCERigidbodyBlockBridge>.size else { return 0 }
+            let input = block.assumingMemoryBound(to: MCERigidbodyBlockBridge.self).pointee
+            for index in 0..<Int(handleCount) {
+                guard let entity = EditorEntityHandleQueries.entityValue(handles[index], context: context),
+                      let current = ecs.get(RigidbodyComponent.self, for: entity) else { continue }
+                var motionType = current.motionType
+                if isDirty(dirtyMask, RigidbodyField.motionType) {
+                    motionType = RigidbodyMotionType(rawValue: UInt32(max(0, input.motionType))) ?? .dynamic
+                }
+                let rigidbody = RigidbodyComponent(
+                    isEnabled: isDirty(dirtyMask, RigidbodyField.isEnabled) ? input.isEnabled != 0 : current.isEnabled,
+                    motionType: motionType,
+                    mass: isDirty(dirtyMask, RigidbodyField.mass) ? input.mass : current.mass,
+                    friction: isDirty(dirtyMask, RigidbodyField.friction) ? input.friction : current.friction,
+                    restitution: isDirty(dirtyMask, RigidbodyField.restitution) ? input.restitution : current.restitution,
+                    linearDamping: isDirty(dirtyMask, RigidbodyField.linearDamping) ? input.linearDamping : current.linearDamping,
+                    angularDamping: isDirty(dirtyMask, RigidbodyField.angularDamping) ? input.angularDamping : current.angularDamping,
+                    gravityFactor: isDirty(dirtyMask, RigidbodyField.gravityFactor) ? input.gravityFactor : current.gravityFactor,
+                    allowSleeping: isDirty(dirtyMask, RigidbodyField.allowSleeping) ? input.allowSleeping != 0 : current.allowSleeping,
+                    ccdEnabled: isDirty(dirtyMask, RigidbodyField.ccdEnabled) ? input.ccdEnabled != 0 : current.ccdEnabled,
+                    collisionLayer: isDirty(dirtyMask, RigidbodyField.collisionLayer) ? input.collisionLayer : current.collisionLayer
+                )
+                ecs.add(rigidbody, to: entity)
+                applied += 1
+            }
+        case .collider:
+            guard Int(blockSize) == MemoryLayout<MCEColliderBlockBridge>.size else { return 0 }
+            let input = block.assumingMemoryBound(to: MCEColliderBlockBridge.self).pointee
+            let inputShapes = withUnsafeBytes(of: input.shapes) { Array($0.bindMemory(to: MCEColliderShapeBlockBridge.self)) }
+            for index in 0..<Int(handleCount) {
+                guard let entity = EditorEntityHandleQueries.entityValue(handles[index], context: context),
+                      var collider = ecs.get(ColliderComponent.self, for: entity) else { continue }
+                var shapes = collider.allShapes()
+                var changed = false
+                // Adding and removing shapes stays on its own calls, so a commit only rewrites shapes that exist.
+                for slot in 0..<min(shapes.count, colliderShapeCapacity) where (dirtyMask >> UInt32(slot)) & 1 != 0 {
+                    let shape = inputShapes[slot]
+                    shapes[slot] = ColliderShape(isEnabled: shape.isEnabled != 0,
+                                                 shapeType: ColliderShapeType(rawValue: UInt32(max(0, shape.shapeType))) ?? .box,
+                                                 boxHalfExtents: SIMD3<Float>(shape.boxX, shape.boxY, shape.boxZ),
+                                                 sphereRadius: shape.sphereRadius,
+                                                 capsuleHalfHeight: shape.capsuleHalfHeight,
+                                                 capsuleRadius: shape.capsuleRadius,
+                                                 offset: SIMD3<Float>(shape.offsetX, shape.offsetY, shape.offsetZ),
+                                                 rotationOffset: SIMD3<Float>(shape.rotationX, shape.rotationY, shape.rotationZ),
+                                                 isTrigger: shape.isTrigger != 0,
+                                                 collisionLayerOverride: shape.hasLayerOverride != 0 ? shape.layerOverride : nil,
+                                                 physicsMaterial: shapes[slot].physicsMaterial)
+                    changed = true
+                }
+                guard changed else { continue }
+                collider.setShapes(shapes)
+                ecs.add(collider, to: entity)
+                applied += 1
+            }
+        }
+        if applied > 0 {
+            EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        }
+        return applied
+    }
+}
@@ -44,6 +44,30 @@ enum EditorComponentCommands {
         }
     }
 
+    /// One bit per component type id, so panels can answer every presence check for an entity with a single call.
+    static func componentMask(ecs: SceneECS, entity: Entity) -> UInt32 {
+        var mask: UInt32 = 0
+        func set(_ type: BridgeComponentType, _ present: Bool) {
+            if present { mask |= 1 << UInt32(type.rawValue) }
+        }
+        set(.name, ecs.has(NameComponent.self, entity))
+        set(.transform, ecs.has(TransformComponent.self, entity))
+        set(.meshRenderer, ecs.has(MeshRendererComponent.self, entity))
+        set(.light, ecs.has(LightComponent.self, entity))
+        set(.skyLight, ecs.has(SkyLightComponent.self, entity))
+        set(.material, ecs.has(MaterialComponent.self, entity))
+        set(.camera, ecs.has(CameraComponent.self, entity))
+        set(.rigidbody, ecs.has(RigidbodyComponent.self, entity))
+        set(.collider, ecs.has(ColliderComponent.self, entity))
+        set(.script, ecs.has(ScriptComponent.self, entity))
+        set(.characterController, ecs.has(CharacterControllerComponent.self, entity))
+        set(.skinnedMesh, ecs.has(SkinnedMeshComponent.self, entity))
+        set(.animator, ecs.has(AnimatorComponent.self, entity))
+        set(.reflectionProbe, ecs.has(ReflectionProbeComponent.self, entity))
+        set(.environment, ecs.has(EnvironmentComponent.self, entity))
+        return mask
+    }
+
     static func addComponent(_ contextPtr: UnsafeRawPointer?, _ entityId: UnsafePointer<CChar>?, _ componentType: Int32) -> UInt32 {
         guard let context = EditorBridgeInternals.contextValue(contextPtr),
               !context.bridgeServices.isPlaying,
@@ -105,7 +129,9 @@ enum EditorComponentCommands {
             ecs.add(EnvironmentRuntimeStateComponent.default(from: environment), to: entity)
             ecs.add(EnvironmentIBLStateComponent.defaultNeedsRebuild, to: entity)
         }
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        // Hierarchy rows show the name and component icons, so adds rebuild them as well.
+        context.bridgeServices.notifyComponentLayoutMutation()
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return 1
     }
 }
@@ -6,6 +6,98 @@ import Foundation
 import MetalCupEngine
 import simd
 
+public struct MCETransformBlockBridge {
+    public var positionX: Float
+    public var positionY: Float
+    public var positionZ: Float
+    public var rotationX: Float
+    public var rotationY: Float
+    public var rotationZ: Float
+    public var scaleX: Float
+    public var scaleY: Float
+    public var scaleZ: Float
+}
+
+public struct MCECameraBlockBridge {
+    public var projectionType: Int32
+    public var fovDegrees: Float
+    public var orthoSize: Float
+    public var nearPlane: Float
+    public var farPlane: Float
+    public var isPrimary: UInt32
+    public var isEditor: UInt32
+    public var exposureEV: Float
+}
+
+public struct MCELightBlockBridge {
+    public var type: Int32
+    public var colorX: Float
+    public var colorY: Float
+    public var colorZ: Float
+    public var brightness: Float
+    public var range: Float
+    public var innerCos: Float
+    public var outerCos: Float
+    public var directionX: Float
+    public var directionY: Float
+    public var directionZ: Float
+    public var castsShadows: UInt32
+}
+
+public struct MCERigidbodyBlockBridge {
+    public var isEnabled: UInt32
+    public var motionType: Int32
+    public var mass: Float
+    public var friction: Float
+    public var restitution: Float
+    public var linearDamping: Float
+    public var angularDamping: Float
+    public var gravityFactor: Float
+    public var allowSleeping: UInt32
+    public var ccdEnabled: UInt32
+    public var collisionLayer: Int32
+}
+
+public struct MCEColliderShapeBlockBridge {
+    public var isEnabled: UInt32
+    public var shapeType: Int32
+    public var boxX: Float
+    public var boxY: Float
+    public var boxZ: Float
+    public var sphereRadius: Float
+    public var capsuleHalfHeight: Float
+    public var capsuleRadius: Float
+    public var offsetX: Float
+    public var offsetY: Float
+    public var offsetZ: Float
+    public var rotationX: Float
+    public var rotationY: Float
+    public var rotationZ: Float
+    public var isTrigger: UInt32
+    public var hasLayerOverride: UInt32
+    public var layerOverride: Int32
+}
+
+/// The first `EditorComponentBlocks.colliderShapeCapacity` shapes of a collider. `shapeCount` is the
+/// component's full shape count, which can exceed the capacity.
+public struct MCEColliderBlockBridge {
+    public var shapeCount: Int32
+    public var shapes: (MCEColliderShapeBlockBridge, MCEColliderShapeBlockBridge,
+                        MCEColliderShapeBlockBridge, MCEColliderShapeBlockBridge,
+                        MCEColliderShapeBlockBridge, MCEColliderShapeBlockBridge,
+                        MCEColliderShapeBlockBridge, MCEColliderShapeBlockBridge)
+}
+
+public struct MCEWorldIconBridge {
+    public var handleHigh: UInt64
+    public var handleLow: UInt64
+    public var positionX: Float
+    public var positionY: Float
+    public var positionZ: Float
+    public var kind: Int32
+    public var status: Int32
+}
+
 public struct MCEEnvironmentLookBridge {
     public var preset: Int32
     public var mood: Float
@@ -963,6 +1055,8 @@ enum EditorBridgeInternals {
     static func entityValue(from idPointer: UnsafePointer<CChar>?, context: MCEContext) -> Entity? { entity(from: idPointer, context: context) }
     static func cStringWrite(_ string: String, to buffer: UnsafeMutablePointer<CChar>?, max: Int32) -> Int32 { writeCString(string, to: buffer, max: max) }
     static func assetHandleValue(_ string: String) -> AssetHandle? { handleFromString(string) }
+    static func uuidPartsValue(_ uuid: UUID) -> (high: UInt64, low: UInt64) { uuidParts(uuid) }
+    static func uuidValue(high: UInt64, low: UInt64) -> UUID { uuidFromParts(high: high, low: low) }
     static func submeshMaterialHandlesValue(_ raw: String) -> [AssetHandle?] { parseSubmeshMaterialHandles(raw) }
     static func assetMetadataValue(for handle: AssetHandle, snapshot: [AssetMetadata]) -> AssetMetadata? { metadata(for: handle, in: snapshot) }
     static func prefabURLValue(from handleString: String, context: MCEContext) -> URL? { prefabURL(from: handleString, context: context) }
@@ -1013,6 +1107,16 @@ enum EditorBridgeInternals {
         }
         context.bridgeServices.notifySceneMutation()
     }
+
+    static func commitHierarchyMutation(_ context: MCEContext, label: String) {
+        context.bridgeServices.notifyHierarchyMutation()
+        commitMutation(context, label: label)
+    }
+
+    static func commitComponentLayoutMutation(_ context: MCEContext, label: String) {
+        context.bridgeServices.notifyComponentLayoutMutation()
+        commitMutation(context, label: label)
+    }
 }
 
 @_cdecl("MCEEditorGetEntityCount")
@@ -1072,6 +1176,31 @@ public func MCEEditorGetChildEntityIdAt(_ contextPtr: UnsafeRawPointer?,
     EditorSceneQueries.getChildEntityIdAt(contextPtr, parentId, index, buffer, bufferSize)
 }
 
+@_cdecl("MCEEditorGetHierarchyGeneration")
+public func MCEEditorGetHierarchyGeneration(_ contextPtr: UnsafeRawPointer?) -> UInt64 {
+    EditorSceneQueries.getHierarchyGeneration(contextPtr)
+}
+
+@_cdecl("MCEEditorGetHierarchySnapshot")
+public func MCEEditorGetHierarchySnapshot(_ contextPtr: UnsafeRawPointer?,
+                                          _ idsOut: UnsafeMutablePointer<CChar>?,
+                                          _ idStride: Int32,
+                                          _ namesOut: UnsafeMutablePointer<CChar>?,
+                                          _ nameStride: Int32,
+                                          _ depthsOut: UnsafeMutablePointer<Int32>?,
+                                          _ maxCount: Int32) -> Int32 {
+    EditorSceneQueries.getHierarchySnapshot(contextPtr, idsOut, idStride, namesOut, nameStride, depthsOut, maxCount)
+}
+
+@_cdecl("MCEEditorGetWorldIcons")
+public func MCEEditorGetWorldIcons(_ contextPtr: UnsafeRawPointer?,
+                                   _ viewMatrix: UnsafePointer<Float>?,
+                                   _ projectionMatrix: UnsafePointer<Float>?,
+                                   _ iconsOut: UnsafeMutableRawPointer?,
+                                   _ maxCount: Int32) -> Int32 {
+    EditorSceneQueries.getWorldIcons(contextPtr, viewMatrix, projectionMatrix, iconsOut, maxCount)
+}
+
 @_cdecl("MCEEditorGetParentEntityId")
 public func MCEEditorGetParentEntityId(_ contextPtr: UnsafeRawPointer?,
                                        _ childId: UnsafePointer<CChar>?,
@@ -1124,6 +1253,90 @@ public func MCEEditorEntityExists(_ contextPtr: UnsafeRawPointer?, _ entityId: U
     EditorSceneQueries.entityExists(contextPtr, entityId)
 }
 
+@_cdecl("MCEEditorEntityHandleIsValid")
+public func MCEEditorEntityHandleIsValid(_ contextPtr: UnsafeRawPointer?, _ entity: MCEEntityHandle) -> UInt32 {
+    EditorEntityHandleQueries.isValid(contextPtr, entity)
+}
+
+@_cdecl("MCEEditorGetEntityHandle")
+public func MCEEditorGetEntityHandle(_ contextPtr: UnsafeRawPointer?,
+                                     _ entityId: UnsafePointer<CChar>?,
+                                     _ handleOut: UnsafeMutablePointer<MCEEntityHandle>?) -> UInt32 {
+    EditorEntityHandleQueries.getEntityHandle(contextPtr, entityId, handleOut)
+}
+
+@_cdecl("MCEEditorGetComponentMaskH")
+public func MCEEditorGetComponentMaskH(_ contextPtr: UnsafeRawPointer?, _ entity: MCEEntityHandle) -> UInt32 {
+    EditorEntityHandleQueries.getComponentMask(contextPtr, entity)
+}
+
+@_cdecl("MCEEditorEntityHasComponentH")
+public func MCEEditorEntityHasComponentH(_ contextPtr: UnsafeRawPointer?,
+                                         _ entity: MCEEntityHandle,
+                                         _ componentType: Int32) -> UInt32 {
+    EditorEntityHandleQueries.entityHasComponent(contextPtr, entity, componentType)
+}
+
+@_cdecl("MCEEditorGetEntityNameH")
+public func MCEEditorGetEntityNameH(_ contextPtr: UnsafeRawPointer?,
+                                    _ entity: MCEEntityHandle,
+                                    _ buffer: UnsafeMutablePointer<CChar>?,
+                                    _ bufferSize: Int32) -> Int32 {
+    EditorEntityHandleQueries.getEntityName(contextPtr, entity, buffer, bufferSize)
+}
+
+@_cdecl("MCEEditorGetModelMatrixH")
+public func MCEEditorGetModelMatrixH(_ contextPtr: UnsafeRawPointer?,
+                                     _ entity: MCEEntityHandle,
+                                     _ matrixOut: UnsafeMutablePointer<Float>?) -> UInt32 {
+    EditorEntityHandleQueries.getModelMatrix(contextPtr, entity, matrixOut)
+}
+
+@_cdecl("MCEEditorGetTransformH")
+public func MCEEditorGetTransformH(_ contextPtr: UnsafeRawPointer?,
+                                   _ entity: MCEEntityHandle,
+                                   _ px: UnsafeMutablePointer<Float>?, _ py: UnsafeMutablePointer<Float>?, _ pz: UnsafeMutablePointer<Float>?,
+                                   _ rx: UnsafeMutablePointer<Float>?, _ ry: UnsafeMutablePointer<Float>?, _ rz: UnsafeMutablePointer<Float>?,
+                                   _ sx: UnsafeMutablePointer<Float>?, _ sy: UnsafeMutablePointer<Float>?, _ sz: UnsafeMutablePointer<Float>?) -> UInt32 {
+    EditorEntityHandleQueries.getTransform(contextPtr, entity, px, py, pz, rx, ry, rz, sx, sy, sz)
+}
+
+@_cdecl("MCEEditorGetParentEntityHandle")
+public func MCEEditorGetParentEntityHandle(_ contextPtr: UnsafeRawPointer?,
+                                           _ child: MCEEntityHandle,
+                                           _ parentOut: UnsafeMutablePointer<MCEEntityHandle>?) -> UInt32 {
+    EditorEntityHandleQueries.getParentEntityHandle(contextPtr, child, parentOut)
+}
+
+@_cdecl("MCEEditorGetSelectedEntityHandles")
+public func MCEEditorGetSelectedEntityHandles(_ contextPtr: UnsafeRawPointer?,
+                                              _ handlesOut: UnsafeMutablePointer<MCEEntityHandle>?,
+                                              _ maxCount: Int32) -> Int32 {
+    EditorEntityHandleQueries.getSelectedEntityHandles(contextPtr, handlesOut, maxCount)
+}
+
+@_cdecl("MCEEditorGetComponentBlock")
+public func MCEEditorGetComponentBlock(_ contextPtr: UnsafeRawPointer?,
+                                       _ entity: MCEEntityHandle,
+                                       _ componentType: Int32,
+                                       _ knownRevision: UInt64,
+                                       _ blockOut: UnsafeMutableRawPointer?,
+                                       _ blockSize: Int32,
+                                       _ revisionOut: UnsafeMutablePointer<UInt64>?) -> UInt32 {
+    EditorComponentBlocks.getBlock(contextPtr, entity, componentType, knownRevision, blockOut, blockSize, revisionOut)
+}
+
+@_cdecl("MCEEditorCommitComponentBlock")
+public func MCEEditorCommitComponentBlock(_ contextPtr: UnsafeRawPointer?,
+                                          _ entities: UnsafePointer<MCEEntityHandle>?,
+                                          _ entityCount: Int32,
+                                          _ componentType: Int32,
+                                          _ block: UnsafeRawPointer?,
+                                          _ blockSize: Int32,
+                                          _ dirtyMask: UInt32) -> Int32 {
+    EditorComponentBlocks.commitBlock(contextPtr, entities, entityCount, componentType, block, blockSize, dirtyMask)
+}
+
 @_cdecl("MCEEditorEntityIsAutoDrivenSkySun")
 public func MCEEditorEntityIsAutoDrivenSkySun(_ contextPtr: UnsafeRawPointer?, _ entityId: UnsafePointer<CChar>?) -> UInt32 {
     EditorSceneQueries.entityIsAutoDrivenSkySun(contextPtr, entityId)
@@ -1289,6 +1502,7 @@ public func MCEEditorApplyPrefabInstanceToAsset(_ contextPtr: UnsafeRawPointer?,
 
         resolved.scene.ecs.remove(PrefabOverrideComponent.self, from: resolved.entity)
         context.engineContext.prefabSystem.applyPrefabs(handles: Set([resolved.link.prefabHandle]), to: resolved.scene)
+        context.bridgeServices.notifyHierarchyMutation()
         context.bridgeServices.notifySceneMutation()
         return 1
     } catch {
@@ -1319,6 +1533,7 @@ public func MCEEditorRevertPrefabInstance(_ contextPtr: UnsafeRawPointer?,
 
     resolved.scene.ecs.remove(PrefabOverrideComponent.self, from: resolved.entity)
     guard context.engineContext.prefabSystem.reapplyInstance(entity: resolved.entity, in: resolved.scene) else { return 0 }
+    context.bridgeServices.notifyHierarchyMutation()
     context.bridgeServices.notifySceneMutation()
     return 1
 }
@@ -1428,7 +1643,8 @@ public func MCEEditorRemoveComponent(_ contextPtr: UnsafeRawPointer?,
         ecs.remove(EnvironmentRuntimeStateComponent.self, from: entity)
         ecs.remove(EnvironmentIBLStateComponent.self, from: entity)
     }
-    context.bridgeServices.notifySceneMutation()
+    context.bridgeServices.notifyComponentLayoutMutation()
+    EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
     return 1
 }
 
@@ -2147,6 +2363,7 @@ public func MCEEditorCharacterControllerCreateRecommendedHierarchy(_ contextPtr:
 
     if didMutate {
         ecs.add(controller, to: root)
+        context.bridgeServices.notifyHierarchyMutation()
         context.bridgeServices.notifySceneMutation()
     }
     return didMutate ? 1 : 0
@@ -76,7 +76,7 @@ enum EditorEntityCommands {
         let success = ecs.setParent(child, EditorBridgeInternals.entityValue(from: parentId, context: context), keepWorldTransform: keepWorldTransform != 0)
         if success {
             EditorBridgeInternals.markHierarchyOverrideValue(ecs, child)
-            EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+            EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         }
         return success ? 1 : 0
     }
@@ -90,7 +90,7 @@ enum EditorEntityCommands {
         let success = ecs.unparent(child, keepWorldTransform: keepWorldTransform != 0)
         if success {
             EditorBridgeInternals.markHierarchyOverrideValue(ecs, child)
-            EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+            EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         }
         return success ? 1 : 0
     }
@@ -104,7 +104,7 @@ enum EditorEntityCommands {
         let success = ecs.reorderChild(parent: EditorBridgeInternals.entityValue(from: parentId, context: context), child: child, newIndex: Int(newIndex))
         if success {
             EditorBridgeInternals.markHierarchyOverrideValue(ecs, child)
-            EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+            EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         }
         return success ? 1 : 0
     }
@@ -118,7 +118,7 @@ enum EditorEntityCommands {
               let name else { return }
         let newName = String(cString: name)
         ecs.add(NameComponent(name: newName), to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         context.engineContext.log.logInfo("Entity renamed: \(entity.id.uuidString) \(newName)", category: .scene)
     }
 
@@ -129,7 +129,7 @@ enum EditorEntityCommands {
               !context.bridgeServices.isSimulating,
               let ecs = EditorBridgeInternals.ecsValue(context) else { return 0 }
         let entity = ecs.createEntity(name: name != nil ? String(cString: name!) : "Entity")
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -159,7 +159,7 @@ enum EditorEntityCommands {
                                                           default: TransformComponent(),
                                                           source: .editor)
         ecs.add(MeshRendererComponent(meshHandle: meshHandle), to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -175,7 +175,7 @@ enum EditorEntityCommands {
                                                           default: TransformComponent(),
                                                           source: .editor)
         ecs.add(MeshRendererComponent(meshHandle: EditorBridgeInternals.assetHandleValue(meshString)), to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -275,7 +275,7 @@ enum EditorEntityCommands {
             category: .assets
         )
 #endif
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -366,7 +366,7 @@ enum EditorEntityCommands {
         )
 #endif
 
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -388,7 +388,7 @@ enum EditorEntityCommands {
                                                           default: TransformComponent(),
                                                           source: .editor)
         ecs.add(LightComponent(type: lightTypeValue), to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -404,7 +404,7 @@ enum EditorEntityCommands {
         ecs.add(EnvironmentStateComponent(seededFromAuthored: sky), to: entity)
         ecs.add(SkyIBLStateComponent(needsRebuild: true), to: entity)
         EditorBridgeInternals.setActiveSkyValue(ecs: ecs, entity: entity, logger: context.engineContext.log)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -418,7 +418,7 @@ enum EditorEntityCommands {
         ecs.add(environment, to: entity)
         ecs.add(EnvironmentRuntimeStateComponent.default(from: environment), to: entity)
         ecs.add(EnvironmentIBLStateComponent.defaultNeedsRebuild, to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -433,7 +433,7 @@ enum EditorEntityCommands {
             component.isPrimary = true
         }
         ecs.add(component, to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -453,7 +453,7 @@ enum EditorEntityCommands {
         component.isEditor = false
         component.isPrimary = !EditorBridgeInternals.hasPrimaryRuntimeCameraValue(ecs: ecs)
         ecs.add(component, to: entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         return EditorBridgeInternals.cStringWrite(entity.id.uuidString, to: outId, max: outIdSize)
     }
 
@@ -522,7 +522,7 @@ enum EditorEntityCommands {
 
         let newSelectionIds = duplicatedRoots.map { $0.id }
         context.bridgeServices.setSelectedEntityIds(newSelectionIds, primary: duplicatedRoots.last?.id)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
         if let primary = duplicatedRoots.last {
             return EditorBridgeInternals.cStringWrite(primary.id.uuidString, to: outPrimaryId, max: outPrimaryIdSize)
         }
@@ -536,7 +536,7 @@ enum EditorEntityCommands {
               let ecs = EditorBridgeInternals.ecsValue(context),
               let entity = EditorBridgeInternals.entityValue(from: entityId, context: context) else { return }
         ecs.destroyEntity(entity)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
     }
 
     static func destroySelectedEntities(_ contextPtr: UnsafeRawPointer?) {
@@ -560,6 +560,6 @@ enum EditorEntityCommands {
             ecs.destroyEntity(entity)
         }
         context.bridgeServices.setSelectedEntityIds([], primary: nil)
-        EditorBridgeInternals.commitMutation(context, label: "EditorCommand")
+        EditorBridgeInternals.commitHierarchyMutation(context, label: "EditorCommand")
     }
 }
@@ -0,0 +1,110 @@
+/// EditorEntityHandle.h
+/// Defines the fixed-size binary entity handle shared by the editor C ABI.
+/// Created by Kaden Cringle
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "MCEBridgeMacros.h"
+
+/// 16-byte entity UUID split into big-endian halves (same layout as the asset handle high/low pairs).
+typedef struct {
+    uint64_t high;
+    uint64_t low;
+} MCEEntityHandle;
+
+static inline MCEEntityHandle MCEEntityHandleNull(void) {
+    MCEEntityHandle handle = {0, 0};
+    return handle;
+}
+
+static inline uint32_t MCEEntityHandleIsNull(MCEEntityHandle handle) {
+    return (handle.high == 0 && handle.low == 0) ? 1 : 0;
+}
+
+static inline uint32_t MCEEntityHandleEquals(MCEEntityHandle lhs, MCEEntityHandle rhs) {
+    return (lhs.high == rhs.high && lhs.low == rhs.low) ? 1 : 0;
+}
+
+static inline int MCEEntityHandleHexValue(char c) {
+    if (c >= '0' && c <= '9') { return c - '0'; }
+    if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+    if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+    return -1;
+}
+
+/// Parses a canonical 36-character UUID string. Returns 0 and writes a null handle on malformed input.
+static inline uint32_t MCEEntityHandleFromId(const char *entityId, MCEEntityHandle *out) {
+    if (!out) { return 0; }
+    *out = MCEEntityHandleNull();
+    if (!entityId) { return 0; }
+    uint64_t halves[2] = {0, 0};
+    int nibbles = 0;
+    int i = 0;
+    for (; entityId[i] != 0 && i < 36; ++i) {
+        const char c = entityId[i];
+        if (i == 8 || i == 13 || i == 18 || i == 23) {
+            if (c != '-') { return 0; }
+            continue;
+        }
+        const int value = MCEEntityHandleHexValue(c);
+        if (value < 0) { return 0; }
+        uint64_t *half = &halves[nibbles < 16 ? 0 : 1];
+        *half = (*half << 4) | (uint64_t)value;
+        nibbles += 1;
+    }
+    if (i != 36 || entityId[36] != 0 || nibbles != 32) { return 0; }
+    out->high = halves[0];
+    out->low = halves[1];
+    return 1;
+}
+
+/// Formats a handle as an uppercase UUID string (matching Swift's `uuidString`). Returns the length written.
+static inline int32_t MCEEntityHandleToId(MCEEntityHandle handle, char *buffer, int32_t bufferSize) {
+    if (!buffer || bufferSize < 37) {
+        if (buffer && bufferSize > 0) { buffer[0] = 0; }
+        return 0;
+    }
+    static const char digits[] = "0123456789ABCDEF";
+    int out = 0;
+    for (int nibble = 0; nibble < 32; ++nibble) {
+        if (nibble == 8 || nibble == 12 || nibble == 16 || nibble == 20) {
+            buffer[out++] = '-';
+        }
+        const uint64_t half = nibble < 16 ? handle.high : handle.low;
+        const int shift = (15 - (nibble % 16)) * 4;
+        buffer[out++] = digits[(half >> shift) & 0xF];
+    }
+    buffer[out] = 0;
+    return out;
+}
+
+// ABI entry points are implemented in Swift (@_cdecl); only C++ callers need the prototypes.
+#ifdef __cplusplus
+extern "C" {
+
+uint32_t MCEEditorEntityHandleIsValid(MCE_CTX, MCEEntityHandle entity);
+uint32_t MCEEditorGetEntityHandle(MCE_CTX, const char *entityId, MCEEntityHandle *out);
+uint32_t MCEEditorGetComponentMaskH(MCE_CTX, MCEEntityHandle entity);
+uint32_t MCEEditorEntityHasComponentH(MCE_CTX, MCEEntityHandle entity, int32_t componentType);
+int32_t MCEEditorGetEntityNameH(MCE_CTX, MCEEntityHandle entity, char *buffer, int32_t bufferSize);
+uint32_t MCEEditorGetModelMatrixH(MCE_CTX, MCEEntityHandle entity, float *matrixOut);
+uint32_t MCEEditorGetTransformH(MCE_CTX, MCEEntityHandle entity,
+                                float *px, float *py, float *pz,
+                                float *rx, float *ry, float *rz,
+                                float *sx, float *sy, float *sz);
+uint32_t MCEEditorGetParentEntityHandle(MCE_CTX, MCEEntityHandle child, MCEEntityHandle *parentOut);
+int32_t MCEEditorGetSelectedEntityHandles(MCE_CTX, MCEEntityHandle *handlesOut, int32_t maxCount);
+
+/// Component block ABI. Get returns 0 when missing, 1 when the block was written, and 2 when
+/// `knownRevision` is still the component's stamp (the caller's copy is current). Stamps are per
+/// component and only advance when the entity or the block contents change. Commit applies only the
+/// fields flagged in `dirtyMask` to every handle and returns the number of entities updated.
+uint32_t MCEEditorGetComponentBlock(MCE_CTX, MCEEntityHandle entity, int32_t componentType, uint64_t knownRevision,
+                                    void *blockOut, int32_t blockSize, uint64_t *revisionOut);
+int32_t MCEEditorCommitComponentBlock(MCE_CTX, const MCEEntityHandle *entities, int32_t entityCount, int32_t componentType,
+                                      const void *block, int32_t blockSize, uint32_t dirtyMask);
+
+}
+#endif
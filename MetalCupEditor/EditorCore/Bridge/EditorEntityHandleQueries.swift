@@ -0,0 +1,140 @@
+import Foundation
+import MetalCupEngine
+
+/// Remembers the most recent handle resolution. Panels query the same entity many times per frame
+/// (inspector sections, gizmo, outline), so a single entry keyed on the hierarchy generation skips
+/// the UUID lookup for nearly every call while staying correct across structural edits and scene swaps.
+/// The generation only tracks editor-side mutations, so while playing or simulating, where scripts and
+/// physics can destroy entities without an editor command, every call goes straight to the ECS.
+final class EditorEntityHandleCache {
+    private var generation: UInt64 = 0
+    private var high: UInt64 = 0
+    private var low: UInt64 = 0
+    private var entity: Entity?
+
+    func resolve(_ handle: MCEEntityHandle, context: MCEContext) -> Entity? {
+        if handle.high == 0 && handle.low == 0 { return nil }
+        let services = context.bridgeServices
+        let uuid = EditorBridgeInternals.uuidValue(high: handle.high, low: handle.low)
+        if services.isPlaying || services.isSimulating {
+            entity = nil
+            return EditorBridgeInternals.ecsValue(context)?.entity(with: uuid)
+        }
+        let currentGeneration = services.hierarchyGeneration
+        if let entity, generation == currentGeneration, high == handle.high, low == handle.low {
+            return entity
+        }
+        guard let resolved = EditorBridgeInternals.ecsValue(context)?.entity(with: uuid) else { return nil }
+        generation = currentGeneration
+        high = handle.high
+        low = handle.low
+        entity = resolved
+        return resolved
+    }
+}
+
+enum EditorEntityHandleQueries {
+    static func entityValue(_ handle: MCEEntityHandle, context: MCEContext) -> Entity? {
+        context.entityHandleCache.resolve(handle, context: context)
+    }
+
+    static func handleValue(_ uuid: UUID) -> MCEEntityHandle {
+        let parts = EditorBridgeInternals.uuidPartsValue(uuid)
+        return MCEEntityHandle(high: parts.high, low: parts.low)
+    }
+
+    static func isValid(_ contextPtr: UnsafeRawPointer?, _ handle: MCEEntityHandle) -> UInt32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              entityValue(handle, context: context) != nil else { return 0 }
+        return 1
+    }
+
+    static func getEntityHandle(_ contextPtr: UnsafeRawPointer?,
+                                _ entityId: UnsafePointer<CChar>?,
+                                _ handleOut: UnsafeMutablePointer<MCEEntityHandle>?) -> UInt32 {
+        guard let handleOut else { return 0 }
+        handleOut.pointee = MCEEntityHandle(high: 0, low: 0)
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let entity = EditorBridgeInternals.entityValue(from: entityId, context: context) else { return 0 }
+        handleOut.pointee = handleValue(entity.id)
+        return 1
+    }
+
+    static func getComponentMask(_ contextPtr: UnsafeRawPointer?, _ handle: MCEEntityHandle) -> UInt32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let entity = entityValue(handle, context: context) else { return 0 }
+        return EditorComponentCommands.componentMask(ecs: ecs, entity: entity)
+    }
+
+    static func entityHasComponent(_ contextPtr: UnsafeRawPointer?, _ handle: MCEEntityHandle, _ componentType: Int32) -> UInt32 {
+        guard componentType >= 0, componentType < 32 else { return 0 }
+        return (getComponentMask(contextPtr, handle) >> UInt32(componentType)) & 1
+    }
+
+    static func getEntityName(_ contextPtr: UnsafeRawPointer?, _ handle: MCEEntityHandle,
+                              _ buffer: UnsafeMutablePointer<CChar>?, _ bufferSize: Int32) -> Int32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let entity = entityValue(handle, context: context) else { return 0 }
+        let name = ecs.get(NameComponent.self, for: entity)?.name ?? ""
+        return EditorBridgeInternals.cStringWrite(name, to: buffer, max: bufferSize)
+    }
+
+    static func getModelMatrix(_ contextPtr: UnsafeRawPointer?, _ handle: MCEEntityHandle,
+                               _ matrixOut: UnsafeMutablePointer<Float>?) -> UInt32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let entity = entityValue(handle, context: context),
+              ecs.get(TransformComponent.self, for: entity) != nil,
+              let matrixOut else { return 0 }
+        EditorBridgeInternals.matrixWrite(ecs.worldMatrix(for: entity), to: matrixOut)
+        return 1
+    }
+
+    static func getTransform(_ contextPtr: UnsafeRawPointer?, _ handle: MCEEntityHandle,
+                             _ px: UnsafeMutablePointer<Float>?, _ py: UnsafeMutablePointer<Float>?, _ pz: UnsafeMutablePointer<Float>?,
+                             _ rx: UnsafeMutablePointer<Float>?, _ ry: UnsafeMutablePointer<Float>?, _ rz: UnsafeMutablePointer<Float>?,
+                             _ sx: UnsafeMutablePointer<Float>?, _ sy: UnsafeMutablePointer<Float>?, _ sz: UnsafeMutablePointer<Float>?) -> UInt32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let entity = entityValue(handle, context: context),
+              let transform = ecs.get(TransformComponent.self, for: entity) else { return 0 }
+        px?.pointee = transform.position.x
+        py?.pointee = transform.position.y
+        pz?.pointee = transform.position.z
+        let euler = TransformMath.eulerFromQuaternionXYZ(transform.rotation)
+        rx?.pointee = euler.x
+        ry?.pointee = euler.y
+        rz?.pointee = euler.z
+        sx?.pointee = transform.scale.x
+        sy?.pointee = transform.scale.y
+        sz?.pointee = transform.scale.z
+        return 1
+    }
+
+    static func getParentEntityHandle(_ contextPtr: UnsafeRawPointer?, _ child: MCEEntityHandle,
+                                      _ parentOut: UnsafeMutablePointer<MCEEntityHandle>?) -> UInt32 {
+        guard let parentOut else { return 0 }
+        parentOut.pointee = MCEEntityHandle(high: 0, low: 0)
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let ecs = EditorBridgeInternals.ecsValue(context),
+              let entity = entityValue(child, context: context),
+              let parent = ecs.getParent(entity) else { return 0 }
+        parentOut.pointee = handleValue(parent.id)
+        return 1
+    }
+
+    static func getSelectedEntityHandles(_ contextPtr: UnsafeRawPointer?,
+                                         _ handlesOut: UnsafeMutablePointer<MCEEntityHandle>?,
+                                         _ maxCount: Int32) -> Int32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+        let ids = context.bridgeServices.selectedEntityIds()
+        if let handlesOut, maxCount > 0 {
+            for (index, id) in ids.prefix(Int(maxCount)).enumerated() {
+                handlesOut[index] = handleValue(id)
+            }
+        }
+        return Int32(ids.count)
+    }
+}
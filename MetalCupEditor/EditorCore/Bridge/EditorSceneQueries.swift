@@ -57,6 +57,41 @@ enum EditorSceneQueries {
         return EditorBridgeInternals.cStringWrite(children[Int(index)].id.uuidString, to: buffer, max: bufferSize)
     }
 
+    static func getHierarchyGeneration(_ contextPtr: UnsafeRawPointer?) -> UInt64 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+        return context.bridgeServices.hierarchyGeneration
+    }
+
+    /// Writes the visible hierarchy in depth-first order (ids, names, depths) in a single call.
+    /// Returns the total node count; only the first `maxCount` nodes are written.
+    static func getHierarchySnapshot(_ contextPtr: UnsafeRawPointer?,
+                                     _ idsOut: UnsafeMutablePointer<CChar>?, _ idStride: Int32,
+                                     _ namesOut: UnsafeMutablePointer<CChar>?, _ nameStride: Int32,
+                                     _ depthsOut: UnsafeMutablePointer<Int32>?,
+                                     _ maxCount: Int32) -> Int32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr), let ecs = EditorBridgeInternals.ecsValue(context) else { return 0 }
+        var stack: [(entity: Entity, depth: Int32)] = visibleRootEditorEntities(ecs).reversed().map { ($0, 0) }
+        var count: Int32 = 0
+        while let node = stack.popLast() {
+            if count < maxCount {
+                let offset = Int(count)
+                if let idsOut, idStride > 0 {
+                    _ = EditorBridgeInternals.cStringWrite(node.entity.id.uuidString, to: idsOut + offset * Int(idStride), max: idStride)
+                }
+                if let namesOut, nameStride > 0 {
+                    let name = ecs.get(NameComponent.self, for: node.entity)?.name ?? ""
+                    _ = EditorBridgeInternals.cStringWrite(name, to: namesOut + offset * Int(nameStride), max: nameStride)
+                }
+                depthsOut?[offset] = node.depth
+            }
+            count += 1
+            for child in visibleEditorChildren(ecs, parent: node.entity).reversed() {
+                stack.append((child, node.depth + 1))
+            }
+        }
+        return count
+    }
+
     static func getParentEntityId(_ contextPtr: UnsafeRawPointer?, _ childId: UnsafePointer<CChar>?,
                                   _ buffer: UnsafeMutablePointer<CChar>?, _ bufferSize: Int32) -> Int32 {
         guard let context = EditorBridgeInternals.contextValue(contextPtr),
@@ -120,6 +155,89 @@ enum EditorSceneQueries {
         return 1
     }
 
+    /// Icons whose unclamped on-screen size would fall below this are culled before the min-size
+    /// clamp; it matches the viewport's icon scaling (base / (1 + depth * distanceScale * 0.1)).
+    private static let minVisibleWorldIconPixels: Float = 2.0
+
+    /// Writes the visible world icons (position, icon kind, probe status) in one call.
+    /// Kinds: 0 camera, 1 reflection probe, 2 point light, 3 spot light, 4 directional light.
+    /// With `viewMatrix` and `projectionMatrix`, icons outside the frustum or too small on screen are
+    /// culled here, from cached positions, before any per-icon work. Returns the visible icon count;
+    /// only the first `maxCount` entries are written.
+    static func getWorldIcons(_ contextPtr: UnsafeRawPointer?,
+                              _ viewMatrix: UnsafePointer<Float>?,
+                              _ projectionMatrix: UnsafePointer<Float>?,
+                              _ iconsOut: UnsafeMutableRawPointer?,
+                              _ maxCount: Int32) -> Int32 {
+        guard let context = EditorBridgeInternals.contextValue(contextPtr),
+              let ecs = EditorBridgeInternals.ecsValue(context) else { return 0 }
+        let icons = context.worldIconIndex.icons(context: context, rebuild: {
+            visibleEditorEntities(ecs).filter {
+                ecs.has(CameraComponent.self, $0)
+                    || ecs.has(ReflectionProbeComponent.self, $0)
+                    || ecs.has(LightComponent.self, $0)
+            }
+        }, resolve: { entity in
+            let kind: Int32
+            if let camera = ecs.get(CameraComponent.self, for: entity) {
+                if camera.isEditor { return nil }
+                kind = 0
+            } else if ecs.has(ReflectionProbeComponent.self, entity) {
+                kind = 1
+            } else if let light = ecs.get(LightComponent.self, for: entity) {
+                switch light.type {
+                case .spot: kind = 3
+                case .directional: kind = 4
+                default: kind = 2
+                }
+            } else {
+                return nil
+            }
+            guard ecs.has(TransformComponent.self, entity) else { return nil }
+            let world = ecs.worldMatrix(for: entity).columns.3
+            return EditorWorldIconIndex.Icon(entity: entity, kind: kind, position: SIMD3<Float>(world.x, world.y, world.z))
+        })
+
+        let view = viewMatrix.map { EditorBridgeInternals.matrixRead(from: $0) }
+        let projection = projectionMatrix.map { EditorBridgeInternals.matrixRead(from: $0) }
+        let settings = context.editorProjectManager
+        let baseSize = settings.viewportWorldIconBaseSize()
+        let distanceScale = settings.viewportWorldIconDistanceScale()
+        let output = iconsOut?.assumingMemoryBound(to: MCEWorldIconBridge.self)
+        let capacity = max(0, Int(maxCount))
+        let renderer = context.engineContext.renderer
+        let runtimeScene = context.bridgeServices.isPlaying ? context.bridgeServices.runtimeScene : nil
+        var count = 0
+        for icon in icons {
+            if let view, let projection {
+                let viewPosition = view * SIMD4<Float>(icon.position, 1)
+                let clip = projection * viewPosition
+                guard clip.w > 0.0001 else { continue }
+                let ndc = SIMD3<Float>(clip.x, clip.y, clip.z) / clip.w
+                guard all(abs(ndc) .<= SIMD3<Float>(repeating: 1)) else { continue }
+                let scaled = baseSize / (1 + abs(viewPosition.z) * distanceScale * 0.1)
+                guard scaled >= minVisibleWorldIconPixels else { continue }
+            }
+            if let output, count < capacity {
+                var status: Int32 = 0
+                if icon.kind == 1, let runtimeScene, let renderer,
+                   let bakeStatus = renderer.reflectionProbeBakeStatus(scene: runtimeScene, entityID: icon.entity.id) {
+                    status = bakeStatus.rawValue
+                }
+                let handle = EditorEntityHandleQueries.handleValue(icon.entity.id)
+                output[count] = MCEWorldIconBridge(handleHigh: handle.high,
+                                                   handleLow: handle.low,
+                                                   positionX: icon.position.x,
+                                                   positionY: icon.position.y,
+                                                   positionZ: icon.position.z,
+                                                   kind: icon.kind,
+                                                   status: status)
+            }
+            count += 1
+        }
+        return Int32(count)
+    }
+
     static func getEditorCameraMatrices(_ contextPtr: UnsafeRawPointer?, _ viewOut: UnsafeMutablePointer<Float>?,
                                         _ projectionOut: UnsafeMutablePointer<Float>?) -> UInt32 {
         guard let context = EditorBridgeInternals.contextValue(contextPtr), let scene = context.bridgeServices.activeScene() else { return 0 }
@@ -0,0 +1,40 @@
+import Foundation
+import simd
+import MetalCupEngine
+
+/// Entities that carry a viewport world icon (non-editor cameras, reflection probes, lights).
+/// The entity list is rebuilt only when the hierarchy or component layout generation moves, and
+/// icon kinds and world positions only when the component revision moves, so an idle editor frame
+/// does no world-matrix work at all and the per-frame query is a pass over cached positions.
+final class EditorWorldIconIndex {
+    struct Icon {
+        let entity: Entity
+        let kind: Int32
+        let position: SIMD3<Float>
+    }
+
+    private var hierarchyGeneration: UInt64 = 0
+    private var componentLayoutGeneration: UInt64 = 0
+    private var componentRevision: UInt64 = 0
+    private var entities: [Entity] = []
+    private var icons: [Icon] = []
+
+    func icons(context: MCEContext,
+               rebuild: () -> [Entity],
+               resolve: (Entity) -> Icon?) -> [Icon] {
+        let services = context.bridgeServices
+        var stale = componentRevision != services.componentRevision
+        if hierarchyGeneration != services.hierarchyGeneration
+            || componentLayoutGeneration != services.componentLayoutGeneration {
+            entities = rebuild()
+            hierarchyGeneration = services.hierarchyGeneration
+            componentLayoutGeneration = services.componentLayoutGeneration
+            stale = true
+        }
+        if stale {
+            icons = entities.compactMap(resolve)
+            componentRevision = services.componentRevision
+        }
+        return icons
+    }
+}
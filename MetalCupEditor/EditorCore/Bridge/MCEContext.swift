@@ -15,6 +15,11 @@ protocol EditorBridgeServices: AnyObject {
     func setSelectedEntityIds(_ ids: [UUID], primary: UUID?)
 
     func notifySceneMutation()
+    func notifyHierarchyMutation()
+    var hierarchyGeneration: UInt64 { get }
+    func notifyComponentLayoutMutation()
+    var componentLayoutGeneration: UInt64 { get }
+    var componentRevision: UInt64 { get }
     func assetMetadataSnapshot() -> [AssetMetadata]
     func assetURL(for handle: AssetHandle) -> URL?
     func performAssetMutation(_ body: () throws -> Bool) -> Bool
@@ -46,9 +51,25 @@ final class DefaultEditorBridgeServices: EditorBridgeServices {
     }
 
     func notifySceneMutation() {
+        context.undoJournal.markDirty()
+        context.editorSceneController.notifyComponentRevision()
         context.editorProjectManager.notifySceneMutation()
     }
 
+    func notifyHierarchyMutation() {
+        context.editorSceneController.notifyHierarchyMutation()
+    }
+
+    var hierarchyGeneration: UInt64 { context.editorSceneController.hierarchyGeneration }
+
+    func notifyComponentLayoutMutation() {
+        context.editorSceneController.notifyComponentLayoutMutation()
+    }
+
+    var componentLayoutGeneration: UInt64 { context.editorSceneController.componentLayoutGeneration }
+
+    var componentRevision: UInt64 { context.editorSceneController.componentRevision }
+
     func assetMetadataSnapshot() -> [AssetMetadata] {
         context.editorProjectManager.assetMetadataSnapshot()
     }
@@ -61,10 +82,10 @@ final class DefaultEditorBridgeServices: EditorBridgeServices {
         context.editorProjectManager.performAssetMutation(body)
     }
 
-    var supportsUndoTransactions: Bool { false }
+    var supportsUndoTransactions: Bool { true }
 
     func recordUndoTransaction(_ label: String) {
-        _ = label
+        context.undoJournal.markDirty(label: label)
     }
 }
 
@@ -73,10 +94,27 @@ final class EditorAssetSnapshotStore {
     var revision: UInt64 = 0
 }
 
+/// Clip durations keyed by the modification time the asset registry recorded for each clip. An entry
+/// is re-checked only when the asset snapshot revision moves, so inspector frames do no file I/O.
+final class EditorClipDurationStore {
+    struct Entry {
+        var lastModified: TimeInterval
+        var revision: UInt64
+        let duration: Float?
+    }
+
+    var entries: [AssetHandle: Entry] = [:]
+}
+
 final class EditorDirectorySnapshotStore {
     var entries: [DirectoryEntrySnapshot] = []
 }
 
+/// Result of the last asset reference query, read back entry by entry by the content browser.
+final class EditorAssetReferenceStore {
+    var entries: [AssetMetadata] = []
+}
+
 struct DirectoryEntrySnapshot {
     let name: String
     let relativePath: String
@@ -108,6 +146,13 @@ final class MCEContext {
     let directorySnapshotStore: EditorDirectorySnapshotStore
     let importController: ImportController
     let panelState: UnsafeMutableRawPointer
+    let entityHandleCache = EditorEntityHandleCache()
+    let componentBlockStamps = EditorComponentBlockStamps()
+    let worldIconIndex = EditorWorldIconIndex()
+    let materialEditStore = EditorMaterialEditStore()
+    let undoJournal = EditorUndoJournal()
+    let assetReferenceStore = EditorAssetReferenceStore()
+    let clipDurationStore = EditorClipDurationStore()
     var imguiBridge: ImGuiBridge?
     lazy var bridgeServices: EditorBridgeServices = DefaultEditorBridgeServices(context: self)
 
@@ -0,0 +1,72 @@
+/// EditorLogIndex.h
+/// Defines the retained log store and search index behind the Logs panel.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct EditorLogEntry {
+    uint64_t sequence = 0;
+    uint64_t frameIndex = 0;
+    double timestamp = 0.0;
+    int32_t level = 0;
+    int32_t category = 0;
+    int32_t source = 0;
+    int32_t templateId = 0;
+    std::string message;
+};
+
+/// Level/category masks plus ImGuiTextFilter-style text ("a,b" includes any, "-c" excludes).
+struct EditorLogQuery {
+    uint32_t levelMask = 0xFu;
+    uint32_t categoryMask = 0x1FFu;
+    std::string text;
+};
+
+/// Entries are kept contiguous by sequence so lookup is an offset from the oldest one. Beside them
+/// live one bitmap per level and per category, an inverted index from lowercase letter-run tokens to
+/// entry slots, and a fixed table from digit trigrams to entry slots; a query intersects those and
+/// only runs the substring check on the survivors.
+class EditorLogIndex {
+public:
+    static constexpr int32_t kLevelCount = 4;
+    static constexpr int32_t kCategoryCount = 9;
+    static constexpr int32_t kDigitTrigramCount = 1000;
+
+    void Append(EditorLogEntry &&entry);
+    void EvictBefore(uint64_t firstSequence);
+    void Clear();
+
+    bool Empty() const { return _entries.empty(); }
+    size_t Size() const { return _entries.size(); }
+    const EditorLogEntry *Find(uint64_t sequence) const;
+
+    bool Matches(const EditorLogQuery &query, const EditorLogEntry &entry) const;
+    /// Writes the sequences of every retained entry matching `query`, oldest first.
+    void Query(const EditorLogQuery &query, std::deque<uint64_t> &sequencesOut) const;
+
+    size_t TokenCount() const { return _postings.size(); }
+
+    static int32_t CategorySlot(int32_t category);
+
+private:
+    using Bitmap = std::vector<uint64_t>;
+
+    uint32_t LiveSlotBegin() const;
+    void IndexEntry(const EditorLogEntry &entry, uint32_t slot);
+    void Rebuild();
+    void TermCandidates(const std::string &term, Bitmap &out, bool &indexed) const;
+
+    std::deque<EditorLogEntry> _entries;
+    uint64_t _baseSequence = 1;
+    uint32_t _slotCount = 0;
+    Bitmap _levelBits[kLevelCount];
+    Bitmap _categoryBits[kCategoryCount];
+    std::unordered_map<std::string, std::vector<uint32_t>> _postings;
+    std::vector<uint32_t> _digitTrigrams[kDigitTrigramCount];
+};
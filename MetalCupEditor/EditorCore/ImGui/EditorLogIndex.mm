@@ -0,0 +1,290 @@
+/// EditorLogIndex.mm
+/// Implements the retained log store and search index behind the Logs panel.
+/// Created by Kaden Cringle.
+
+#include "EditorLogIndex.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace {
+struct ParsedLogText {
+    std::vector<std::string> includes;
+    std::vector<std::string> excludes;
+};
+
+char LowerAscii(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// Letter runs go into the token vocabulary. Digit runs (counters, ids, frame numbers) would explode the
+// vocabulary that term lookup scans, so they are indexed as digit trigrams instead (see ForEachDigitTrigram).
+bool IsTokenChar(char c) {
+    return std::isalpha(static_cast<unsigned char>(c)) != 0;
+}
+
+bool IsDigitChar(char c) {
+    return c >= '0' && c <= '9';
+}
+
+ParsedLogText ParseLogText(const std::string &text) {
+    ParsedLogText parsed;
+    size_t start = 0;
+    while (start <= text.size()) {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) { end = text.size(); }
+        size_t first = start;
+        size_t last = end;
+        while (first < last && text[first] == ' ') { ++first; }
+        while (last > first && text[last - 1] == ' ') { --last; }
+        if (first < last) {
+            const bool exclude = text[first] == '-';
+            std::string term;
+            for (size_t i = exclude ? first + 1 : first; i < last; ++i) {
+                term.push_back(LowerAscii(text[i]));
+            }
+            if (!term.empty()) {
+                (exclude ? parsed.excludes : parsed.includes).push_back(std::move(term));
+            }
+        }
+        start = end + 1;
+    }
+    return parsed;
+}
+
+bool ContainsLowercase(const std::string &haystack, const std::string &needleLower) {
+    if (needleLower.empty()) { return true; }
+    if (needleLower.size() > haystack.size()) { return false; }
+    const size_t limit = haystack.size() - needleLower.size();
+    for (size_t i = 0; i <= limit; ++i) {
+        size_t j = 0;
+        while (j < needleLower.size() && LowerAscii(haystack[i + j]) == needleLower[j]) { ++j; }
+        if (j == needleLower.size()) { return true; }
+    }
+    return false;
+}
+
+bool TextMatches(const ParsedLogText &parsed, const std::string &message) {
+    for (const std::string &term : parsed.excludes) {
+        if (ContainsLowercase(message, term)) { return false; }
+    }
+    if (parsed.includes.empty()) { return true; }
+    for (const std::string &term : parsed.includes) {
+        if (ContainsLowercase(message, term)) { return true; }
+    }
+    return false;
+}
+
+template <typename Visitor>
+void ForEachToken(const std::string &text, Visitor &&visit) {
+    std::string token;
+    for (size_t i = 0; i <= text.size(); ++i) {
+        if (i < text.size() && IsTokenChar(text[i])) {
+            token.push_back(LowerAscii(text[i]));
+            continue;
+        }
+        if (!token.empty()) {
+            visit(token);
+            token.clear();
+        }
+    }
+}
+
+// Visits every three-digit window of every digit run as its value 0..999, so the trigram table has a
+// fixed size however many distinct numbers the log contains. Shorter runs have no trigram.
+template <typename Visitor>
+void ForEachDigitTrigram(const std::string &text, Visitor &&visit) {
+    uint32_t runLength = 0;
+    uint32_t window = 0;
+    for (char c : text) {
+        if (!IsDigitChar(c)) {
+            runLength = 0;
+            window = 0;
+            continue;
+        }
+        window = (window * 10 + static_cast<uint32_t>(c - '0')) % 1000;
+        runLength += 1;
+        if (runLength >= 3) { visit(window); }
+    }
+}
+
+void AddPosting(std::vector<uint32_t> &slots, uint32_t slot) {
+    if (slots.empty() || slots.back() != slot) {
+        slots.push_back(slot);
+    }
+}
+
+void SetBit(std::vector<uint64_t> &bits, uint32_t slot) {
+    bits[slot / 64] |= (uint64_t{1} << (slot % 64));
+}
+}
+
+int32_t EditorLogIndex::CategorySlot(int32_t category) {
+    return (category >= 0 && category < kCategoryCount - 1) ? category : kCategoryCount - 1;
+}
+
+void EditorLogIndex::Append(EditorLogEntry &&entry) {
+    if (entry.sequence != _baseSequence + _slotCount) {
+        // Sequences only jump after everything retained was evicted; start a fresh slot range.
+        _entries.clear();
+        _baseSequence = entry.sequence;
+        Rebuild();
+    }
+    const uint32_t slot = _slotCount;
+    _slotCount += 1;
+    IndexEntry(entry, slot);
+    _entries.push_back(std::move(entry));
+}
+
+void EditorLogIndex::EvictBefore(uint64_t firstSequence) {
+    while (!_entries.empty() && _entries.front().sequence < firstSequence) {
+        _entries.pop_front();
+    }
+    if (_entries.empty()) {
+        _baseSequence = std::max(firstSequence, _baseSequence + _slotCount);
+        Rebuild();
+        return;
+    }
+    // Evicted slots stay in the bitmaps and postings until they outweigh the live range.
+    const uint32_t dead = LiveSlotBegin();
+    if (dead > std::max<uint32_t>(65536u, static_cast<uint32_t>(_entries.size()))) {
+        Rebuild();
+    }
+}
+
+void EditorLogIndex::Clear() {
+    const uint64_t next = _baseSequence + _slotCount;
+    _entries.clear();
+    _baseSequence = next;
+    Rebuild();
+}
+
+const EditorLogEntry *EditorLogIndex::Find(uint64_t sequence) const {
+    if (_entries.empty()) { return nullptr; }
+    const uint64_t first = _entries.front().sequence;
+    if (sequence < first || sequence - first >= _entries.size()) { return nullptr; }
+    return &_entries[static_cast<size_t>(sequence - first)];
+}
+
+bool EditorLogIndex::Matches(const EditorLogQuery &query, const EditorLogEntry &entry) const {
+    if (entry.level < 0 || entry.level >= kLevelCount || (query.levelMask & (1u << entry.level)) == 0) { return false; }
+    if ((query.categoryMask & (1u << CategorySlot(entry.category))) == 0) { return false; }
+    if (query.text.empty()) { return true; }
+    return TextMatches(ParseLogText(query.text), entry.message);
+}
+
+void EditorLogIndex::Query(const EditorLogQuery &query, std::deque<uint64_t> &sequencesOut) const {
+    sequencesOut.clear();
+    if (_entries.empty()) { return; }
+    const size_t wordCount = (static_cast<size_t>(_slotCount) + 63) / 64;
+
+    Bitmap candidates(wordCount, 0);
+    for (int32_t level = 0; level < kLevelCount; ++level) {
+        if ((query.levelMask & (1u << level)) == 0) { continue; }
+        for (size_t w = 0; w < wordCount; ++w) { candidates[w] |= _levelBits[level][w]; }
+    }
+    Bitmap categories(wordCount, 0);
+    for (int32_t category = 0; category < kCategoryCount; ++category) {
+        if ((query.categoryMask & (1u << category)) == 0) { continue; }
+        for (size_t w = 0; w < wordCount; ++w) { categories[w] |= _categoryBits[category][w]; }
+    }
+    for (size_t w = 0; w < wordCount; ++w) { candidates[w] &= categories[w]; }
+
+    const ParsedLogText parsed = ParseLogText(query.text);
+    if (!parsed.includes.empty()) {
+        Bitmap anyTerm(wordCount, 0);
+        bool allIndexed = true;
+        for (const std::string &term : parsed.includes) {
+            Bitmap termBits;
+            bool indexed = false;
+            TermCandidates(term, termBits, indexed);
+            if (!indexed) {
+                allIndexed = false;
+                break;
+            }
+            for (size_t w = 0; w < wordCount; ++w) { anyTerm[w] |= termBits[w]; }
+        }
+        if (allIndexed) {
+            for (size_t w = 0; w < wordCount; ++w) { candidates[w] &= anyTerm[w]; }
+        }
+    }
+
+    const uint32_t begin = LiveSlotBegin();
+    for (size_t w = begin / 64; w < wordCount; ++w) {
+        uint64_t bits = candidates[w];
+        if (w == begin / 64) { bits &= ~uint64_t{0} << (begin % 64); }
+        while (bits != 0) {
+            const uint32_t slot = static_cast<uint32_t>(w * 64) + static_cast<uint32_t>(__builtin_ctzll(bits));
+            bits &= bits - 1;
+            const EditorLogEntry &entry = _entries[slot - begin];
+            if (parsed.includes.empty() && parsed.excludes.empty()) {
+                sequencesOut.push_back(entry.sequence);
+            } else if (TextMatches(parsed, entry.message)) {
+                sequencesOut.push_back(entry.sequence);
+            }
+        }
+    }
+}
+
+uint32_t EditorLogIndex::LiveSlotBegin() const {
+    return _entries.empty() ? _slotCount : static_cast<uint32_t>(_entries.front().sequence - _baseSequence);
+}
+
+void EditorLogIndex::IndexEntry(const EditorLogEntry &entry, uint32_t slot) {
+    const size_t wordCount = static_cast<size_t>(slot) / 64 + 1;
+    if (_levelBits[0].size() < wordCount) {
+        for (Bitmap &bits : _levelBits) { bits.resize(wordCount, 0); }
+        for (Bitmap &bits : _categoryBits) { bits.resize(wordCount, 0); }
+    }
+    if (entry.level >= 0 && entry.level < kLevelCount) {
+        SetBit(_levelBits[entry.level], slot);
+    }
+    SetBit(_categoryBits[CategorySlot(entry.category)], slot);
+
+    ForEachToken(entry.message, [&](const std::string &token) {
+        AddPosting(_postings[token], slot);
+    });
+    ForEachDigitTrigram(entry.message, [&](uint32_t trigram) {
+        AddPosting(_digitTrigrams[trigram], slot);
+    });
+}
+
+void EditorLogIndex::Rebuild() {
+    if (!_entries.empty()) {
+        _baseSequence = _entries.front().sequence;
+    }
+    _slotCount = 0;
+    for (Bitmap &bits : _levelBits) { bits.clear(); }
+    for (Bitmap &bits : _categoryBits) { bits.clear(); }
+    _postings.clear();
+    for (std::vector<uint32_t> &slots : _digitTrigrams) { slots.clear(); }
+    for (const EditorLogEntry &entry : _entries) {
+        IndexEntry(entry, _slotCount);
+        _slotCount += 1;
+    }
+}
+
+void EditorLogIndex::TermCandidates(const std::string &term, Bitmap &out, bool &indexed) const {
+    const size_t wordCount = (static_cast<size_t>(_slotCount) + 63) / 64;
+    out.assign(wordCount, ~uint64_t{0});
+    indexed = false;
+    // Every word run inside a matching substring sits inside some message token, so the union of
+    // postings whose token contains the run is a superset of the matches for that run.
+    ForEachToken(term, [&](const std::string &token) {
+        Bitmap tokenBits(wordCount, 0);
+        for (const auto &posting : _postings) {
+            if (posting.first.find(token) == std::string::npos) { continue; }
+            for (uint32_t slot : posting.second) { SetBit(tokenBits, slot); }
+        }
+        for (size_t w = 0; w < wordCount; ++w) { out[w] &= tokenBits[w]; }
+        indexed = true;
+    });
+    // Likewise every digit run of the term sits inside a message digit run, so each of its trigrams
+    // appears in the message. Runs shorter than three digits do not narrow anything.
+    ForEachDigitTrigram(term, [&](uint32_t trigram) {
+        Bitmap trigramBits(wordCount, 0);
+        for (uint32_t slot : _digitTrigrams[trigram]) { SetBit(trigramBits, slot); }
+        for (size_t w = 0; w < wordCount; ++w) { out[w] &= trigramBits[w]; }
+        indexed = true;
+    });
+}
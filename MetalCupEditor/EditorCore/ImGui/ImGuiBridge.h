@@ -58,6 +58,8 @@ extern "C" {
 #endif
 bool MCEImGuiHandleEvent(void *event, void *view);
 bool MCEImGuiWantsCaptureKeyboard(void);
+/// True while a widget is held or a mouse button is down; the undo journal keeps its transaction open.
+bool MCEImGuiIsEditInteractionActive(void);
 #ifdef __cplusplus
 }
 #endif
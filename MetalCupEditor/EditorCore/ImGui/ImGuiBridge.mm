@@ -30,12 +30,22 @@
 #import "../../EditorUI/EditorIcons.h"
 #import "../Bridge/RendererSettingsBridge.h"
 #import "../Bridge/PhysicsSettingsBridge.h"
+#import "../Bridge/EditorEntityHandle.h"
+#import "EditorLogIndex.h"
+#import "../Services/EditorTrace.h"
+#import "../Services/EditorProfilerHistory.h"
+#import "../Services/EditorJobs.h"
+#import "../Assets/MeshletBuilder.h"
+#import "../Assets/SkinInfluenceSelector.h"
+#import "../Assets/TextureHeaderProbe.h"
 #import "../../EditorUI/Widgets/UIWidgets.h"
 #import <Cocoa/Cocoa.h>
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <ctime>
+#include <deque>
 #include <cmath>
 #include <fstream>
 #include <regex>
@@ -180,6 +190,7 @@ extern "C" void MCESceneStop(MCE_CTX);
 extern "C" void MCEScenePause(MCE_CTX);
 extern "C" void MCESceneResume(MCE_CTX);
 extern "C" uint32_t MCESceneIsPlaying(MCE_CTX);
+extern "C" uint32_t MCESceneIsSimulating(MCE_CTX);
 extern "C" uint32_t MCESceneIsPaused(MCE_CTX);
 extern "C" uint32_t MCESceneIsDirty(MCE_CTX);
 extern "C" void MCESceneNotifyMutation(MCE_CTX);
@@ -430,6 +441,9 @@ extern "C" uint32_t MCEEditorGetAnimatorGraphDebugTraceEntryAt(MCE_CTX, const ch
                                                                 char *nodeTitleBuffer, int32_t nodeTitleBufferSize,
                                                                 char *outputSummaryBuffer, int32_t outputSummaryBufferSize);
 extern "C" uint32_t MCEEditorEntityHasComponent(MCE_CTX, const char *entityId, int32_t componentType);
+extern "C" uint32_t MCEEditorGetModelMatrix(MCE_CTX, const char *entityId, float *matrixOut);
+extern "C" int32_t MCEEditorGetEntityCount(MCE_CTX);
+extern "C" int32_t MCEEditorGetEntityIdAt(MCE_CTX, int32_t index, char *buffer, int32_t bufferSize);
 extern "C" uint32_t MCEEditorGetSkinnedMesh(MCE_CTX, const char *entityId,
                                             char *skeletonHandle, int32_t skeletonHandleSize,
                                             int32_t *jointCountOut, uint32_t *isValidSkeletonOut);
@@ -437,7 +451,14 @@ extern "C" int32_t MCEEditorLogCount(MCE_CTX);
 extern "C" uint32_t MCEEditorLogEntryAt(MCE_CTX,  int32_t index, int32_t *levelOut, int32_t *categoryOut, double *timestampOut, char *messageBuffer, int32_t messageBufferSize);
 extern "C" uint64_t MCEEditorLogRevision(MCE_CTX);
 extern "C" void MCEEditorLogClear(MCE_CTX);
-extern "C" void MCEEditorLogMessage(MCE_CTX, int32_t level, int32_t category, const char *message);
+struct MCELogRecordBridge;
+extern "C" int32_t MCEEditorLogReadSince(MCE_CTX, uint64_t afterSequence, MCELogRecordBridge *recordsOut, int32_t maxRecords,
+                                         char *textBuffer, int32_t textBufferSize, uint64_t *nextAfterOut);
+extern "C" void MCEEditorLogGetWindow(MCE_CTX, uint64_t *firstSequenceOut, uint64_t *nextSequenceOut);
+extern "C" void MCEEditorLogGetStats(MCE_CTX, int32_t *capacityOut, int32_t *retainedOut, uint64_t *overwrittenOut, uint64_t *truncatedReadsOut);
+extern "C" int32_t MCEEditorLogGetTemplate(MCE_CTX, int32_t templateId, char *buffer, int32_t bufferSize);
+extern "C" int32_t MCEEditorLogGetSourceName(MCE_CTX, int32_t sourceId, char *buffer, int32_t bufferSize);
+extern "C" void MCEEditorLogMessageWithSource(MCE_CTX, int32_t level, int32_t category, const char *source, const char *message);
 extern "C" void MCEEditorRequestQuit(MCE_CTX);
 extern "C" uint32_t MCEImportIsOpen(MCE_CTX);
 extern "C" uint32_t MCEImportIsReimport(MCE_CTX);
@@ -472,6 +493,78 @@ extern "C" uint32_t MCEImportGetCommitSubmeshMaterialHandles(MCE_CTX, char *buff
 extern "C" void MCEImportClearCommitResult(MCE_CTX);
 extern "C" uint32_t MCEImportGetLastError(MCE_CTX, char *buffer, int32_t bufferSize);
 extern "C" void *MCEContextGetUIPanelState(MCE_CTX);
+extern "C" uint32_t MCEEditorMakeTraceExportPath(MCE_CTX, const char *baseName, const char *fileExtension, char *buffer, int32_t bufferSize);
+extern "C" uint32_t MCEEditorChooseTraceCapture(MCE_CTX, char *buffer, int32_t bufferSize);
+extern "C" uint32_t MCEEditorGetPlayModeTransitionStats(MCE_CTX,
+                                                        double *enterMs,
+                                                        double *exitMs,
+                                                        int32_t *componentsChecked,
+                                                        int32_t *componentsRestored,
+                                                        int32_t *entitiesDestroyed,
+                                                        uint64_t *documentRestores);
+extern "C" uint32_t MCEEditorGetFixedStepStats(MCE_CTX,
+                                               int32_t *policy,
+                                               uint64_t *frames,
+                                               uint64_t *steps,
+                                               double *droppedMs,
+                                               double *slowedMs,
+                                               uint64_t *budgetHitFrames,
+                                               uint64_t *adaptiveFrames,
+                                               double *stepCostMeanMs,
+                                               int32_t *stepsLastSecond);
+extern "C" int32_t MCEEditorGetFixedStepHistogram(MCE_CTX, uint64_t *counts, int32_t capacity);
+extern "C" int32_t MCEEditorGetFixedStepRecent(MCE_CTX, float *steps, float *droppedMs, float *stepCostMs, float *fixedDeltaMs, int32_t capacity);
+extern "C" int32_t MCEEditorGetFixedStepLastCosts(MCE_CTX, float *costsMs, int32_t capacity);
+extern "C" void MCEEditorSetFixedStepOverloadPolicy(MCE_CTX, int32_t policy);
+extern "C" void MCEEditorResetFixedStepStats(MCE_CTX);
+extern "C" uint32_t MCEEditorRunFixedStepReplay(MCE_CTX, int32_t steps);
+extern "C" uint32_t MCEEditorGetAssetDependencyStats(MCE_CTX, int32_t *nodeCount, int32_t *edgeCount, int32_t *lastChanged, double *lastUpdateMs);
+extern "C" uint32_t MCEEditorGetAssetMutationStats(MCE_CTX, uint64_t *mutations, uint64_t *registryUpdates, uint64_t *rescansAvoided,
+                                                   uint64_t *watcherEventsSuppressed, int32_t *lastPathsReloaded, double *lastUpdateMs);
+extern "C" uint32_t MCEEditorGetTextureCookStats(MCE_CTX, uint64_t *hits, uint64_t *cooks, uint64_t *failures,
+                                                 uint64_t *bytesWritten, double *lastCookMs);
+extern "C" uint32_t MCEEditorGetSkeletonIndexStats(MCE_CTX, int32_t *entryCount, int32_t *skeletonsLoaded, int32_t *queries,
+                                                   int32_t *candidatesScored, int32_t *candidatesSkipped);
+extern "C" uint32_t MCEEditorGetBakedClipStats(MCE_CTX, uint64_t *bakes, uint64_t *failures, uint64_t *opens,
+                                               uint64_t *staleOpens, uint64_t *bytesWritten);
+extern "C" uint32_t MCEEditorGetFixedStepReplayResult(MCE_CTX,
+                                                      int32_t *steps,
+                                                      double *totalMs,
+                                                      double *stepsPerSecond,
+                                                      double *stepP50Ms,
+                                                      double *stepP99Ms,
+                                                      double *stepMaxMs,
+                                                      uint64_t *checksum,
+                                                      uint32_t *deterministic);
+extern "C" uint32_t MCEEditorUndo(MCE_CTX);
+extern "C" uint32_t MCEEditorRedo(MCE_CTX);
+extern "C" uint32_t MCEEditorGetUndoState(MCE_CTX,
+                                          char *undoLabel, int32_t undoLabelSize,
+                                          char *redoLabel, int32_t redoLabelSize,
+                                          int32_t *undoCount,
+                                          int32_t *redoCount);
+extern "C" uint32_t MCEEditorGetUndoJournalStats(MCE_CTX,
+                                                 uint64_t *bytesUsed,
+                                                 uint64_t *budgetBytes,
+                                                 uint64_t *transactions,
+                                                 uint64_t *merged,
+                                                 uint64_t *evicted,
+                                                 double *lastCloseMs,
+                                                 double *lastApplyMs);
+extern "C" void MCEEditorSetUndoJournalBudget(MCE_CTX, int32_t budgetMB);
+extern "C" uint32_t MCEEditorRunUndoBenchmark(MCE_CTX, int32_t steps);
+extern "C" uint32_t MCEEditorGetUndoBenchmarkResult(MCE_CTX,
+                                                    int32_t *steps,
+                                                    int32_t *entities,
+                                                    double *recordMs,
+                                                    double *undoMs,
+                                                    double *redoMs,
+                                                    uint32_t *restored);
+extern "C" uint32_t MCEEditorGetMaterialEditStats(MCE_CTX,
+                                                  uint64_t *deltasApplied,
+                                                  uint64_t *writesPerformed,
+                                                  uint64_t *writesAvoided,
+                                                  int32_t *pendingCount);
 extern bool ImGui_ImplOSX_HandleEvent(NSEvent* event, NSView* view);
 
 extern "C" bool MCEImGuiHandleEvent(void *event, void *view) {
@@ -484,15 +577,22 @@ extern "C" bool MCEImGuiWantsCaptureKeyboard(void) {
     return io.WantCaptureKeyboard || io.WantTextInput;
 }
 
-struct LogEntrySnapshot {
-    int32_t level = 0;
-    int32_t category = 0;
-    double timestamp = 0.0;
-    std::string message;
-    std::string singleLineMessage;
-    std::string timeLabel;
-    std::string label;
-    std::string displayLabel;
+extern "C" bool MCEImGuiIsEditInteractionActive(void) {
+    if (!ImGui::GetCurrentContext()) { return false; }
+    return ImGui::IsAnyItemActive() || ImGui::IsMouseDown(ImGuiMouseButton_Left) || ImGui::IsMouseDown(ImGuiMouseButton_Right);
+}
+
+// Mirrors MCELogRecordBridge in EditorLogCenter.swift.
+struct MCELogRecordBridge {
+    uint64_t sequence;
+    uint64_t frameIndex;
+    double timestamp;
+    int32_t level;
+    int32_t category;
+    int32_t source;
+    int32_t templateId;
+    int32_t messageOffset;
+    int32_t messageLength;
 };
 
 @interface ImGuiBridge () {
@@ -521,8 +621,12 @@ struct LogEntrySnapshot {
     char _SelectedEntityId[64];
 
     uint64_t _LogRevision;
-    std::vector<LogEntrySnapshot> _LogEntries;
-    std::vector<int32_t> _LogFilteredIndices;
+    uint64_t _LogLastSequence;
+    EditorLogIndex _LogIndex;
+    std::deque<uint64_t> _LogFilteredSequences;
+    std::unordered_map<int32_t, std::string> _LogSourceNames;
+    uint32_t _LogFilterCategoryMask;
+    uint32_t _LogCategoryMask;
     bool _LogFilterDirty;
     char _LogFilterText[256];
     bool _LogFilterTrace;
@@ -808,34 +912,86 @@ static std::string NormalizeLogMessageToSingleLine(const char *raw) {
     return normalized;
 }
 
+static EditorLogQuery AppliedLogQuery(ImGuiBridge *bridge) {
+    EditorLogQuery query;
+    query.levelMask = (bridge->_LogFilterTrace ? 1u : 0u) | (bridge->_LogFilterInfo ? 2u : 0u) |
+        (bridge->_LogFilterWarn ? 4u : 0u) | (bridge->_LogFilterError ? 8u : 0u);
+    query.categoryMask = bridge->_LogFilterCategoryMask;
+    query.text = bridge->_LogFilterText;
+    return query;
+}
+
+static const std::string &LogSourceName(ImGuiBridge *bridge, int32_t source) {
+    auto it = bridge->_LogSourceNames.find(source);
+    if (it == bridge->_LogSourceNames.end()) {
+        char buffer[128] = {0};
+        if (source != 0) {
+            MCEEditorLogGetSourceName(bridge->_context, source, buffer, sizeof(buffer));
+        }
+        it = bridge->_LogSourceNames.emplace(source, std::string(buffer)).first;
+    }
+    return it->second;
+}
+
+static std::string LogEntryPrefix(ImGuiBridge *bridge, const EditorLogEntry &entry) {
+    std::string prefix = "[" + FormatClockTime(entry.timestamp) + "] [" + LogCategoryLabel(entry.category) + "] ";
+    const std::string &source = LogSourceName(bridge, entry.source);
+    if (!source.empty()) {
+        prefix += "[" + source + "] ";
+    }
+    return prefix;
+}
+
+/// Pulls only records appended since the last refresh, indexes them, and filters them once against
+/// the applied query. Records the editor ring has overwritten (or cleared) are evicted from the front.
 static void RefreshLogSnapshotIfNeeded(ImGuiBridge *bridge) {
     const uint64_t revision = MCEEditorLogRevision(bridge->_context);
     if (revision == bridge->_LogRevision) { return; }
     bridge->_LogRevision = revision;
-    bridge->_LogEntries.clear();
-    bridge->_LogFilteredIndices.clear();
-
-    const int32_t count = MCEEditorLogCount(bridge->_context);
-    bridge->_LogEntries.reserve(static_cast<size_t>(count));
-    for (int32_t i = 0; i < count; ++i) {
-        char message[8192] = {0};
-        int32_t level = 0;
-        int32_t category = 0;
-        double timestamp = 0.0;
-        if (MCEEditorLogEntryAt(bridge->_context, i, &level, &category, &timestamp, message, sizeof(message)) == 0) { continue; }
-        LogEntrySnapshot entry;
-        entry.level = level;
-        entry.category = category;
-        entry.timestamp = timestamp;
-        entry.message = NormalizeLogMessageForDisplay(message);
-        entry.singleLineMessage = NormalizeLogMessageToSingleLine(entry.message.c_str());
-        entry.timeLabel = FormatClockTime(timestamp);
-        entry.label = "[" + entry.timeLabel + "] [" + LogCategoryLabel(category) + "] " + entry.singleLineMessage;
-        entry.displayLabel = "[" + entry.timeLabel + "] [" + LogCategoryLabel(category) + "] " + entry.message;
-        bridge->_LogEntries.push_back(std::move(entry));
-    }
-
-    bridge->_LogFilterDirty = true;
+
+    uint64_t firstSequence = 0;
+    uint64_t nextSequence = 0;
+    MCEEditorLogGetWindow(bridge->_context, &firstSequence, &nextSequence);
+    bridge->_LogIndex.EvictBefore(firstSequence);
+    while (!bridge->_LogFilteredSequences.empty() && bridge->_LogFilteredSequences.front() < firstSequence) {
+        bridge->_LogFilteredSequences.pop_front();
+    }
+    if (bridge->_LogLastSequence + 1 >= nextSequence) { return; }
+
+    static std::vector<MCELogRecordBridge> records(256);
+    static std::vector<char> text(256 * 1024);
+    const EditorLogQuery query = AppliedLogQuery(bridge);
+    uint64_t afterSequence = bridge->_LogLastSequence;
+    while (true) {
+        uint64_t nextAfter = afterSequence;
+        const int32_t count = MCEEditorLogReadSince(bridge->_context,
+                                                    afterSequence,
+                                                    records.data(),
+                                                    static_cast<int32_t>(records.size()),
+                                                    text.data(),
+                                                    static_cast<int32_t>(text.size()),
+                                                    &nextAfter);
+        if (count <= 0) { break; }
+        for (int32_t i = 0; i < count; ++i) {
+            const MCELogRecordBridge &record = records[i];
+            const std::string raw(text.data() + record.messageOffset, static_cast<size_t>(record.messageLength));
+            EditorLogEntry entry;
+            entry.sequence = record.sequence;
+            entry.frameIndex = record.frameIndex;
+            entry.timestamp = record.timestamp;
+            entry.level = record.level;
+            entry.category = record.category;
+            entry.source = record.source;
+            entry.templateId = record.templateId;
+            entry.message = NormalizeLogMessageForDisplay(raw.c_str());
+            if (!bridge->_LogFilterDirty && bridge->_LogIndex.Matches(query, entry)) {
+                bridge->_LogFilteredSequences.push_back(entry.sequence);
+            }
+            bridge->_LogIndex.Append(std::move(entry));
+        }
+        afterSequence = nextAfter;
+    }
+    bridge->_LogLastSequence = afterSequence;
 }
 
 static void RebuildLogFilterIfNeeded(ImGuiBridge *bridge, ImGuiTextFilter &filter, bool showTrace, bool showInfo, bool showWarn, bool showError) {
@@ -853,19 +1009,34 @@ static void RebuildLogFilterIfNeeded(ImGuiBridge *bridge, ImGuiTextFilter &filte
         bridge->_LogFilterDirty = true;
     }
 
+    if (bridge->_LogFilterCategoryMask != bridge->_LogCategoryMask) {
+        bridge->_LogFilterCategoryMask = bridge->_LogCategoryMask;
+        bridge->_LogFilterDirty = true;
+    }
+
+    // New entries are filtered as they arrive; a full query only runs when the filter itself changes.
     if (!bridge->_LogFilterDirty) { return; }
     bridge->_LogFilterDirty = false;
-    bridge->_LogFilteredIndices.clear();
-    bridge->_LogFilteredIndices.reserve(bridge->_LogEntries.size());
+    bridge->_LogIndex.Query(AppliedLogQuery(bridge), bridge->_LogFilteredSequences);
+}
 
-    for (int32_t i = 0; i < static_cast<int32_t>(bridge->_LogEntries.size()); ++i) {
-        const auto &entry = bridge->_LogEntries[i];
-        const bool levelEnabled = (entry.level == 0 && showTrace) || (entry.level == 1 && showInfo) ||
-            (entry.level == 2 && showWarn) || (entry.level == 3 && showError);
-        if (!levelEnabled) { continue; }
-        if (!filter.PassFilter(entry.message.c_str())) { continue; }
-        bridge->_LogFilteredIndices.push_back(i);
+static void DrawLogCategoryFilter(ImGuiBridge *bridge) {
+    const uint32_t allCategories = (1u << EditorLogIndex::kCategoryCount) - 1u;
+    const char *preview = bridge->_LogCategoryMask == allCategories ? "All Categories" : "Some Categories";
+    ImGui::SetNextItemWidth(140.0f);
+    if (!ImGui::BeginCombo("##LogCategories", preview)) { return; }
+    for (int32_t category = 0; category < EditorLogIndex::kCategoryCount; ++category) {
+        const uint32_t bit = 1u << category;
+        bool enabled = (bridge->_LogCategoryMask & bit) != 0;
+        if (ImGui::Checkbox(LogCategoryLabel(category), &enabled)) {
+            bridge->_LogCategoryMask = enabled ? (bridge->_LogCategoryMask | bit) : (bridge->_LogCategoryMask & ~bit);
+        }
+    }
+    ImGui::Separator();
+    if (ImGui::Selectable("All", false, ImGuiSelectableFlags_DontClosePopups)) {
+        bridge->_LogCategoryMask = allCategories;
     }
+    ImGui::EndCombo();
 }
 
 static void DrawHistorySeries(ImDrawList *drawList,
@@ -968,10 +1139,12 @@ static void DrawLogsPanel(ImGuiBridge *bridge, bool *isOpen) {
     ImGui::Checkbox("Warn", &bridge->_LogShowWarn);
     ImGui::SameLine();
     ImGui::Checkbox("Error", &bridge->_LogShowError);
+    ImGui::SameLine();
+    DrawLogCategoryFilter(bridge);
 
     RebuildLogFilterIfNeeded(bridge, bridge->_LogFilter, bridge->_LogShowTrace, bridge->_LogShowInfo, bridge->_LogShowWarn, bridge->_LogShowError);
-    const int32_t filteredCount = static_cast<int32_t>(bridge->_LogFilteredIndices.size());
-    const int32_t totalCount = static_cast<int32_t>(bridge->_LogEntries.size());
+    const int32_t filteredCount = static_cast<int32_t>(bridge->_LogFilteredSequences.size());
+    const int32_t totalCount = static_cast<int32_t>(bridge->_LogIndex.Size());
 
     if (clearClicked) {
         MCEEditorLogClear(bridge->_context);
@@ -979,10 +1152,11 @@ static void DrawLogsPanel(ImGuiBridge *bridge, bool *isOpen) {
     if (copyClicked) {
         std::string output;
         output.reserve(static_cast<size_t>(filteredCount) * 80);
-        for (int32_t index : bridge->_LogFilteredIndices) {
-            if (index < 0 || index >= static_cast<int32_t>(bridge->_LogEntries.size())) { continue; }
-            const auto &entry = bridge->_LogEntries[index];
-            output += entry.displayLabel;
+        for (uint64_t sequence : bridge->_LogFilteredSequences) {
+            const EditorLogEntry *entry = bridge->_LogIndex.Find(sequence);
+            if (!entry) { continue; }
+            output += LogEntryPrefix(bridge, *entry);
+            output += entry->message;
             output += "\n";
         }
         ImGui::SetClipboardText(output.c_str());
@@ -994,6 +1168,18 @@ static void DrawLogsPanel(ImGuiBridge *bridge, bool *isOpen) {
     } else {
         ImGui::TextDisabled("Entries: %d", totalCount);
     }
+    int32_t ringCapacity = 0;
+    int32_t ringRetained = 0;
+    uint64_t ringOverwritten = 0;
+    uint64_t truncatedReads = 0;
+    MCEEditorLogGetStats(bridge->_context, &ringCapacity, &ringRetained, &ringOverwritten, &truncatedReads);
+    if (ringOverwritten > 0 || truncatedReads > 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("|  Dropped: %llu of capacity %d  |  Truncated: %llu",
+                            static_cast<unsigned long long>(ringOverwritten),
+                            ringCapacity,
+                            static_cast<unsigned long long>(truncatedReads));
+    }
 
     ImGui::Separator();
     ImGui::BeginChild("LogsScroll", ImVec2(0, 0), false, ImGuiWindowFlags_AlwaysVerticalScrollbar);
@@ -1001,25 +1187,45 @@ static void DrawLogsPanel(ImGuiBridge *bridge, bool *isOpen) {
     const float scrollMaxY = ImGui::GetScrollMaxY();
     const bool wasAtBottom = (scrollMaxY <= 0.0f) || (scrollY >= (scrollMaxY - 4.0f));
 
-    ImGui::PushTextWrapPos(0.0f);
-    for (int32_t row = 0; row < filteredCount; ++row) {
-        const int32_t entryIndex = bridge->_LogFilteredIndices[row];
-        if (entryIndex < 0 || entryIndex >= static_cast<int32_t>(bridge->_LogEntries.size())) { continue; }
-        const auto &entry = bridge->_LogEntries[entryIndex];
-        ImVec4 color = ImGui::GetStyleColorVec4(ImGuiCol_Text);
-        if (entry.level == 0) {
-            color = ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
-        } else if (entry.level == 2) {
-            color = ImVec4(0.95f, 0.7f, 0.2f, 1.0f);
-        } else if (entry.level == 3) {
-            color = ImVec4(0.95f, 0.4f, 0.35f, 1.0f);
-        }
-        ImGui::PushStyleColor(ImGuiCol_Text, color);
-        ImGui::TextUnformatted(entry.displayLabel.c_str());
-        ImGui::PopStyleColor();
-        ImGui::Spacing();
+    // Rows are single-line so the clipper can skip everything off screen; the full multi-line
+    // message and its structured fields show in the row tooltip.
+    ImGuiListClipper clipper;
+    clipper.Begin(filteredCount);
+    while (clipper.Step()) {
+        for (int32_t row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            const EditorLogEntry *entryPtr = bridge->_LogIndex.Find(bridge->_LogFilteredSequences[row]);
+            if (!entryPtr) {
+                ImGui::TextUnformatted("");
+                continue;
+            }
+            const auto &entry = *entryPtr;
+            ImVec4 color = ImGui::GetStyleColorVec4(ImGuiCol_Text);
+            if (entry.level == 0) {
+                color = ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled);
+            } else if (entry.level == 2) {
+                color = ImVec4(0.95f, 0.7f, 0.2f, 1.0f);
+            } else if (entry.level == 3) {
+                color = ImVec4(0.95f, 0.4f, 0.35f, 1.0f);
+            }
+            const std::string label = LogEntryPrefix(bridge, entry) + NormalizeLogMessageToSingleLine(entry.message.c_str());
+            ImGui::PushStyleColor(ImGuiCol_Text, color);
+            ImGui::TextUnformatted(label.c_str());
+            ImGui::PopStyleColor();
+            if (ImGui::IsItemHovered()) {
+                char templateText[512] = {0};
+                MCEEditorLogGetTemplate(bridge->_context, entry.templateId, templateText, sizeof(templateText));
+                ImGui::BeginTooltip();
+                ImGui::PushTextWrapPos(ImGui::GetFontSize() * 40.0f);
+                ImGui::TextUnformatted(entry.message.c_str());
+                ImGui::PopTextWrapPos();
+                ImGui::Separator();
+                ImGui::TextDisabled("Frame %llu  |  Seq %llu", static_cast<unsigned long long>(entry.frameIndex), static_cast<unsigned long long>(entry.sequence));
+                ImGui::TextDisabled("Template: %s", templateText);
+                ImGui::EndTooltip();
+            }
+        }
     }
-    ImGui::PopTextWrapPos();
+    clipper.End();
 
     if (bridge->_LogAutoScroll && wasAtBottom) {
         ImGui::SetScrollHereY(1.0f);
@@ -1844,6 +2050,94 @@ static void DrawImportModal(void *context) {
         if (ImGui::Checkbox("Create Hierarchy", &createHierarchy)) {
             MCEImportSetOptionBool(context, "createHierarchy", createHierarchy ? 1 : 0);
         }
+        bool generateLODs = MCEImportGetOptionBool(context, "generateLODs", 0) != 0;
+        if (ImGui::Checkbox("Generate LODs", &generateLODs)) {
+            MCEImportSetOptionBool(context, "generateLODs", generateLODs ? 1 : 0);
+        }
+        if (generateLODs) {
+            char lodRatios[64] = {0};
+            MCEImportGetOptionString(context, "lodRatios", lodRatios, sizeof(lodRatios));
+            if (ImGui::InputText("LOD Triangle Ratios", lodRatios, sizeof(lodRatios))) {
+                MCEImportSetOptionString(context, "lodRatios", lodRatios);
+            }
+            char lodScreenSizes[64] = {0};
+            MCEImportGetOptionString(context, "lodScreenSizes", lodScreenSizes, sizeof(lodScreenSizes));
+            if (ImGui::InputText("LOD Screen Sizes", lodScreenSizes, sizeof(lodScreenSizes))) {
+                MCEImportSetOptionString(context, "lodScreenSizes", lodScreenSizes);
+            }
+            ImGui::TextDisabled("Comma-separated, finest first. Screen size is the fraction of view height.");
+        }
+        bool generateMeshlets = MCEImportGetOptionBool(context, "generateMeshlets", 0) != 0;
+        if (ImGui::Checkbox("Generate Meshlets", &generateMeshlets)) {
+            MCEImportSetOptionBool(context, "generateMeshlets", generateMeshlets ? 1 : 0);
+        }
+        if (generateMeshlets) {
+            float meshletVertices = MCEImportGetOptionFloat(context, "meshletMaxVertices", 64.0f);
+            int meshletVertexLimit = static_cast<int>(meshletVertices);
+            if (ImGui::SliderInt("Meshlet Vertices", &meshletVertexLimit, 16, MCE_MESHLET_MAX_VERTICES_LIMIT)) {
+                MCEImportSetOptionString(context, "meshletMaxVertices", std::to_string(meshletVertexLimit).c_str());
+            }
+            float meshletTriangles = MCEImportGetOptionFloat(context, "meshletMaxTriangles", 124.0f);
+            int meshletTriangleLimit = static_cast<int>(meshletTriangles);
+            if (ImGui::SliderInt("Meshlet Triangles", &meshletTriangleLimit, 16, MCE_MESHLET_MAX_TRIANGLES_LIMIT)) {
+                MCEImportSetOptionString(context, "meshletMaxTriangles", std::to_string(meshletTriangleLimit).c_str());
+            }
+        }
+        const char *quantizationLabels[] = { "None", "Balanced", "Compact" };
+        const char *quantizationValues[] = { "none", "balanced", "compact" };
+        char quantizationValue[32] = {0};
+        MCEImportGetOptionString(context, "vertexQuantization", quantizationValue, sizeof(quantizationValue));
+        int quantizationIndex = 0;
+        for (int i = 1; i < 3; ++i) {
+            if (strcmp(quantizationValue, quantizationValues[i]) == 0) { quantizationIndex = i; }
+        }
+        if (ImGui::BeginCombo("Vertex Quantization", quantizationLabels[quantizationIndex])) {
+            for (int i = 0; i < 3; ++i) {
+                bool selected = (i == quantizationIndex);
+                if (ImGui::Selectable(quantizationLabels[i], selected)) {
+                    MCEImportSetOptionString(context, "vertexQuantization", quantizationValues[i]);
+                }
+                if (selected) {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+        if (quantizationIndex != 0) {
+            ImGui::TextDisabled("Adds a packed vertex copy; the import log reports its error and size.");
+        }
+        // Only FBX imports extract skin weights themselves, and only they seed these keys.
+        char skinInfluenceValue[8] = {0};
+        if (MCEImportGetOptionString(context, "skinInfluences", skinInfluenceValue, sizeof(skinInfluenceValue)) != 0) {
+            const char *skinInfluenceLabels[] = { "1", "2", "4" };
+            int skinInfluenceIndex = 2;
+            for (int i = 0; i < 3; ++i) {
+                if (strcmp(skinInfluenceValue, skinInfluenceLabels[i]) == 0) { skinInfluenceIndex = i; }
+            }
+            if (ImGui::BeginCombo("Skin Influences", skinInfluenceLabels[skinInfluenceIndex])) {
+                for (int i = 0; i < 3; ++i) {
+                    bool selected = (i == skinInfluenceIndex);
+                    if (ImGui::Selectable(skinInfluenceLabels[i], selected)) {
+                        MCEImportSetOptionString(context, "skinInfluences", skinInfluenceLabels[i]);
+                    }
+                    if (selected) {
+                        ImGui::SetItemDefaultFocus();
+                    }
+                }
+                ImGui::EndCombo();
+            }
+            float skinMinWeight = MCEImportGetOptionFloat(context, "skinMinWeight", 0.0f);
+            if (ImGui::SliderFloat("Skin Min Weight", &skinMinWeight, 0.0f, 0.2f, "%.3f")) {
+                MCEImportSetOptionFloat(context, "skinMinWeight", skinMinWeight);
+            }
+            char skinRenormalize[8] = {0};
+            MCEImportGetOptionString(context, "skinRenormalize", skinRenormalize, sizeof(skinRenormalize));
+            bool renormalizeSkin = strcmp(skinRenormalize, "none") != 0;
+            if (ImGui::Checkbox("Renormalize Skin Weights", &renormalizeSkin)) {
+                MCEImportSetOptionString(context, "skinRenormalize", renormalizeSkin ? "sum" : "none");
+            }
+            ImGui::TextDisabled("The import log reports how many vertices 1, 2, 4 and 8 influences cover.");
+        }
 
         int32_t warningCount = MCEImportGetWarningCount(context);
         if (warningCount > 0) {
@@ -1904,6 +2198,524 @@ static void DrawImportModal(void *context) {
     ImGui::EndPopup();
 }
 
+struct EntityHandleBenchmarkResult {
+    int32_t entityCount = 0;
+    int32_t iterations = 0;
+    double stringNsPerCall = 0.0;
+    double handleNsPerCall = 0.0;
+};
+
+// Issues the same HasComponent + GetModelMatrix pair the panels make per entity, once through the
+// UUID-string ABI and once through the 16-byte handle ABI, so the per-call marshalling cost is visible.
+static EntityHandleBenchmarkResult RunEntityHandleBenchmark(void *context, int32_t iterations) {
+    EntityHandleBenchmarkResult result;
+    const int32_t entityCount = MCEEditorGetEntityCount(context);
+    if (entityCount <= 0 || iterations <= 0) { return result; }
+    std::vector<std::array<char, 64>> ids;
+    std::vector<MCEEntityHandle> handles;
+    ids.reserve(static_cast<size_t>(entityCount));
+    handles.reserve(static_cast<size_t>(entityCount));
+    for (int32_t i = 0; i < entityCount; ++i) {
+        std::array<char, 64> id {};
+        if (MCEEditorGetEntityIdAt(context, i, id.data(), static_cast<int32_t>(id.size())) <= 0) { continue; }
+        MCEEntityHandle handle = MCEEntityHandleNull();
+        if (MCEEditorGetEntityHandle(context, id.data(), &handle) == 0) { continue; }
+        ids.push_back(id);
+        handles.push_back(handle);
+    }
+    if (ids.empty()) { return result; }
+
+    using Clock = std::chrono::steady_clock;
+    float matrix[16] = {0};
+    uint32_t sink = 0;
+    const Clock::time_point stringStart = Clock::now();
+    for (int32_t iteration = 0; iteration < iterations; ++iteration) {
+        for (const std::array<char, 64> &id : ids) {
+            sink += MCEEditorEntityHasComponent(context, id.data(), 1);
+            sink += MCEEditorGetModelMatrix(context, id.data(), matrix);
+        }
+    }
+    const Clock::time_point handleStart = Clock::now();
+    for (int32_t iteration = 0; iteration < iterations; ++iteration) {
+        for (const MCEEntityHandle &handle : handles) {
+            sink += MCEEditorEntityHasComponentH(context, handle, 1);
+            sink += MCEEditorGetModelMatrixH(context, handle, matrix);
+        }
+    }
+    const Clock::time_point handleEnd = Clock::now();
+    (void)sink;
+
+    const double calls = static_cast<double>(ids.size()) * static_cast<double>(iterations) * 2.0;
+    result.entityCount = static_cast<int32_t>(ids.size());
+    result.iterations = iterations;
+    result.stringNsPerCall = std::chrono::duration<double, std::nano>(handleStart - stringStart).count() / calls;
+    result.handleNsPerCall = std::chrono::duration<double, std::nano>(handleEnd - handleStart).count() / calls;
+    return result;
+}
+
+struct TraceTimelineState {
+    bool paused = false;
+    bool showingFile = false;
+    EditorTrace::Capture capture;
+    int frameOffset = 0;
+    int exportFrames = 120;
+    float zoom = 1.0f;
+};
+
+static TraceTimelineState gTraceTimeline;
+static EditorProfilerHistory::History gProfilerHistory;
+
+static ImU32 TraceScopeColor(uint32_t nameId) {
+    const float hue = static_cast<float>((nameId * 2654435761u) >> 16 & 0xFFFFu) / 65535.0f;
+    float r = 0.0f;
+    float g = 0.0f;
+    float b = 0.0f;
+    ImGui::ColorConvertHSVtoRGB(hue, 0.45f, 0.72f, r, g, b);
+    return ImGui::ColorConvertFloat4ToU32(ImVec4(r, g, b, 1.0f));
+}
+
+static void ExportTraceCapture(void *context, const EditorTrace::Capture &capture, bool chromeJson) {
+    char path[1024] = {0};
+    if (MCEEditorMakeTraceExportPath(context, "trace", chromeJson ? "json" : "mctrace", path, sizeof(path)) == 0) { return; }
+    const bool written = chromeJson ? EditorTrace::WriteChromeJson(capture, path) : EditorTrace::WriteBinary(capture, path);
+    const std::string message = std::string(written ? "Exported trace: " : "Failed to export trace: ") + path;
+    MCEEditorLogMessageWithSource(context, written ? 1 : 3, 1, "Profiler", message.c_str());
+}
+
+static void DrawTraceFrame(const EditorTrace::Capture &capture, const EditorTrace::Frame &frame, float zoom) {
+    const double frameNs = static_cast<double>(std::max<uint64_t>(1, frame.endNs - frame.startNs));
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const float laneHeaderHeight = ImGui::GetTextLineHeight() + 2.0f;
+
+    std::vector<int> laneDepth(capture.threads.size(), -1);
+    for (const EditorTrace::Scope &scope : frame.scopes) {
+        if (scope.threadIndex < laneDepth.size()) {
+            laneDepth[scope.threadIndex] = std::max<int>(laneDepth[scope.threadIndex], scope.depth);
+        }
+    }
+    std::vector<float> laneY(capture.threads.size(), 0.0f);
+    float totalHeight = 0.0f;
+    for (size_t lane = 0; lane < laneDepth.size(); ++lane) {
+        if (laneDepth[lane] < 0) { continue; }
+        laneY[lane] = totalHeight + laneHeaderHeight;
+        totalHeight += laneHeaderHeight + static_cast<float>(laneDepth[lane] + 1) * rowHeight + 4.0f;
+    }
+    if (totalHeight <= 0.0f) {
+        ImGui::TextDisabled("No scopes recorded in this frame.");
+        return;
+    }
+
+    ImGui::BeginChild("TraceTimeline", ImVec2(0.0f, std::min(totalHeight + 18.0f, 320.0f)), true, ImGuiWindowFlags_HorizontalScrollbar);
+    const float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f) * zoom;
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##TraceTimelineCanvas", ImVec2(width, totalHeight));
+    ImDrawList *drawList = ImGui::GetWindowDrawList();
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+    const bool canvasHovered = ImGui::IsItemHovered();
+
+    for (size_t lane = 0; lane < laneDepth.size(); ++lane) {
+        if (laneDepth[lane] < 0) { continue; }
+        drawList->AddText(ImVec2(origin.x + ImGui::GetScrollX() + 4.0f, origin.y + laneY[lane] - laneHeaderHeight),
+                          IM_COL32(170, 170, 178, 255),
+                          capture.threads[lane].name.c_str());
+    }
+
+    const EditorTrace::Scope *hovered = nullptr;
+    for (const EditorTrace::Scope &scope : frame.scopes) {
+        if (scope.threadIndex >= laneDepth.size()) { continue; }
+        const double startT = (static_cast<double>(scope.startNs) - static_cast<double>(frame.startNs)) / frameNs;
+        const double endT = (static_cast<double>(scope.endNs) - static_cast<double>(frame.startNs)) / frameNs;
+        const float x0 = origin.x + static_cast<float>(std::max(0.0, startT)) * width;
+        const float x1 = origin.x + static_cast<float>(std::min(1.0, endT)) * width;
+        const float y0 = origin.y + laneY[scope.threadIndex] + static_cast<float>(scope.depth) * rowHeight;
+        const ImVec2 min(x0, y0);
+        const ImVec2 max(std::max(x1, x0 + 1.0f), y0 + rowHeight - 1.0f);
+        drawList->AddRectFilled(min, max, TraceScopeColor(scope.nameId), 2.0f);
+        if (max.x - min.x > 24.0f && scope.nameId < capture.names.size()) {
+            drawList->PushClipRect(min, max, true);
+            drawList->AddText(ImVec2(min.x + 3.0f, min.y + 2.0f), IM_COL32(18, 18, 20, 255), capture.names[scope.nameId].c_str());
+            drawList->PopClipRect();
+        }
+        if (canvasHovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y && mouse.y < max.y) {
+            hovered = &scope;
+        }
+    }
+    if (hovered) {
+        ImGui::BeginTooltip();
+        ImGui::TextUnformatted(hovered->nameId < capture.names.size() ? capture.names[hovered->nameId].c_str() : "?");
+        ImGui::Text("%.3f ms", static_cast<double>(hovered->endNs - hovered->startNs) / 1.0e6);
+        ImGui::TextDisabled("Depth %u  |  %s", static_cast<unsigned>(hovered->depth), capture.threads[hovered->threadIndex].name.c_str());
+        ImGui::EndTooltip();
+    }
+    ImGui::EndChild();
+}
+
+static void DrawTraceTimeline(void *context) {
+    TraceTimelineState &state = gTraceTimeline;
+    const bool frozen = state.paused || state.showingFile;
+
+    bool recording = MCETraceIsEnabled() != 0;
+    if (ImGui::Checkbox("Record##TraceTimeline", &recording)) {
+        MCETraceSetEnabled(recording ? 1 : 0);
+    }
+    ImGui::SameLine();
+    if (state.showingFile) {
+        if (ImGui::Button("Back to Live##TraceTimeline")) {
+            state.showingFile = false;
+            state.paused = false;
+        }
+    } else if (ImGui::Button(state.paused ? "Resume##TraceTimeline" : "Pause##TraceTimeline")) {
+        state.paused = !state.paused;
+        if (state.paused) {
+            state.capture = EditorTrace::Snapshot(EditorTrace::kHistoryFrames);
+            state.frameOffset = 0;
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Open Capture...##TraceTimeline")) {
+        char path[1024] = {0};
+        if (MCEEditorChooseTraceCapture(context, path, sizeof(path)) != 0) {
+            EditorTrace::Capture loaded;
+            if (EditorTrace::ReadBinary(path, loaded) && !loaded.frames.empty()) {
+                state.capture = std::move(loaded);
+                state.showingFile = true;
+                state.frameOffset = 0;
+            } else {
+                const std::string message = std::string("Failed to read trace capture: ") + path;
+                MCEEditorLogMessageWithSource(context, 3, 1, "Profiler", message.c_str());
+            }
+        }
+    }
+
+    if (!frozen) {
+        state.capture = EditorTrace::Snapshot(static_cast<size_t>(std::max(1, state.exportFrames)));
+        state.frameOffset = 0;
+    }
+    const int frameCount = static_cast<int>(state.capture.frames.size());
+
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::DragInt("Frames##TraceExport", &state.exportFrames, 1.0f, 1, static_cast<int>(EditorTrace::kHistoryFrames));
+    ImGui::SameLine();
+    if (ImGui::Button("Export Chrome Trace##TraceTimeline") && frameCount > 0) {
+        ExportTraceCapture(context, state.capture, true);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export Capture##TraceTimeline") && frameCount > 0) {
+        ExportTraceCapture(context, state.capture, false);
+    }
+
+    if (frameCount == 0) {
+        ImGui::TextDisabled("No frames recorded yet.");
+        return;
+    }
+    if (frozen) {
+        ImGui::SetNextItemWidth(220.0f);
+        ImGui::SliderInt("Frames Back##TraceTimeline", &state.frameOffset, 0, frameCount - 1);
+        ImGui::SameLine();
+    }
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::SliderFloat("Zoom##TraceTimeline", &state.zoom, 1.0f, 32.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+    state.frameOffset = std::max(0, std::min(state.frameOffset, frameCount - 1));
+    const EditorTrace::Frame &frame = state.capture.frames[static_cast<size_t>(frameCount - 1 - state.frameOffset)];
+    const EditorTrace::Stats stats = EditorTrace::GetStats();
+    ImGui::TextDisabled("Frame %llu  |  %.2f ms  |  %zu scopes  |  %u threads  |  dropped %llu",
+                        static_cast<unsigned long long>(frame.frameIndex),
+                        static_cast<double>(frame.endNs - frame.startNs) / 1.0e6,
+                        frame.scopes.size(),
+                        stats.threadCount,
+                        static_cast<unsigned long long>(stats.droppedEvents));
+    DrawTraceFrame(state.capture, frame, state.zoom);
+}
+
+static void SampleProfilerHistory(void *context) {
+    using namespace EditorProfilerHistory;
+    void *engineContext = MCEContextGetEngineContext(context);
+    float values[MetricCount] = {};
+    values[MetricFrame] = MCERendererGetFrameMs(engineContext);
+    values[MetricGpu] = MCERendererGetGpuMs(engineContext);
+    values[MetricUpdate] = MCERendererGetUpdateMs(engineContext);
+    values[MetricRender] = MCERendererGetRenderMs(engineContext);
+    values[MetricPost] = MCERendererGetBloomMs(engineContext) + MCERendererGetCompositeMs(engineContext) + MCERendererGetOverlaysMs(engineContext);
+    gProfilerHistory.Sample(ImGui::GetTime(), values);
+
+    EditorTrace::Capture capture;
+    SpikeRecord record;
+    if (!gProfilerHistory.TakeSpikeCapture(capture, record)) { return; }
+    char baseName[64] = {0};
+    snprintf(baseName, sizeof(baseName), "spike-f%llu", static_cast<unsigned long long>(record.frameIndex));
+    char path[1024] = {0};
+    char message[1200] = {0};
+    if (MCEEditorMakeTraceExportPath(context, baseName, "mctrace", path, sizeof(path)) != 0 && EditorTrace::WriteBinary(capture, path)) {
+        record.path = path;
+        snprintf(message, sizeof(message), "Frame %llu took %.1f ms; captured %zu frames to %s",
+                 static_cast<unsigned long long>(record.frameIndex), record.frameMs, capture.frames.size(), path);
+        MCEEditorLogMessageWithSource(context, 2, 1, "Profiler", message);
+        gProfilerHistory.AddSpikeRecord(std::move(record));
+    } else {
+        snprintf(message, sizeof(message), "Failed to save spike capture for frame %llu",
+                 static_cast<unsigned long long>(record.frameIndex));
+        MCEEditorLogMessageWithSource(context, 3, 1, "Profiler", message);
+    }
+}
+
+static void DrawLongHistoryGraph(const std::deque<float> &samples, float thresholdMs) {
+    ImVec2 graphSize(ImGui::GetContentRegionAvail().x, 80.0f);
+    ImVec2 graphMin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##LongHistoryGraph", graphSize);
+    ImVec2 graphMax(graphMin.x + graphSize.x, graphMin.y + graphSize.y);
+    ImDrawList *drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(graphMin, graphMax, IM_COL32(24, 24, 27, 255), 4.0f);
+    drawList->AddRect(graphMin, graphMax, IM_COL32(60, 60, 66, 255), 4.0f);
+    const int columns = std::max(1, static_cast<int>(graphSize.x) - 2);
+    if (samples.empty()) { return; }
+
+    float maxValue = thresholdMs * 1.25f;
+    for (float value : samples) { maxValue = std::max(maxValue, value); }
+    auto toY = [&](float value) {
+        return graphMax.y - 1.0f - (std::min(value, maxValue) / maxValue) * (graphSize.y - 2.0f);
+    };
+
+    // Each column shows the min..max of its bin so single-frame hitches survive downsampling.
+    const size_t count = samples.size();
+    for (int column = 0; column < columns; ++column) {
+        const size_t begin = count * static_cast<size_t>(column) / static_cast<size_t>(columns);
+        const size_t end = std::max(begin + 1, count * static_cast<size_t>(column + 1) / static_cast<size_t>(columns));
+        if (begin >= count) { break; }
+        float low = samples[begin];
+        float high = samples[begin];
+        for (size_t i = begin + 1; i < std::min(end, count); ++i) {
+            low = std::min(low, samples[i]);
+            high = std::max(high, samples[i]);
+        }
+        const float x = graphMin.x + 1.0f + static_cast<float>(column);
+        const ImU32 color = high > thresholdMs ? IM_COL32(214, 96, 88, 255) : IM_COL32(189, 164, 214, 255);
+        drawList->AddLine(ImVec2(x, toY(low) + 1.0f), ImVec2(x, toY(high)), color);
+    }
+    const float thresholdY = toY(thresholdMs);
+    drawList->AddLine(ImVec2(graphMin.x, thresholdY), ImVec2(graphMax.x, thresholdY), IM_COL32(214, 96, 88, 120));
+
+    char maxLabel[32] = {0};
+    snprintf(maxLabel, sizeof(maxLabel), "%.1f ms", maxValue);
+    drawList->AddText(ImVec2(graphMin.x + 6.0f, graphMin.y + 4.0f), IM_COL32(180, 180, 185, 255), maxLabel);
+}
+
+static void DrawLongHistory(void *context) {
+    using namespace EditorProfilerHistory;
+    float windowMinutes = gProfilerHistory.WindowSeconds() / 60.0f;
+    ImGui::SetNextItemWidth(120.0f);
+    if (ImGui::DragFloat("Window (min)##LongHistory", &windowMinutes, 0.25f, 0.5f, 60.0f, "%.1f")) {
+        gProfilerHistory.SetWindowSeconds(windowMinutes * 60.0f);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Clear##LongHistory")) {
+        gProfilerHistory.Clear();
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("%.1f min  |  %llu samples",
+                        gProfilerHistory.CoveredSeconds() / 60.0,
+                        static_cast<unsigned long long>(gProfilerHistory.Summarize(MetricFrame).count));
+
+    SpikeSettings &spikes = gProfilerHistory.Spikes();
+    DrawLongHistoryGraph(gProfilerHistory.Samples(MetricFrameInterval), spikes.thresholdMs);
+
+    if (ImGui::BeginTable("LongHistoryStats", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp)) {
+        ImGui::TableSetupColumn("Metric");
+        ImGui::TableSetupColumn("p50");
+        ImGui::TableSetupColumn("p95");
+        ImGui::TableSetupColumn("p99");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableSetupColumn("Mean");
+        ImGui::TableHeadersRow();
+        for (int32_t metric = 0; metric < MetricCount; ++metric) {
+            const Summary summary = gProfilerHistory.Summarize(static_cast<Metric>(metric));
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(MetricName(static_cast<Metric>(metric)));
+            const float columnsMs[5] = { summary.p50, summary.p95, summary.p99, summary.max, summary.mean };
+            for (int column = 0; column < 5; ++column) {
+                ImGui::TableSetColumnIndex(column + 1);
+                ImGui::Text("%.2f", columnsMs[column]);
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::Checkbox("Capture Spikes", &spikes.enabled);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(100.0f);
+    ImGui::DragFloat("Threshold (ms)##Spikes", &spikes.thresholdMs, 1.0f, 5.0f, 2000.0f, "%.0f");
+    const int maxAround = static_cast<int>(EditorTrace::kHistoryFrames / 2) - 1;
+    ImGui::SetNextItemWidth(100.0f);
+    ImGui::DragInt("Frames Before##Spikes", &spikes.framesBefore, 1.0f, 0, maxAround);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(100.0f);
+    ImGui::DragInt("Frames After##Spikes", &spikes.framesAfter, 1.0f, 0, maxAround);
+    ImGui::TextDisabled("Detected %llu  |  saved %zu (limit %d per session)",
+                        static_cast<unsigned long long>(gProfilerHistory.SpikesDetected()),
+                        gProfilerHistory.SpikeRecords().size(),
+                        spikes.maxCapturesPerSession);
+
+    const std::vector<SpikeRecord> &records = gProfilerHistory.SpikeRecords();
+    for (size_t i = records.size(); i > 0; --i) {
+        const SpikeRecord &record = records[i - 1];
+        char label[96] = {0};
+        snprintf(label, sizeof(label), "Frame %llu  %.1f ms##Spike%zu",
+                 static_cast<unsigned long long>(record.frameIndex), record.frameMs, i);
+        if (ImGui::Selectable(label)) {
+            EditorTrace::Capture loaded;
+            if (EditorTrace::ReadBinary(record.path, loaded) && !loaded.frames.empty()) {
+                gTraceTimeline.capture = std::move(loaded);
+                gTraceTimeline.showingFile = true;
+                gTraceTimeline.frameOffset = 0;
+                for (size_t frame = 0; frame < gTraceTimeline.capture.frames.size(); ++frame) {
+                    if (gTraceTimeline.capture.frames[frame].frameIndex == record.frameIndex) {
+                        gTraceTimeline.frameOffset = static_cast<int>(gTraceTimeline.capture.frames.size() - 1 - frame);
+                    }
+                }
+            } else {
+                const std::string message = "Failed to read trace capture: " + record.path;
+                MCEEditorLogMessageWithSource(context, 3, 1, "Profiler", message.c_str());
+            }
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("%s", record.path.c_str());
+        }
+    }
+}
+
+static void DrawFixedStepDiagnostics(void *context) {
+    int32_t policy = 0;
+    uint64_t frames = 0;
+    uint64_t steps = 0;
+    double droppedMs = 0.0;
+    double slowedMs = 0.0;
+    uint64_t budgetHitFrames = 0;
+    uint64_t adaptiveFrames = 0;
+    double stepCostMeanMs = 0.0;
+    int32_t stepsLastSecond = 0;
+    if (MCEEditorGetFixedStepStats(context, &policy, &frames, &steps, &droppedMs, &slowedMs,
+                                   &budgetHitFrames, &adaptiveFrames, &stepCostMeanMs, &stepsLastSecond) == 0) {
+        return;
+    }
+
+    const char *policyNames[] = { "Drop Time", "Slow Motion", "Adaptive Delta" };
+    ImGui::SetNextItemWidth(160.0f);
+    if (ImGui::Combo("Overload Policy", &policy, policyNames, IM_ARRAYSIZE(policyNames))) {
+        MCEEditorSetFixedStepOverloadPolicy(context, policy);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Reset##FixedStep")) {
+        MCEEditorResetFixedStepStats(context);
+    }
+
+    ImGui::Text("Steps:        %llu over %llu frames (%d last second)",
+                static_cast<unsigned long long>(steps), static_cast<unsigned long long>(frames), stepsLastSecond);
+    ImGui::Text("Dropped:      %.1f ms", droppedMs);
+    if (slowedMs > 0.0) {
+        ImGui::Text("Slowed:       %.1f ms", slowedMs);
+    }
+    ImGui::Text("Budget hits:  %llu frames", static_cast<unsigned long long>(budgetHitFrames));
+    if (adaptiveFrames > 0) {
+        ImGui::Text("Adapted:      %llu frames", static_cast<unsigned long long>(adaptiveFrames));
+    }
+    ImGui::Text("Step cost:    %.3f ms mean", stepCostMeanMs);
+
+    uint64_t histogram[32] = {};
+    const int32_t bucketCount = MCEEditorGetFixedStepHistogram(context, histogram, IM_ARRAYSIZE(histogram));
+    if (bucketCount > 0 && frames > 0) {
+        float histogramValues[32] = {};
+        float histogramMax = 0.0f;
+        for (int32_t i = 0; i < bucketCount; ++i) {
+            histogramValues[i] = static_cast<float>(histogram[i]);
+            histogramMax = std::max(histogramMax, histogramValues[i]);
+        }
+        ImGui::PlotHistogram("Substeps/frame##FixedStep", histogramValues, bucketCount, 0,
+                             "0 .. max substeps", 0.0f, histogramMax, ImVec2(0.0f, 60.0f));
+    }
+
+    float recentSteps[240] = {};
+    float recentDroppedMs[240] = {};
+    float recentCostMs[240] = {};
+    const int32_t recentCount = MCEEditorGetFixedStepRecent(context, recentSteps, recentDroppedMs, recentCostMs,
+                                                            nullptr, IM_ARRAYSIZE(recentSteps));
+    if (recentCount > 1) {
+        ImGui::PlotLines("Steps##FixedStepRecent", recentSteps, recentCount, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+        ImGui::PlotLines("Cost (ms)##FixedStepRecent", recentCostMs, recentCount, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+        ImGui::PlotLines("Dropped (ms)##FixedStepRecent", recentDroppedMs, recentCount, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+    }
+
+    float lastCosts[32] = {};
+    const int32_t lastCount = MCEEditorGetFixedStepLastCosts(context, lastCosts, IM_ARRAYSIZE(lastCosts));
+    if (lastCount > 0) {
+        ImGui::TextDisabled("Last frame substeps:");
+        for (int32_t i = 0; i < lastCount; ++i) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("%.2f", lastCosts[i]);
+        }
+    }
+
+    static int replaySteps = 600;
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::DragInt("Replay Steps", &replaySteps, 10.0f, 1, 100000);
+    ImGui::SameLine();
+    const bool runtimeActive = MCESceneIsPlaying(context) != 0 || MCESceneIsSimulating(context) != 0;
+    ImGui::BeginDisabled(runtimeActive);
+    if (ImGui::Button("Run Replay")) {
+        MCEEditorRunFixedStepReplay(context, replaySteps);
+    }
+    ImGui::EndDisabled();
+    int32_t replayedSteps = 0;
+    double replayMs = 0.0;
+    double stepsPerSecond = 0.0;
+    double p50Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    uint64_t checksum = 0;
+    uint32_t deterministic = 0;
+    if (MCEEditorGetFixedStepReplayResult(context, &replayedSteps, &replayMs, &stepsPerSecond, &p50Ms, &p99Ms,
+                                          &maxMs, &checksum, &deterministic) != 0) {
+        ImGui::Text("Replay: %d steps in %.1f ms (%.0f steps/s)", replayedSteps, replayMs, stepsPerSecond);
+        ImGui::Text("  Step p50 %.3f  p99 %.3f  max %.3f ms", p50Ms, p99Ms, maxMs);
+        ImGui::Text("  Checksum %016llx  %s", static_cast<unsigned long long>(checksum),
+                    deterministic != 0 ? "deterministic" : "NOT deterministic");
+    }
+}
+
+static void DrawJobSystemStats() {
+    uint64_t jobsExecuted = 0;
+    uint64_t steals = 0;
+    uint64_t parallelFors = 0;
+    uint64_t graphsRun = 0;
+    MCEJobsGetStats(&jobsExecuted, &steals, &parallelFors, &graphsRun);
+    ImGui::Text("Workers:  %u", MCEJobsWorkerCount());
+    ImGui::Text("Jobs:     %llu (%llu stolen)", static_cast<unsigned long long>(jobsExecuted),
+                static_cast<unsigned long long>(steals));
+    ImGui::Text("Parallel-for: %llu  Graphs: %llu", static_cast<unsigned long long>(parallelFors),
+                static_cast<unsigned long long>(graphsRun));
+
+    static uint32_t benchParticipants[16] = {};
+    static double benchMs[16] = {};
+    static int32_t benchRuns = 0;
+    static int benchItems = 262144;
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::DragInt("Items##JobScaling", &benchItems, 1024.0f, 1024, 16777216);
+    ImGui::SameLine();
+    if (ImGui::Button("Run Scaling Benchmark")) {
+        benchRuns = MCEJobsRunScalingBenchmark(static_cast<uint32_t>(benchItems), benchParticipants, benchMs,
+                                               IM_ARRAYSIZE(benchParticipants));
+    }
+    if (benchRuns <= 0) {
+        ImGui::TextDisabled("Runs a fixed workload with 1, 2, 4, ... threads.");
+        return;
+    }
+    const double baseline = benchMs[0];
+    for (int32_t i = 0; i < benchRuns; ++i) {
+        const double speedup = benchMs[i] > 0.0 ? baseline / benchMs[i] : 0.0;
+        ImGui::Text("%2u threads: %8.2f ms  %.2fx", benchParticipants[i], benchMs[i], speedup);
+    }
+}
+
 static void DrawProfilingPanel(void *context, bool *isOpen) {
     if (!isOpen || !*isOpen) { return; }
     ImGui::Begin("Profiling", isOpen);
@@ -2017,6 +2829,10 @@ static void DrawProfilingPanel(void *context, bool *isOpen) {
     ImGui::Text("Overlays:   %.2f ms", MCERendererGetOverlaysMs(engineContext));
     ImGui::Text("Present:    %.2f ms", MCERendererGetPresentMs(engineContext));
 
+    ImGui::Separator();
+    ImGui::TextUnformatted("Fixed Step");
+    DrawFixedStepDiagnostics(context);
+
     ImGui::Separator();
     ImGui::TextUnformatted("GPU Passes");
     bool gpuPassSupported = MCERendererGetGpuPassTimingsSupported(engineContext) != 0;
@@ -2046,6 +2862,247 @@ static void DrawProfilingPanel(void *context, bool *isOpen) {
         ImGui::Text("Composite:  %.2f ms", MCERendererGetGpuFinalCompositePassMs(engineContext));
     }
 
+    ImGui::Separator();
+    ImGui::TextUnformatted("Long History");
+    DrawLongHistory(context);
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Timeline");
+    DrawTraceTimeline(context);
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Entity ABI");
+    static EntityHandleBenchmarkResult handleBenchmark;
+    static int handleBenchmarkIterations = 100;
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::DragInt("Iterations##EntityHandleBenchmark", &handleBenchmarkIterations, 1.0f, 1, 10000);
+    ImGui::SameLine();
+    if (ImGui::Button("Run Benchmark##EntityHandleBenchmark")) {
+        handleBenchmark = RunEntityHandleBenchmark(context, handleBenchmarkIterations);
+    }
+    if (handleBenchmark.entityCount > 0) {
+        ImGui::Text("Entities: %d x %d iterations", handleBenchmark.entityCount, handleBenchmark.iterations);
+        ImGui::Text("String id: %.1f ns/call", handleBenchmark.stringNsPerCall);
+        ImGui::Text("Handle:    %.1f ns/call", handleBenchmark.handleNsPerCall);
+        if (handleBenchmark.handleNsPerCall > 0.0) {
+            ImGui::Text("Speedup:   %.2fx", handleBenchmark.stringNsPerCall / handleBenchmark.handleNsPerCall);
+        }
+    } else {
+        ImGui::TextDisabled("Compares string-id and handle lookups over the active scene.");
+    }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Material Edits");
+    uint64_t materialDeltas = 0;
+    uint64_t materialWrites = 0;
+    uint64_t materialWritesAvoided = 0;
+    int32_t materialPending = 0;
+    if (MCEEditorGetMaterialEditStats(context, &materialDeltas, &materialWrites, &materialWritesAvoided, &materialPending) != 0) {
+        ImGui::Text("Deltas:         %llu", static_cast<unsigned long long>(materialDeltas));
+        ImGui::Text("Files written:  %llu", static_cast<unsigned long long>(materialWrites));
+        ImGui::Text("Writes avoided: %llu", static_cast<unsigned long long>(materialWritesAvoided));
+        ImGui::Text("Pending:        %d", materialPending);
+    }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Assets");
+    int32_t dependencyNodes = 0;
+    int32_t dependencyEdges = 0;
+    int32_t dependencyChanged = 0;
+    double dependencyUpdateMs = 0.0;
+    if (MCEEditorGetAssetDependencyStats(context, &dependencyNodes, &dependencyEdges, &dependencyChanged, &dependencyUpdateMs) != 0) {
+        ImGui::Text("Assets: %d  References: %d", dependencyNodes, dependencyEdges);
+        ImGui::Text("Last update: %d changed, %.2f ms", dependencyChanged, dependencyUpdateMs);
+    }
+    uint64_t assetMutations = 0;
+    uint64_t registryUpdates = 0;
+    uint64_t rescansAvoided = 0;
+    uint64_t watcherSuppressed = 0;
+    int32_t pathsReloaded = 0;
+    double registryUpdateMs = 0.0;
+    if (MCEEditorGetAssetMutationStats(context, &assetMutations, &registryUpdates, &rescansAvoided,
+                                       &watcherSuppressed, &pathsReloaded, &registryUpdateMs) != 0) {
+        ImGui::Text("Mutations: %llu in %llu registry updates", static_cast<unsigned long long>(assetMutations),
+                    static_cast<unsigned long long>(registryUpdates));
+        ImGui::Text("Rescans avoided: %llu  Watcher events ignored: %llu", static_cast<unsigned long long>(rescansAvoided),
+                    static_cast<unsigned long long>(watcherSuppressed));
+        ImGui::Text("Last registry update: %d reloaded, %.2f ms", pathsReloaded, registryUpdateMs);
+    }
+    uint64_t cookHits = 0;
+    uint64_t cooks = 0;
+    uint64_t cookFailures = 0;
+    uint64_t cookBytes = 0;
+    double lastCookMs = 0.0;
+    if (MCEEditorGetTextureCookStats(context, &cookHits, &cooks, &cookFailures, &cookBytes, &lastCookMs) != 0
+        && cookHits + cooks + cookFailures > 0) {
+        ImGui::Text("Texture cooks: %llu (%llu cached, %llu failed)", static_cast<unsigned long long>(cooks),
+                    static_cast<unsigned long long>(cookHits), static_cast<unsigned long long>(cookFailures));
+        ImGui::Text("Cooked output: %.2f MB, last cook %.1f ms", static_cast<double>(cookBytes) / (1024.0 * 1024.0), lastCookMs);
+    }
+    int32_t skeletonEntries = 0;
+    int32_t skeletonsLoaded = 0;
+    int32_t skeletonQueries = 0;
+    int32_t skeletonsScored = 0;
+    int32_t skeletonsSkipped = 0;
+    if (MCEEditorGetSkeletonIndexStats(context, &skeletonEntries, &skeletonsLoaded, &skeletonQueries,
+                                       &skeletonsScored, &skeletonsSkipped) != 0 && skeletonEntries > 0) {
+        ImGui::Text("Skeleton index: %d fingerprints, %d loaded from disk", skeletonEntries, skeletonsLoaded);
+        ImGui::Text("Skeleton matches: %d queries, %d scored, %d skipped by sketch", skeletonQueries, skeletonsScored, skeletonsSkipped);
+    }
+    uint64_t clipBakes = 0;
+    uint64_t clipBakeFailures = 0;
+    uint64_t clipOpens = 0;
+    uint64_t clipStaleOpens = 0;
+    uint64_t clipBytes = 0;
+    if (MCEEditorGetBakedClipStats(context, &clipBakes, &clipBakeFailures, &clipOpens, &clipStaleOpens, &clipBytes) != 0
+        && clipBakes + clipBakeFailures + clipOpens > 0) {
+        ImGui::Text("Baked clips: %llu baked (%llu failed), %.2f MB", static_cast<unsigned long long>(clipBakes),
+                    static_cast<unsigned long long>(clipBakeFailures), static_cast<double>(clipBytes) / (1024.0 * 1024.0));
+        ImGui::Text("Baked clip reads: %llu opened, %llu stale", static_cast<unsigned long long>(clipOpens),
+                    static_cast<unsigned long long>(clipStaleOpens));
+    }
+    static std::array<MCEMeshletBenchmarkResult, 4> meshletResults {};
+    static int32_t meshletResultCount = 0;
+    if (ImGui::Button("Run Meshlet Culling Benchmark")) {
+        meshletResultCount = MCEMeshletRunBenchmark(meshletResults.data(), static_cast<int32_t>(meshletResults.size()));
+    }
+    if (meshletResultCount > 0) {
+        for (int32_t i = 0; i < meshletResultCount; ++i) {
+            const MCEMeshletBenchmarkResult &result = meshletResults[i];
+            ImGui::Text("%-8s %u tris -> %u meshlets (%.1fv/%.1ft), %.1f ms", MCEMeshletBenchmarkMeshName(i),
+                        result.triangleCount, result.meshletCount, result.averageVertices, result.averageTriangles,
+                        result.buildMilliseconds);
+            ImGui::Text("         cone %.0f%% of %.0f%% back-facing, sphere %.0f%% / box %.0f%% of %.0f%% outside",
+                        result.coneCulled * 100.0f, result.backfacingIdeal * 100.0f, result.sphereCulled * 100.0f,
+                        result.boxCulled * 100.0f, result.outsideIdeal * 100.0f);
+            if (result.coneViolations > 0) {
+                ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "         %u visible triangles cone-culled",
+                                   result.coneViolations);
+            }
+        }
+    } else {
+        ImGui::TextDisabled("Measures meshlet cone and bounds culling on generated meshes.");
+    }
+    static std::array<MCESkinInfluenceBenchmarkResult, 4> skinResults {};
+    static int32_t skinResultCount = 0;
+    if (ImGui::Button("Run Skin Influence Benchmark")) {
+        skinResultCount = MCESkinInfluenceRunBenchmark(skinResults.data(), static_cast<int32_t>(skinResults.size()));
+    }
+    if (skinResultCount > 0) {
+        for (int32_t i = 0; i < skinResultCount; ++i) {
+            const MCESkinInfluenceBenchmarkResult &result = skinResults[i];
+            const MCESkinInfluenceCoverage &coverage = result.coverage;
+            const float skinned = static_cast<float>(std::max(coverage.skinnedVertexCount, 1u));
+            ImGui::Text("%-7s %u verts, %.2f -> %.2f influences, max %u, %.2f ms at k4", MCESkinInfluenceBenchmarkSkinName(i),
+                        result.vertexCount, static_cast<float>(result.sourceInfluences) / static_cast<float>(result.vertexCount),
+                        static_cast<float>(coverage.keptInfluences) / skinned, coverage.maxInfluences,
+                        result.selectMilliseconds[2]);
+            ImGui::Text("        covered k1 %.0f%% k2 %.0f%% k4 %.0f%% k8 %.0f%%, worst loss at k4 %.3f",
+                        coverage.coveredByK[0] * 100.0f / skinned, coverage.coveredByK[1] * 100.0f / skinned,
+                        coverage.coveredByK[2] * 100.0f / skinned, coverage.coveredByK[3] * 100.0f / skinned,
+                        coverage.maxDroppedWeightByK[2]);
+        }
+    } else {
+        ImGui::TextDisabled("Selects top-K skin influences on generated skins at a 1%% threshold.");
+    }
+    static std::array<int32_t, MCETextureContainerCount> probeContainers {};
+    static std::array<double, MCETextureContainerCount> probeNanoseconds {};
+    static int32_t probeResultCount = 0;
+    if (ImGui::Button("Run Texture Probe Benchmark")) {
+        probeResultCount = MCETextureProbeRunBenchmark(20000, probeContainers.data(), probeNanoseconds.data(),
+                                                       static_cast<int32_t>(probeContainers.size()));
+    }
+    if (probeResultCount > 0) {
+        for (int32_t i = 0; i < probeResultCount; ++i) {
+            const int32_t container = probeContainers[i];
+            if (container < 0) {
+                ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%-5s probe failed", MCETextureContainerName(-container));
+            } else {
+                ImGui::Text("%-5s %.0f ns/header", MCETextureContainerName(container), probeNanoseconds[i]);
+            }
+        }
+    } else {
+        ImGui::TextDisabled("Times header-only probes of 8K textures per container.");
+    }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Play Mode");
+    double playEnterMs = 0.0;
+    double playExitMs = 0.0;
+    int32_t componentsChecked = 0;
+    int32_t componentsRestored = 0;
+    int32_t entitiesDestroyed = 0;
+    uint64_t documentRestores = 0;
+    if (MCEEditorGetPlayModeTransitionStats(context, &playEnterMs, &playExitMs, &componentsChecked,
+                                            &componentsRestored, &entitiesDestroyed, &documentRestores) != 0) {
+        ImGui::Text("Enter:    %.2f ms", playEnterMs);
+        ImGui::Text("Exit:     %.2f ms", playExitMs);
+        ImGui::Text("Restored: %d of %d components", componentsRestored, componentsChecked);
+        ImGui::Text("Removed entities: %d", entitiesDestroyed);
+        if (documentRestores > 0) {
+            ImGui::TextDisabled("Full document restores: %llu", static_cast<unsigned long long>(documentRestores));
+        }
+    }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Undo Journal");
+    uint64_t undoBytes = 0;
+    uint64_t undoBudget = 0;
+    uint64_t undoTransactions = 0;
+    uint64_t undoMerged = 0;
+    uint64_t undoEvicted = 0;
+    double undoCloseMs = 0.0;
+    double undoApplyMs = 0.0;
+    int32_t undoCount = 0;
+    int32_t redoCount = 0;
+    if (MCEEditorGetUndoJournalStats(context, &undoBytes, &undoBudget, &undoTransactions, &undoMerged,
+                                     &undoEvicted, &undoCloseMs, &undoApplyMs) != 0
+        && MCEEditorGetUndoState(context, nullptr, 0, nullptr, 0, &undoCount, &redoCount) != 0) {
+        ImGui::Text("Entries:  %d undo / %d redo", undoCount, redoCount);
+        ImGui::Text("Memory:   %.2f / %.0f MB", static_cast<double>(undoBytes) / (1024.0 * 1024.0),
+                    static_cast<double>(undoBudget) / (1024.0 * 1024.0));
+        ImGui::Text("Recorded: %llu (%llu merged, %llu evicted)",
+                    static_cast<unsigned long long>(undoTransactions),
+                    static_cast<unsigned long long>(undoMerged),
+                    static_cast<unsigned long long>(undoEvicted));
+        ImGui::Text("Close:    %.3f ms", undoCloseMs);
+        ImGui::Text("Apply:    %.3f ms", undoApplyMs);
+        int budgetMB = static_cast<int>(undoBudget / (1024 * 1024));
+        ImGui::SetNextItemWidth(120.0f);
+        if (ImGui::DragInt("Budget (MB)", &budgetMB, 1.0f, 1, 4096) && budgetMB > 0) {
+            MCEEditorSetUndoJournalBudget(context, budgetMB);
+        }
+    }
+    static int undoBenchmarkSteps = 1000;
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::DragInt("Benchmark Steps", &undoBenchmarkSteps, 10.0f, 1, 100000);
+    ImGui::SameLine();
+    ImGui::BeginDisabled(MCESceneIsPlaying(context) != 0 || MCESceneIsSimulating(context) != 0);
+    if (ImGui::Button("Run Undo Benchmark")) {
+        MCEEditorRunUndoBenchmark(context, undoBenchmarkSteps);
+    }
+    ImGui::EndDisabled();
+    int32_t benchmarkSteps = 0;
+    int32_t benchmarkEntities = 0;
+    double benchmarkRecordMs = 0.0;
+    double benchmarkUndoMs = 0.0;
+    double benchmarkRedoMs = 0.0;
+    uint32_t benchmarkRestored = 0;
+    if (MCEEditorGetUndoBenchmarkResult(context, &benchmarkSteps, &benchmarkEntities, &benchmarkRecordMs,
+                                        &benchmarkUndoMs, &benchmarkRedoMs, &benchmarkRestored) != 0) {
+        if (benchmarkSteps == 0) {
+            ImGui::TextDisabled("Benchmark needs an entity with a Transform.");
+        } else {
+            ImGui::Text("Benchmark: %d steps over %d entities", benchmarkSteps, benchmarkEntities);
+            ImGui::Text("  Record %.1f ms  Undo all %.1f ms  Redo all %.1f ms", benchmarkRecordMs, benchmarkUndoMs, benchmarkRedoMs);
+            ImGui::Text("  %s", benchmarkRestored != 0 ? "Undo restored every transform" : "Undo did NOT restore the scene");
+        }
+    }
+
+    ImGui::Separator();
+    ImGui::TextUnformatted("Jobs");
+    DrawJobSystemStats();
+
     ImGui::End();
 }
 
@@ -2142,8 +3199,12 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
         _LoadedPanelVisibility = false;
         _SelectedEntityId[0] = 0;
         _LogRevision = 0;
-        _LogEntries.clear();
-        _LogFilteredIndices.clear();
+        _LogLastSequence = 0;
+        _LogIndex.Clear();
+        _LogFilteredSequences.clear();
+        _LogSourceNames.clear();
+        _LogFilterCategoryMask = 0x1FFu;
+        _LogCategoryMask = 0x1FFu;
         _LogFilterDirty = true;
         _LogFilterText[0] = 0;
         _LogFilterTrace = true;
@@ -2227,12 +3288,12 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
     const std::string solidFontPath = ResolveEditorIconFontPath("FA7Free-Solid-900.otf");
     const std::string regularFontPath = ResolveEditorIconFontPath("FA7Free-Regular-400.otf");
     if (solidFontPath.empty()) {
-        MCEEditorLogMessage(_context, 3, 1,
-                            "Bundled Editor icon font is missing: Icons/FA7Free-Solid-900.otf");
+        MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                      "Bundled Editor icon font is missing: Icons/FA7Free-Solid-900.otf");
     }
     if (regularFontPath.empty()) {
-        MCEEditorLogMessage(_context, 3, 1,
-                            "Bundled Editor icon font is missing: Icons/FA7Free-Regular-400.otf");
+        MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                      "Bundled Editor icon font is missing: Icons/FA7Free-Regular-400.otf");
     }
 
     bool loadedAnyIconFont = false;
@@ -2241,8 +3302,8 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
         ImFont *solidFont = io.Fonts->AddFontFromFileTTF(solidFontPath.c_str(), 13.0f, &iconConfig, iconRanges);
         if (solidFont == nullptr) {
             loadedAllIconFonts = false;
-            MCEEditorLogMessage(_context, 3, 1,
-                                "Failed to load bundled Editor icon font: Icons/FA7Free-Solid-900.otf");
+            MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                          "Failed to load bundled Editor icon font: Icons/FA7Free-Solid-900.otf");
         } else {
             loadedAnyIconFont = true;
         }
@@ -2251,23 +3312,23 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
         ImFont *regularFont = io.Fonts->AddFontFromFileTTF(regularFontPath.c_str(), 13.0f, &iconConfig, iconRanges);
         if (regularFont == nullptr) {
             loadedAllIconFonts = false;
-            MCEEditorLogMessage(_context, 3, 1,
-                                "Failed to load bundled Editor icon font: Icons/FA7Free-Regular-400.otf");
+            MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                          "Failed to load bundled Editor icon font: Icons/FA7Free-Regular-400.otf");
         } else {
             loadedAnyIconFont = true;
         }
     }
     if (!loadedAnyIconFont) {
-        MCEEditorLogMessage(_context, 3, 1,
-                            "No bundled Editor icon fonts loaded; icon glyphs will be unavailable.");
+        MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                      "No bundled Editor icon fonts loaded; icon glyphs will be unavailable.");
     } else if (!loadedAllIconFonts) {
-        MCEEditorLogMessage(_context, 3, 1,
-                            "The bundled Editor icon font set is incomplete; some icon glyphs may be unavailable.");
+        MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                      "The bundled Editor icon font set is incomplete; some icon glyphs may be unavailable.");
     }
 
     if (!io.Fonts->Build()) {
-        MCEEditorLogMessage(_context, 3, 1,
-                            "Failed to build the Editor font atlas; embedded default text remains available.");
+        MCEEditorLogMessageWithSource(_context, 3, 1, "Fonts",
+                                      "Failed to build the Editor font atlas; embedded default text remains available.");
     }
 }
 
@@ -2398,6 +3459,24 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
             EditorUI::PopMenuPopupStyle();
             ImGui::EndMenu();
         }
+        if (ImGui::BeginMenu("Edit")) {
+            EditorUI::PushMenuPopupStyle();
+            char undoLabel[128] = {0};
+            char redoLabel[128] = {0};
+            int32_t undoCount = 0;
+            int32_t redoCount = 0;
+            MCEEditorGetUndoState(_context, undoLabel, sizeof(undoLabel), redoLabel, sizeof(redoLabel), &undoCount, &redoCount);
+            std::string undoItem = undoCount > 0 ? std::string("Undo ") + undoLabel : std::string("Undo");
+            std::string redoItem = redoCount > 0 ? std::string("Redo ") + redoLabel : std::string("Redo");
+            if (ImGui::MenuItem(undoItem.c_str(), "Cmd+Z", false, undoCount > 0)) {
+                MCEEditorUndo(_context);
+            }
+            if (ImGui::MenuItem(redoItem.c_str(), "Shift+Cmd+Z", false, redoCount > 0)) {
+                MCEEditorRedo(_context);
+            }
+            EditorUI::PopMenuPopupStyle();
+            ImGui::EndMenu();
+        }
         if (ImGui::BeginMenu("View")) {
             EditorUI::PushMenuPopupStyle();
             DrawPanelMenuItem(self, { "Scene Hierarchy", "SceneHierarchy", &_ShowSceneHierarchyPanel });
@@ -2525,9 +3604,23 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
         ImGui::EndPopup();
     }
 
+    SampleProfilerHistory(_context);
+
+    ImGuiIO &shortcutIO = ImGui::GetIO();
+    if (!shortcutIO.WantTextInput
+        && (shortcutIO.KeySuper || shortcutIO.KeyCtrl)
+        && ImGui::IsKeyPressed(ImGuiKey_Z)) {
+        if (shortcutIO.KeyShift) {
+            MCEEditorRedo(_context);
+        } else {
+            MCEEditorUndo(_context);
+        }
+    }
+
     // --- Panels ---
     bool hierarchyOpen = _ShowSceneHierarchyPanel;
     if (hierarchyOpen) {
+        MCE_TRACE_SCOPE("Scene Hierarchy Panel");
         ImGuiSceneHierarchyPanelDraw(_context, &hierarchyOpen, _SelectedEntityId, sizeof(_SelectedEntityId));
         if (hierarchyOpen != _ShowSceneHierarchyPanel) {
             _ShowSceneHierarchyPanel = hierarchyOpen;
@@ -2537,6 +3630,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
     bool inspectorOpen = _ShowInspectorPanel;
     if (inspectorOpen) {
+        MCE_TRACE_SCOPE("Inspector Panel");
         ImGuiInspectorPanelDraw(_context, &inspectorOpen, _SelectedEntityId);
         if (inspectorOpen != _ShowInspectorPanel) {
             _ShowInspectorPanel = inspectorOpen;
@@ -2547,6 +3641,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
     bool contentOpen = _ShowContentBrowserPanel;
     if (contentOpen) {
+        MCE_TRACE_SCOPE("Content Browser Panel");
         ImGuiContentBrowserPanelDraw(_context, &contentOpen);
         if (contentOpen != _ShowContentBrowserPanel) {
             _ShowContentBrowserPanel = contentOpen;
@@ -2556,6 +3651,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
     bool profilingOpen = _ShowProfilingPanel;
     if (profilingOpen) {
+        MCE_TRACE_SCOPE("Profiling Panel");
         DrawProfilingPanel(_context, &profilingOpen);
         if (profilingOpen != _ShowProfilingPanel) {
             _ShowProfilingPanel = profilingOpen;
@@ -2565,6 +3661,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
     bool logsOpen = _ShowLogsPanel;
     if (logsOpen) {
+        MCE_TRACE_SCOPE("Logs Panel");
         DrawLogsPanel(self, &logsOpen);
         if (logsOpen != _ShowLogsPanel) {
             _ShowLogsPanel = logsOpen;
@@ -2574,6 +3671,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
     if (_ShowViewportPanel) {
         _ViewportUIHovered = false;
+        MCE_TRACE_SCOPE("Viewport Panel");
         ImGuiViewportPanelDraw(_context,
                                sceneTexture,
                                previewTexture,
@@ -2591,6 +3689,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
     bool animationGraphOpen = _ShowAnimationGraphPanel;
     if (animationGraphOpen) {
+        MCE_TRACE_SCOPE("Animation Graph Panel");
         DrawAnimationGraphPanel(self, &animationGraphOpen);
         if (animationGraphOpen != _ShowAnimationGraphPanel) {
             _ShowAnimationGraphPanel = animationGraphOpen;
@@ -2603,7 +3702,7 @@ static ImGuiKey MapKeyCode(uint16_t keyCode) {
 
 - (void)renderWithCommandBuffer:(id<MTLCommandBuffer>)commandBuffer
             renderPassDescriptor:(MTLRenderPassDescriptor *)renderPassDescriptor {
-
+    MCE_TRACE_SCOPE("ImGui Render");
     ImGui::Render();
 
     id<MTLRenderCommandEncoder> encoder =
@@ -42,7 +42,11 @@ final class ImGuiLayer: Layer {
     }
 
     nonisolated override func onUpdate(frame: FrameContext) {
+        MCETraceFrameMark(frame.time.frameCount)
+        MCETraceBegin(EditorTraceScopes.editorUpdate)
+        defer { MCETraceEnd() }
         context.engineContext.debugDraw.beginFrame()
+        context.editorLogCenter.beginFrame(frame.time.frameCount)
         lastFrameTime = frame.time
         sceneContext.editorScene = context.editorSceneController.editorScene
         sceneContext.runtimeScene = context.editorSceneController.runtimeScene
@@ -60,6 +64,7 @@ final class ImGuiLayer: Layer {
         sceneContext.viewportOrigin = SIMD2<Float>(Float(viewportOrigin.x), Float(viewportOrigin.y))
         sceneContext.viewportSize = SIMD2<Float>(Float(viewportSize.width), Float(viewportSize.height))
         context.editorSceneController.update(frame: frame)
+        context.undoJournal.tick(context: context, interactionActive: MCEImGuiIsEditInteractionActive())
         if !context.editorSceneController.isPlaying,
            let scene = sceneContext.activeScene {
             context.engineContext.debugDraw.submitGridXZ(SceneRenderer.gridParams(scene: scene))
@@ -76,8 +81,7 @@ final class ImGuiLayer: Layer {
             )
         }
         if let scene = sceneContext.activeScene {
-            submitSelectedCameraFrustumGizmoIfNeeded(scene: scene)
-            submitReflectionProbeDebugGizmosIfNeeded(scene: scene)
+            submitViewportGizmos(scene: scene)
         }
         context.engineContext.debugDraw.endFrame()
 
@@ -107,6 +111,8 @@ final class ImGuiLayer: Layer {
     }
     
     nonisolated override func onOverlayRender(view: MTKView, commandBuffer: MTLCommandBuffer, frameContext: RendererFrameContext) {
+        MCETraceBegin(EditorTraceScopes.overlayRender)
+        defer { MCETraceEnd() }
         imguiBridge.setup(with: view)
         let deltaTime = lastFrameTime?.deltaTime ?? 0.0
         imguiBridge.newFrame(with: view, deltaTime: deltaTime)
@@ -376,84 +382,135 @@ final class ImGuiLayer: Layer {
             && lhs.isEditor == rhs.isEditor
     }
 
-    private func submitSelectedCameraFrustumGizmoIfNeeded(scene: EngineScene) {
+    /// One debug-draw call produced by gizmo math.
+    private enum GizmoPrimitive {
+        case frustumLine(SIMD3<Float>, SIMD3<Float>, SIMD4<Float>)
+        case frustumRect([SIMD3<Float>], SIMD4<Float>)
+        case probeInfluenceBox(simd_float4x4, halfExtents: SIMD3<Float>, SIMD4<Float>)
+        case probeBlendShell(simd_float4x4, inner: SIMD3<Float>, outer: SIMD3<Float>, outerColor: SIMD4<Float>, connectorColor: SIMD4<Float>)
+        case probeCenter(simd_float4x4, SIMD4<Float>)
+    }
+
+    /// Scene and renderer values are read here on the main thread; each gizmo's matrices, frustum corners
+    /// and colours are then built on the editor jobs from those copies, and only submission runs serially.
+    private func submitViewportGizmos(scene: EngineScene) {
+        var jobs: [() -> [GizmoPrimitive]] = []
+        if let cameraJob = selectedCameraFrustumGizmoJob(scene: scene) {
+            jobs.append(cameraJob)
+        }
+        jobs.append(contentsOf: reflectionProbeGizmoJobs(scene: scene))
+        guard !jobs.isEmpty else { return }
+
+        let primitives = EditorJobs.parallelMap(count: jobs.count, grain: 16) { jobs[$0]() }
+        let debugDraw = context.engineContext.debugDraw
+        for primitive in primitives.joined() {
+            switch primitive {
+            case let .frustumLine(from, to, color):
+                debugDraw.submitLine(category: .cameraFrustum, from, to, color: color)
+            case let .frustumRect(corners, color):
+                debugDraw.submitPolyline(category: .cameraFrustum, corners, color: color, closed: true)
+            case let .probeInfluenceBox(transform, halfExtents, color):
+                debugDraw.submitWireBox(category: .reflectionProbeInfluence,
+                                        transform: transform,
+                                        halfExtents: halfExtents,
+                                        color: color)
+            case let .probeBlendShell(transform, inner, outer, outerColor, connectorColor):
+                debugDraw.submitWireBoxShell(category: .reflectionProbeBlendShell,
+                                             transform: transform,
+                                             innerHalfExtents: inner,
+                                             outerHalfExtents: outer,
+                                             outerColor: outerColor,
+                                             connectorColor: connectorColor)
+            case let .probeCenter(transform, color):
+                debugDraw.submitWireSphere(category: .reflectionProbeInfluence,
+                                           transform: transform,
+                                           radius: 0.08,
+                                           color: color,
+                                           segments: 10)
+            }
+        }
+    }
+
+    private func selectedCameraFrustumGizmoJob(scene: EngineScene) -> (() -> [GizmoPrimitive])? {
         if context.editorSceneController.isPlaying || context.editorSceneController.isSimulating {
-            return
+            return nil
         }
         if !context.editorProjectManager.viewportDebugStyle(.cameraFrustums).enabled {
-            return
+            return nil
         }
         guard let selectedId = context.editorSceneController.selectedEntityUUID(),
               let entity = scene.ecs.entity(with: selectedId),
               let camera = scene.ecs.get(CameraComponent.self, for: entity),
               scene.ecs.get(TransformComponent.self, for: entity) != nil else {
-            return
+            return nil
         }
         if camera.isEditor {
-            return
+            return nil
         }
 
         let accent = context.editorProjectManager.themeAccent()
         let color = SIMD4<Float>(accent.0, accent.1, accent.2, 1.0)
-        let debugDraw = context.engineContext.debugDraw
-
         let worldTransform = scene.ecs.worldTransform(for: entity)
         let position = worldTransform.position
-        let normalizedRotation = TransformMath.normalizedQuaternion(worldTransform.rotation)
-        let rotation = simd_quatf(
-            real: normalizedRotation.w,
-            imag: SIMD3<Float>(normalizedRotation.x, normalizedRotation.y, normalizedRotation.z)
-        )
+        let worldRotation = worldTransform.rotation
+        let aspect = max(0.1, sceneContext.viewportSize.x / max(1.0, sceneContext.viewportSize.y))
+
+        return {
+            let normalizedRotation = TransformMath.normalizedQuaternion(worldRotation)
+            let rotation = simd_quatf(
+                real: normalizedRotation.w,
+                imag: SIMD3<Float>(normalizedRotation.x, normalizedRotation.y, normalizedRotation.z)
+            )
+
+            let right = Self.safeNormalize(rotation.act(SIMD3<Float>(1, 0, 0)), fallback: SIMD3<Float>(1, 0, 0))
+            let up = Self.safeNormalize(rotation.act(SIMD3<Float>(0, 1, 0)), fallback: SIMD3<Float>(0, 1, 0))
+            let forward = Self.safeNormalize(rotation.act(SIMD3<Float>(0, 0, -1)), fallback: SIMD3<Float>(0, 0, -1))
+
+            let gizmoLength: Float = 2.0
+            let nearDepth = gizmoLength * 0.05
+            let farDepth = gizmoLength
+
+            let nearHalfW: Float
+            let nearHalfH: Float
+            let farHalfW: Float
+            let farHalfH: Float
+            switch camera.projectionType {
+            case .perspective:
+                let fov = max(1.0, min(179.0, camera.fovDegrees)) * (.pi / 180.0)
+                let tanHalfFov = tan(fov * 0.5)
+                nearHalfH = nearDepth * tanHalfFov
+                nearHalfW = nearHalfH * aspect
+                farHalfH = farDepth * tanHalfFov
+                farHalfW = farHalfH * aspect
+            case .orthographic:
+                let baseHalfHeight = max(0.05, camera.orthoSize * 0.5)
+                let clampedHalfHeight = min(baseHalfHeight, gizmoLength * 0.75)
+                nearHalfH = clampedHalfHeight
+                nearHalfW = clampedHalfHeight * aspect
+                farHalfH = clampedHalfHeight
+                farHalfW = clampedHalfHeight * aspect
+            }
 
-        let right = safeNormalize(rotation.act(SIMD3<Float>(1, 0, 0)), fallback: SIMD3<Float>(1, 0, 0))
-        let up = safeNormalize(rotation.act(SIMD3<Float>(0, 1, 0)), fallback: SIMD3<Float>(0, 1, 0))
-        let forward = safeNormalize(rotation.act(SIMD3<Float>(0, 0, -1)), fallback: SIMD3<Float>(0, 0, -1))
+            let nearCenter = position + forward * nearDepth
+            let farCenter = position + forward * farDepth
 
-        let gizmoLength: Float = 2.0
-        let nearDepth = gizmoLength * 0.05
-        let farDepth = gizmoLength
-        let aspect = max(0.1, sceneContext.viewportSize.x / max(1.0, sceneContext.viewportSize.y))
+            let nearCorners = Self.makeFrustumCorners(center: nearCenter, right: right, up: up, halfWidth: nearHalfW, halfHeight: nearHalfH)
+            let farCorners = Self.makeFrustumCorners(center: farCenter, right: right, up: up, halfWidth: farHalfW, halfHeight: farHalfH)
 
-        let nearHalfW: Float
-        let nearHalfH: Float
-        let farHalfW: Float
-        let farHalfH: Float
-        switch camera.projectionType {
-        case .perspective:
-            let fov = max(1.0, min(179.0, camera.fovDegrees)) * (.pi / 180.0)
-            let tanHalfFov = tan(fov * 0.5)
-            nearHalfH = nearDepth * tanHalfFov
-            nearHalfW = nearHalfH * aspect
-            farHalfH = farDepth * tanHalfFov
-            farHalfW = farHalfH * aspect
-        case .orthographic:
-            let baseHalfHeight = max(0.05, camera.orthoSize * 0.5)
-            let clampedHalfHeight = min(baseHalfHeight, gizmoLength * 0.75)
-            nearHalfH = clampedHalfHeight
-            nearHalfW = clampedHalfHeight * aspect
-            farHalfH = clampedHalfHeight
-            farHalfW = clampedHalfHeight * aspect
-        }
-
-        let nearCenter = position + forward * nearDepth
-        let farCenter = position + forward * farDepth
-
-        let nearCorners = makeFrustumCorners(center: nearCenter, right: right, up: up, halfWidth: nearHalfW, halfHeight: nearHalfH)
-        let farCorners = makeFrustumCorners(center: farCenter, right: right, up: up, halfWidth: farHalfW, halfHeight: farHalfH)
-
-        submitFrustumRect(corners: nearCorners, debugDraw: debugDraw, color: color)
-        submitFrustumRect(corners: farCorners, debugDraw: debugDraw, color: color)
-        for i in 0..<4 {
-            debugDraw.submitLine(category: .cameraFrustum, nearCorners[i], farCorners[i], color: color)
-        }
-        debugDraw.submitLine(category: .cameraFrustum, position, farCenter, color: color)
+            var primitives: [GizmoPrimitive] = [.frustumRect(nearCorners, color), .frustumRect(farCorners, color)]
+            for i in 0..<4 {
+                primitives.append(.frustumLine(nearCorners[i], farCorners[i], color))
+            }
+            primitives.append(.frustumLine(position, farCenter, color))
+            return primitives
+        }
     }
 
-    private func makeFrustumCorners(center: SIMD3<Float>,
-                                    right: SIMD3<Float>,
-                                    up: SIMD3<Float>,
-                                    halfWidth: Float,
-                                    halfHeight: Float) -> [SIMD3<Float>] {
+    private static func makeFrustumCorners(center: SIMD3<Float>,
+                                           right: SIMD3<Float>,
+                                           up: SIMD3<Float>,
+                                           halfWidth: Float,
+                                           halfHeight: Float) -> [SIMD3<Float>] {
         [
             center - right * halfWidth + up * halfHeight,
             center + right * halfWidth + up * halfHeight,
@@ -462,12 +519,7 @@ final class ImGuiLayer: Layer {
         ]
     }
 
-    private func submitFrustumRect(corners: [SIMD3<Float>], debugDraw: DebugDraw, color: SIMD4<Float>) {
-        guard corners.count == 4 else { return }
-        debugDraw.submitPolyline(category: .cameraFrustum, corners, color: color, closed: true)
-    }
-
-    private func safeNormalize(_ v: SIMD3<Float>, fallback: SIMD3<Float>) -> SIMD3<Float> {
+    private static func safeNormalize(_ v: SIMD3<Float>, fallback: SIMD3<Float>) -> SIMD3<Float> {
         let lenSq = simd_length_squared(v)
         if lenSq < 1e-8 || !lenSq.isFinite {
             return fallback
@@ -475,12 +527,13 @@ final class ImGuiLayer: Layer {
         return v / sqrt(lenSq)
     }
 
-    private func submitReflectionProbeDebugGizmosIfNeeded(scene: EngineScene) {
+    /// Submits the selection link directly (one primitive) and returns one job per enabled probe.
+    private func reflectionProbeGizmoJobs(scene: EngineScene) -> [() -> [GizmoPrimitive]] {
         let probeInfluenceEnabled = context.editorProjectManager.viewportDebugStyle(.reflectionProbeInfluence).enabled
         let probeShellEnabled = context.editorProjectManager.viewportDebugStyle(.reflectionProbeBlendShell).enabled
         let probeLinkEnabled = context.editorProjectManager.viewportDebugStyle(.reflectionProbeLinks).enabled
         if !probeInfluenceEnabled && !probeShellEnabled && !probeLinkEnabled {
-            return
+            return []
         }
 
         let debugDraw = context.engineContext.debugDraw
@@ -533,64 +586,64 @@ final class ImGuiLayer: Layer {
                 )
             }
         }
+        guard probeInfluenceEnabled || probeShellEnabled else { return [] }
 
+        var jobs: [() -> [GizmoPrimitive]] = []
         scene.ecs.viewReflectionProbes { entity, probe in
             guard probe.enabled else { return }
             let worldTransform = scene.ecs.worldTransform(for: entity)
-            let transformMatrix = TransformMath.makeMatrix(
-                position: worldTransform.position,
-                rotation: worldTransform.rotation,
-                scale: SIMD3<Float>(repeating: 1.0)
-            )
-            let halfExtents = max(probe.boxExtents, SIMD3<Float>(repeating: 0.001))
-            let outerHalfExtents = max(halfExtents + SIMD3<Float>(repeating: max(probe.blendDistance, 0.0)),
-                                       SIMD3<Float>(repeating: 0.001))
-
-            let statusColor = reflectionProbeDebugColor(
-                for: renderer?.reflectionProbeBakeStatus(scene: scene, entityID: entity.id)
-            )
-            let baseColor: SIMD4<Float>
+            let position = worldTransform.position
+            let rotation = worldTransform.rotation
+            let boxExtents = probe.boxExtents
+            let blendDistance = probe.blendDistance
+            let bakeStatus = renderer?.reflectionProbeBakeStatus(scene: scene, entityID: entity.id)
+            let highlight: SIMD4<Float>?
             if selectedEntityID == entity.id {
-                baseColor = accentColor
+                highlight = accentColor
             } else if selectedProbeEntityID == entity.id {
-                baseColor = SIMD4<Float>(0.25, 0.95, 0.95, 1.0)
+                highlight = SIMD4<Float>(0.25, 0.95, 0.95, 1.0)
             } else {
-                baseColor = statusColor
+                highlight = nil
             }
-            let shellOuterColor = SIMD4<Float>(baseColor.x, baseColor.y, baseColor.z, max(0.32, baseColor.w * 0.5))
-            let shellConnectorColor = SIMD4<Float>(baseColor.x, baseColor.y, baseColor.z, max(0.55, baseColor.w * 0.78))
 
-            if probeInfluenceEnabled {
-                debugDraw.submitWireBox(category: .reflectionProbeInfluence,
-                                        transform: transformMatrix,
-                                        halfExtents: halfExtents,
-                                        color: baseColor)
-            }
-            if probeShellEnabled && probe.blendDistance > 0.0 {
-                debugDraw.submitWireBoxShell(category: .reflectionProbeBlendShell,
-                                             transform: transformMatrix,
-                                             innerHalfExtents: halfExtents,
-                                             outerHalfExtents: outerHalfExtents,
-                                             outerColor: shellOuterColor,
-                                             connectorColor: shellConnectorColor)
-            }
-            if probeInfluenceEnabled {
-                debugDraw.submitWireSphere(
-                    category: .reflectionProbeInfluence,
-                    transform: TransformMath.makeMatrix(
-                        position: worldTransform.position,
+            jobs.append {
+                let transformMatrix = TransformMath.makeMatrix(
+                    position: position,
+                    rotation: rotation,
+                    scale: SIMD3<Float>(repeating: 1.0)
+                )
+                let halfExtents = max(boxExtents, SIMD3<Float>(repeating: 0.001))
+                let outerHalfExtents = max(halfExtents + SIMD3<Float>(repeating: max(blendDistance, 0.0)),
+                                           SIMD3<Float>(repeating: 0.001))
+                let baseColor = highlight ?? Self.reflectionProbeDebugColor(for: bakeStatus)
+                let shellOuterColor = SIMD4<Float>(baseColor.x, baseColor.y, baseColor.z, max(0.32, baseColor.w * 0.5))
+                let shellConnectorColor = SIMD4<Float>(baseColor.x, baseColor.y, baseColor.z, max(0.55, baseColor.w * 0.78))
+
+                var primitives: [GizmoPrimitive] = []
+                if probeInfluenceEnabled {
+                    primitives.append(.probeInfluenceBox(transformMatrix, halfExtents: halfExtents, baseColor))
+                }
+                if probeShellEnabled && blendDistance > 0.0 {
+                    primitives.append(.probeBlendShell(transformMatrix,
+                                                       inner: halfExtents,
+                                                       outer: outerHalfExtents,
+                                                       outerColor: shellOuterColor,
+                                                       connectorColor: shellConnectorColor))
+                }
+                if probeInfluenceEnabled {
+                    primitives.append(.probeCenter(TransformMath.makeMatrix(
+                        position: position,
                         rotation: .zero,
                         scale: SIMD3<Float>(repeating: 1.0)
-                    ),
-                    radius: 0.08,
-                    color: baseColor,
-                    segments: 10
-                )
+                    ), baseColor))
+                }
+                return primitives
             }
         }
+        return jobs
     }
 
-    private func reflectionProbeDebugColor(for status: ReflectionProbeRuntimeStatus?) -> SIMD4<Float> {
+    private static func reflectionProbeDebugColor(for status: ReflectionProbeRuntimeStatus?) -> SIMD4<Float> {
         switch status {
         case .queued:
             return SIMD4<Float>(0.95, 0.75, 0.2, 0.95)
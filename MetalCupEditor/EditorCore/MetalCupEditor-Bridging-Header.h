@@ -3,4 +3,14 @@
 /// Created by Kaden Cringle.
 
 #import "ImGui/ImGuiBridge.h"
+#import "Assets/BakedClip.h"
 #import "Assets/FbxBridge.h"
+#import "Assets/MeshSimplifier.h"
+#import "Assets/MeshletBuilder.h"
+#import "Assets/SkinInfluenceSelector.h"
+#import "Assets/TextureCooker.h"
+#import "Assets/TextureHeaderProbe.h"
+#import "Assets/VertexQuantizer.h"
+#import "Bridge/EditorEntityHandle.h"
+#import "Services/EditorTrace.h"
+#import "Services/EditorJobs.h"
@@ -0,0 +1,117 @@
+/// EditorComponentRegistry.swift
+/// Type-erased accessors for the component types the editor snapshots, diffs, and journals.
+/// Created by Kaden Cringle
+
+import Foundation
+import MetalCupEngine
+
+struct EditorComponentKind {
+    let name: String
+    let byteSize: Int
+    /// False for state the engine derives or rebuilds at runtime; the undo journal does not diff it.
+    let journaled: Bool
+    /// Boxed copy of the component, or nil when the entity does not have it.
+    let read: (SceneECS, Entity) -> Any?
+    /// True when the entity has the component and its bytes equal `stored`. Reads unboxed, so the
+    /// common "unchanged" answer costs a lookup and a memcmp.
+    let matches: (SceneECS, Entity, Any) -> Bool
+    let has: (SceneECS, Entity) -> Bool
+    let write: (EngineScene, Any, Entity) -> Void
+    let remove: (SceneECS, Entity) -> Void
+}
+
+enum EditorComponentRegistry {
+    static let kinds: [EditorComponentKind] = [
+        kind("Name", { $0.get(NameComponent.self, for: $1) }, { $0.remove(NameComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Transform", { $0.get(TransformComponent.self, for: $1) }, { $0.remove(TransformComponent.self, from: $1) },
+             { _ = $0.transformAuthority.setLocalTransform(entity: $2, transform: $1, source: .editor) }),
+        kind("Layer", { $0.get(LayerComponent.self, for: $1) }, { $0.remove(LayerComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("MeshRenderer", { $0.get(MeshRendererComponent.self, for: $1) }, { $0.remove(MeshRendererComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("SkinnedMesh", { $0.get(SkinnedMeshComponent.self, for: $1) }, { $0.remove(SkinnedMeshComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Material", { $0.get(MaterialComponent.self, for: $1) }, { $0.remove(MaterialComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Animator", { $0.get(AnimatorComponent.self, for: $1) }, { $0.remove(AnimatorComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Rigidbody", { $0.get(RigidbodyComponent.self, for: $1) }, { $0.remove(RigidbodyComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Collider", { $0.get(ColliderComponent.self, for: $1) }, { $0.remove(ColliderComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("CharacterController", { $0.get(CharacterControllerComponent.self, for: $1) }, { $0.remove(CharacterControllerComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Light", { $0.get(LightComponent.self, for: $1) }, { $0.remove(LightComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("LightOrbit", { $0.get(LightOrbitComponent.self, for: $1) }, { $0.remove(LightOrbitComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Camera", { $0.get(CameraComponent.self, for: $1) }, { $0.remove(CameraComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("Script", { $0.get(ScriptComponent.self, for: $1) }, { $0.remove(ScriptComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("ReflectionProbe", { $0.get(ReflectionProbeComponent.self, for: $1) }, { $0.remove(ReflectionProbeComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("SkyLight", { $0.get(SkyLightComponent.self, for: $1) }, { $0.remove(SkyLightComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("EnvironmentState", { $0.get(EnvironmentStateComponent.self, for: $1) }, { $0.remove(EnvironmentStateComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("SkyIBLState", { $0.get(SkyIBLStateComponent.self, for: $1) }, { $0.remove(SkyIBLStateComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }, journaled: false),
+        kind("Environment", { $0.get(EnvironmentComponent.self, for: $1) }, { $0.remove(EnvironmentComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("EnvironmentRuntimeState", { $0.get(EnvironmentRuntimeStateComponent.self, for: $1) }, { $0.remove(EnvironmentRuntimeStateComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }, journaled: false),
+        kind("EnvironmentIBLState", { $0.get(EnvironmentIBLStateComponent.self, for: $1) }, { $0.remove(EnvironmentIBLStateComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }, journaled: false),
+        kind("EnvironmentFrameState", { $0.get(EnvironmentFrameStateComponent.self, for: $1) }, { $0.remove(EnvironmentFrameStateComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }, journaled: false),
+        kind("SkyLightTag", { $0.get(SkyLightTag.self, for: $1) }, { $0.remove(SkyLightTag.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("SkySunTag", { $0.get(SkySunTag.self, for: $1) }, { $0.remove(SkySunTag.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("PrefabInstance", { $0.get(PrefabInstanceComponent.self, for: $1) }, { $0.remove(PrefabInstanceComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) }),
+        kind("PrefabOverride", { $0.get(PrefabOverrideComponent.self, for: $1) }, { $0.remove(PrefabOverrideComponent.self, from: $1) },
+             { $0.ecs.add($1, to: $2) })
+    ]
+
+    static let nameKindIndex = 0
+    static let journaledKindIndices: [Int] = kinds.indices.filter { kinds[$0].journaled }
+
+    /// Accessors are spelled out per type so each closure binds the concrete component type.
+    private static func kind<Component>(_ name: String,
+                                        _ get: @escaping (SceneECS, Entity) -> Component?,
+                                        _ remove: @escaping (SceneECS, Entity) -> Void,
+                                        _ set: @escaping (EngineScene, Component, Entity) -> Void,
+                                        journaled: Bool = true) -> EditorComponentKind {
+        EditorComponentKind(
+            name: name,
+            byteSize: MemoryLayout<Component>.size,
+            journaled: journaled,
+            read: { get($0, $1) },
+            matches: { ecs, entity, stored in
+                guard let live = get(ecs, entity), let stored = stored as? Component else { return false }
+                return bitwiseEqual(live, stored)
+            },
+            has: { get($0, $1) != nil },
+            write: { scene, value, entity in
+                guard let value = value as? Component else { return }
+                set(scene, value, entity)
+            },
+            remove: remove
+        )
+    }
+
+    /// Bitwise equality is conservative: equal bytes mean equal values (copy-on-write buffers compare
+    /// by identity), while padding or reallocated-but-equal storage only costs a redundant write.
+    @inline(__always)
+    static func bitwiseEqual<T>(_ lhs: T, _ rhs: T) -> Bool {
+        withUnsafeBytes(of: lhs) { lhsBytes in
+            withUnsafeBytes(of: rhs) { rhsBytes in
+                guard lhsBytes.count > 0, let lhsBase = lhsBytes.baseAddress, let rhsBase = rhsBytes.baseAddress else { return true }
+                return memcmp(lhsBase, rhsBase, lhsBytes.count) == 0
+            }
+        }
+    }
+}
@@ -12,11 +12,13 @@ final class EditorSceneController {
     private weak var engineContext: EngineContext?
     private let playModeStateMachine: PlayModeStateMachine
     private let runtimeSessionManager: RuntimeSessionManager
+    let fixedStepScheduler: FixedStepScheduler
 
     init(prefabSystem: PrefabSystem, engineContext: EngineContext) {
         self.prefabSystem = prefabSystem
         self.engineContext = engineContext
         self.runtimeSessionManager = RuntimeSessionManager(prefabSystem: prefabSystem, engineContext: engineContext)
+        self.fixedStepScheduler = FixedStepScheduler(engineContext: engineContext)
         self.playModeStateMachine = PlayModeStateMachine(onIllegalTransition: { [weak engineContext] message in
             engineContext?.log.logWarning(message, category: .editor)
         })
@@ -27,28 +29,28 @@ final class EditorSceneController {
     var isPlaying: Bool { playModeStateMachine.isPlaying }
     var isPaused: Bool { playModeStateMachine.isPaused }
     var isSimulating: Bool { playModeStateMachine.isSimulating }
+    var playModeTransitionStats: PlayModeTransitionStats { runtimeSessionManager.transitionStats }
 
     private var selectedEntityId: UUID?
     private var selectedEntityIds: [UUID] = []
     private var fixedAccumulator: Float = 0.0
     private var simulateAccumulator: Float = 0.0
-    private let maxFixedSteps: Int = 16
-    private let runtimeSafetyMaxSubsteps: Int = 5
     private var lastFrameTime: FrameTime?
     private var timeBaseTotal: Float = 0.0
     private var timeBaseUnscaled: Float = 0.0
     private var timeBaseFrameCount: UInt64 = 0
-
-    private enum FixedStepScheduleMode {
-        case play
-        case simulate
-    }
+    private(set) var hierarchyGeneration: UInt64 = 1
+    private(set) var componentLayoutGeneration: UInt64 = 1
+    private(set) var componentRevision: UInt64 = 1
+    private var prefabApplyPending = false
+    private var runtimeEntitySample: (count: Int, idHash: Int) = (-1, 0)
 
     // MARK: - Scene Accessors
 
     func setScene(_ scene: EngineScene) {
         scene.engineContext = engineContext
         editorScene = scene
+        notifyHierarchyMutation()
     }
 
     func activeScene() -> EngineScene? {
@@ -61,7 +63,21 @@ final class EditorSceneController {
     func update(frame: FrameContext) {
         lastFrameTime = frame.time
         guard let scene = activeScene() else { return }
+        if isSimulating && prefabApplyPending {
+            // Prefab apply re-instantiates entities in the simulated editor scene.
+            runtimeSessionManager.captureSimulateFallback(of: scene)
+        }
         prefabSystem.applyIfNeeded(scene: scene)
+        if prefabApplyPending {
+            // Prefab apply re-instantiates entities, so the tree is only final after it has run.
+            prefabApplyPending = false
+            notifyHierarchyMutation()
+        }
+        if isPlaying || isSimulating {
+            sampleRuntimeHierarchy(scene)
+            // Runtime systems write components every tick; treat every frame as a new revision.
+            notifyComponentRevision()
+        }
         if isPlaying {
             updateRuntimeScene(scene, frame: adjustFrame(frame))
         } else {
@@ -75,6 +91,44 @@ final class EditorSceneController {
 
     func markPrefabsDirty(handles: [AssetHandle]) {
         prefabSystem.markAllDirty(handles: handles)
+        prefabApplyPending = true
+        notifyHierarchyMutation()
+    }
+
+    // MARK: - Hierarchy Generation
+
+    /// Bumped on structural edits (create/destroy/reparent/reorder/rename), prefab applies, scene
+    /// swaps and play-mode transitions so hierarchy views rebuild cached rows only when the tree
+    /// actually changed. Scripts and physics create and destroy entities inside the engine during
+    /// play and simulate, which is caught by sampling the runtime entity set each frame.
+    func notifyHierarchyMutation() {
+        hierarchyGeneration &+= 1
+        notifyComponentRevision()
+    }
+
+    /// Bumped when components are added to or removed from existing entities.
+    func notifyComponentLayoutMutation() {
+        componentLayoutGeneration &+= 1
+        notifyComponentRevision()
+    }
+
+    /// Bumped on any component value change (editor commits, and every runtime tick), letting
+    /// panels skip re-reading component blocks whose revision stamp has not moved.
+    func notifyComponentRevision() {
+        componentRevision &+= 1
+    }
+
+    /// Count plus an order-independent hash of the entity IDs, so a spawn paired with a destroy in
+    /// the same frame still registers.
+    private func sampleRuntimeHierarchy(_ scene: EngineScene) {
+        let entities = scene.ecs.allEntities()
+        var idHash = 0
+        for entity in entities {
+            idHash ^= entity.id.hashValue
+        }
+        guard entities.count != runtimeEntitySample.count || idHash != runtimeEntitySample.idHash else { return }
+        runtimeEntitySample = (entities.count, idHash)
+        notifyHierarchyMutation()
     }
 
     // MARK: - Play/Pause/Stop
@@ -92,6 +146,8 @@ final class EditorSceneController {
         }
         resetTimingBase()
         fixedAccumulator = 0.0
+        fixedStepScheduler.resetDiagnostics()
+        notifyHierarchyMutation()
     }
 
     func stop() {
@@ -99,6 +155,8 @@ final class EditorSceneController {
         runtimeSessionManager.stopPlay(restoreInto: editorScene)
         resetTimingBase()
         fixedAccumulator = 0.0
+        runtimeEntitySample = (-1, 0)
+        notifyHierarchyMutation()
     }
 
     func simulate() {
@@ -110,6 +168,8 @@ final class EditorSceneController {
         }
         resetTimingBase()
         simulateAccumulator = 0.0
+        fixedStepScheduler.resetDiagnostics()
+        notifyHierarchyMutation()
     }
 
     func resetSimulation() {
@@ -117,6 +177,8 @@ final class EditorSceneController {
         runtimeSessionManager.resetSimulate(on: editorScene)
         resetTimingBase()
         simulateAccumulator = 0.0
+        runtimeEntitySample = (-1, 0)
+        notifyHierarchyMutation()
     }
 
     func pause() {
@@ -128,6 +190,30 @@ final class EditorSceneController {
         guard playModeStateMachine.send(.resume) else { return }
     }
 
+    // MARK: - Fixed-Step Replay
+
+    /// Replays a copy of the editor scene headlessly; the editor scene itself is not touched.
+    func runFixedStepReplay(steps: Int) -> FixedStepReplayResult? {
+        guard let document = scratchDocument() else { return nil }
+        return fixedStepScheduler.runReplay(document: document, prefabSystem: prefabSystem, steps: steps)
+    }
+
+    /// A detached copy of the editor scene for benchmarks that mutate it.
+    func makeScratchScene() -> EngineScene? {
+        guard let document = scratchDocument() else { return nil }
+        return SerializedScene(document: document, prefabSystem: prefabSystem, engineContext: engineContext)
+    }
+
+    private func scratchDocument() -> SceneDocument? {
+        guard let editorScene, !isPlaying, !isSimulating else { return nil }
+        let rendererSettings = engineContext?.rendererSettings ?? RendererSettings()
+        let physicsSettings = engineContext?.physicsSettings ?? PhysicsSettings()
+        return editorScene.toDocument(
+            rendererSettingsOverride: RendererSettingsDTO(settings: rendererSettings),
+            physicsSettingsOverride: PhysicsSettingsDTO(settings: physicsSettings)
+        )
+    }
+
     // MARK: - Serialization
 
     func saveScene(to url: URL) throws {
@@ -149,6 +235,7 @@ final class EditorSceneController {
         if isPlaying {
             runtimeSessionManager.replaceRuntimeScene(with: document)
         }
+        notifyHierarchyMutation()
     }
 
     // MARK: - Selection
@@ -200,15 +287,15 @@ final class EditorSceneController {
         }
 
         if isPaused { return }
-        let fixedStepResult = executeFixedStepSchedule(scene: scene,
-                                                       frameTime: frame.time,
-                                                       mode: .play,
-                                                       accumulator: &fixedAccumulator)
+        let fixedStepResult = fixedStepScheduler.execute(scene: scene,
+                                                         frameTime: frame.time,
+                                                         mode: .play,
+                                                         accumulator: &fixedAccumulator)
         scene.setFixedStepDiagnostics(
             .init(renderDeltaTime: frame.time.unscaledDeltaTime,
                   fixedDeltaTime: fixedStepResult.fixedDeltaTime,
                   fixedStepsThisFrame: fixedStepResult.stepsExecuted,
-                  fixedStepsLastSecond: 0,
+                  fixedStepsLastSecond: fixedStepScheduler.stepsLastSecond(),
                   accumulatorBefore: fixedStepResult.accumulatorBefore,
                   accumulatorAfter: fixedStepResult.accumulatorAfter,
                   interpolationAlpha: fixedStepResult.interpolationAlpha)
@@ -230,10 +317,10 @@ final class EditorSceneController {
             }
         }
         if isSimulating {
-            _ = executeFixedStepSchedule(scene: scene,
-                                         frameTime: frame.time,
-                                         mode: .simulate,
-                                         accumulator: &simulateAccumulator)
+            _ = fixedStepScheduler.execute(scene: scene,
+                                           frameTime: frame.time,
+                                           mode: .simulate,
+                                           accumulator: &simulateAccumulator)
         }
         recordProfilerScope(.lateUpdate) {}
     }
@@ -256,67 +343,6 @@ final class EditorSceneController {
         return FrameContext(time: adjustedTime, input: frame.input)
     }
 
-    private struct FixedStepPolicy {
-        var fixedDeltaTime: Float
-        var maxSubsteps: Int
-        var maxAccumulatedDelta: Float
-    }
-
-    private struct FixedStepExecutionResult {
-        var stepsExecuted: Int
-        var fixedDeltaTime: Float
-        var accumulatorBefore: Float
-        var accumulatorAfter: Float
-        var interpolationAlpha: Float
-    }
-
-    private func makeFixedStepPolicy(frameTime: FrameTime, mode: FixedStepScheduleMode) -> FixedStepPolicy {
-        let settings = engineContext?.physicsSettings
-        let requestedFixedDelta = settings?.fixedDeltaTime ?? frameTime.fixedDeltaTime
-        let requestedMaxSubsteps = settings?.maxSubsteps ?? maxFixedSteps
-        let safetyClamp = mode == .play ? runtimeSafetyMaxSubsteps : maxFixedSteps
-        return FixedStepPolicy(
-            fixedDeltaTime: max(0.0001, requestedFixedDelta),
-            maxSubsteps: max(1, min(requestedMaxSubsteps, safetyClamp, maxFixedSteps)),
-            maxAccumulatedDelta: 0.1
-        )
-    }
-
-    private func executeFixedStepSchedule(scene: EngineScene,
-                                          frameTime: FrameTime,
-                                          mode: FixedStepScheduleMode,
-                                          accumulator: inout Float) -> FixedStepExecutionResult {
-        let policy = makeFixedStepPolicy(frameTime: frameTime, mode: mode)
-        let accumulatorBefore = accumulator
-        accumulator += max(0.0, frameTime.unscaledDeltaTime)
-        accumulator = min(accumulator, policy.maxAccumulatedDelta)
-
-        var stepsExecuted = 0
-        if accumulator >= policy.fixedDeltaTime {
-            let fixedStart = CACurrentMediaTime()
-            while accumulator >= policy.fixedDeltaTime && stepsExecuted < policy.maxSubsteps {
-                switch mode {
-                case .play:
-                    _ = scene.runPlayFixedStep(fixedDeltaOverride: policy.fixedDeltaTime)
-                case .simulate:
-                    _ = scene.runSimulateFixedStep(fixedDeltaOverride: policy.fixedDeltaTime)
-                }
-                accumulator -= policy.fixedDeltaTime
-                stepsExecuted += 1
-            }
-            engineContext?.renderer?.profiler.record(.fixedUpdate, seconds: CACurrentMediaTime() - fixedStart)
-        }
-
-        let interpolationAlpha = policy.fixedDeltaTime > 1.0e-6
-            ? simd_clamp(accumulator / policy.fixedDeltaTime, 0.0, 1.0)
-            : 0.0
-        return FixedStepExecutionResult(stepsExecuted: stepsExecuted,
-                                        fixedDeltaTime: policy.fixedDeltaTime,
-                                        accumulatorBefore: accumulatorBefore,
-                                        accumulatorAfter: accumulator,
-                                        interpolationAlpha: interpolationAlpha)
-    }
-
     private func resetTimingBase() {
         guard let lastFrameTime else {
             timeBaseTotal = 0.0
@@ -330,6 +356,8 @@ final class EditorSceneController {
     }
 
     private func recordProfilerScope(_ scope: RendererProfiler.Scope, _ body: () -> Void) {
+        MCETraceBegin(Self.traceName(for: scope))
+        defer { MCETraceEnd() }
         guard let profiler = engineContext?.renderer?.profiler else {
             body()
             return
@@ -338,4 +366,13 @@ final class EditorSceneController {
         body()
         profiler.record(scope, seconds: CACurrentMediaTime() - start)
     }
+
+    private static func traceName(for scope: RendererProfiler.Scope) -> UInt32 {
+        switch scope {
+        case .sceneUpdate: return EditorTraceScopes.sceneUpdate
+        case .fixedUpdate: return EditorTraceScopes.fixedUpdate
+        case .lateUpdate: return EditorTraceScopes.lateUpdate
+        default: return EditorTraceScopes.engineScope
+        }
+    }
 }
@@ -0,0 +1,128 @@
+/// EditorSceneSnapshot.swift
+/// Component-pool snapshot of the editor scene taken on play/simulate entry and restored by delta.
+/// Created by Kaden Cringle
+
+import Foundation
+import MetalCupEngine
+
+struct SceneSnapshotRestoreStats {
+    var componentsChecked: Int = 0
+    var componentsRestored: Int = 0
+    var componentsRemoved: Int = 0
+    var entitiesDestroyed: Int = 0
+    var hierarchyFixups: Int = 0
+    var missingEntities: Int = 0
+}
+
+final class EditorSceneSnapshot {
+    private let entityIds: Set<UUID>
+    private let entities: [Entity]
+    private let parents: [Entity: Entity]
+    private let rootOrder: [Entity]
+    private let childOrder: [Entity: [Entity]]
+    /// One pool per registry kind. Values are plain struct copies, so array and string storage
+    /// inside them stays shared with the live scene until either side writes.
+    private let pools: [[Entity: Any]]
+
+    init(scene: EngineScene) {
+        let ecs = scene.ecs
+        let entities = ecs.allEntities()
+        self.entities = entities
+        self.entityIds = Set(entities.map { $0.id })
+
+        var parents: [Entity: Entity] = [:]
+        var childOrder: [Entity: [Entity]] = [:]
+        for entity in entities {
+            if let parent = ecs.getParent(entity) {
+                parents[entity] = parent
+            }
+            let children = ecs.getChildren(entity)
+            if !children.isEmpty {
+                childOrder[entity] = children
+            }
+        }
+        self.parents = parents
+        self.childOrder = childOrder
+        self.rootOrder = ecs.rootLevelEntities()
+        self.pools = EditorComponentRegistry.kinds.map { kind in
+            var pool: [Entity: Any] = [:]
+            for entity in entities {
+                if let value = kind.read(ecs, entity) {
+                    pool[entity] = value
+                }
+            }
+            return pool
+        }
+    }
+
+    var entityCount: Int { entities.count }
+
+    /// Writes back only components whose bytes differ from the snapshot, strips components added
+    /// since, destroys entities created since, and re-links hierarchy edges that moved. Returns
+    /// false when snapshot entities were destroyed; ids cannot be recreated through the ECS, so the
+    /// caller must fall back to a document restore if it has one.
+    @discardableResult
+    func restore(into scene: EngineScene, stats: inout SceneSnapshotRestoreStats) -> Bool {
+        let ecs = scene.ecs
+        for entity in ecs.allEntities().reversed() where !entityIds.contains(entity.id) {
+            guard ecs.entity(with: entity.id) != nil else { continue }
+            ecs.destroyEntity(entity)
+            stats.entitiesDestroyed += 1
+        }
+
+        let live = entities.filter { ecs.entity(with: $0.id) != nil }
+        stats.missingEntities = entities.count - live.count
+        for (kind, pool) in zip(EditorComponentRegistry.kinds, pools) {
+            for entity in live {
+                if let saved = pool[entity] {
+                    stats.componentsChecked += 1
+                    if kind.matches(ecs, entity, saved) { continue }
+                    kind.write(scene, saved, entity)
+                    stats.componentsRestored += 1
+                } else if kind.has(ecs, entity) {
+                    kind.remove(ecs, entity)
+                    stats.componentsRemoved += 1
+                }
+            }
+        }
+
+        for entity in live where ecs.getParent(entity) != parents[entity] {
+            _ = ecs.setParent(entity, parents[entity], keepWorldTransform: false)
+            stats.hierarchyFixups += 1
+        }
+        restoreOrder(parent: nil, saved: rootOrder, ecs: ecs, stats: &stats)
+        for (parent, children) in childOrder where ecs.entity(with: parent.id) != nil {
+            restoreOrder(parent: parent, saved: children, ecs: ecs, stats: &stats)
+        }
+        return stats.missingEntities == 0
+    }
+
+    private func restoreOrder(parent: Entity?, saved: [Entity], ecs: SceneECS, stats: inout SceneSnapshotRestoreStats) {
+        let current = parent.map { ecs.getChildren($0) } ?? ecs.rootLevelEntities()
+        let expected = saved.filter { ecs.entity(with: $0.id) != nil }
+        guard current != expected else { return }
+        for (index, child) in expected.enumerated() {
+            _ = ecs.reorderChild(parent: parent, child: child, newIndex: index)
+        }
+        stats.hierarchyFixups += 1
+    }
+}
+
+@_cdecl("MCEEditorGetPlayModeTransitionStats")
+public func MCEEditorGetPlayModeTransitionStats(_ contextPtr: UnsafeRawPointer?,
+                                                _ enterMs: UnsafeMutablePointer<Double>?,
+                                                _ exitMs: UnsafeMutablePointer<Double>?,
+                                                _ componentsChecked: UnsafeMutablePointer<Int32>?,
+                                                _ componentsRestored: UnsafeMutablePointer<Int32>?,
+                                                _ entitiesDestroyed: UnsafeMutablePointer<Int32>?,
+                                                _ documentRestores: UnsafeMutablePointer<UInt64>?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    let stats = context.editorSceneController.playModeTransitionStats
+    enterMs?.pointee = stats.lastEnterMs
+    exitMs?.pointee = stats.lastExitMs
+    componentsChecked?.pointee = Int32(clamping: stats.lastRestore.componentsChecked)
+    componentsRestored?.pointee = Int32(clamping: stats.lastRestore.componentsRestored + stats.lastRestore.componentsRemoved)
+    entitiesDestroyed?.pointee = Int32(clamping: stats.lastRestore.entitiesDestroyed)
+    documentRestores?.pointee = stats.documentRestores
+    return 1
+}
@@ -0,0 +1,728 @@
+/// EditorUndoJournal.swift
+/// Delta-based undo/redo journal for editor scene and asset-document edits.
+/// Created by Kaden Cringle
+
+import Foundation
+import QuartzCore
+import MetalCupEngine
+
+/// Every mutation marks the open transaction dirty; the journal closes it once the user lets go
+/// (no active widget, no held mouse button, no mutation this frame), so a gizmo drag or slider
+/// scrub becomes one entry. Closing diffs the editor scene against a baseline copy of each
+/// journaled registry component and records only the components that changed. The editor camera
+/// and derived environment state are left out; they move on their own every frame. Undo and redo
+/// apply those deltas directly and never re-diff.
+final class EditorUndoJournal {
+    enum AssetKind {
+        case material(AssetHandle)
+        case animationGraph(AssetHandle)
+    }
+
+    struct Stats {
+        var transactions: UInt64 = 0
+        var merged: UInt64 = 0
+        var evicted: UInt64 = 0
+        var lastCloseMs: Double = 0
+        var lastApplyMs: Double = 0
+    }
+
+    struct BenchmarkResult {
+        var steps = 0
+        var entities = 0
+        var recordMs = 0.0
+        var undoMs = 0.0
+        var redoMs = 0.0
+        /// Every nudged transform was bit-identical to its original after undoing all steps.
+        var restored = false
+    }
+
+    private struct ComponentDelta {
+        let key: Int
+        let kind: Int
+        let before: Any?
+        let after: Any?
+    }
+
+    private struct EntityRecord {
+        let key: Int
+        let components: [Any?]
+    }
+
+    private struct OrderDelta {
+        let parentKey: Int
+        let before: [Int]
+        let after: [Int]
+    }
+
+    /// File bytes with the shared prefix and suffix stripped; edits to JSON documents usually touch
+    /// a few fields, so the middles are small.
+    private struct AssetDelta {
+        let url: URL
+        let kind: AssetKind
+        let prefixCount: Int
+        let suffixCount: Int
+        let before: Data
+        let after: Data
+    }
+
+    private struct Transaction {
+        var label: String
+        var components: [ComponentDelta] = []
+        var created: [EntityRecord] = []
+        var destroyed: [EntityRecord] = []
+        var orders: [OrderDelta] = []
+        var assets: [AssetDelta] = []
+        var byteCost: Int = 0
+        var closeTime: CFTimeInterval = 0
+
+        var hasSceneDeltas: Bool {
+            !components.isEmpty || !created.isEmpty || !destroyed.isEmpty || !orders.isEmpty
+        }
+
+        var isEmpty: Bool { !hasSceneDeltas && assets.isEmpty }
+    }
+
+    static let defaultBudgetBytes = 64 * 1024 * 1024
+    /// Separate transactions that touch the same components within this window (arrow-key nudges,
+    /// wheel scrubs) merge into one entry.
+    static let mergeWindowSeconds: CFTimeInterval = 0.4
+    static let maxBenchmarkSteps = 100_000
+
+    private static let rootKey = 0
+
+    var budgetBytes: Int = EditorUndoJournal.defaultBudgetBytes {
+        didSet { evictToBudget() }
+    }
+    private(set) var stats = Stats()
+    private(set) var lastBenchmark: BenchmarkResult?
+    private(set) var bytesUsed: Int = 0
+
+    private var undoStack: [Transaction] = []
+    private var redoStack: [Transaction] = []
+
+    private weak var trackedScene: EngineScene?
+    private var wasInSession = false
+    private var baseline: [Int: [Any?]] = [:]
+    private var baselineOrder: [Int: [Int]] = [:]
+    private var keyForId: [UUID: Int] = [:]
+    private var idForKey: [Int: UUID] = [:]
+    private var nextKey = 1
+
+    private var dirty = false
+    private var mutatedThisFrame = false
+    private var pendingLabel: String?
+    private var pendingAssets: [URL: (AssetKind, Data)] = [:]
+    private var applying = false
+    private var mergeEnabled = true
+
+    var undoCount: Int { undoStack.count }
+    var redoCount: Int { redoStack.count }
+    var undoLabel: String? { undoStack.last?.label }
+    var redoLabel: String? { redoStack.last?.label }
+
+    // MARK: - Recording
+
+    func markDirty(label: String? = nil) {
+        guard !applying else { return }
+        dirty = true
+        mutatedThisFrame = true
+        if let label, pendingLabel == nil {
+            pendingLabel = label
+        }
+    }
+
+    /// Call before an asset document is modified; the first call per transaction keeps the bytes
+    /// the file had before the edit.
+    func noteAssetWillChange(_ url: URL, kind: AssetKind) {
+        guard !applying else { return }
+        markDirty()
+        guard pendingAssets[url] == nil else { return }
+        pendingAssets[url] = (kind, (try? Data(contentsOf: url)) ?? Data())
+    }
+
+    /// Runs once per editor frame, after panels have applied their edits.
+    func tick(context: MCEContext, interactionActive: Bool) {
+        let controller = context.editorSceneController
+        let inSession = controller.isPlaying || controller.isSimulating
+        defer { mutatedThisFrame = false }
+
+        if inSession {
+            // Runtime edits are discarded on stop; only asset documents stay journaled.
+            wasInSession = true
+            if dirty, !pendingAssets.isEmpty, !interactionActive, !mutatedThisFrame {
+                close(scene: nil)
+            }
+            return
+        }
+
+        guard let scene = controller.editorScene else {
+            reset()
+            return
+        }
+        if trackedScene !== scene {
+            reset()
+            trackedScene = scene
+            captureBaseline(scene: scene)
+            return
+        }
+        if wasInSession {
+            // The session restored the scene to its pre-play state, which is the baseline up to
+            // restore fidelity; re-capture so the next diff starts from what is actually live.
+            wasInSession = false
+            dirty = false
+            pendingLabel = nil
+            captureBaseline(scene: scene)
+            return
+        }
+        if dirty, !interactionActive, !mutatedThisFrame {
+            close(scene: scene)
+        }
+    }
+
+    func reset() {
+        undoStack.removeAll()
+        redoStack.removeAll()
+        bytesUsed = 0
+        baseline.removeAll()
+        baselineOrder.removeAll()
+        keyForId.removeAll()
+        idForKey.removeAll()
+        nextKey = 1
+        dirty = false
+        pendingLabel = nil
+        pendingAssets.removeAll()
+        trackedScene = nil
+    }
+
+    /// Closes any open transaction immediately, e.g. before undo or save.
+    func commitPending(context: MCEContext) {
+        guard dirty else { return }
+        let controller = context.editorSceneController
+        let inSession = controller.isPlaying || controller.isSimulating
+        if inSession {
+            if !pendingAssets.isEmpty { close(scene: nil) }
+            return
+        }
+        guard let scene = controller.editorScene, scene === trackedScene else { return }
+        close(scene: scene)
+    }
+
+    private func close(scene: EngineScene?) {
+        let start = CACurrentMediaTime()
+        MCETraceBegin(EditorTraceScopes.undoClose)
+        defer { MCETraceEnd() }
+
+        var transaction = Transaction(label: pendingLabel ?? "Edit")
+        if let scene {
+            diffScene(scene, into: &transaction)
+        }
+        closeAssets(into: &transaction)
+        dirty = false
+        pendingLabel = nil
+        stats.lastCloseMs = (CACurrentMediaTime() - start) * 1000.0
+        guard !transaction.isEmpty else { return }
+
+        transaction.closeTime = start
+        transaction.byteCost = estimateCost(transaction)
+        redoStack.removeAll()
+        if mergeEnabled, let last = undoStack.last, canMerge(last, with: transaction) {
+            let merged = merge(undoStack.removeLast(), with: transaction)
+            bytesUsed -= last.byteCost
+            push(merged)
+            stats.merged &+= 1
+        } else {
+            push(transaction)
+            stats.transactions &+= 1
+        }
+        evictToBudget()
+    }
+
+    private func push(_ transaction: Transaction) {
+        undoStack.append(transaction)
+        bytesUsed += transaction.byteCost
+    }
+
+    // MARK: - Scene Diff
+
+    private func key(for entity: Entity) -> Int {
+        if let existing = keyForId[entity.id] { return existing }
+        let key = nextKey
+        nextKey += 1
+        keyForId[entity.id] = key
+        idForKey[key] = entity.id
+        return key
+    }
+
+    /// The editor camera follows viewport navigation; journaling it would turn every orbit into an entry.
+    private static func isEditorCamera(_ ecs: SceneECS, _ entity: Entity) -> Bool {
+        ecs.get(CameraComponent.self, for: entity)?.isEditor == true
+    }
+
+    private func captureBaseline(scene: EngineScene) {
+        let ecs = scene.ecs
+        let kinds = EditorComponentRegistry.kinds
+        baseline.removeAll(keepingCapacity: true)
+        baselineOrder.removeAll(keepingCapacity: true)
+        for entity in ecs.allEntities() {
+            if !Self.isEditorCamera(ecs, entity) {
+                baseline[key(for: entity)] = kinds.map { $0.read(ecs, entity) }
+            }
+            let children = ecs.getChildren(entity)
+            if !children.isEmpty {
+                baselineOrder[key(for: entity)] = children.map { key(for: $0) }
+            }
+        }
+        baselineOrder[Self.rootKey] = ecs.rootLevelEntities().map { key(for: $0) }
+    }
+
+    private func diffScene(_ scene: EngineScene, into transaction: inout Transaction) {
+        let ecs = scene.ecs
+        let kinds = EditorComponentRegistry.kinds
+        let journaledKinds = EditorComponentRegistry.journaledKindIndices
+        let entities = ecs.allEntities()
+        var liveKeys = Set<Int>()
+        liveKeys.reserveCapacity(entities.count)
+
+        for entity in entities where !Self.isEditorCamera(ecs, entity) {
+            let key = key(for: entity)
+            liveKeys.insert(key)
+            guard var stored = baseline[key] else {
+                let components = kinds.map { $0.read(ecs, entity) }
+                transaction.created.append(EntityRecord(key: key, components: components))
+                baseline[key] = components
+                continue
+            }
+            var changed = false
+            for index in journaledKinds {
+                let kind = kinds[index]
+                let before = stored[index]
+                if let before {
+                    if kind.matches(ecs, entity, before) { continue }
+                } else if !kind.has(ecs, entity) {
+                    continue
+                }
+                let after = kind.read(ecs, entity)
+                transaction.components.append(ComponentDelta(key: key, kind: index, before: before, after: after))
+                stored[index] = after
+                changed = true
+            }
+            if changed {
+                baseline[key] = stored
+            }
+        }
+
+        if baseline.count != liveKeys.count {
+            for (key, components) in baseline where !liveKeys.contains(key) {
+                transaction.destroyed.append(EntityRecord(key: key, components: components))
+            }
+            for record in transaction.destroyed {
+                baseline.removeValue(forKey: record.key)
+            }
+        }
+
+        var currentOrder: [Int: [Int]] = [Self.rootKey: ecs.rootLevelEntities().map { key(for: $0) }]
+        for entity in entities {
+            let children = ecs.getChildren(entity)
+            if !children.isEmpty {
+                currentOrder[key(for: entity)] = children.map { key(for: $0) }
+            }
+        }
+        for (parentKey, after) in currentOrder where baselineOrder[parentKey] != after {
+            transaction.orders.append(OrderDelta(parentKey: parentKey, before: baselineOrder[parentKey] ?? [], after: after))
+        }
+        for (parentKey, before) in baselineOrder where currentOrder[parentKey] == nil {
+            transaction.orders.append(OrderDelta(parentKey: parentKey, before: before, after: []))
+        }
+        baselineOrder = currentOrder
+    }
+
+    // MARK: - Asset Deltas
+
+    private func closeAssets(into transaction: inout Transaction) {
+        guard !pendingAssets.isEmpty else { return }
+        for (url, (kind, before)) in pendingAssets {
+            let after = (try? Data(contentsOf: url)) ?? Data()
+            guard after != before else { continue }
+            transaction.assets.append(Self.assetDelta(url: url, kind: kind, before: before, after: after))
+        }
+        pendingAssets.removeAll()
+    }
+
+    private static func assetDelta(url: URL, kind: AssetKind, before: Data, after: Data) -> AssetDelta {
+        let limit = min(before.count, after.count)
+        let prefix: Int = before.withUnsafeBytes { lhs in
+            after.withUnsafeBytes { rhs in
+                var index = 0
+                while index < limit, lhs[index] == rhs[index] { index += 1 }
+                return index
+            }
+        }
+        let suffix: Int = before.withUnsafeBytes { lhs in
+            after.withUnsafeBytes { rhs in
+                var count = 0
+                while count < limit - prefix, lhs[lhs.count - 1 - count] == rhs[rhs.count - 1 - count] { count += 1 }
+                return count
+            }
+        }
+        return AssetDelta(url: url,
+                          kind: kind,
+                          prefixCount: prefix,
+                          suffixCount: suffix,
+                          before: Data(before[before.startIndex + prefix ..< before.endIndex - suffix]),
+                          after: Data(after[after.startIndex + prefix ..< after.endIndex - suffix]))
+    }
+
+    /// Splices `from` out of the file and `to` in. Returns false when the file no longer holds
+    /// `from` at the recorded position, i.e. it changed outside the journal.
+    private func applyAssetDelta(_ delta: AssetDelta, reverse: Bool, context: MCEContext) -> Bool {
+        let from = reverse ? delta.after : delta.before
+        let to = reverse ? delta.before : delta.after
+        guard let current = try? Data(contentsOf: delta.url),
+              current.count == delta.prefixCount + from.count + delta.suffixCount else { return false }
+        let middleStart = current.startIndex + delta.prefixCount
+        let middleEnd = middleStart + from.count
+        guard current[middleStart ..< middleEnd].elementsEqual(from) else { return false }
+
+        var updated = Data(capacity: delta.prefixCount + to.count + delta.suffixCount)
+        updated.append(current[current.startIndex ..< middleStart])
+        updated.append(to)
+        updated.append(current[middleEnd ..< current.endIndex])
+
+        if case let .material(handle) = delta.kind {
+            context.materialEditStore.discard(handle)
+        }
+        let written = context.editorProjectManager.performAssetMutation {
+            try updated.write(to: delta.url, options: .atomic)
+            context.editorProjectManager.noteAssetPathChanged(delta.url)
+            return true
+        }
+        guard written else { return false }
+        if case let .animationGraph(handle) = delta.kind {
+            reloadAnimationGraphRuntime(context: context, handle: handle)
+        }
+        return true
+    }
+
+    // MARK: - Undo / Redo
+
+    @discardableResult
+    func undo(context: MCEContext) -> Bool {
+        commitPending(context: context)
+        guard let transaction = undoStack.last, canApply(transaction, context: context) else { return false }
+        undoStack.removeLast()
+        bytesUsed -= transaction.byteCost
+        apply(transaction, reverse: true, context: context)
+        redoStack.append(transaction)
+        return true
+    }
+
+    @discardableResult
+    func redo(context: MCEContext) -> Bool {
+        commitPending(context: context)
+        guard let transaction = redoStack.last, canApply(transaction, context: context) else { return false }
+        redoStack.removeLast()
+        apply(transaction, reverse: false, context: context)
+        push(transaction)
+        evictToBudget()
+        return true
+    }
+
+    /// Scene entries wait until play or simulate ends; the session would discard them anyway.
+    private func canApply(_ transaction: Transaction, context: MCEContext) -> Bool {
+        let controller = context.editorSceneController
+        return !transaction.hasSceneDeltas || (!controller.isPlaying && !controller.isSimulating)
+    }
+
+    private func apply(_ transaction: Transaction, reverse: Bool, context: MCEContext) {
+        let start = CACurrentMediaTime()
+        MCETraceBegin(EditorTraceScopes.undoApply)
+        defer { MCETraceEnd() }
+        applying = true
+        defer { applying = false }
+
+        if transaction.hasSceneDeltas, let scene = context.editorSceneController.editorScene, scene === trackedScene {
+            applyScene(transaction, reverse: reverse, scene: scene)
+            context.bridgeServices.notifyHierarchyMutation()
+            context.bridgeServices.notifyComponentLayoutMutation()
+            context.bridgeServices.notifySceneMutation()
+        }
+
+        let assets = reverse ? Array(transaction.assets.reversed()) : transaction.assets
+        context.editorProjectManager.performAssetMutationBatch {
+            for delta in assets where !applyAssetDelta(delta, reverse: reverse, context: context) {
+                context.engineContext.log.logWarning(
+                    "Undo skipped \(delta.url.lastPathComponent); it was modified outside the editor.",
+                    category: .editor)
+            }
+        }
+        stats.lastApplyMs = (CACurrentMediaTime() - start) * 1000.0
+    }
+
+    private func applyScene(_ transaction: Transaction, reverse: Bool, scene: EngineScene) {
+        let ecs = scene.ecs
+        let kinds = EditorComponentRegistry.kinds
+        let toCreate = reverse ? transaction.destroyed : transaction.created
+        let toDestroy = reverse ? transaction.created : transaction.destroyed
+
+        // Entities come back with fresh ids; the key map follows them so older entries still resolve.
+        for record in toCreate {
+            let entity = ecs.createEntity(name: "Entity")
+            if let oldId = idForKey[record.key] {
+                keyForId.removeValue(forKey: oldId)
+            }
+            keyForId[entity.id] = record.key
+            idForKey[record.key] = entity.id
+            for (index, kind) in kinds.enumerated() {
+                if let value = record.components[index] {
+                    kind.write(scene, value, entity)
+                } else if kind.has(ecs, entity) {
+                    kind.remove(ecs, entity)
+                }
+            }
+            baseline[record.key] = record.components
+        }
+
+        for delta in transaction.components {
+            guard let entity = resolve(delta.key, ecs: ecs) else { continue }
+            let kind = kinds[delta.kind]
+            let value = reverse ? delta.before : delta.after
+            if let value {
+                kind.write(scene, value, entity)
+            } else {
+                kind.remove(ecs, entity)
+            }
+            baseline[delta.key]?[delta.kind] = value
+        }
+
+        for delta in transaction.orders {
+            let order = reverse ? delta.before : delta.after
+            let parent = delta.parentKey == Self.rootKey ? nil : resolve(delta.parentKey, ecs: ecs)
+            if delta.parentKey != Self.rootKey, parent == nil { continue }
+            for (index, childKey) in order.enumerated() {
+                guard let child = resolve(childKey, ecs: ecs) else { continue }
+                if ecs.getParent(child) != parent {
+                    _ = ecs.setParent(child, parent, keepWorldTransform: false)
+                }
+                _ = ecs.reorderChild(parent: parent, child: child, newIndex: index)
+            }
+            if order.isEmpty {
+                baselineOrder.removeValue(forKey: delta.parentKey)
+            } else {
+                baselineOrder[delta.parentKey] = order
+            }
+        }
+
+        for record in toDestroy {
+            if let entity = resolve(record.key, ecs: ecs) {
+                ecs.destroyEntity(entity)
+            }
+            baseline.removeValue(forKey: record.key)
+        }
+    }
+
+    private func resolve(_ key: Int, ecs: SceneECS) -> Entity? {
+        guard let id = idForKey[key] else { return nil }
+        return ecs.entity(with: id)
+    }
+
+    // MARK: - Benchmark
+
+    /// Records `steps` transform nudges on `scene` through a private journal, then undoes and redoes
+    /// all of them. Pass a scratch copy: the scene is mutated, but this journal's history is not.
+    /// Replay is timed through the same delta apply undo uses, minus the per-entry UI notifications.
+    @discardableResult
+    func runBenchmark(on scene: EngineScene, steps requestedSteps: Int) -> BenchmarkResult {
+        let steps = max(1, min(requestedSteps, Self.maxBenchmarkSteps))
+        let ecs = scene.ecs
+        let targets = ecs.allEntities().filter {
+            ecs.get(TransformComponent.self, for: $0) != nil && !Self.isEditorCamera(ecs, $0)
+        }
+        var result = BenchmarkResult()
+        result.entities = ecs.allEntities().count
+        guard !targets.isEmpty else {
+            lastBenchmark = result
+            return result
+        }
+        let originals = targets.map { ecs.get(TransformComponent.self, for: $0) }
+
+        let journal = EditorUndoJournal()
+        journal.budgetBytes = Int.max
+        journal.mergeEnabled = false
+        journal.trackedScene = scene
+        journal.captureBaseline(scene: scene)
+
+        let recordStart = CACurrentMediaTime()
+        for step in 0..<steps {
+            let entity = targets[step % targets.count]
+            guard var transform = ecs.get(TransformComponent.self, for: entity) else { continue }
+            transform.position.x += 0.01
+            _ = scene.transformAuthority.setLocalTransform(entity: entity, transform: transform, source: .editor)
+            journal.markDirty(label: "Benchmark")
+            journal.close(scene: scene)
+        }
+        result.recordMs = (CACurrentMediaTime() - recordStart) * 1000.0
+        result.steps = journal.undoStack.count
+
+        journal.applying = true
+        let undoStart = CACurrentMediaTime()
+        while let transaction = journal.undoStack.popLast() {
+            journal.applyScene(transaction, reverse: true, scene: scene)
+            journal.redoStack.append(transaction)
+        }
+        result.undoMs = (CACurrentMediaTime() - undoStart) * 1000.0
+        result.restored = zip(targets, originals).allSatisfy { entity, original in
+            guard let original, let live = ecs.get(TransformComponent.self, for: entity) else { return false }
+            return EditorComponentRegistry.bitwiseEqual(live, original)
+        }
+
+        let redoStart = CACurrentMediaTime()
+        while let transaction = journal.redoStack.popLast() {
+            journal.applyScene(transaction, reverse: false, scene: scene)
+            journal.undoStack.append(transaction)
+        }
+        result.redoMs = (CACurrentMediaTime() - redoStart) * 1000.0
+        journal.applying = false
+
+        lastBenchmark = result
+        return result
+    }
+
+    // MARK: - Merge / Budget
+
+    private func canMerge(_ previous: Transaction, with next: Transaction) -> Bool {
+        guard next.closeTime - previous.closeTime < Self.mergeWindowSeconds,
+              previous.label == next.label,
+              previous.created.isEmpty, previous.destroyed.isEmpty, previous.orders.isEmpty, previous.assets.isEmpty,
+              next.created.isEmpty, next.destroyed.isEmpty, next.orders.isEmpty, next.assets.isEmpty,
+              previous.components.count == next.components.count else { return false }
+        return zip(previous.components, next.components).allSatisfy { $0.key == $1.key && $0.kind == $1.kind }
+    }
+
+    private func merge(_ previous: Transaction, with next: Transaction) -> Transaction {
+        var merged = next
+        merged.components = zip(previous.components, next.components).map {
+            ComponentDelta(key: $0.key, kind: $0.kind, before: $0.before, after: $1.after)
+        }
+        merged.byteCost = estimateCost(merged)
+        return merged
+    }
+
+    private func estimateCost(_ transaction: Transaction) -> Int {
+        let kinds = EditorComponentRegistry.kinds
+        let entryOverhead = 64
+        var bytes = entryOverhead + transaction.label.utf8.count
+        for delta in transaction.components {
+            bytes += entryOverhead + kinds[delta.kind].byteSize * 2
+        }
+        let recordBytes = kinds.reduce(0) { $0 + $1.byteSize } + entryOverhead
+        bytes += (transaction.created.count + transaction.destroyed.count) * recordBytes
+        for delta in transaction.orders {
+            bytes += entryOverhead + (delta.before.count + delta.after.count) * MemoryLayout<Int>.stride
+        }
+        for delta in transaction.assets {
+            bytes += entryOverhead + delta.before.count + delta.after.count
+        }
+        return bytes
+    }
+
+    /// Oldest entries go first; redo entries are only dropped when the undo side is already empty.
+    private func evictToBudget() {
+        var redoBytes = redoStack.reduce(0) { $0 + $1.byteCost }
+        while bytesUsed + redoBytes > budgetBytes {
+            if !undoStack.isEmpty {
+                bytesUsed -= undoStack.removeFirst().byteCost
+            } else if !redoStack.isEmpty {
+                redoBytes -= redoStack.removeFirst().byteCost
+            } else {
+                break
+            }
+            stats.evicted &+= 1
+        }
+    }
+}
+
+@_cdecl("MCEEditorUndo")
+public func MCEEditorUndo(_ contextPtr: UnsafeRawPointer?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    return context.undoJournal.undo(context: context) ? 1 : 0
+}
+
+@_cdecl("MCEEditorRedo")
+public func MCEEditorRedo(_ contextPtr: UnsafeRawPointer?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    return context.undoJournal.redo(context: context) ? 1 : 0
+}
+
+@_cdecl("MCEEditorGetUndoState")
+public func MCEEditorGetUndoState(_ contextPtr: UnsafeRawPointer?,
+                                  _ undoLabel: UnsafeMutablePointer<CChar>?, _ undoLabelSize: Int32,
+                                  _ redoLabel: UnsafeMutablePointer<CChar>?, _ redoLabelSize: Int32,
+                                  _ undoCount: UnsafeMutablePointer<Int32>?,
+                                  _ redoCount: UnsafeMutablePointer<Int32>?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    let journal = context.undoJournal
+    _ = EditorBridgeInternals.cStringWrite(journal.undoLabel ?? "", to: undoLabel, max: undoLabelSize)
+    _ = EditorBridgeInternals.cStringWrite(journal.redoLabel ?? "", to: redoLabel, max: redoLabelSize)
+    undoCount?.pointee = Int32(clamping: journal.undoCount)
+    redoCount?.pointee = Int32(clamping: journal.redoCount)
+    return 1
+}
+
+@_cdecl("MCEEditorGetUndoJournalStats")
+public func MCEEditorGetUndoJournalStats(_ contextPtr: UnsafeRawPointer?,
+                                         _ bytesUsed: UnsafeMutablePointer<UInt64>?,
+                                         _ budgetBytes: UnsafeMutablePointer<UInt64>?,
+                                         _ transactions: UnsafeMutablePointer<UInt64>?,
+                                         _ merged: UnsafeMutablePointer<UInt64>?,
+                                         _ evicted: UnsafeMutablePointer<UInt64>?,
+                                         _ lastCloseMs: UnsafeMutablePointer<Double>?,
+                                         _ lastApplyMs: UnsafeMutablePointer<Double>?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    let journal = context.undoJournal
+    bytesUsed?.pointee = UInt64(max(0, journal.bytesUsed))
+    budgetBytes?.pointee = UInt64(max(0, journal.budgetBytes))
+    transactions?.pointee = journal.stats.transactions
+    merged?.pointee = journal.stats.merged
+    evicted?.pointee = journal.stats.evicted
+    lastCloseMs?.pointee = journal.stats.lastCloseMs
+    lastApplyMs?.pointee = journal.stats.lastApplyMs
+    return 1
+}
+
+/// Runs the undo benchmark on a scratch copy of the editor scene. Blocks until it finishes.
+@_cdecl("MCEEditorRunUndoBenchmark")
+public func MCEEditorRunUndoBenchmark(_ contextPtr: UnsafeRawPointer?, _ steps: Int32) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr),
+          let scene = context.editorSceneController.makeScratchScene() else { return 0 }
+    let result = context.undoJournal.runBenchmark(on: scene, steps: Int(steps))
+    context.engineContext.log.logInfo(
+        String(format: "Undo benchmark: %d steps, record %.1f ms, undo %.1f ms, redo %.1f ms, restored: %@",
+               result.steps, result.recordMs, result.undoMs, result.redoMs, result.restored ? "yes" : "no"),
+        category: .editor)
+    return 1
+}
+
+@_cdecl("MCEEditorGetUndoBenchmarkResult")
+public func MCEEditorGetUndoBenchmarkResult(_ contextPtr: UnsafeRawPointer?,
+                                            _ steps: UnsafeMutablePointer<Int32>?,
+                                            _ entities: UnsafeMutablePointer<Int32>?,
+                                            _ recordMs: UnsafeMutablePointer<Double>?,
+                                            _ undoMs: UnsafeMutablePointer<Double>?,
+                                            _ redoMs: UnsafeMutablePointer<Double>?,
+                                            _ restored: UnsafeMutablePointer<UInt32>?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr),
+          let result = context.undoJournal.lastBenchmark else { return 0 }
+    steps?.pointee = Int32(clamping: result.steps)
+    entities?.pointee = Int32(clamping: result.entities)
+    recordMs?.pointee = result.recordMs
+    undoMs?.pointee = result.undoMs
+    redoMs?.pointee = result.redoMs
+    restored?.pointee = result.restored ? 1 : 0
+    return 1
+}
+
+@_cdecl("MCEEditorSetUndoJournalBudget")
+public func MCEEditorSetUndoJournalBudget(_ contextPtr: UnsafeRawPointer?, _ budgetMB: Int32) {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return }
+    context.undoJournal.budgetBytes = Int(max(1, budgetMB)) * 1024 * 1024
+}
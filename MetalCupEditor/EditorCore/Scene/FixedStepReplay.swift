@@ -0,0 +1,83 @@
+/// FixedStepReplay.swift
+/// Headless fixed-step replay used by the scheduler's determinism check and the Stage 4 replay test.
+/// Created by Kaden Cringle
+
+import Foundation
+import QuartzCore
+import MetalCupEngine
+
+struct FixedStepReplayResult {
+    var steps: Int = 0
+    var totalMs: Double = 0
+    var stepsPerSecond: Double = 0
+    var stepP50Ms: Double = 0
+    var stepP99Ms: Double = 0
+    var stepMaxMs: Double = 0
+    var checksum: UInt64 = 0
+    var deterministic = false
+}
+
+/// Depends only on the engine, so Stage4Tests can compile it without the editor bridge.
+enum FixedStepReplay {
+    /// Instantiates `document` twice off-screen and runs `steps` simulate steps on each at `fixedDelta`.
+    /// Throughput comes from the first run; the transform checksums of both runs must match for the
+    /// result to count as deterministic. Scripts do not run (simulate policy), so the numbers cover
+    /// physics and animation only.
+    static func run(document: SceneDocument,
+                    prefabSystem: PrefabSystem,
+                    engineContext: EngineContext?,
+                    physicsSettings: PhysicsSettings,
+                    fixedDelta: Float,
+                    steps: Int) -> FixedStepReplayResult {
+        var result = FixedStepReplayResult()
+        result.steps = steps
+        var costs: [Double] = []
+        costs.reserveCapacity(steps)
+        var checksums: [UInt64] = []
+
+        for pass in 0..<2 {
+            let scene = SerializedScene(document: document, prefabSystem: prefabSystem, engineContext: engineContext)
+            scene.startPhysics(settings: physicsSettings)
+            let start = CACurrentMediaTime()
+            for _ in 0..<steps {
+                let stepStart = CACurrentMediaTime()
+                _ = scene.runSimulateFixedStep(fixedDeltaOverride: fixedDelta)
+                if pass == 0 {
+                    costs.append((CACurrentMediaTime() - stepStart) * 1000.0)
+                }
+            }
+            if pass == 0 {
+                result.totalMs = (CACurrentMediaTime() - start) * 1000.0
+            }
+            scene.stopPhysics()
+            checksums.append(transformChecksum(scene: scene))
+        }
+
+        result.stepsPerSecond = result.totalMs > 0 ? Double(steps) / (result.totalMs / 1000.0) : 0
+        costs.sort()
+        result.stepP50Ms = costs[min(costs.count - 1, costs.count / 2)]
+        result.stepP99Ms = costs[min(costs.count - 1, Int(Double(costs.count) * 0.99))]
+        result.stepMaxMs = costs.last ?? 0
+        result.checksum = checksums[0]
+        result.deterministic = checksums[0] == checksums[1]
+        return result
+    }
+
+    /// FNV-1a over every entity's id and transform bytes, in id order.
+    static func transformChecksum(scene: EngineScene) -> UInt64 {
+        var hash: UInt64 = 0xcbf29ce484222325
+        func mix(_ bytes: UnsafeRawBufferPointer) {
+            for byte in bytes {
+                hash = (hash ^ UInt64(byte)) &* 0x100000001b3
+            }
+        }
+        let ecs = scene.ecs
+        for entity in ecs.allEntities().sorted(by: { $0.id.uuidString < $1.id.uuidString }) {
+            withUnsafeBytes(of: entity.id.uuid) { mix($0) }
+            if let transform = ecs.get(TransformComponent.self, for: entity) {
+                withUnsafeBytes(of: transform) { mix($0) }
+            }
+        }
+        return hash
+    }
+}
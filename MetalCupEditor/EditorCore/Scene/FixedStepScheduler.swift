@@ -0,0 +1,360 @@
+/// FixedStepScheduler.swift
+/// Fixed-step scheduling for play/simulate, with overload policies, diagnostics, and a replay harness.
+/// Created by Kaden Cringle
+
+import Foundation
+import QuartzCore
+import simd
+import MetalCupEngine
+
+enum FixedStepScheduleMode {
+    case play
+    case simulate
+}
+
+/// What the scheduler does when a frame brings more time than `maxSubsteps` steps can consume.
+enum FixedStepOverloadPolicy: Int32 {
+    /// Carry the backlog up to `maxAccumulatedDelta` and discard the rest. Catches up in bursts.
+    case dropTime = 0
+    /// Never accumulate more than one frame's step budget; the simulation runs slower than wall
+    /// time instead of bursting to catch up.
+    case slowMotion = 1
+    /// Stretch the step delta (up to `maxAdaptiveScale`x) so the backlog fits in `maxSubsteps`.
+    case adaptiveDelta = 2
+}
+
+struct FixedStepFrameSample {
+    var steps: Int = 0
+    var fixedDeltaTime: Float = 0
+    /// Wall time the clamp discarded this frame.
+    var droppedSeconds: Float = 0
+    /// Wall time slow motion declined to simulate this frame.
+    var slowedSeconds: Float = 0
+    var stepCostTotalMs: Float = 0
+    var stepCostMaxMs: Float = 0
+}
+
+/// Per-session scheduler statistics. Reset whenever play or simulate starts.
+struct FixedStepDiagnostics {
+    static let recentCapacity = 240
+
+    var frames: UInt64 = 0
+    var steps: UInt64 = 0
+    var droppedSeconds: Double = 0
+    var slowedSeconds: Double = 0
+    /// Frames that stopped at `maxSubsteps` with a full step still pending.
+    var budgetHitFrames: UInt64 = 0
+    var adaptiveFrames: UInt64 = 0
+    /// `substepHistogram[n]` counts frames that ran n steps.
+    var substepHistogram: [UInt64]
+    var recent: [FixedStepFrameSample] = []
+    var recentHead = 0
+    var lastStepCostsMs: [Float] = []
+    var stepCostMeanMs: Double = 0
+
+    init(maxSubsteps: Int) {
+        substepHistogram = Array(repeating: 0, count: maxSubsteps + 1)
+        recent.reserveCapacity(Self.recentCapacity)
+    }
+
+    mutating func record(_ sample: FixedStepFrameSample, stepCostsMs: [Float]) {
+        frames &+= 1
+        steps &+= UInt64(sample.steps)
+        droppedSeconds += Double(sample.droppedSeconds)
+        slowedSeconds += Double(sample.slowedSeconds)
+        substepHistogram[min(sample.steps, substepHistogram.count - 1)] &+= 1
+        if recent.count < Self.recentCapacity {
+            recent.append(sample)
+        } else {
+            recent[recentHead] = sample
+            recentHead = (recentHead + 1) % Self.recentCapacity
+        }
+        if !stepCostsMs.isEmpty {
+            lastStepCostsMs = stepCostsMs
+            for cost in stepCostsMs {
+                // Exponential mean over roughly the last few hundred steps.
+                stepCostMeanMs += (Double(cost) - stepCostMeanMs) * 0.01
+            }
+        }
+    }
+
+    /// Recent samples oldest first.
+    func orderedRecent() -> [FixedStepFrameSample] {
+        guard recent.count == Self.recentCapacity else { return recent }
+        return Array(recent[recentHead...] + recent[..<recentHead])
+    }
+}
+
+final class FixedStepScheduler {
+    private struct Policy {
+        var fixedDeltaTime: Float
+        var maxSubsteps: Int
+        var maxAccumulatedDelta: Float
+    }
+
+    struct ExecutionResult {
+        var stepsExecuted: Int
+        var fixedDeltaTime: Float
+        var accumulatorBefore: Float
+        var accumulatorAfter: Float
+        var interpolationAlpha: Float
+    }
+
+    static let maxFixedSteps = 16
+    static let runtimeSafetyMaxSubsteps = 5
+    static let maxAdaptiveScale: Float = 4.0
+    static let maxReplaySteps = 100_000
+
+    private weak var engineContext: EngineContext?
+    var overloadPolicy: FixedStepOverloadPolicy = .dropTime
+    private(set) var diagnostics = FixedStepDiagnostics(maxSubsteps: FixedStepScheduler.maxFixedSteps)
+    private(set) var lastReplay: FixedStepReplayResult?
+    private var stepCostScratch: [Float] = []
+
+    init(engineContext: EngineContext?) {
+        self.engineContext = engineContext
+    }
+
+    func resetDiagnostics() {
+        diagnostics = FixedStepDiagnostics(maxSubsteps: Self.maxFixedSteps)
+    }
+
+    /// Steps run over the most recent second of recorded frames.
+    func stepsLastSecond() -> Int {
+        var seconds: Float = 0
+        var steps = 0
+        for sample in diagnostics.orderedRecent().reversed() {
+            steps += sample.steps
+            seconds += Float(sample.steps) * sample.fixedDeltaTime + sample.droppedSeconds + sample.slowedSeconds
+            if seconds >= 1.0 { break }
+        }
+        return steps
+    }
+
+    private func makePolicy(fallbackFixedDelta: Float, mode: FixedStepScheduleMode) -> Policy {
+        let settings = engineContext?.physicsSettings
+        let requestedFixedDelta = settings?.fixedDeltaTime ?? fallbackFixedDelta
+        let requestedMaxSubsteps = settings?.maxSubsteps ?? Self.maxFixedSteps
+        let safetyClamp = mode == .play ? Self.runtimeSafetyMaxSubsteps : Self.maxFixedSteps
+        return Policy(
+            fixedDeltaTime: max(0.0001, requestedFixedDelta),
+            maxSubsteps: max(1, min(requestedMaxSubsteps, safetyClamp, Self.maxFixedSteps)),
+            maxAccumulatedDelta: 0.1
+        )
+    }
+
+    func execute(scene: EngineScene,
+                 frameTime: FrameTime,
+                 mode: FixedStepScheduleMode,
+                 accumulator: inout Float) -> ExecutionResult {
+        let policy = makePolicy(fallbackFixedDelta: frameTime.fixedDeltaTime, mode: mode)
+        let accumulatorBefore = accumulator
+        let frameDelta = max(0.0, frameTime.unscaledDeltaTime)
+        var sample = FixedStepFrameSample()
+
+        var stepDelta = policy.fixedDeltaTime
+        switch overloadPolicy {
+        case .dropTime:
+            accumulator += frameDelta
+        case .slowMotion:
+            let budget = Float(policy.maxSubsteps) * policy.fixedDeltaTime
+            let room = max(0.0, budget - accumulator)
+            accumulator += min(frameDelta, room)
+            sample.slowedSeconds = max(0.0, frameDelta - room)
+        case .adaptiveDelta:
+            accumulator += frameDelta
+        }
+        if accumulator > policy.maxAccumulatedDelta {
+            sample.droppedSeconds = accumulator - policy.maxAccumulatedDelta
+            accumulator = policy.maxAccumulatedDelta
+        }
+        // Sized from the clamped accumulator: time the clamp drops must not stretch the steps that remain.
+        if overloadPolicy == .adaptiveDelta {
+            let budget = Float(policy.maxSubsteps) * policy.fixedDeltaTime
+            if accumulator > budget {
+                stepDelta = min(accumulator / Float(policy.maxSubsteps), policy.fixedDeltaTime * Self.maxAdaptiveScale)
+                diagnostics.adaptiveFrames &+= 1
+            }
+        }
+
+        var stepsExecuted = 0
+        stepCostScratch.removeAll(keepingCapacity: true)
+        if accumulator >= stepDelta {
+            let fixedStart = CACurrentMediaTime()
+            MCETraceBegin(EditorTraceScopes.fixedUpdate)
+            while accumulator >= stepDelta && stepsExecuted < policy.maxSubsteps {
+                let stepStart = CACurrentMediaTime()
+                EditorTraceScopes.measure(EditorTraceScopes.fixedStep) {
+                    switch mode {
+                    case .play:
+                        _ = scene.runPlayFixedStep(fixedDeltaOverride: stepDelta)
+                    case .simulate:
+                        _ = scene.runSimulateFixedStep(fixedDeltaOverride: stepDelta)
+                    }
+                }
+                stepCostScratch.append(Float((CACurrentMediaTime() - stepStart) * 1000.0))
+                accumulator -= stepDelta
+                stepsExecuted += 1
+            }
+            MCETraceEnd()
+            engineContext?.renderer?.profiler.record(.fixedUpdate, seconds: CACurrentMediaTime() - fixedStart)
+        }
+        if stepsExecuted == policy.maxSubsteps && accumulator >= stepDelta {
+            diagnostics.budgetHitFrames &+= 1
+        }
+
+        sample.steps = stepsExecuted
+        sample.fixedDeltaTime = stepDelta
+        sample.stepCostTotalMs = stepCostScratch.reduce(0, +)
+        sample.stepCostMaxMs = stepCostScratch.max() ?? 0
+        diagnostics.record(sample, stepCostsMs: stepCostScratch)
+
+        let interpolationAlpha = stepDelta > 1.0e-6
+            ? simd_clamp(accumulator / stepDelta, 0.0, 1.0)
+            : 0.0
+        return ExecutionResult(stepsExecuted: stepsExecuted,
+                               fixedDeltaTime: stepDelta,
+                               accumulatorBefore: accumulatorBefore,
+                               accumulatorAfter: accumulator,
+                               interpolationAlpha: interpolationAlpha)
+    }
+
+    // MARK: - Replay Harness
+
+    /// Replays `document` off-screen at the configured simulate fixed delta (see FixedStepReplay).
+    func runReplay(document: SceneDocument, prefabSystem: PrefabSystem, steps: Int) -> FixedStepReplayResult {
+        var settings = engineContext?.physicsSettings ?? PhysicsSettings()
+        settings.deterministic = true
+        let fixedDelta = makePolicy(fallbackFixedDelta: 1.0 / 60.0, mode: .simulate).fixedDeltaTime
+        let result = FixedStepReplay.run(document: document,
+                                         prefabSystem: prefabSystem,
+                                         engineContext: engineContext,
+                                         physicsSettings: settings,
+                                         fixedDelta: fixedDelta,
+                                         steps: max(1, min(steps, Self.maxReplaySteps)))
+        lastReplay = result
+        return result
+    }
+}
+
+@_cdecl("MCEEditorGetFixedStepStats")
+public func MCEEditorGetFixedStepStats(_ contextPtr: UnsafeRawPointer?,
+                                       _ policy: UnsafeMutablePointer<Int32>?,
+                                       _ frames: UnsafeMutablePointer<UInt64>?,
+                                       _ steps: UnsafeMutablePointer<UInt64>?,
+                                       _ droppedMs: UnsafeMutablePointer<Double>?,
+                                       _ slowedMs: UnsafeMutablePointer<Double>?,
+                                       _ budgetHitFrames: UnsafeMutablePointer<UInt64>?,
+                                       _ adaptiveFrames: UnsafeMutablePointer<UInt64>?,
+                                       _ stepCostMeanMs: UnsafeMutablePointer<Double>?,
+                                       _ stepsLastSecond: UnsafeMutablePointer<Int32>?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    let scheduler = context.editorSceneController.fixedStepScheduler
+    let diagnostics = scheduler.diagnostics
+    policy?.pointee = scheduler.overloadPolicy.rawValue
+    frames?.pointee = diagnostics.frames
+    steps?.pointee = diagnostics.steps
+    droppedMs?.pointee = diagnostics.droppedSeconds * 1000.0
+    slowedMs?.pointee = diagnostics.slowedSeconds * 1000.0
+    budgetHitFrames?.pointee = diagnostics.budgetHitFrames
+    adaptiveFrames?.pointee = diagnostics.adaptiveFrames
+    stepCostMeanMs?.pointee = diagnostics.stepCostMeanMs
+    stepsLastSecond?.pointee = Int32(clamping: scheduler.stepsLastSecond())
+    return 1
+}
+
+@_cdecl("MCEEditorGetFixedStepHistogram")
+public func MCEEditorGetFixedStepHistogram(_ contextPtr: UnsafeRawPointer?,
+                                           _ counts: UnsafeMutablePointer<UInt64>?,
+                                           _ capacity: Int32) -> Int32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr), let counts else { return 0 }
+    let histogram = context.editorSceneController.fixedStepScheduler.diagnostics.substepHistogram
+    let count = min(Int(capacity), histogram.count)
+    for index in 0..<count {
+        counts[index] = histogram[index]
+    }
+    return Int32(count)
+}
+
+/// Fills the recent-frame series oldest first; any output pointer may be null.
+@_cdecl("MCEEditorGetFixedStepRecent")
+public func MCEEditorGetFixedStepRecent(_ contextPtr: UnsafeRawPointer?,
+                                        _ steps: UnsafeMutablePointer<Float>?,
+                                        _ droppedMs: UnsafeMutablePointer<Float>?,
+                                        _ stepCostMs: UnsafeMutablePointer<Float>?,
+                                        _ fixedDeltaMs: UnsafeMutablePointer<Float>?,
+                                        _ capacity: Int32) -> Int32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    let recent = context.editorSceneController.fixedStepScheduler.diagnostics.orderedRecent()
+    let count = min(Int(max(0, capacity)), recent.count)
+    let offset = recent.count - count
+    for index in 0..<count {
+        let sample = recent[offset + index]
+        steps?[index] = Float(sample.steps)
+        droppedMs?[index] = (sample.droppedSeconds + sample.slowedSeconds) * 1000.0
+        stepCostMs?[index] = sample.stepCostTotalMs
+        fixedDeltaMs?[index] = sample.fixedDeltaTime * 1000.0
+    }
+    return Int32(count)
+}
+
+@_cdecl("MCEEditorGetFixedStepLastCosts")
+public func MCEEditorGetFixedStepLastCosts(_ contextPtr: UnsafeRawPointer?,
+                                           _ costsMs: UnsafeMutablePointer<Float>?,
+                                           _ capacity: Int32) -> Int32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr), let costsMs else { return 0 }
+    let costs = context.editorSceneController.fixedStepScheduler.diagnostics.lastStepCostsMs
+    let count = min(Int(max(0, capacity)), costs.count)
+    for index in 0..<count {
+        costsMs[index] = costs[index]
+    }
+    return Int32(count)
+}
+
+@_cdecl("MCEEditorSetFixedStepOverloadPolicy")
+public func MCEEditorSetFixedStepOverloadPolicy(_ contextPtr: UnsafeRawPointer?, _ policy: Int32) {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr),
+          let value = FixedStepOverloadPolicy(rawValue: policy) else { return }
+    context.editorSceneController.fixedStepScheduler.overloadPolicy = value
+}
+
+@_cdecl("MCEEditorResetFixedStepStats")
+public func MCEEditorResetFixedStepStats(_ contextPtr: UnsafeRawPointer?) {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return }
+    context.editorSceneController.fixedStepScheduler.resetDiagnostics()
+}
+
+/// Runs the replay harness on the current editor scene. Blocks until both passes finish.
+@_cdecl("MCEEditorRunFixedStepReplay")
+public func MCEEditorRunFixedStepReplay(_ contextPtr: UnsafeRawPointer?, _ steps: Int32) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr) else { return 0 }
+    guard let result = context.editorSceneController.runFixedStepReplay(steps: Int(steps)) else { return 0 }
+    context.engineContext.log.logInfo(
+        String(format: "Fixed-step replay: %d steps in %.1f ms (%.0f steps/s), deterministic: %@",
+               result.steps, result.totalMs, result.stepsPerSecond, result.deterministic ? "yes" : "no"),
+        category: .editor)
+    return 1
+}
+
+@_cdecl("MCEEditorGetFixedStepReplayResult")
+public func MCEEditorGetFixedStepReplayResult(_ contextPtr: UnsafeRawPointer?,
+                                              _ steps: UnsafeMutablePointer<Int32>?,
+                                              _ totalMs: UnsafeMutablePointer<Double>?,
+                                              _ stepsPerSecond: UnsafeMutablePointer<Double>?,
+                                              _ stepP50Ms: UnsafeMutablePointer<Double>?,
+                                              _ stepP99Ms: UnsafeMutablePointer<Double>?,
+                                              _ stepMaxMs: UnsafeMutablePointer<Double>?,
+                                              _ checksum: UnsafeMutablePointer<UInt64>?,
+                                              _ deterministic: UnsafeMutablePointer<UInt32>?) -> UInt32 {
+    guard let context = EditorBridgeInternals.contextValue(contextPtr),
+          let result = context.editorSceneController.fixedStepScheduler.lastReplay else { return 0 }
+    steps?.pointee = Int32(clamping: result.steps)
+    totalMs?.pointee = result.totalMs
+    stepsPerSecond?.pointee = result.stepsPerSecond
+    stepP50Ms?.pointee = result.stepP50Ms
+    stepP99Ms?.pointee = result.stepP99Ms
+    stepMaxMs?.pointee = result.stepMaxMs
+    checksum?.pointee = result.checksum
+    deterministic?.pointee = result.deterministic ? 1 : 0
+    return 1
+}
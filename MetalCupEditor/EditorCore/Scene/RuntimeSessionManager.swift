@@ -1,16 +1,26 @@
 import Foundation
+import QuartzCore
 import MetalCupEngine
 
+struct PlayModeTransitionStats {
+    var lastEnterMs: Double = 0.0
+    var lastExitMs: Double = 0.0
+    var lastRestore = SceneSnapshotRestoreStats()
+    var documentRestores: UInt64 = 0
+}
+
 final class RuntimeSessionManager {
     private let prefabSystem: PrefabSystem
     private weak var engineContext: EngineContext?
 
-    private var editorSnapshot: SceneDocument?
-    private var simulateSnapshot: SceneDocument?
+    private var editorComponentSnapshot: EditorSceneSnapshot?
+    private var simulateSnapshot: EditorSceneSnapshot?
+    private var simulateDocument: SceneDocument?
     private var cachedScriptRuntime: ScriptRuntime?
     private var prePlayPhysicsSettings: PhysicsSettings?
 
     private(set) var runtimeScene: EngineScene?
+    private(set) var transitionStats = PlayModeTransitionStats()
 
     init(prefabSystem: PrefabSystem, engineContext: EngineContext) {
         self.prefabSystem = prefabSystem
@@ -19,28 +29,20 @@ final class RuntimeSessionManager {
 
     @discardableResult
     func startPlay(from editorScene: EngineScene) -> Bool {
-        let rendererSettings = engineContext?.rendererSettings ?? RendererSettings()
-        let physicsSettings = engineContext?.physicsSettings ?? PhysicsSettings()
-        editorSnapshot = editorScene.toDocument(
-            rendererSettingsOverride: RendererSettingsDTO(settings: rendererSettings),
-            physicsSettingsOverride: PhysicsSettingsDTO(settings: physicsSettings)
+        let start = CACurrentMediaTime()
+        defer { transitionStats.lastEnterMs = (CACurrentMediaTime() - start) * 1000.0 }
+        MCETraceBegin(EditorTraceScopes.playEnter)
+        defer { MCETraceEnd() }
+        // The runtime scene is built from a document because the engine instantiates scenes that
+        // way. The document is not kept: while playing, the runtime scene is the active one, so nothing
+        // destroys editor-scene entities and the component snapshot alone restores it.
+        editorComponentSnapshot = EditorSceneSnapshot(scene: editorScene)
+        runtimeScene = SerializedScene(
+            document: document(of: editorScene),
+            prefabSystem: prefabSystem,
+            engineContext: engineContext
         )
 
-        if let snapshot = editorSnapshot {
-            runtimeScene = SerializedScene(
-                document: snapshot,
-                prefabSystem: prefabSystem,
-                engineContext: engineContext
-            )
-        } else {
-            let empty = SceneDocument(id: UUID(), name: "Untitled", entities: [])
-            runtimeScene = SerializedScene(
-                document: empty,
-                prefabSystem: prefabSystem,
-                engineContext: engineContext
-            )
-        }
-
         if let engineContext {
             prePlayPhysicsSettings = engineContext.physicsSettings
             if !engineContext.physicsSettings.deterministic {
@@ -70,6 +72,10 @@ final class RuntimeSessionManager {
     }
 
     func stopPlay(restoreInto editorScene: EngineScene?) {
+        let start = CACurrentMediaTime()
+        defer { transitionStats.lastExitMs = (CACurrentMediaTime() - start) * 1000.0 }
+        MCETraceBegin(EditorTraceScopes.playExit)
+        defer { MCETraceEnd() }
         runtimeForceCursorNormal()
         runtimeScene?.notifyScriptSceneStop()
         runtimeScene?.stopPhysics()
@@ -79,11 +85,11 @@ final class RuntimeSessionManager {
         }
         cachedScriptRuntime = nil
 
-        if let snapshot = editorSnapshot, let editorScene {
-            editorScene.apply(document: snapshot)
+        if let editorScene {
+            restore(editorScene, from: editorComponentSnapshot, fallback: nil)
         }
 
-        editorSnapshot = nil
+        editorComponentSnapshot = nil
         runtimeScene = nil
 
         if let engineContext, let prePlayPhysicsSettings {
@@ -94,22 +100,63 @@ final class RuntimeSessionManager {
 
     @discardableResult
     func startSimulate(on editorScene: EngineScene) -> Bool {
-        let rendererSettings = engineContext?.rendererSettings ?? RendererSettings()
+        let start = CACurrentMediaTime()
+        defer { transitionStats.lastEnterMs = (CACurrentMediaTime() - start) * 1000.0 }
+        MCETraceBegin(EditorTraceScopes.simulateEnter)
+        defer { MCETraceEnd() }
         let physicsSettings = engineContext?.physicsSettings ?? PhysicsSettings()
-        simulateSnapshot = editorScene.toDocument(
-            rendererSettingsOverride: RendererSettingsDTO(settings: rendererSettings),
-            physicsSettingsOverride: PhysicsSettingsDTO(settings: physicsSettings)
-        )
+        simulateSnapshot = EditorSceneSnapshot(scene: editorScene)
+        simulateDocument = nil
         editorScene.startPhysics(settings: physicsSettings)
         return true
     }
 
     func resetSimulate(on editorScene: EngineScene?) {
+        let start = CACurrentMediaTime()
+        defer { transitionStats.lastExitMs = (CACurrentMediaTime() - start) * 1000.0 }
+        MCETraceBegin(EditorTraceScopes.simulateReset)
+        defer { MCETraceEnd() }
         editorScene?.stopPhysics()
-        if let snapshot = simulateSnapshot, let editorScene {
-            editorScene.apply(document: snapshot)
+        if let editorScene {
+            restore(editorScene, from: simulateSnapshot, fallback: simulateDocument)
         }
         simulateSnapshot = nil
+        simulateDocument = nil
+    }
+
+    /// Simulate runs on the editor scene, and the component snapshot cannot bring back entities destroyed
+    /// there. The caller invokes this right before something destroys or respawns editor-scene entities
+    /// (a prefab apply); the first call captures the document that reset falls back to, later calls are free.
+    func captureSimulateFallback(of editorScene: EngineScene) {
+        guard simulateSnapshot != nil, simulateDocument == nil else { return }
+        simulateDocument = document(of: editorScene)
+    }
+
+    private func document(of editorScene: EngineScene) -> SceneDocument {
+        let rendererSettings = engineContext?.rendererSettings ?? RendererSettings()
+        let physicsSettings = engineContext?.physicsSettings ?? PhysicsSettings()
+        return editorScene.toDocument(
+            rendererSettingsOverride: RendererSettingsDTO(settings: rendererSettings),
+            physicsSettingsOverride: PhysicsSettingsDTO(settings: physicsSettings)
+        )
+    }
+
+    private func restore(_ editorScene: EngineScene, from snapshot: EditorSceneSnapshot?, fallback: SceneDocument?) {
+        var stats = SceneSnapshotRestoreStats()
+        let restored = snapshot?.restore(into: editorScene, stats: &stats) ?? false
+        transitionStats.lastRestore = stats
+        guard !restored else { return }
+        if let fallback {
+            editorScene.apply(document: fallback)
+            // The fallback is captured mid-session, so it can hold simulated values; the snapshot
+            // still decides what every entity it knows about goes back to.
+            var replayStats = SceneSnapshotRestoreStats()
+            _ = snapshot?.restore(into: editorScene, stats: &replayStats)
+            transitionStats.documentRestores += 1
+        } else if stats.missingEntities > 0 {
+            engineContext?.log.logWarning("Scene restore could not bring back \(stats.missingEntities) destroyed entities.",
+                                          category: .editor)
+        }
     }
 
     func replaceRuntimeScene(with document: SceneDocument) {
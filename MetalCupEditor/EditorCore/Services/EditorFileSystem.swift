@@ -37,6 +37,13 @@ enum EditorFileSystem {
         return base.appendingPathComponent("imgui.ini")
     }
 
+    static func tracesRootURL() -> URL? {
+        guard let base = appSupportRootURL(ensureExists: true) else { return nil }
+        let traces = base.appendingPathComponent("Traces", isDirectory: true)
+        PathUtils.ensureDirectoryExists(traces)
+        return traces.standardizedFileURL
+    }
+
 }
 @_cdecl("MCEEditorGetImGuiIniPath")
 public func MCEEditorGetImGuiIniPath(_ contextPtr: UnsafeRawPointer?,
@@ -0,0 +1,94 @@
+/// EditorJobs.h
+/// Defines the editor's work-stealing job system: parallel-for and dependency graphs.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Body of a parallel-for chunk: processes indices [begin, end).
+typedef void (*MCEJobRangeFunction)(void *userData, uint32_t begin, uint32_t end);
+typedef void (*MCEJobFunction)(void *userData);
+
+/// Threads that run jobs, including the calling thread.
+uint32_t MCEJobsWorkerCount(void);
+/// Runs `body` over [0, count) in chunks of `grain` and returns when every chunk has run. The
+/// calling thread takes chunks too. `maxParticipants` caps the threads used (0 = all).
+void MCEJobsParallelFor(uint32_t count, uint32_t grain, uint32_t maxParticipants,
+                        void *userData, MCEJobRangeFunction body);
+
+typedef struct MCEJobGraph MCEJobGraph;
+MCEJobGraph *MCEJobGraphCreate(void);
+void MCEJobGraphDestroy(MCEJobGraph *graph);
+/// Returns the job's index in the graph.
+uint32_t MCEJobGraphAdd(MCEJobGraph *graph, void *userData, MCEJobFunction function);
+/// `after` will not start before `before` has finished.
+void MCEJobGraphDepend(MCEJobGraph *graph, uint32_t before, uint32_t after);
+/// Runs every job respecting dependencies; blocks (and helps) until all have finished.
+void MCEJobGraphRun(MCEJobGraph *graph);
+
+/// Runs a fixed synthetic workload with 1, 2, 4, ... participants up to the worker count. Writes
+/// the participant count and elapsed milliseconds of each run; returns the number of runs.
+int32_t MCEJobsRunScalingBenchmark(uint32_t itemCount, uint32_t *participantsOut, double *millisecondsOut, int32_t capacity);
+void MCEJobsGetStats(uint64_t *jobsExecuted, uint64_t *steals, uint64_t *parallelFors, uint64_t *graphsRun);
+
+#ifdef __cplusplus
+}
+
+#include <functional>
+#include <vector>
+
+namespace EditorJobs {
+struct Stats {
+    uint64_t jobsExecuted = 0;
+    uint64_t steals = 0;
+    uint64_t parallelFors = 0;
+    uint64_t graphsRun = 0;
+};
+
+uint32_t WorkerCount();
+void ParallelFor(uint32_t count, uint32_t grain, const std::function<void(uint32_t, uint32_t)> &body,
+                 uint32_t maxParticipants = 0);
+Stats GetStats();
+
+/// Measured per-item cost of one loop, for sizing its chunks. Owned by a single call site and only
+/// touched from the thread that starts the loop.
+class LoopCost {
+public:
+    /// Splits the work across every worker, but never into chunks worth less than a worker wake-up;
+    /// a loop that cheap comes back as one chunk and runs on the caller. Before the first
+    /// measurement the count is simply split across the workers.
+    uint32_t Grain(uint32_t count) const;
+    /// Folds in one run: `busyNs` is the summed time spent inside the chunks.
+    void Record(uint32_t count, uint64_t busyNs);
+    double NanosecondsPerItem() const { return _nsPerItem; }
+
+private:
+    double _nsPerItem = 0.0;
+};
+
+/// ParallelFor with the grain taken from `cost`, which is updated with this run's measurement.
+void ParallelFor(uint32_t count, LoopCost &cost, const std::function<void(uint32_t, uint32_t)> &body);
+
+/// Build once, run once. Jobs without dependencies start immediately.
+class Graph {
+public:
+    using JobId = uint32_t;
+    JobId Add(std::function<void()> job);
+    void Depend(JobId before, JobId after);
+    void Run();
+
+private:
+    struct Node {
+        std::function<void()> job;
+        std::vector<JobId> successors;
+        uint32_t dependencyCount = 0;
+    };
+    std::vector<Node> _nodes;
+};
+}
+#endif
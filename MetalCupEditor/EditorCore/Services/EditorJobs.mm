@@ -0,0 +1,428 @@
+/// EditorJobs.mm
+/// Implements the editor's work-stealing job system.
+/// Created by Kaden Cringle.
+
+#include "EditorJobs.h"
+#include "EditorTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <pthread.h>
+
+namespace {
+struct Task {
+    void (*run)(void *context) = nullptr;
+    void *context = nullptr;
+};
+
+/// The owner pushes and pops at the back (newest first, cache-warm); thieves take the front.
+class TaskQueue {
+public:
+    void Push(const Task &task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(task);
+    }
+
+    bool PopBack(Task &task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_tasks.empty()) { return false; }
+        task = _tasks.back();
+        _tasks.pop_back();
+        return true;
+    }
+
+    bool StealFront(Task &task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_tasks.empty()) { return false; }
+        task = _tasks.front();
+        _tasks.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<Task> _tasks;
+};
+
+thread_local int32_t tWorkerIndex = -1;
+
+class Scheduler {
+public:
+    static Scheduler &Shared() {
+        // Never destroyed: workers may still be parked when static destructors run at exit.
+        static Scheduler *scheduler = new Scheduler();
+        return *scheduler;
+    }
+
+    uint32_t ParticipantCount() const { return _workerCount + 1; }
+
+    void Submit(const Task &task) {
+        // Workers push to their own queue; every other thread shares the injection queue.
+        const uint32_t queue = tWorkerIndex >= 0 ? static_cast<uint32_t>(tWorkerIndex) : _workerCount;
+        _queues[queue]->Push(task);
+        _pending.fetch_add(1, std::memory_order_release);
+        { std::lock_guard<std::mutex> lock(_sleepMutex); }
+        _wake.notify_one();
+    }
+
+    bool RunOne() {
+        const uint32_t self = tWorkerIndex >= 0 ? static_cast<uint32_t>(tWorkerIndex) : _workerCount;
+        Task task;
+        bool found = _queues[self]->PopBack(task);
+        if (!found) {
+            const uint32_t queueCount = _workerCount + 1;
+            for (uint32_t offset = 1; offset < queueCount && !found; ++offset) {
+                found = _queues[(self + offset) % queueCount]->StealFront(task);
+            }
+            if (found) { _stats.steals.fetch_add(1, std::memory_order_relaxed); }
+        }
+        if (!found) { return false; }
+        _pending.fetch_sub(1, std::memory_order_acq_rel);
+        MCETraceBegin(_jobScope);
+        task.run(task.context);
+        MCETraceEnd();
+        _stats.jobsExecuted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// The waiting thread runs queued jobs (its own or stolen) instead of blocking, so nested
+    /// parallel work cannot deadlock on a full pool.
+    void WaitHelping(const std::atomic<uint32_t> &remaining) {
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (!RunOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    struct AtomicStats {
+        std::atomic<uint64_t> jobsExecuted{0};
+        std::atomic<uint64_t> steals{0};
+        std::atomic<uint64_t> parallelFors{0};
+        std::atomic<uint64_t> graphsRun{0};
+    };
+    AtomicStats &Stats() { return _stats; }
+
+private:
+    Scheduler() {
+        const uint32_t hardware = std::max(2u, std::thread::hardware_concurrency());
+        // Leave a core for the main thread's render work.
+        _workerCount = std::min(15u, hardware - 1);
+        _jobScope = MCETraceInternName("Job");
+        for (uint32_t i = 0; i <= _workerCount; ++i) {
+            _queues.push_back(std::make_unique<TaskQueue>());
+        }
+        for (uint32_t i = 0; i < _workerCount; ++i) {
+            std::thread([this, i]() { WorkerLoop(i); }).detach();
+        }
+    }
+
+    void WorkerLoop(uint32_t index) {
+        tWorkerIndex = static_cast<int32_t>(index);
+        const std::string name = "MCE Job " + std::to_string(index);
+        pthread_setname_np(name.c_str());
+        while (true) {
+            if (RunOne()) { continue; }
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _wake.wait_for(lock, std::chrono::milliseconds(50), [this]() {
+                return _pending.load(std::memory_order_acquire) > 0;
+            });
+        }
+    }
+
+    uint32_t _workerCount = 0;
+    uint32_t _jobScope = 0;
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    std::atomic<uint32_t> _pending{0};
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    AtomicStats _stats;
+};
+
+struct ParallelForState {
+    const std::function<void(uint32_t, uint32_t)> *body = nullptr;
+    uint32_t count = 0;
+    uint32_t grain = 1;
+    uint32_t chunkCount = 0;
+    std::atomic<uint32_t> nextChunk{0};
+    std::atomic<uint32_t> remainingHelpers{0};
+};
+
+/// Chunks are claimed from a shared counter, so fast threads take more and helpers that start
+/// late simply find nothing left.
+void RunChunks(ParallelForState &state) {
+    while (true) {
+        const uint32_t chunk = state.nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= state.chunkCount) { return; }
+        const uint32_t begin = chunk * state.grain;
+        const uint32_t end = std::min(state.count, begin + state.grain);
+        (*state.body)(begin, end);
+    }
+}
+
+void RunParallelForHelper(void *context) {
+    ParallelForState &state = *static_cast<ParallelForState *>(context);
+    RunChunks(state);
+    state.remainingHelpers.fetch_sub(1, std::memory_order_release);
+}
+
+struct GraphRun;
+struct GraphJobContext {
+    GraphRun *run = nullptr;
+    uint32_t index = 0;
+};
+
+struct GraphRun {
+    const std::vector<std::function<void()>> *jobs = nullptr;
+    const std::vector<std::vector<uint32_t>> *successors = nullptr;
+    std::unique_ptr<std::atomic<uint32_t>[]> waiting;
+    std::vector<GraphJobContext> contexts;
+    std::atomic<uint32_t> remaining{0};
+};
+
+void RunGraphJob(void *context) {
+    GraphJobContext &job = *static_cast<GraphJobContext *>(context);
+    GraphRun &run = *job.run;
+    (*run.jobs)[job.index]();
+    for (uint32_t successor : (*run.successors)[job.index]) {
+        if (run.waiting[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Scheduler::Shared().Submit({ RunGraphJob, &run.contexts[successor] });
+        }
+    }
+    run.remaining.fetch_sub(1, std::memory_order_release);
+}
+
+float BenchmarkWork(uint32_t index) {
+    float value = static_cast<float>(index) * 0.001f;
+    for (int i = 0; i < 96; ++i) {
+        value = std::sqrt(value * value + 1.0f) * std::sin(value + static_cast<float>(i));
+    }
+    return value;
+}
+}
+
+namespace EditorJobs {
+uint32_t WorkerCount() {
+    return Scheduler::Shared().ParticipantCount();
+}
+
+void ParallelFor(uint32_t count, uint32_t grain, const std::function<void(uint32_t, uint32_t)> &body,
+                 uint32_t maxParticipants) {
+    if (count == 0) { return; }
+    grain = std::max(1u, grain);
+    Scheduler &scheduler = Scheduler::Shared();
+    const uint32_t chunkCount = (count + grain - 1) / grain;
+    uint32_t participants = scheduler.ParticipantCount();
+    if (maxParticipants > 0) { participants = std::min(participants, maxParticipants); }
+    const uint32_t helpers = std::min(participants, chunkCount) - 1;
+    if (helpers == 0) {
+        body(0, count);
+        return;
+    }
+
+    ParallelForState state;
+    state.body = &body;
+    state.count = count;
+    state.grain = grain;
+    state.chunkCount = chunkCount;
+    state.remainingHelpers.store(helpers, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < helpers; ++i) {
+        scheduler.Submit({ RunParallelForHelper, &state });
+    }
+    RunChunks(state);
+    scheduler.WaitHelping(state.remainingHelpers);
+    scheduler.Stats().parallelFors.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Roughly what handing a chunk to a sleeping worker costs; smaller chunks lose to running serially.
+constexpr double kMinChunkNs = 25000.0;
+// More chunks than workers lets stealing even out uneven items.
+constexpr uint32_t kChunksPerWorker = 4;
+
+uint32_t LoopCost::Grain(uint32_t count) const {
+    const uint32_t workers = std::max(1u, WorkerCount());
+    const uint32_t perWorker = std::max(1u, (count + workers - 1) / workers);
+    if (_nsPerItem <= 0.0) {
+        return perWorker;
+    }
+    const double minItems = std::ceil(kMinChunkNs / _nsPerItem);
+    if (minItems >= static_cast<double>(count)) {
+        return std::max(1u, count);
+    }
+    const uint32_t balanced = std::max(1u, (count + workers * kChunksPerWorker - 1) / (workers * kChunksPerWorker));
+    return std::max(balanced, static_cast<uint32_t>(minItems));
+}
+
+void LoopCost::Record(uint32_t count, uint64_t busyNs) {
+    if (count == 0) { return; }
+    const double sample = static_cast<double>(busyNs) / static_cast<double>(count);
+    _nsPerItem = _nsPerItem <= 0.0 ? sample : _nsPerItem * 0.8 + sample * 0.2;
+}
+
+void ParallelFor(uint32_t count, LoopCost &cost, const std::function<void(uint32_t, uint32_t)> &body) {
+    if (count == 0) { return; }
+    std::atomic<uint64_t> busyNs{0};
+    ParallelFor(count, cost.Grain(count), [&](uint32_t begin, uint32_t end) {
+        const auto start = std::chrono::steady_clock::now();
+        body(begin, end);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        busyNs.fetch_add(static_cast<uint64_t>(elapsed.count()), std::memory_order_relaxed);
+    });
+    cost.Record(count, busyNs.load(std::memory_order_relaxed));
+}
+
+Stats GetStats() {
+    Scheduler::AtomicStats &stats = Scheduler::Shared().Stats();
+    Stats out;
+    out.jobsExecuted = stats.jobsExecuted.load(std::memory_order_relaxed);
+    out.steals = stats.steals.load(std::memory_order_relaxed);
+    out.parallelFors = stats.parallelFors.load(std::memory_order_relaxed);
+    out.graphsRun = stats.graphsRun.load(std::memory_order_relaxed);
+    return out;
+}
+
+Graph::JobId Graph::Add(std::function<void()> job) {
+    _nodes.push_back(Node{ std::move(job), {}, 0 });
+    return static_cast<JobId>(_nodes.size() - 1);
+}
+
+void Graph::Depend(JobId before, JobId after) {
+    if (before >= _nodes.size() || after >= _nodes.size() || before == after) { return; }
+    _nodes[before].successors.push_back(after);
+    _nodes[after].dependencyCount += 1;
+}
+
+void Graph::Run() {
+    const uint32_t count = static_cast<uint32_t>(_nodes.size());
+    if (count == 0) { return; }
+
+    // Kahn pass: a cycle would leave jobs waiting forever, so fall back to insertion order.
+    std::vector<uint32_t> indegree(count);
+    std::vector<uint32_t> ready;
+    for (uint32_t i = 0; i < count; ++i) {
+        indegree[i] = _nodes[i].dependencyCount;
+        if (indegree[i] == 0) { ready.push_back(i); }
+    }
+    const std::vector<uint32_t> roots = ready;
+    uint32_t visited = 0;
+    while (!ready.empty()) {
+        const uint32_t node = ready.back();
+        ready.pop_back();
+        visited += 1;
+        for (uint32_t successor : _nodes[node].successors) {
+            if (--indegree[successor] == 0) { ready.push_back(successor); }
+        }
+    }
+    if (visited != count) {
+        for (Node &node : _nodes) { node.job(); }
+        return;
+    }
+
+    std::vector<std::function<void()>> jobs;
+    std::vector<std::vector<uint32_t>> successors;
+    jobs.reserve(count);
+    successors.reserve(count);
+    for (Node &node : _nodes) {
+        jobs.push_back(std::move(node.job));
+        successors.push_back(std::move(node.successors));
+    }
+
+    GraphRun run;
+    run.jobs = &jobs;
+    run.successors = &successors;
+    run.waiting.reset(new std::atomic<uint32_t>[count]);
+    run.contexts.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        run.waiting[i].store(_nodes[i].dependencyCount, std::memory_order_relaxed);
+        run.contexts[i] = GraphJobContext{ &run, i };
+    }
+    run.remaining.store(count, std::memory_order_release);
+
+    Scheduler &scheduler = Scheduler::Shared();
+    for (uint32_t root : roots) {
+        scheduler.Submit({ RunGraphJob, &run.contexts[root] });
+    }
+    scheduler.WaitHelping(run.remaining);
+    scheduler.Stats().graphsRun.fetch_add(1, std::memory_order_relaxed);
+    _nodes.clear();
+}
+}
+
+struct MCEJobGraph {
+    EditorJobs::Graph graph;
+};
+
+extern "C" uint32_t MCEJobsWorkerCount(void) {
+    return EditorJobs::WorkerCount();
+}
+
+extern "C" void MCEJobsParallelFor(uint32_t count, uint32_t grain, uint32_t maxParticipants,
+                                   void *userData, MCEJobRangeFunction body) {
+    if (!body) { return; }
+    EditorJobs::ParallelFor(count, grain, [userData, body](uint32_t begin, uint32_t end) {
+        body(userData, begin, end);
+    }, maxParticipants);
+}
+
+extern "C" MCEJobGraph *MCEJobGraphCreate(void) {
+    return new MCEJobGraph();
+}
+
+extern "C" void MCEJobGraphDestroy(MCEJobGraph *graph) {
+    delete graph;
+}
+
+extern "C" uint32_t MCEJobGraphAdd(MCEJobGraph *graph, void *userData, MCEJobFunction function) {
+    if (!graph || !function) { return UINT32_MAX; }
+    return graph->graph.Add([userData, function]() { function(userData); });
+}
+
+extern "C" void MCEJobGraphDepend(MCEJobGraph *graph, uint32_t before, uint32_t after) {
+    if (!graph) { return; }
+    graph->graph.Depend(before, after);
+}
+
+extern "C" void MCEJobGraphRun(MCEJobGraph *graph) {
+    if (!graph) { return; }
+    graph->graph.Run();
+}
+
+extern "C" int32_t MCEJobsRunScalingBenchmark(uint32_t itemCount, uint32_t *participantsOut, double *millisecondsOut, int32_t capacity) {
+    if (!participantsOut || !millisecondsOut || capacity <= 0 || itemCount == 0) { return 0; }
+    std::vector<float> results(itemCount);
+    const uint32_t maxParticipants = EditorJobs::WorkerCount();
+    int32_t runs = 0;
+    for (uint32_t participants = 1; runs < capacity; participants *= 2) {
+        const uint32_t clamped = std::min(participants, maxParticipants);
+        double best = 0.0;
+        for (int repeat = 0; repeat < 3; ++repeat) {
+            const auto start = std::chrono::steady_clock::now();
+            EditorJobs::ParallelFor(itemCount, 1024, [&results](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i) { results[i] = BenchmarkWork(i); }
+            }, clamped);
+            const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = repeat == 0 ? elapsed : std::min(best, elapsed);
+        }
+        participantsOut[runs] = clamped;
+        millisecondsOut[runs] = best;
+        runs += 1;
+        if (clamped == maxParticipants) { break; }
+    }
+    return runs;
+}
+
+extern "C" void MCEJobsGetStats(uint64_t *jobsExecuted, uint64_t *steals, uint64_t *parallelFors, uint64_t *graphsRun) {
+    const EditorJobs::Stats stats = EditorJobs::GetStats();
+    if (jobsExecuted) { *jobsExecuted = stats.jobsExecuted; }
+    if (steals) { *steals = stats.steals; }
+    if (parallelFors) { *parallelFors = stats.parallelFors; }
+    if (graphsRun) { *graphsRun = stats.graphsRun; }
+}
@@ -0,0 +1,38 @@
+/// EditorJobs.swift
+/// Defines the Swift entry points into the editor job system.
+/// Created by Kaden Cringle.
+
+import Foundation
+
+/// Bodies run on job threads; they must only touch data they own or that no other thread writes
+/// while the call is in flight. The call returns after every chunk has finished.
+enum EditorJobs {
+    static var workerCount: Int { Int(MCEJobsWorkerCount()) }
+
+    static func parallelFor(count: Int, grain: Int = 64, _ body: (Range<Int>) -> Void) {
+        guard count > 0 else { return }
+        withoutActuallyEscaping(body) { escapable in
+            var box = escapable
+            withUnsafeMutablePointer(to: &box) { pointer in
+                MCEJobsParallelFor(UInt32(clamping: count), UInt32(clamping: max(1, grain)), 0, pointer) { userData, begin, end in
+                    let body = userData!.assumingMemoryBound(to: ((Range<Int>) -> Void).self).pointee
+                    body(Int(begin)..<Int(end))
+                }
+            }
+        }
+    }
+
+    /// Each index writes only its own slot, so no synchronisation is needed on the result.
+    static func parallelMap<T>(count: Int, grain: Int = 64, _ transform: (Int) -> T) -> [T] {
+        guard count > 0 else { return [] }
+        return [T](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            let base = buffer.baseAddress!
+            parallelFor(count: count, grain: grain) { range in
+                for index in range {
+                    (base + index).initialize(to: transform(index))
+                }
+            }
+            initializedCount = count
+        }
+    }
+}
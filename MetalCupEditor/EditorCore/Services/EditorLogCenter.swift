@@ -8,11 +8,67 @@ import MetalCupEngine
 typealias EditorLogLevel = MCLogLevel
 typealias EditorLogCategory = MCLogCategory
 
+/// One record of a batched log read. Message bytes live in the caller's text buffer at
+/// `messageOffset`, `messageLength` bytes long, not NUL-terminated. `source` and `templateId`
+/// resolve through `MCEEditorLogGetSourceName` / `MCEEditorLogGetTemplate`.
+public struct MCELogRecordBridge {
+    public var sequence: UInt64
+    public var frameIndex: UInt64
+    public var timestamp: Double
+    public var level: Int32
+    public var category: Int32
+    public var source: Int32
+    public var templateId: Int32
+    public var messageOffset: Int32
+    public var messageLength: Int32
+}
+
 final class EditorLogCenter {
+    /// A log line stored as an interned template plus the variable parts cut out of it, so repeated
+    /// messages ("Saved scene: …", "Migrated 3 asset(s) …") share one template string.
+    struct Record {
+        let sequence: UInt64
+        let frameIndex: UInt64
+        let timestamp: Double
+        let level: Int32
+        let category: Int32
+        let sourceId: Int32
+        let templateId: Int32
+        let arguments: [String]
+    }
+
+    struct Stats {
+        var overwritten: UInt64 = 0
+        var truncatedReads: UInt64 = 0
+        var resyncs: UInt64 = 0
+    }
+
+    static let defaultCapacity = 1 << 20
+    static let maxTemplates = 1 << 16
+    static let maxSources = 256
+    /// Marks an argument slot inside a stored template; rendered as `{}` when templates are exported.
+    static let argumentMarker: Character = "\u{1F}"
+    private static let rawTemplateId: Int32 = 0
+
+    let capacity: Int
     private let engineLogger: EngineLogger
+    private var ring: [Record] = []
+    private var head = 0
+    private var nextSequence: UInt64 = 1
+    private var syncedRevision: UInt64 = 0
+    private var ingestedEngineCount = 0
+    private var lastIngested: (timestamp: Double, message: String)?
+    private var currentFrameIndex: UInt64 = 0
+    private var templates: [String] = [String(EditorLogCenter.argumentMarker)]
+    private var templateIds: [String: Int32] = [:]
+    private var sources: [String] = [""]
+    private var sourceIds: [String: Int32] = ["": 0]
+    private var pendingSources: [(message: String, sourceId: Int32)] = []
+    private(set) var stats = Stats()
 
-    init(engineLogger: EngineLogger) {
+    init(engineLogger: EngineLogger, capacity: Int = EditorLogCenter.defaultCapacity) {
         self.engineLogger = engineLogger
+        self.capacity = max(1, capacity)
     }
 
     func revisionToken() -> UInt64 {
@@ -21,21 +77,224 @@ final class EditorLogCenter {
 
     func clear() {
         engineLogger.clear()
+        ring.removeAll(keepingCapacity: false)
+        head = 0
+        ingestedEngineCount = 0
+        lastIngested = nil
+        pendingSources.removeAll()
+        syncedRevision = engineLogger.revisionToken()
+    }
+
+    /// Stamps entries logged so far with the previous frame, then starts attributing to `frameIndex`.
+    func beginFrame(_ frameIndex: UInt64) {
+        sync()
+        currentFrameIndex = frameIndex
+    }
+
+    /// Tags the next engine entry carrying `message` with `source`. The engine logger has no source
+    /// field, so the tag is matched up when the entry is ingested.
+    func expectSource(_ source: String, message: String) {
+        let sourceId = internSource(source)
+        guard sourceId != 0 else { return }
+        if pendingSources.count >= 64 {
+            pendingSources.removeFirst()
+        }
+        pendingSources.append((message, sourceId))
+    }
+
+    /// Sequence of the oldest retained record (equal to `nextSequenceValue` when empty).
+    var firstSequence: UInt64 {
+        sync()
+        return nextSequence - UInt64(ring.count)
+    }
+
+    var nextSequenceValue: UInt64 {
+        sync()
+        return nextSequence
     }
 
     func entryCount() -> Int {
-        return engineLogger.entryCount()
+        sync()
+        return ring.count
+    }
+
+    func entry(at index: Int) -> Record? {
+        sync()
+        guard index >= 0, index < ring.count else { return nil }
+        return ring[(head + index) % ring.count]
+    }
+
+    func record(sequence: UInt64) -> Record? {
+        let first = firstSequence
+        guard sequence >= first, sequence < nextSequence else { return nil }
+        return ring[(head + Int(sequence - first)) % ring.count]
+    }
+
+    func message(for record: Record) -> String {
+        guard record.templateId != Self.rawTemplateId else { return record.arguments.first ?? "" }
+        let template = templates[Int(record.templateId)]
+        var result = ""
+        result.reserveCapacity(template.utf8.count + record.arguments.reduce(0) { $0 + $1.utf8.count })
+        var argumentIndex = 0
+        for character in template {
+            if character == Self.argumentMarker, argumentIndex < record.arguments.count {
+                result += record.arguments[argumentIndex]
+                argumentIndex += 1
+            } else {
+                result.append(character)
+            }
+        }
+        return result
+    }
+
+    func templateText(_ templateId: Int32) -> String? {
+        guard templateId >= 0, Int(templateId) < templates.count else { return nil }
+        return templates[Int(templateId)].replacingOccurrences(of: String(Self.argumentMarker), with: "{}")
+    }
+
+    func sourceName(_ sourceId: Int32) -> String? {
+        guard sourceId >= 0, Int(sourceId) < sources.count else { return nil }
+        return sources[Int(sourceId)]
+    }
+
+    func noteTruncatedRead() {
+        stats.truncatedReads &+= 1
+    }
+
+    /// Pulls entries appended to the engine log since the last sync. The engine log only exposes
+    /// index access, so the last ingested entry is re-located to survive engine-side trimming.
+    private func sync() {
+        let revision = engineLogger.revisionToken()
+        if revision == syncedRevision { return }
+        syncedRevision = revision
+
+        let engineCount = engineLogger.entryCount()
+        var start = ingestedEngineCount
+        if let lastIngested, !isLastIngested(at: ingestedEngineCount - 1, lastIngested) {
+            start = 0
+            var index = engineCount - 1
+            while index >= 0 {
+                if isLastIngested(at: index, lastIngested) {
+                    start = index + 1
+                    break
+                }
+                index -= 1
+            }
+            stats.resyncs &+= 1
+        }
+        if start > engineCount { start = 0 }
+
+        var index = start
+        while index < engineCount {
+            if let entry = engineLogger.entry(at: index) {
+                append(level: entry.level.rawValue, category: entry.category.rawValue, timestamp: entry.timestamp, message: entry.message)
+            }
+            index += 1
+        }
+        ingestedEngineCount = engineCount
+        if engineCount > 0, let last = engineLogger.entry(at: engineCount - 1) {
+            lastIngested = (last.timestamp, last.message)
+        }
+    }
+
+    private func isLastIngested(at index: Int, _ marker: (timestamp: Double, message: String)) -> Bool {
+        guard index >= 0, let entry = engineLogger.entry(at: index) else { return false }
+        return entry.timestamp == marker.timestamp && entry.message == marker.message
+    }
+
+    private func append(level: Int32, category: Int32, timestamp: Double, message: String) {
+        var sourceId: Int32 = 0
+        if let pendingIndex = pendingSources.firstIndex(where: { $0.message == message }) {
+            sourceId = pendingSources[pendingIndex].sourceId
+            pendingSources.remove(at: pendingIndex)
+        }
+        let (templateId, arguments) = splitTemplate(message)
+        let record = Record(sequence: nextSequence,
+                            frameIndex: currentFrameIndex,
+                            timestamp: timestamp,
+                            level: level,
+                            category: category,
+                            sourceId: sourceId,
+                            templateId: templateId,
+                            arguments: arguments)
+        nextSequence &+= 1
+        if ring.count < capacity {
+            ring.append(record)
+        } else {
+            ring[head] = record
+            head = (head + 1) % capacity
+            stats.overwritten &+= 1
+        }
+    }
+
+    /// Cuts the variable parts out of a message: everything after the first ": " and any word in
+    /// the head containing a digit. Messages that cannot be templated are kept whole.
+    private func splitTemplate(_ message: String) -> (Int32, [String]) {
+        guard !message.contains(Self.argumentMarker) else { return (Self.rawTemplateId, [message]) }
+        var head = Substring(message)
+        var tail: Substring?
+        if let separator = message.range(of: ": ") {
+            head = message[..<separator.upperBound]
+            tail = message[separator.upperBound...]
+        }
+
+        var template = ""
+        var arguments: [String] = []
+        var word = Substring()
+        func flushWord() {
+            guard !word.isEmpty else { return }
+            if word.contains(where: { $0.isNumber }) {
+                template.append(Self.argumentMarker)
+                arguments.append(String(word))
+            } else {
+                template += word
+            }
+            word = Substring()
+        }
+        var wordStart = head.startIndex
+        var cursor = head.startIndex
+        while cursor < head.endIndex {
+            if head[cursor] == " " {
+                word = head[wordStart..<cursor]
+                flushWord()
+                template.append(" ")
+                wordStart = head.index(after: cursor)
+            }
+            cursor = head.index(after: cursor)
+        }
+        word = head[wordStart..<head.endIndex]
+        flushWord()
+        if let tail, !tail.isEmpty {
+            template.append(Self.argumentMarker)
+            arguments.append(String(tail))
+        }
+
+        if let existing = templateIds[template] {
+            return (existing, arguments)
+        }
+        guard templates.count < Self.maxTemplates else { return (Self.rawTemplateId, [message]) }
+        let templateId = Int32(templates.count)
+        templates.append(template)
+        templateIds[template] = templateId
+        return (templateId, arguments)
     }
 
-    func entry(at index: Int) -> MCLogEntry? {
-        return engineLogger.entry(at: index)
+    private func internSource(_ source: String) -> Int32 {
+        if let existing = sourceIds[source] {
+            return existing
+        }
+        guard sources.count < Self.maxSources else { return 0 }
+        let sourceId = Int32(sources.count)
+        sources.append(source)
+        sourceIds[source] = sourceId
+        return sourceId
     }
 }
 
 @_cdecl("MCEEditorLogCount")
 public func MCEEditorLogCount(_ contextPtr: UnsafeMutableRawPointer) -> Int32 {
     let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
-    return Int32(context.engineContext.log.entryCount())
+    return Int32(context.editorLogCenter.entryCount())
 }
 
 @_cdecl("MCEEditorLogEntryAt")
@@ -49,20 +308,133 @@ public func MCEEditorLogEntryAt(_ contextPtr: UnsafeMutableRawPointer,
     guard index >= 0, let messageBuffer, messageBufferSize > 0 else { return 0 }
     let idx = Int(index)
     let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
-    guard let entry = context.engineContext.log.entry(at: idx) else { return 0 }
-    levelOut?.pointee = entry.level.rawValue
-    categoryOut?.pointee = entry.category.rawValue
+    let logCenter = context.editorLogCenter
+    guard let entry = logCenter.entry(at: idx) else { return 0 }
+    levelOut?.pointee = entry.level
+    categoryOut?.pointee = entry.category
     timestampOut?.pointee = entry.timestamp
-    let length = min(Int(messageBufferSize - 1), entry.message.count)
-    entry.message.withCString { ptr in
+    let message = logCenter.message(for: entry)
+    let total = message.utf8.count
+    let length = message.withCString { ptr -> Int in
+        let length = utf8ClippedLength(ptr, limit: Int(messageBufferSize - 1), total: total)
         if length > 0 {
             memcpy(messageBuffer, ptr, length)
         }
+        return length
     }
     messageBuffer[length] = 0
     return 1
 }
 
+/// Byte count of the longest prefix of a `total`-byte UTF-8 string that fits in `limit` bytes without
+/// splitting a code point: a clip moves back while the first dropped byte is a continuation byte.
+private func utf8ClippedLength(_ bytes: UnsafePointer<CChar>, limit: Int, total: Int) -> Int {
+    guard limit < total else { return total }
+    var length = max(0, limit)
+    while length > 0 && (UInt8(bitPattern: bytes[length]) & 0xC0) == 0x80 {
+        length -= 1
+    }
+    return length
+}
+
+/// Copies records with `sequence > afterSequence` in order until either output buffer is full.
+/// Returns the number of records written; `nextAfterOut` receives the sequence to pass next time.
+/// A returned first sequence greater than `afterSequence + 1` means older records were overwritten.
+@_cdecl("MCEEditorLogReadSince")
+public func MCEEditorLogReadSince(_ contextPtr: UnsafeMutableRawPointer,
+                                  _ afterSequence: UInt64,
+                                  _ recordsOut: UnsafeMutableRawPointer?,
+                                  _ maxRecords: Int32,
+                                  _ textBuffer: UnsafeMutablePointer<CChar>?,
+                                  _ textBufferSize: Int32,
+                                  _ nextAfterOut: UnsafeMutablePointer<UInt64>?) -> Int32 {
+    let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
+    let logCenter = context.editorLogCenter
+    nextAfterOut?.pointee = afterSequence
+    guard let recordsOut, maxRecords > 0, let textBuffer, textBufferSize > 0 else { return 0 }
+    let records = recordsOut.assumingMemoryBound(to: MCELogRecordBridge.self)
+    let first = logCenter.firstSequence
+    let end = logCenter.nextSequenceValue
+    var sequence = max(afterSequence &+ 1, first)
+    var written: Int32 = 0
+    var textUsed = 0
+    let textCapacity = Int(textBufferSize)
+    while sequence < end && written < maxRecords {
+        guard let record = logCenter.record(sequence: sequence) else { break }
+        let message = logCenter.message(for: record)
+        let total = message.utf8.count
+        if textUsed + total > textCapacity {
+            // Always make progress: a single oversized message is clipped to the whole buffer.
+            if written > 0 { break }
+            logCenter.noteTruncatedRead()
+        }
+        let bytes = message.withCString { ptr -> Int in
+            let bytes = utf8ClippedLength(ptr, limit: textCapacity - textUsed, total: total)
+            if bytes > 0 {
+                memcpy(textBuffer + textUsed, ptr, bytes)
+            }
+            return bytes
+        }
+        records[Int(written)] = MCELogRecordBridge(sequence: record.sequence,
+                                                   frameIndex: record.frameIndex,
+                                                   timestamp: record.timestamp,
+                                                   level: record.level,
+                                                   category: record.category,
+                                                   source: record.sourceId,
+                                                   templateId: record.templateId,
+                                                   messageOffset: Int32(textUsed),
+                                                   messageLength: Int32(bytes))
+        textUsed += bytes
+        written += 1
+        nextAfterOut?.pointee = sequence
+        sequence += 1
+    }
+    return written
+}
+
+@_cdecl("MCEEditorLogGetWindow")
+public func MCEEditorLogGetWindow(_ contextPtr: UnsafeMutableRawPointer,
+                                  _ firstSequenceOut: UnsafeMutablePointer<UInt64>?,
+                                  _ nextSequenceOut: UnsafeMutablePointer<UInt64>?) {
+    let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
+    firstSequenceOut?.pointee = context.editorLogCenter.firstSequence
+    nextSequenceOut?.pointee = context.editorLogCenter.nextSequenceValue
+}
+
+@_cdecl("MCEEditorLogGetStats")
+public func MCEEditorLogGetStats(_ contextPtr: UnsafeMutableRawPointer,
+                                 _ capacityOut: UnsafeMutablePointer<Int32>?,
+                                 _ retainedOut: UnsafeMutablePointer<Int32>?,
+                                 _ overwrittenOut: UnsafeMutablePointer<UInt64>?,
+                                 _ truncatedReadsOut: UnsafeMutablePointer<UInt64>?) {
+    let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
+    let logCenter = context.editorLogCenter
+    capacityOut?.pointee = Int32(logCenter.capacity)
+    retainedOut?.pointee = Int32(logCenter.entryCount())
+    overwrittenOut?.pointee = logCenter.stats.overwritten
+    truncatedReadsOut?.pointee = logCenter.stats.truncatedReads
+}
+
+@_cdecl("MCEEditorLogGetTemplate")
+public func MCEEditorLogGetTemplate(_ contextPtr: UnsafeMutableRawPointer,
+                                    _ templateId: Int32,
+                                    _ buffer: UnsafeMutablePointer<CChar>?,
+                                    _ bufferSize: Int32) -> Int32 {
+    let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
+    guard let text = context.editorLogCenter.templateText(templateId) else { return 0 }
+    return EditorBridgeInternals.cStringWrite(text, to: buffer, max: bufferSize)
+}
+
+@_cdecl("MCEEditorLogGetSourceName")
+public func MCEEditorLogGetSourceName(_ contextPtr: UnsafeMutableRawPointer,
+                                      _ sourceId: Int32,
+                                      _ buffer: UnsafeMutablePointer<CChar>?,
+                                      _ bufferSize: Int32) -> Int32 {
+    let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
+    guard let name = context.editorLogCenter.sourceName(sourceId) else { return 0 }
+    return EditorBridgeInternals.cStringWrite(name, to: buffer, max: bufferSize)
+}
+
 @_cdecl("MCEEditorLogRevision")
 public func MCEEditorLogRevision(_ contextPtr: UnsafeMutableRawPointer) -> UInt64 {
     let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
@@ -87,3 +459,17 @@ public func MCEEditorLogMessage(_ contextPtr: UnsafeMutableRawPointer,
     let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
     context.engineContext.log.log(value, level: resolvedLevel, category: resolvedCategory)
 }
+
+@_cdecl("MCEEditorLogMessageWithSource")
+public func MCEEditorLogMessageWithSource(_ contextPtr: UnsafeMutableRawPointer,
+                                          _ level: Int32,
+                                          _ category: Int32,
+                                          _ source: UnsafePointer<CChar>?,
+                                          _ message: UnsafePointer<CChar>?) {
+    guard let message else { return }
+    let context = Unmanaged<MCEContext>.fromOpaque(contextPtr).takeUnretainedValue()
+    if let source {
+        context.editorLogCenter.expectSource(String(cString: source), message: String(cString: message))
+    }
+    MCEEditorLogMessage(contextPtr, level, category, message)
+}
@@ -0,0 +1,131 @@
+/// EditorProfilerHistory.h
+/// Defines the long-window profiler metric history, percentile summaries, and spike capture.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include "EditorTrace.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace EditorProfilerHistory {
+enum Metric : int32_t {
+    MetricFrameInterval = 0,
+    MetricFrame,
+    MetricGpu,
+    MetricUpdate,
+    MetricRender,
+    MetricPost,
+    MetricCount
+};
+
+const char *MetricName(Metric metric);
+
+struct Summary {
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float max = 0.0f;
+    float mean = 0.0f;
+    uint64_t count = 0;
+};
+
+/// Log-bucketed histogram (about 1% relative error from 1 us to 60 s). Unlike a t-digest it can
+/// remove samples, so percentiles always describe exactly the retained window.
+class LogHistogram {
+public:
+    LogHistogram();
+    void Add(float valueMs);
+    void Remove(float valueMs);
+    void Clear();
+    uint64_t Count() const { return _count; }
+    /// Fills p50/p95/p99 in one pass over the buckets.
+    void Percentiles(float &p50, float &p95, float &p99) const;
+
+private:
+    static int32_t BucketFor(float valueMs);
+    static float BucketValue(int32_t bucket);
+
+    std::vector<uint32_t> _buckets;
+    uint64_t _count = 0;
+};
+
+/// Samples for one metric over the history window, with an exact sliding max.
+class MetricSeries {
+public:
+    void Push(uint64_t serial, float valueMs);
+    void PopFront();
+    void Clear();
+    Summary Summarize() const;
+    const std::deque<float> &Samples() const { return _samples; }
+
+private:
+    std::deque<float> _samples;
+    uint64_t _firstSerial = 0;
+    // Serials with non-increasing values; the front is the window max.
+    std::deque<std::pair<uint64_t, float>> _maxCandidates;
+    LogHistogram _histogram;
+    double _sum = 0.0;
+};
+
+struct SpikeSettings {
+    bool enabled = true;
+    float thresholdMs = 100.0f;
+    int32_t framesBefore = 30;
+    int32_t framesAfter = 30;
+    int32_t maxCapturesPerSession = 32;
+};
+
+struct SpikeRecord {
+    uint64_t frameIndex = 0;
+    float frameMs = 0.0f;
+    std::string path;
+};
+
+/// Main-thread only. Sample once per frame; the frame interval and spike detection read the newest
+/// frame from EditorTrace::History(), so spikes are captured whether or not the panel is open.
+class History {
+public:
+    void SetWindowSeconds(float seconds);
+    float WindowSeconds() const { return _windowSeconds; }
+    /// `values` holds MetricCount entries; MetricFrameInterval is filled in from the trace history.
+    void Sample(double timeSeconds, float values[MetricCount]);
+    void Clear();
+
+    Summary Summarize(Metric metric) const { return _series[metric].Summarize(); }
+    const std::deque<float> &Samples(Metric metric) const { return _series[metric].Samples(); }
+    double CoveredSeconds() const;
+
+    SpikeSettings &Spikes() { return _spikeSettings; }
+    /// Returns true once the frames after a pending spike have been recorded; `captureOut` then
+    /// holds the frames around it, ready to be written.
+    bool TakeSpikeCapture(EditorTrace::Capture &captureOut, SpikeRecord &recordOut);
+    void AddSpikeRecord(SpikeRecord record);
+    const std::vector<SpikeRecord> &SpikeRecords() const { return _spikeRecords; }
+    uint64_t SpikesDetected() const { return _spikesDetected; }
+
+private:
+    void Evict(double nowSeconds);
+
+    float _windowSeconds = 600.0f;
+    std::deque<double> _times;
+    uint64_t _nextSerial = 0;
+    MetricSeries _series[MetricCount];
+
+    uint64_t _lastTraceFrame = 0;
+    bool _hasTraceFrame = false;
+
+    SpikeSettings _spikeSettings;
+    bool _spikePending = false;
+    SpikeRecord _pendingSpike;
+    uint64_t _captureEndFrame = 0;
+    uint64_t _quietUntilFrame = 0;
+    uint64_t _spikesDetected = 0;
+    int32_t _capturesTaken = 0;
+    std::vector<SpikeRecord> _spikeRecords;
+};
+}
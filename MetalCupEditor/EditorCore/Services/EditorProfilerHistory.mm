@@ -0,0 +1,222 @@
+/// EditorProfilerHistory.mm
+/// Implements the long-window profiler metric history, percentile summaries, and spike capture.
+/// Created by Kaden Cringle.
+
+#include "EditorProfilerHistory.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr float kHistogramMinMs = 0.001f;
+constexpr float kHistogramMaxMs = 60000.0f;
+constexpr double kHistogramGrowth = 1.02;
+
+const double kInvLogGrowth = 1.0 / std::log(kHistogramGrowth);
+const int32_t kHistogramBucketCount =
+    static_cast<int32_t>(std::ceil(std::log(static_cast<double>(kHistogramMaxMs / kHistogramMinMs)) * kInvLogGrowth)) + 2;
+
+constexpr float kMinWindowSeconds = 10.0f;
+constexpr float kMaxWindowSeconds = 3600.0f;
+}
+
+namespace EditorProfilerHistory {
+const char *MetricName(Metric metric) {
+    switch (metric) {
+    case MetricFrameInterval: return "Frame Interval";
+    case MetricFrame: return "Frame";
+    case MetricGpu: return "GPU";
+    case MetricUpdate: return "Update";
+    case MetricRender: return "Render";
+    case MetricPost: return "Post";
+    default: return "?";
+    }
+}
+
+LogHistogram::LogHistogram() : _buckets(static_cast<size_t>(kHistogramBucketCount), 0) {}
+
+int32_t LogHistogram::BucketFor(float valueMs) {
+    if (!(valueMs > kHistogramMinMs)) { return 0; }
+    const int32_t bucket = 1 + static_cast<int32_t>(std::log(static_cast<double>(valueMs / kHistogramMinMs)) * kInvLogGrowth);
+    return std::min(bucket, kHistogramBucketCount - 1);
+}
+
+float LogHistogram::BucketValue(int32_t bucket) {
+    if (bucket <= 0) { return kHistogramMinMs; }
+    // Geometric midpoint of [min * g^(b-1), min * g^b).
+    return static_cast<float>(kHistogramMinMs * std::pow(kHistogramGrowth, static_cast<double>(bucket) - 0.5));
+}
+
+void LogHistogram::Add(float valueMs) {
+    _buckets[static_cast<size_t>(BucketFor(valueMs))] += 1;
+    _count += 1;
+}
+
+void LogHistogram::Remove(float valueMs) {
+    uint32_t &bucket = _buckets[static_cast<size_t>(BucketFor(valueMs))];
+    if (bucket == 0) { return; }
+    bucket -= 1;
+    _count -= 1;
+}
+
+void LogHistogram::Clear() {
+    std::fill(_buckets.begin(), _buckets.end(), 0);
+    _count = 0;
+}
+
+void LogHistogram::Percentiles(float &p50, float &p95, float &p99) const {
+    p50 = p95 = p99 = 0.0f;
+    if (_count == 0) { return; }
+    auto rankFor = [&](double quantile) {
+        return std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(_count))));
+    };
+    const uint64_t ranks[3] = { rankFor(0.50), rankFor(0.95), rankFor(0.99) };
+    float *outputs[3] = { &p50, &p95, &p99 };
+    int32_t next = 0;
+    uint64_t cumulative = 0;
+    for (int32_t bucket = 0; bucket < kHistogramBucketCount && next < 3; ++bucket) {
+        cumulative += _buckets[static_cast<size_t>(bucket)];
+        while (next < 3 && cumulative >= ranks[next]) {
+            *outputs[next] = BucketValue(bucket);
+            next += 1;
+        }
+    }
+}
+
+void MetricSeries::Push(uint64_t serial, float valueMs) {
+    if (_samples.empty()) { _firstSerial = serial; }
+    _samples.push_back(valueMs);
+    while (!_maxCandidates.empty() && _maxCandidates.back().second <= valueMs) {
+        _maxCandidates.pop_back();
+    }
+    _maxCandidates.emplace_back(serial, valueMs);
+    _histogram.Add(valueMs);
+    _sum += valueMs;
+}
+
+void MetricSeries::PopFront() {
+    if (_samples.empty()) { return; }
+    const float valueMs = _samples.front();
+    _samples.pop_front();
+    if (!_maxCandidates.empty() && _maxCandidates.front().first == _firstSerial) {
+        _maxCandidates.pop_front();
+    }
+    _firstSerial += 1;
+    _histogram.Remove(valueMs);
+    _sum -= valueMs;
+}
+
+void MetricSeries::Clear() {
+    _samples.clear();
+    _maxCandidates.clear();
+    _histogram.Clear();
+    _sum = 0.0;
+}
+
+Summary MetricSeries::Summarize() const {
+    Summary summary;
+    summary.count = _samples.size();
+    if (_samples.empty()) { return summary; }
+    _histogram.Percentiles(summary.p50, summary.p95, summary.p99);
+    summary.max = _maxCandidates.empty() ? 0.0f : _maxCandidates.front().second;
+    // Bucket midpoints can overshoot the exact max by up to half a bucket.
+    summary.p50 = std::min(summary.p50, summary.max);
+    summary.p95 = std::min(summary.p95, summary.max);
+    summary.p99 = std::min(summary.p99, summary.max);
+    summary.mean = static_cast<float>(_sum / static_cast<double>(_samples.size()));
+    return summary;
+}
+
+void History::SetWindowSeconds(float seconds) {
+    _windowSeconds = std::max(kMinWindowSeconds, std::min(seconds, kMaxWindowSeconds));
+    if (!_times.empty()) {
+        Evict(_times.back());
+    }
+}
+
+void History::Sample(double timeSeconds, float values[MetricCount]) {
+    const std::deque<EditorTrace::Frame> &traceFrames = EditorTrace::History();
+    values[MetricFrameInterval] = values[MetricFrame];
+    if (!traceFrames.empty()) {
+        const EditorTrace::Frame &frame = traceFrames.back();
+        if (!_hasTraceFrame || frame.frameIndex != _lastTraceFrame) {
+            _hasTraceFrame = true;
+            _lastTraceFrame = frame.frameIndex;
+            const float intervalMs = static_cast<float>(static_cast<double>(frame.endNs - frame.startNs) / 1.0e6);
+            values[MetricFrameInterval] = intervalMs;
+
+            if (_spikeSettings.enabled
+                && !_spikePending
+                && intervalMs > _spikeSettings.thresholdMs
+                && frame.frameIndex >= _quietUntilFrame
+                && _capturesTaken < _spikeSettings.maxCapturesPerSession) {
+                _spikePending = true;
+                _pendingSpike = SpikeRecord();
+                _pendingSpike.frameIndex = frame.frameIndex;
+                _pendingSpike.frameMs = intervalMs;
+                _captureEndFrame = frame.frameIndex + static_cast<uint64_t>(std::max(0, _spikeSettings.framesAfter));
+                _spikesDetected += 1;
+            } else if (_spikePending && intervalMs > _pendingSpike.frameMs) {
+                // Later, larger hitches inside the same window share its capture.
+                _pendingSpike.frameMs = intervalMs;
+            }
+        }
+    }
+
+    const uint64_t serial = _nextSerial++;
+    _times.push_back(timeSeconds);
+    for (int32_t metric = 0; metric < MetricCount; ++metric) {
+        _series[metric].Push(serial, values[metric]);
+    }
+    Evict(timeSeconds);
+}
+
+void History::Evict(double nowSeconds) {
+    const double oldest = nowSeconds - static_cast<double>(_windowSeconds);
+    while (!_times.empty() && _times.front() < oldest) {
+        _times.pop_front();
+        for (MetricSeries &series : _series) {
+            series.PopFront();
+        }
+    }
+}
+
+void History::Clear() {
+    _times.clear();
+    for (MetricSeries &series : _series) {
+        series.Clear();
+    }
+}
+
+double History::CoveredSeconds() const {
+    return _times.size() < 2 ? 0.0 : _times.back() - _times.front();
+}
+
+bool History::TakeSpikeCapture(EditorTrace::Capture &captureOut, SpikeRecord &recordOut) {
+    if (!_spikePending) { return false; }
+    const std::deque<EditorTrace::Frame> &traceFrames = EditorTrace::History();
+    if (traceFrames.empty() || traceFrames.back().frameIndex < _captureEndFrame) { return false; }
+
+    size_t anchor = traceFrames.size();
+    for (size_t i = traceFrames.size(); i > 0; --i) {
+        if (traceFrames[i - 1].frameIndex == _pendingSpike.frameIndex) {
+            anchor = i - 1;
+            break;
+        }
+    }
+    _spikePending = false;
+    if (anchor == traceFrames.size()) { return false; }
+
+    const size_t before = static_cast<size_t>(std::max(0, _spikeSettings.framesBefore));
+    const size_t count = std::min(traceFrames.size(), traceFrames.size() - anchor + before);
+    captureOut = EditorTrace::Snapshot(count);
+    recordOut = _pendingSpike;
+    _quietUntilFrame = traceFrames.back().frameIndex + 1;
+    _capturesTaken += 1;
+    return true;
+}
+
+void History::AddSpikeRecord(SpikeRecord record) {
+    _spikeRecords.push_back(std::move(record));
+}
+}
@@ -0,0 +1,95 @@
+/// EditorTrace.h
+/// Defines the nested, per-thread scope recorder behind the profiler timeline.
+/// Created by Kaden Cringle.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Returns a stable id for `name`; intern once per call site and reuse the id.
+uint32_t MCETraceInternName(const char *name);
+/// Begin/End pair on the calling thread. Recording is a single store into that thread's buffer.
+void MCETraceBegin(uint32_t nameId);
+void MCETraceEnd(void);
+/// Closes the current frame on the main thread: drains every thread buffer and files the
+/// completed scopes under the frame that just ended.
+void MCETraceFrameMark(uint64_t frameIndex);
+void MCETraceSetEnabled(uint32_t enabled);
+uint32_t MCETraceIsEnabled(void);
+
+#ifdef __cplusplus
+}
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace EditorTrace {
+struct Scope {
+    uint64_t startNs = 0;
+    uint64_t endNs = 0;
+    uint32_t nameId = 0;
+    uint16_t threadIndex = 0;
+    uint16_t depth = 0;
+};
+
+struct Frame {
+    uint64_t frameIndex = 0;
+    uint64_t startNs = 0;
+    uint64_t endNs = 0;
+    std::vector<Scope> scopes;
+};
+
+struct ThreadInfo {
+    uint64_t osThreadId = 0;
+    std::string name;
+};
+
+/// Self-contained copy of recorded frames with the name and thread tables they refer to.
+struct Capture {
+    std::vector<std::string> names;
+    std::vector<ThreadInfo> threads;
+    std::vector<Frame> frames;
+};
+
+struct Stats {
+    uint64_t droppedEvents = 0;
+    uint32_t threadCount = 0;
+    uint32_t retainedFrames = 0;
+};
+
+constexpr size_t kHistoryFrames = 300;
+
+/// Most recent frames, oldest first. Main thread only.
+const std::deque<Frame> &History();
+std::string NameFor(uint32_t nameId);
+Stats GetStats();
+Capture Snapshot(size_t frameCount);
+
+/// Chrome trace event JSON (chrome://tracing, Perfetto). Timestamps are relative to the first frame.
+bool WriteChromeJson(const Capture &capture, const std::string &path);
+/// Compact capture: "MCTRACE1" then LEB128 varints for the name table, thread table, and per
+/// frame (index, start delta, duration, scope count) followed by each scope as
+/// (name, thread, depth, zigzag start offset from frame start, duration).
+bool WriteBinary(const Capture &capture, const std::string &path);
+bool ReadBinary(const std::string &path, Capture &out);
+
+class ScopeGuard {
+public:
+    explicit ScopeGuard(uint32_t nameId) { MCETraceBegin(nameId); }
+    ~ScopeGuard() { MCETraceEnd(); }
+    ScopeGuard(const ScopeGuard &) = delete;
+    ScopeGuard &operator=(const ScopeGuard &) = delete;
+};
+}
+
+#define MCE_TRACE_CONCAT_INNER(a, b) a##b
+#define MCE_TRACE_CONCAT(a, b) MCE_TRACE_CONCAT_INNER(a, b)
+#define MCE_TRACE_SCOPE(name) \
+    static const uint32_t MCE_TRACE_CONCAT(mceTraceName, __LINE__) = MCETraceInternName(name); \
+    EditorTrace::ScopeGuard MCE_TRACE_CONCAT(mceTraceScope, __LINE__)(MCE_TRACE_CONCAT(mceTraceName, __LINE__))
+#endif
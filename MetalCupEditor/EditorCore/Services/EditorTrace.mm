@@ -0,0 +1,441 @@
+/// EditorTrace.mm
+/// Implements the nested, per-thread scope recorder behind the profiler timeline.
+/// Created by Kaden Cringle.
+
+#include "EditorTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <pthread.h>
+#include <unordered_map>
+
+namespace {
+constexpr uint32_t kThreadBufferCapacity = 1u << 14;
+
+struct TraceEvent {
+    uint64_t timestampNs;
+    uint32_t nameId;
+    uint32_t isBegin;
+};
+
+struct OpenScope {
+    uint32_t nameId;
+    uint64_t startNs;
+};
+
+/// Single-producer/single-consumer ring: the owning thread advances `head`, the frame mark on the
+/// main thread advances `tail`. Neither side takes a lock.
+struct ThreadBuffer {
+    TraceEvent events[kThreadBufferCapacity];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+    uint16_t threadIndex = 0;
+    // Producer only: begins skipped while full or disabled (and everything nested under them) so
+    // the matching ends are skipped too and pairs stay balanced.
+    uint32_t skippedDepth = 0;
+    // Producer only: recorded begins whose end has not been pushed yet. Each one keeps a slot
+    // reserved, so an end is never dropped after its begin made it into the ring.
+    uint32_t recordedDepth = 0;
+    // Consumer only.
+    std::vector<OpenScope> openScopes;
+};
+
+std::atomic<bool> gEnabled{true};
+
+std::mutex gRegistryMutex;
+std::vector<ThreadBuffer *> gThreadBuffers;
+std::vector<EditorTrace::ThreadInfo> gThreadInfos;
+
+std::mutex gNamesMutex;
+std::vector<std::string> gNames;
+std::unordered_map<std::string, uint32_t> gNameIds;
+
+std::deque<EditorTrace::Frame> gHistory;
+EditorTrace::Frame gCurrentFrame;
+bool gHasCurrentFrame = false;
+
+uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool IsMainThread() {
+#if defined(__APPLE__)
+    return pthread_main_np() != 0;
+#else
+    return false;
+#endif
+}
+
+uint64_t CurrentOSThreadId() {
+#if defined(__APPLE__)
+    uint64_t threadId = 0;
+    pthread_threadid_np(nullptr, &threadId);
+    return threadId;
+#else
+    return static_cast<uint64_t>(pthread_self());
+#endif
+}
+
+ThreadBuffer *RegisterCurrentThread() {
+    ThreadBuffer *buffer = new ThreadBuffer();
+    EditorTrace::ThreadInfo info;
+    info.osThreadId = CurrentOSThreadId();
+    char name[64] = {0};
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    info.name = name[0] != 0 ? name : (IsMainThread() ? "Main" : "Thread " + std::to_string(info.osThreadId));
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    buffer->threadIndex = static_cast<uint16_t>(gThreadBuffers.size());
+    gThreadBuffers.push_back(buffer);
+    gThreadInfos.push_back(std::move(info));
+    return buffer;
+}
+
+ThreadBuffer *CurrentThreadBuffer() {
+    // Buffers outlive their threads so the consumer never races a destructor.
+    thread_local ThreadBuffer *buffer = RegisterCurrentThread();
+    return buffer;
+}
+
+void Push(ThreadBuffer *buffer, uint32_t nameId, bool isBegin) {
+    const uint32_t head = buffer->head.load(std::memory_order_relaxed);
+    const uint32_t tail = buffer->tail.load(std::memory_order_acquire);
+    if (isBegin) {
+        // A begin needs its own slot plus one for its end, on top of the ends already reserved.
+        if (head - tail + buffer->recordedDepth + 2 > kThreadBufferCapacity) {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            buffer->skippedDepth += 1;
+            return;
+        }
+        buffer->recordedDepth += 1;
+    } else {
+        if (buffer->recordedDepth == 0) { return; }
+        buffer->recordedDepth -= 1;
+    }
+    TraceEvent &event = buffer->events[head % kThreadBufferCapacity];
+    event.timestampNs = NowNs();
+    event.nameId = nameId;
+    event.isBegin = isBegin ? 1u : 0u;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void Drain(ThreadBuffer *buffer, std::vector<EditorTrace::Scope> &scopesOut) {
+    uint32_t tail = buffer->tail.load(std::memory_order_relaxed);
+    const uint32_t head = buffer->head.load(std::memory_order_acquire);
+    while (tail != head) {
+        const TraceEvent &event = buffer->events[tail % kThreadBufferCapacity];
+        if (event.isBegin != 0) {
+            buffer->openScopes.push_back({event.nameId, event.timestampNs});
+        } else if (!buffer->openScopes.empty()) {
+            const OpenScope open = buffer->openScopes.back();
+            buffer->openScopes.pop_back();
+            EditorTrace::Scope scope;
+            scope.startNs = open.startNs;
+            scope.endNs = event.timestampNs;
+            scope.nameId = open.nameId;
+            scope.threadIndex = buffer->threadIndex;
+            scope.depth = static_cast<uint16_t>(buffer->openScopes.size());
+            scopesOut.push_back(scope);
+        }
+        ++tail;
+    }
+    buffer->tail.store(tail, std::memory_order_release);
+}
+
+void WriteVarint(std::string &out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+bool ReadVarint(const std::string &in, size_t &cursor, uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (cursor >= in.size()) { return false; }
+        const uint8_t byte = static_cast<uint8_t>(in[cursor++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) { return true; }
+    }
+    return false;
+}
+
+void WriteString(std::string &out, const std::string &value) {
+    WriteVarint(out, value.size());
+    out += value;
+}
+
+bool ReadString(const std::string &in, size_t &cursor, std::string &value) {
+    uint64_t length = 0;
+    if (!ReadVarint(in, cursor, length) || length > in.size() - cursor) { return false; }
+    value.assign(in, cursor, static_cast<size_t>(length));
+    cursor += static_cast<size_t>(length);
+    return true;
+}
+
+uint64_t ZigZag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t UnZigZag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void AppendJsonString(std::string &out, const std::string &value) {
+    out.push_back('"');
+    for (const char c : value) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                out += escaped;
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+bool WriteFile(const std::string &path, const std::string &contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) { return false; }
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    return static_cast<bool>(file);
+}
+}
+
+extern "C" uint32_t MCETraceInternName(const char *name) {
+    const std::string key = name ? name : "";
+    std::lock_guard<std::mutex> lock(gNamesMutex);
+    auto it = gNameIds.find(key);
+    if (it != gNameIds.end()) { return it->second; }
+    const uint32_t nameId = static_cast<uint32_t>(gNames.size());
+    gNames.push_back(key);
+    gNameIds.emplace(key, nameId);
+    return nameId;
+}
+
+extern "C" void MCETraceBegin(uint32_t nameId) {
+    ThreadBuffer *buffer = CurrentThreadBuffer();
+    if (buffer->skippedDepth > 0 || !gEnabled.load(std::memory_order_relaxed)) {
+        buffer->skippedDepth += 1;
+        return;
+    }
+    Push(buffer, nameId, true);
+}
+
+extern "C" void MCETraceEnd(void) {
+    ThreadBuffer *buffer = CurrentThreadBuffer();
+    if (buffer->skippedDepth > 0) {
+        buffer->skippedDepth -= 1;
+        return;
+    }
+    Push(buffer, 0, false);
+}
+
+extern "C" void MCETraceFrameMark(uint64_t frameIndex) {
+    const uint64_t now = NowNs();
+    std::vector<ThreadBuffer *> buffers;
+    {
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+        buffers = gThreadBuffers;
+    }
+    for (ThreadBuffer *buffer : buffers) {
+        Drain(buffer, gCurrentFrame.scopes);
+    }
+    if (gHasCurrentFrame) {
+        gCurrentFrame.endNs = now;
+        gHistory.push_back(std::move(gCurrentFrame));
+        while (gHistory.size() > EditorTrace::kHistoryFrames) {
+            gHistory.pop_front();
+        }
+    }
+    gCurrentFrame = EditorTrace::Frame();
+    gCurrentFrame.frameIndex = frameIndex;
+    gCurrentFrame.startNs = now;
+    gHasCurrentFrame = true;
+}
+
+extern "C" void MCETraceSetEnabled(uint32_t enabled) {
+    gEnabled.store(enabled != 0, std::memory_order_relaxed);
+}
+
+extern "C" uint32_t MCETraceIsEnabled(void) {
+    return gEnabled.load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+namespace EditorTrace {
+const std::deque<Frame> &History() {
+    return gHistory;
+}
+
+std::string NameFor(uint32_t nameId) {
+    std::lock_guard<std::mutex> lock(gNamesMutex);
+    return nameId < gNames.size() ? gNames[nameId] : std::string();
+}
+
+Stats GetStats() {
+    Stats stats;
+    std::lock_guard<std::mutex> lock(gRegistryMutex);
+    for (const ThreadBuffer *buffer : gThreadBuffers) {
+        stats.droppedEvents += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    stats.threadCount = static_cast<uint32_t>(gThreadBuffers.size());
+    stats.retainedFrames = static_cast<uint32_t>(gHistory.size());
+    return stats;
+}
+
+Capture Snapshot(size_t frameCount) {
+    Capture capture;
+    {
+        std::lock_guard<std::mutex> lock(gNamesMutex);
+        capture.names = gNames;
+    }
+    {
+        std::lock_guard<std::mutex> lock(gRegistryMutex);
+        capture.threads = gThreadInfos;
+    }
+    const size_t count = std::min(frameCount, gHistory.size());
+    capture.frames.assign(gHistory.end() - static_cast<std::ptrdiff_t>(count), gHistory.end());
+    return capture;
+}
+
+bool WriteChromeJson(const Capture &capture, const std::string &path) {
+    if (capture.frames.empty()) { return false; }
+    const uint64_t originNs = capture.frames.front().startNs;
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    auto separator = [&]() {
+        if (!first) { out += ",\n"; }
+        first = false;
+    };
+    char number[96];
+    for (size_t i = 0; i < capture.threads.size(); ++i) {
+        separator();
+        snprintf(number, sizeof(number), "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":", i);
+        out += number;
+        AppendJsonString(out, capture.threads[i].name);
+        out += "}}";
+    }
+    for (const Frame &frame : capture.frames) {
+        separator();
+        snprintf(number, sizeof(number), "{\"ph\":\"X\",\"name\":\"Frame %llu\",\"cat\":\"frame\",\"pid\":1,\"tid\":\"frames\",",
+                 static_cast<unsigned long long>(frame.frameIndex));
+        out += number;
+        snprintf(number, sizeof(number), "\"ts\":%.3f,\"dur\":%.3f}",
+                 static_cast<double>(frame.startNs - originNs) / 1000.0,
+                 static_cast<double>(frame.endNs - frame.startNs) / 1000.0);
+        out += number;
+        for (const Scope &scope : frame.scopes) {
+            separator();
+            out += "{\"ph\":\"X\",\"name\":";
+            AppendJsonString(out, scope.nameId < capture.names.size() ? capture.names[scope.nameId] : std::string("?"));
+            const double startUs = (static_cast<double>(scope.startNs) - static_cast<double>(originNs)) / 1000.0;
+            snprintf(number, sizeof(number), ",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                     static_cast<unsigned>(scope.threadIndex),
+                     startUs,
+                     static_cast<double>(scope.endNs - scope.startNs) / 1000.0);
+            out += number;
+        }
+    }
+    out += "\n]}\n";
+    return WriteFile(path, out);
+}
+
+bool WriteBinary(const Capture &capture, const std::string &path) {
+    std::string out = "MCTRACE1";
+    WriteVarint(out, capture.names.size());
+    for (const std::string &name : capture.names) {
+        WriteString(out, name);
+    }
+    WriteVarint(out, capture.threads.size());
+    for (const ThreadInfo &thread : capture.threads) {
+        WriteVarint(out, thread.osThreadId);
+        WriteString(out, thread.name);
+    }
+    WriteVarint(out, capture.frames.size());
+    uint64_t previousStart = 0;
+    for (const Frame &frame : capture.frames) {
+        WriteVarint(out, frame.frameIndex);
+        WriteVarint(out, ZigZag(static_cast<int64_t>(frame.startNs - previousStart)));
+        WriteVarint(out, frame.endNs - frame.startNs);
+        WriteVarint(out, frame.scopes.size());
+        previousStart = frame.startNs;
+        for (const Scope &scope : frame.scopes) {
+            WriteVarint(out, scope.nameId);
+            WriteVarint(out, scope.threadIndex);
+            WriteVarint(out, scope.depth);
+            WriteVarint(out, ZigZag(static_cast<int64_t>(scope.startNs - frame.startNs)));
+            WriteVarint(out, scope.endNs - scope.startNs);
+        }
+    }
+    return WriteFile(path, out);
+}
+
+bool ReadBinary(const std::string &path, Capture &out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) { return false; }
+    const std::string in((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (in.compare(0, 8, "MCTRACE1") != 0) { return false; }
+    size_t cursor = 8;
+    Capture capture;
+    uint64_t count = 0;
+    if (!ReadVarint(in, cursor, count)) { return false; }
+    capture.names.resize(static_cast<size_t>(std::min<uint64_t>(count, in.size())));
+    for (std::string &name : capture.names) {
+        if (!ReadString(in, cursor, name)) { return false; }
+    }
+    if (!ReadVarint(in, cursor, count)) { return false; }
+    capture.threads.resize(static_cast<size_t>(std::min<uint64_t>(count, in.size())));
+    for (ThreadInfo &thread : capture.threads) {
+        if (!ReadVarint(in, cursor, thread.osThreadId) || !ReadString(in, cursor, thread.name)) { return false; }
+    }
+    if (!ReadVarint(in, cursor, count)) { return false; }
+    capture.frames.resize(static_cast<size_t>(std::min<uint64_t>(count, in.size())));
+    uint64_t previousStart = 0;
+    for (Frame &frame : capture.frames) {
+        uint64_t startDelta = 0;
+        uint64_t duration = 0;
+        uint64_t scopeCount = 0;
+        if (!ReadVarint(in, cursor, frame.frameIndex) || !ReadVarint(in, cursor, startDelta) ||
+            !ReadVarint(in, cursor, duration) || !ReadVarint(in, cursor, scopeCount)) {
+            return false;
+        }
+        frame.startNs = previousStart + static_cast<uint64_t>(UnZigZag(startDelta));
+        frame.endNs = frame.startNs + duration;
+        previousStart = frame.startNs;
+        frame.scopes.resize(static_cast<size_t>(std::min<uint64_t>(scopeCount, in.size())));
+        for (Scope &scope : frame.scopes) {
+            uint64_t nameId = 0;
+            uint64_t threadIndex = 0;
+            uint64_t depth = 0;
+            uint64_t startOffset = 0;
+            uint64_t scopeDuration = 0;
+            if (!ReadVarint(in, cursor, nameId) || !ReadVarint(in, cursor, threadIndex) || !ReadVarint(in, cursor, depth) ||
+                !ReadVarint(in, cursor, startOffset) || !ReadVarint(in, cursor, scopeDuration)) {
+                return false;
+            }
+            scope.nameId = static_cast<uint32_t>(nameId);
+            scope.threadIndex = static_cast<uint16_t>(threadIndex);
+            scope.depth = static_cast<uint16_t>(depth);
+            scope.startNs = frame.startNs + static_cast<uint64_t>(UnZigZag(startOffset));
+            scope.endNs = scope.startNs + scopeDuration;
+        }
+    }
+    out = std::move(capture);
+    return true;
+}
+}
@@ -0,0 +1,59 @@
+/// EditorTraceScopes.swift
+/// Defines the Swift-side trace scope names and trace file helpers for the editor.
+/// Created by Kaden Cringle.
+
+import Foundation
+
+/// Trace names are interned once; Swift call sites pass the ids to `MCETraceBegin`.
+enum EditorTraceScopes {
+    static let editorUpdate = MCETraceInternName("Editor Update")
+    static let sceneUpdate = MCETraceInternName("Scene Update")
+    static let fixedUpdate = MCETraceInternName("Fixed Update")
+    static let fixedStep = MCETraceInternName("Fixed Step")
+    static let lateUpdate = MCETraceInternName("Late Update")
+    static let overlayRender = MCETraceInternName("Editor Overlay")
+    static let engineScope = MCETraceInternName("Engine Scope")
+    static let playEnter = MCETraceInternName("Enter Play")
+    static let playExit = MCETraceInternName("Exit Play")
+    static let simulateEnter = MCETraceInternName("Enter Simulate")
+    static let simulateReset = MCETraceInternName("Reset Simulate")
+    static let undoClose = MCETraceInternName("Undo Close")
+    static let undoApply = MCETraceInternName("Undo Apply")
+
+    @inline(__always)
+    static func measure<T>(_ nameId: UInt32, _ body: () throws -> T) rethrows -> T {
+        MCETraceBegin(nameId)
+        defer { MCETraceEnd() }
+        return try body()
+    }
+
+    static func exportURL(baseName: String, fileExtension: String) -> URL? {
+        guard let root = EditorFileSystem.tracesRootURL() else { return nil }
+        let formatter = DateFormatter()
+        formatter.locale = Locale(identifier: "en_US_POSIX")
+        formatter.dateFormat = "yyyyMMdd-HHmmss"
+        return root.appendingPathComponent("\(baseName)-\(formatter.string(from: Date())).\(fileExtension)")
+    }
+}
+
+@_cdecl("MCEEditorMakeTraceExportPath")
+public func MCEEditorMakeTraceExportPath(_ contextPtr: UnsafeRawPointer?,
+                                         _ baseName: UnsafePointer<CChar>?,
+                                         _ fileExtension: UnsafePointer<CChar>?,
+                                         _ buffer: UnsafeMutablePointer<CChar>?,
+                                         _ bufferSize: Int32) -> UInt32 {
+    guard let baseName, let fileExtension,
+          let url = EditorTraceScopes.exportURL(baseName: String(cString: baseName),
+                                                fileExtension: String(cString: fileExtension)) else { return 0 }
+    return EditorBridgeInternals.cStringWrite(url.path, to: buffer, max: bufferSize) > 0 ? 1 : 0
+}
+
+@_cdecl("MCEEditorChooseTraceCapture")
+public func MCEEditorChooseTraceCapture(_ contextPtr: UnsafeRawPointer?,
+                                        _ buffer: UnsafeMutablePointer<CChar>?,
+                                        _ bufferSize: Int32) -> UInt32 {
+    guard let url = EditorFileDialog.openFile(allowedExtensions: ["mctrace"],
+                                              directoryURL: EditorFileSystem.tracesRootURL(),
+                                              message: "Open Trace Capture") else { return 0 }
+    return EditorBridgeInternals.cStringWrite(url.path, to: buffer, max: bufferSize) > 0 ? 1 : 0
+}
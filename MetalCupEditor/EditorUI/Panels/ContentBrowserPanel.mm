@@ -8,6 +8,7 @@
 #import "PanelState.h"
 #import "../Widgets/UIWidgets.h"
 #import "../EditorIcons.h"
+#include "../../EditorCore/Services/EditorJobs.h"
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -46,14 +47,21 @@ extern "C" uint32_t MCEEditorDuplicateAsset(MCE_CTX,  const char *relativePath,
 extern "C" uint32_t MCEEditorDuplicateMaterial(MCE_CTX,  const char *handle, char *outHandle, int32_t outHandleSize);
 extern "C" uint32_t MCEEditorDeleteMaterial(MCE_CTX,  const char *handle);
 extern "C" uint32_t MCEEditorGetAssetPathForHandle(MCE_CTX,  const char *handle, char *buffer, int32_t bufferSize);
+extern "C" int32_t MCEEditorQueryAssetReferences(MCE_CTX, const char *handle, int32_t direction, uint32_t transitive);
+extern "C" uint32_t MCEEditorGetAssetReference(MCE_CTX, int32_t index,
+                                               char *handleBuffer, int32_t handleBufferSize,
+                                               char *relativePathBuffer, int32_t relativePathBufferSize,
+                                               int32_t *typeOut);
 extern "C" uint32_t MCEImportBeginForHandle(MCE_CTX, const char *handle);
 extern "C" uint32_t MCEImportCanReimportHandle(MCE_CTX, const char *handle);
+extern "C" int32_t MCEImportAnimationFolder(MCE_CTX, const char *relativePath);
 extern "C" uint32_t MCEEditorGetLastContentBrowserPath(MCE_CTX,  char *buffer, int32_t bufferSize);
 extern "C" void MCEEditorSetLastContentBrowserPath(MCE_CTX,  const char *value);
-extern "C" void MCEEditorLogMessage(MCE_CTX,  int32_t level, int32_t category, const char *message);
+extern "C" void MCEEditorLogMessageWithSource(MCE_CTX, int32_t level, int32_t category, const char *source, const char *message);
 extern "C" void *MCEContextGetUIPanelState(MCE_CTX);
 
 namespace {
+    using MCEPanelState::AssetReferenceEntry;
     using MCEPanelState::AssetType;
     using MCEPanelState::AssetEnvironment;
     using MCEPanelState::AssetMaterial;
@@ -171,7 +179,7 @@ namespace {
     }
 
     void LogAssetError(void *context, const std::string &message) {
-        MCEEditorLogMessage(context, 2, 3, message.c_str());
+        MCEEditorLogMessageWithSource(context, 2, 3, "ContentBrowser", message.c_str());
     }
 
     void BeginRename(ContentBrowserState &state, const BrowserEntry &entry) {
@@ -286,13 +294,25 @@ namespace {
             state.filteredSearch != search ||
             state.filteredSort != state.sort ||
             state.filteredAscending != state.sortAscending) {
-            state.filteredEntries = GetDirectoryEntries(context, state, state.currentPath);
-            if (!search.empty()) {
-                state.filteredEntries.erase(std::remove_if(state.filteredEntries.begin(), state.filteredEntries.end(),
-                    [&](const BrowserEntry &entry) {
-                        return entry.displayNameLower.find(search) == std::string::npos;
-                    }),
-                    state.filteredEntries.end());
+            const std::vector<BrowserEntry> &source = GetDirectoryEntries(context, state, state.currentPath);
+            if (search.empty()) {
+                state.filteredEntries = source;
+            } else {
+                // Substring matching runs over the job system once the folder is big enough for the
+                // measured match cost to pay for it; only matching entries are copied.
+                static EditorJobs::LoopCost searchCost;
+                std::vector<uint8_t> matches(source.size(), 0);
+                EditorJobs::ParallelFor(static_cast<uint32_t>(source.size()), searchCost, [&](uint32_t begin, uint32_t end) {
+                    for (uint32_t i = begin; i < end; ++i) {
+                        matches[i] = source[i].displayNameLower.find(search) != std::string::npos ? 1 : 0;
+                    }
+                });
+                state.filteredEntries.clear();
+                for (size_t i = 0; i < source.size(); ++i) {
+                    if (matches[i] != 0) {
+                        state.filteredEntries.push_back(source[i]);
+                    }
+                }
             }
             std::sort(state.filteredEntries.begin(), state.filteredEntries.end(), [&](const BrowserEntry &a, const BrowserEntry &b) {
                 if (state.sort == SortByType) {
@@ -426,6 +446,73 @@ namespace {
         SelectEntry(context, state, entry, false);
     }
 
+    std::vector<AssetReferenceEntry> QueryAssetReferences(void *context, const std::string &handle, int32_t direction, bool transitive) {
+        std::vector<AssetReferenceEntry> references;
+        const int32_t count = MCEEditorQueryAssetReferences(context, handle.c_str(), direction, transitive ? 1 : 0);
+        references.reserve(static_cast<size_t>(std::max(count, 0)));
+        for (int32_t i = 0; i < count; ++i) {
+            char handleBuffer[64] = {0};
+            char pathBuffer[512] = {0};
+            int32_t type = AssetUnknown;
+            if (MCEEditorGetAssetReference(context, i, handleBuffer, sizeof(handleBuffer), pathBuffer, sizeof(pathBuffer), &type) == 0) {
+                continue;
+            }
+            references.push_back(AssetReferenceEntry { handleBuffer, pathBuffer, type });
+        }
+        std::sort(references.begin(), references.end(), [](const AssetReferenceEntry &a, const AssetReferenceEntry &b) {
+            return a.relativePath < b.relativePath;
+        });
+        return references;
+    }
+
+    void DrawAssetReferenceList(void *context, ContentBrowserState &state, const std::vector<AssetReferenceEntry> &references) {
+        if (references.empty()) {
+            ImGui::TextDisabled("None");
+            return;
+        }
+        for (const AssetReferenceEntry &reference : references) {
+            ImGui::PushID(reference.handle.c_str());
+            const bool selected = state.selectedHandle == reference.handle;
+            if (ImGui::Selectable(reference.relativePath.c_str(), selected)) {
+                const size_t slash = reference.relativePath.find_last_of('/');
+                const std::string folder = slash == std::string::npos ? std::string() : reference.relativePath.substr(0, slash);
+                if (folder != state.currentPath) {
+                    NavigateTo(context, state, folder);
+                }
+                state.selectedPath = reference.relativePath;
+                state.selectedHandle = reference.handle;
+                state.selectedType = reference.type;
+                state.selectedIsDirectory = false;
+            }
+            ImGui::SameLine();
+            ImGui::TextDisabled("%s", AssetTypeLabel(reference.type));
+            ImGui::PopID();
+        }
+    }
+
+    void DrawAssetReferencesWindow(void *context, ContentBrowserState &state) {
+        if (!state.referencesOpen) { return; }
+        if (state.referencesRevision != state.lastAssetRevision) {
+            state.referencesUsedBy = QueryAssetReferences(context, state.referencesHandle, 0, state.referencesTransitive);
+            state.referencesUses = QueryAssetReferences(context, state.referencesHandle, 1, state.referencesTransitive);
+            state.referencesRevision = state.lastAssetRevision;
+        }
+        ImGui::SetNextWindowSize(ImVec2(420.0f, 360.0f), ImGuiCond_FirstUseEver);
+        if (ImGui::Begin("Asset References", &state.referencesOpen)) {
+            ImGui::Text("%s", state.referencesLabel.c_str());
+            if (ImGui::Checkbox("Include indirect", &state.referencesTransitive)) {
+                state.referencesRevision = 0;
+            }
+            ImGui::Separator();
+            ImGui::Text("Used by (%d)", static_cast<int>(state.referencesUsedBy.size()));
+            DrawAssetReferenceList(context, state, state.referencesUsedBy);
+            ImGui::Separator();
+            ImGui::Text("Uses (%d)", static_cast<int>(state.referencesUses.size()));
+            DrawAssetReferenceList(context, state, state.referencesUses);
+        }
+        ImGui::End();
+    }
+
     void DrawEntryContextMenu(void *context, ContentBrowserState &state) {
         if (!state.contextTarget.valid) { return; }
         if (ImGui::BeginPopup("EntryContext")) {
@@ -484,6 +571,17 @@ namespace {
                     }
                 }
             }
+            if (entry.isDirectory && ImGui::MenuItem("Import Animations")) {
+                if (MCEImportAnimationFolder(context, entry.relativePath.c_str()) <= 0) {
+                    LogAssetError(context, "No animation-only FBX files were imported.");
+                }
+            }
+            if (!entry.isDirectory && !entry.handle.empty() && ImGui::MenuItem("Find References")) {
+                state.referencesHandle = entry.handle;
+                state.referencesLabel = entry.displayName;
+                state.referencesRevision = 0;
+                state.referencesOpen = true;
+            }
             if (ImGui::MenuItem("Delete")) {
                 state.deletePath = entry.relativePath;
                 state.deleteLabel = entry.displayName;
@@ -879,6 +977,8 @@ void ImGuiContentBrowserPanelDraw(void *context, bool *isOpen) {
         ImGui::EndTable();
     }
 
+    DrawAssetReferencesWindow(context, state);
+
     std::string deleteMessage;
     if (!state.deleteLabel.empty()) {
         if (state.deleteIsDirectory) {
@@ -903,7 +1003,7 @@ void ImGuiContentBrowserPanelDraw(void *context, bool *isOpen) {
         if (deleted) {
             if (state.deleteType == AssetMaterial && !state.deletePath.empty()) {
                 std::string message = "Deleted material: " + state.deletePath;
-                MCEEditorLogMessage(context, 1, 3, message.c_str());
+                MCEEditorLogMessageWithSource(context, 1, 3, "ContentBrowser", message.c_str());
             }
             if (state.selectedPath == state.deletePath) {
                 state.selectedPath.clear();
@@ -9,6 +9,7 @@
 #import "../Widgets/UIWidgets.h"
 #import "../Widgets/UIConstants.h"
 #import "../EditorIcons.h"
+#import "../../EditorCore/Bridge/EditorEntityHandle.h"
 #include <string.h>
 #include <stdint.h>
 #include <string>
@@ -32,27 +33,9 @@ extern "C" uint32_t MCEEditorSetActiveSky(MCE_CTX,  const char *entityId);
 extern "C" int32_t MCEEditorGetEntityName(MCE_CTX,  const char *entityId, char *buffer, int32_t bufferSize);
 extern "C" void MCEEditorSetEntityName(MCE_CTX,  const char *entityId, const char *name);
 
-extern "C" uint32_t MCEEditorGetTransform(MCE_CTX,  const char *entityId, float *px, float *py, float *pz,
-                                          float *rx, float *ry, float *rz,
-                                          float *sx, float *sy, float *sz);
 extern "C" void MCEEditorSetTransform(MCE_CTX,  const char *entityId, float px, float py, float pz,
                                       float rx, float ry, float rz,
                                       float sx, float sy, float sz);
-extern "C" uint32_t MCEEditorGetCamera(MCE_CTX,  const char *entityId,
-                                       int32_t *projectionType,
-                                       float *fovDegrees,
-                                       float *orthoSize,
-                                       float *nearPlane,
-                                       float *farPlane,
-                                       uint32_t *isPrimary,
-                                       uint32_t *isEditor);
-extern "C" void MCEEditorSetCamera(MCE_CTX,  const char *entityId,
-                                   int32_t projectionType,
-                                   float fovDegrees,
-                                   float orthoSize,
-                                   float nearPlane,
-                                   float farPlane,
-                                   uint32_t isPrimary);
 extern "C" uint32_t MCEEditorGetReflectionProbe(MCE_CTX,  const char *entityId,
                                                 uint32_t *enabled,
                                                 float *boxExtentsX,
@@ -78,20 +61,6 @@ extern "C" void MCEEditorSetReflectionProbe(MCE_CTX,  const char *entityId,
 extern "C" uint32_t MCEEditorGetReflectionProbeRuntimeStatus(MCE_CTX,  const char *entityId, int32_t *statusOut);
 extern "C" uint32_t MCEEditorRequestReflectionProbeRebuild(MCE_CTX,  const char *entityId);
 extern "C" uint32_t MCEEditorRequestAllReflectionProbeRebuilds(MCE_CTX);
-extern "C" uint32_t MCEEditorGetCameraExposure(MCE_CTX, const char *entityId,
-                                               uint32_t *autoExposureEnabled,
-                                               float *exposureEV,
-                                               float *exposureCompensation,
-                                               float *autoExposureMin,
-                                               float *autoExposureMax,
-                                               float *adaptationSpeed);
-extern "C" void MCEEditorSetCameraExposure(MCE_CTX, const char *entityId,
-                                           uint32_t autoExposureEnabled,
-                                           float exposureEV,
-                                           float exposureCompensation,
-                                           float autoExposureMin,
-                                           float autoExposureMax,
-                                           float adaptationSpeed);
 
 extern "C" uint32_t MCEEditorGetMeshRenderer(MCE_CTX,  const char *entityId, char *meshHandle, int32_t meshHandleSize,
                                              char *materialHandle, int32_t materialHandleSize);
@@ -399,51 +368,6 @@ extern "C" void MCEEditorSetEnvironmentIBL(MCE_CTX, const char *entityId,
                                             uint32_t realtimeUpdate,
                                             uint32_t autoRebuildOnChange);
 extern "C" void MCEEditorRequestEnvironmentIBLRebuild(MCE_CTX, const char *entityId);
-extern "C" uint32_t MCEEditorGetRigidbody(MCE_CTX,  const char *entityId,
-                                          uint32_t *enabled,
-                                          int32_t *motionType,
-                                          float *mass,
-                                          float *friction,
-                                          float *restitution,
-                                          float *linearDamping,
-                                          float *angularDamping,
-                                          float *gravityFactor,
-                                          uint32_t *allowSleeping,
-                                          uint32_t *ccdEnabled,
-                                          int32_t *collisionLayer);
-extern "C" void MCEEditorSetRigidbody(MCE_CTX,  const char *entityId,
-                                      uint32_t enabled,
-                                      int32_t motionType,
-                                      float mass,
-                                      float friction,
-                                      float restitution,
-                                      float linearDamping,
-                                      float angularDamping,
-                                      float gravityFactor,
-                                      uint32_t allowSleeping,
-                                      uint32_t ccdEnabled,
-                                      int32_t collisionLayer);
-extern "C" uint32_t MCEEditorGetCollider(MCE_CTX,  const char *entityId,
-                                         uint32_t *enabled,
-                                         int32_t *shapeType,
-                                         float *boxX, float *boxY, float *boxZ,
-                                         float *sphereRadius,
-                                         float *capsuleHalfHeight,
-                                         float *capsuleRadius,
-                                         float *offsetX, float *offsetY, float *offsetZ,
-                                         float *rotX, float *rotY, float *rotZ,
-                                         uint32_t *isTrigger);
-extern "C" void MCEEditorSetCollider(MCE_CTX,  const char *entityId,
-                                     uint32_t enabled,
-                                     int32_t shapeType,
-                                     float boxX, float boxY, float boxZ,
-                                     float sphereRadius,
-                                     float capsuleHalfHeight,
-                                     float capsuleRadius,
-                                     float offsetX, float offsetY, float offsetZ,
-                                     float rotX, float rotY, float rotZ,
-                                     uint32_t isTrigger);
-extern "C" int32_t MCEEditorGetColliderShapeCount(MCE_CTX, const char *entityId);
 extern "C" void MCEEditorAddColliderShape(MCE_CTX, const char *entityId);
 extern "C" void MCEEditorRemoveColliderShape(MCE_CTX, const char *entityId, int32_t shapeIndex);
 extern "C" uint32_t MCEEditorGetColliderShape(MCE_CTX, const char *entityId,
@@ -592,25 +516,11 @@ extern "C" uint32_t MCEEditorGetMaterialAsset(MCE_CTX,
     char *roughnessHandle, int32_t roughnessHandleSize,
     char *aoHandle, int32_t aoHandleSize,
     char *emissiveHandle, int32_t emissiveHandleSize);
-extern "C" uint32_t MCEEditorSetMaterialAsset(MCE_CTX, 
-    const char *handle,
-    const char *name,
-    int32_t version,
-    float baseColorX, float baseColorY, float baseColorZ,
-    float metallic, float roughness, float ao,
-    float emissiveX, float emissiveY, float emissiveZ,
-    float emissiveIntensity,
-    float uvTilingX, float uvTilingY,
-    float uvOffsetX, float uvOffsetY,
-    int32_t alphaMode, float alphaCutoff,
-    uint32_t doubleSided, uint32_t unlit,
-    const char *baseColorHandle,
-    const char *normalHandle,
-    const char *metalRoughnessHandle,
-    const char *metallicHandle,
-    const char *roughnessHandle,
-    const char *aoHandle,
-    const char *emissiveHandle);
+extern "C" uint32_t MCEEditorPatchMaterialValues(MCE_CTX, const char *handle, int32_t field, const float *values, int32_t valueCount);
+extern "C" uint32_t MCEEditorPatchMaterialTexture(MCE_CTX, const char *handle, int32_t slot, const char *textureHandle);
+extern "C" uint32_t MCEEditorPatchMaterialName(MCE_CTX, const char *handle, const char *name);
+extern "C" int32_t MCEEditorFlushMaterialEdits(MCE_CTX, const char *handle);
+extern "C" void MCEEditorRevertMaterialEdits(MCE_CTX, const char *handle);
 extern "C" uint32_t MCEEditorGetAssetDisplayName(MCE_CTX,  const char *handle, char *buffer, int32_t bufferSize);
 extern "C" uint32_t MCEEditorGetImportedSkeletonHandleForMesh(MCE_CTX, const char *meshHandle, char *outHandle, int32_t outHandleSize);
 extern "C" int32_t MCEEditorGetImportedClipCountForMesh(MCE_CTX, const char *meshHandle);
@@ -681,6 +591,170 @@ namespace {
         return state->inspector;
     }
 
+    // Bit positions match EditorComponentBlocks.TransformField / CameraField / LightField / RigidbodyField.
+    // Collider commits use one bit per shape slot instead.
+    enum TransformBlockField : uint32_t {
+        TransformFieldPositionX = 0,
+        TransformFieldRotationX = 3,
+        TransformFieldScaleX = 6
+    };
+
+    enum CameraBlockField : uint32_t {
+        CameraFieldProjection = 0,
+        CameraFieldFov = 1,
+        CameraFieldOrthoSize = 2,
+        CameraFieldNear = 3,
+        CameraFieldFar = 4,
+        CameraFieldPrimary = 5,
+        CameraFieldExposureEV = 6
+    };
+
+    enum LightBlockField : uint32_t {
+        LightFieldType = 0,
+        LightFieldColor = 1,
+        LightFieldBrightness = 2,
+        LightFieldRange = 3,
+        LightFieldInnerCos = 4,
+        LightFieldOuterCos = 5,
+        LightFieldDirection = 6,
+        LightFieldCastsShadows = 7
+    };
+
+    enum RigidbodyBlockField : uint32_t {
+        RigidbodyFieldEnabled = 0,
+        RigidbodyFieldMotionType = 1,
+        RigidbodyFieldMass = 2,
+        RigidbodyFieldFriction = 3,
+        RigidbodyFieldRestitution = 4,
+        RigidbodyFieldLinearDamping = 5,
+        RigidbodyFieldAngularDamping = 6,
+        RigidbodyFieldGravityFactor = 7,
+        RigidbodyFieldAllowSleeping = 8,
+        RigidbodyFieldCcdEnabled = 9,
+        RigidbodyFieldCollisionLayer = 10
+    };
+
+    // Refreshes `cache` for `handle`. The bridge answers "unchanged" without copying when the component's
+    // stamp still matches, which also holds during play for components the runtime left alone.
+    template <typename Block>
+    bool FetchComponentBlock(void *context, MCEEntityHandle handle, int32_t componentType, MCEPanelState::ComponentBlockCache<Block> &cache) {
+        const bool sameEntity = cache.valid && cache.handleHigh == handle.high && cache.handleLow == handle.low;
+        Block block = cache.block;
+        uint64_t revision = 0;
+        const uint32_t result = MCEEditorGetComponentBlock(context,
+                                                           handle,
+                                                           componentType,
+                                                           sameEntity ? cache.revision : 0,
+                                                           &block,
+                                                           static_cast<int32_t>(sizeof(Block)),
+                                                           &revision);
+        if (result == 2 && sameEntity) {
+            return true;
+        }
+        if (result != 1) {
+            cache.valid = false;
+            return false;
+        }
+        cache.handleHigh = handle.high;
+        cache.handleLow = handle.low;
+        cache.revision = revision;
+        cache.valid = true;
+        cache.block = block;
+        return true;
+    }
+
+    // Shows the edit immediately and drops the stamp, so next frame re-reads whatever the bridge actually
+    // stored (clamped values, or nothing when the write was rejected).
+    template <typename Block>
+    int32_t CommitComponentBlock(void *context, const MCEEntityHandle *handles, int32_t count, int32_t componentType,
+                                 MCEPanelState::ComponentBlockCache<Block> &cache, const Block &block, uint32_t dirtyMask) {
+        if (dirtyMask == 0 || count <= 0) { return 0; }
+        cache.block = block;
+        cache.revision = 0;
+        return MCEEditorCommitComponentBlock(context, handles, count, componentType, &block, static_cast<int32_t>(sizeof(Block)), dirtyMask);
+    }
+
+    uint32_t Vec3DirtyBits(const float before[3], const float after[3], uint32_t firstBit) {
+        uint32_t mask = 0;
+        for (uint32_t axis = 0; axis < 3; ++axis) {
+            if (before[axis] != after[axis]) {
+                mask |= 1u << (firstBit + axis);
+            }
+        }
+        return mask;
+    }
+
+    // Draws the shared Position / Rotation / Scale rows and returns the dirty mask of edited axes.
+    uint32_t DrawTransformBlockProperties(const char *tableId, MCEPanelState::TransformBlock &block, bool withTooltips) {
+        const float positionBefore[3] = {block.positionX, block.positionY, block.positionZ};
+        const float rotationBefore[3] = {block.rotationX * kRadToDeg, block.rotationY * kRadToDeg, block.rotationZ * kRadToDeg};
+        const float scaleBefore[3] = {block.scaleX, block.scaleY, block.scaleZ};
+        float position[3] = {positionBefore[0], positionBefore[1], positionBefore[2]};
+        float rotation[3] = {rotationBefore[0], rotationBefore[1], rotationBefore[2]};
+        float scale[3] = {scaleBefore[0], scaleBefore[1], scaleBefore[2]};
+        if (!EditorUI::BeginPropertyTable(tableId)) {
+            return 0;
+        }
+        if (withTooltips) {
+            EditorUI::SetNextPropertyInfoTooltip("Entity position in world space.\nUnits: meters.\nPerformance: none.\nPersistence: Scene.");
+        }
+        EditorUI::PropertyVec3("Position",
+                               position,
+                               0.0f,
+                               EditorUIConstants::kPositionStep,
+                               0.0f,
+                               0.0f,
+                               "%.3f",
+                               false,
+                               true);
+        if (withTooltips) {
+            EditorUI::SetNextPropertyInfoTooltip("Entity Euler rotation.\nUnits: degrees.\nPerformance: none.\nPersistence: Scene.");
+        }
+        EditorUI::PropertyVec3("Rotation (deg)",
+                               rotation,
+                               0.0f,
+                               EditorUIConstants::kRotationStepDeg,
+                               EditorUIConstants::kRotationMinDeg,
+                               EditorUIConstants::kRotationMaxDeg,
+                               "%.2f",
+                               true,
+                               true);
+        if (withTooltips) {
+            EditorUI::SetNextPropertyInfoTooltip("Entity local scale.\nUnits: scalar.\nPerformance: none.\nPersistence: Scene.");
+        }
+        EditorUI::PropertyVec3("Scale",
+                               scale,
+                               1.0f,
+                               EditorUIConstants::kScaleStep,
+                               0.0f,
+                               0.0f,
+                               "%.3f",
+                               false,
+                               true);
+        EditorUI::EndPropertyTable();
+
+        // Compare in display units so an untouched rotation axis never round-trips through degrees.
+        const uint32_t dirtyMask = Vec3DirtyBits(positionBefore, position, TransformFieldPositionX)
+            | Vec3DirtyBits(rotationBefore, rotation, TransformFieldRotationX)
+            | Vec3DirtyBits(scaleBefore, scale, TransformFieldScaleX);
+        if (dirtyMask == 0) {
+            return 0;
+        }
+        block.positionX = position[0];
+        block.positionY = position[1];
+        block.positionZ = position[2];
+        float *rotationFields[3] = {&block.rotationX, &block.rotationY, &block.rotationZ};
+        for (uint32_t axis = 0; axis < 3; ++axis) {
+            if ((dirtyMask & (1u << (TransformFieldRotationX + axis))) != 0) {
+                *rotationFields[axis] = rotation[axis] * kDegToRad;
+            }
+        }
+        block.scaleX = scale[0];
+        block.scaleY = scale[1];
+        block.scaleZ = scale[2];
+        return dirtyMask;
+    }
+
     enum AtmosphereWeatherTypeUI : int32_t {
         AtmosphereWeatherClear = 0,
         AtmosphereWeatherPartlyCloudy = 1,
@@ -1434,6 +1508,63 @@ namespace {
         }
     }
 
+    // Field and slot ids match EditorMaterialEditStore.Field / TextureSlot.
+    enum MaterialDeltaField : int32_t {
+        MaterialFieldBaseColor = 0,
+        MaterialFieldMetallic = 1,
+        MaterialFieldRoughness = 2,
+        MaterialFieldAO = 3,
+        MaterialFieldEmissiveColor = 4,
+        MaterialFieldEmissiveIntensity = 5,
+        MaterialFieldUVTiling = 6,
+        MaterialFieldUVOffset = 7,
+        MaterialFieldAlphaMode = 8,
+        MaterialFieldAlphaCutoff = 9,
+        MaterialFieldDoubleSided = 10,
+        MaterialFieldUnlit = 11
+    };
+
+    // Sends only the fields that differ between `before` and `after`. Returns the number of deltas sent.
+    int SendMaterialDeltas(void *context, const char *materialHandle, const MaterialEditorState &before, const MaterialEditorState &after) {
+        int sent = 0;
+        auto sendValues = [&](int32_t field, const float *oldValues, const float *newValues, int32_t count) {
+            if (memcmp(oldValues, newValues, sizeof(float) * static_cast<size_t>(count)) == 0) { return; }
+            sent += MCEEditorPatchMaterialValues(context, materialHandle, field, newValues, count) != 0 ? 1 : 0;
+        };
+        auto sendScalar = [&](int32_t field, float oldValue, float newValue) {
+            sendValues(field, &oldValue, &newValue, 1);
+        };
+        auto sendTexture = [&](int32_t slot, const char *oldHandle, const char *newHandle) {
+            if (strcmp(oldHandle, newHandle) == 0) { return; }
+            sent += MCEEditorPatchMaterialTexture(context, materialHandle, slot, newHandle) != 0 ? 1 : 0;
+        };
+
+        if (strcmp(before.name, after.name) != 0) {
+            sent += MCEEditorPatchMaterialName(context, materialHandle, after.name) != 0 ? 1 : 0;
+        }
+        sendValues(MaterialFieldBaseColor, before.baseColor, after.baseColor, 3);
+        sendScalar(MaterialFieldMetallic, before.metallic, after.metallic);
+        sendScalar(MaterialFieldRoughness, before.roughness, after.roughness);
+        sendScalar(MaterialFieldAO, before.ao, after.ao);
+        sendValues(MaterialFieldEmissiveColor, before.emissive, after.emissive, 3);
+        sendScalar(MaterialFieldEmissiveIntensity, before.emissiveIntensity, after.emissiveIntensity);
+        sendValues(MaterialFieldUVTiling, before.uvTiling, after.uvTiling, 2);
+        sendValues(MaterialFieldUVOffset, before.uvOffset, after.uvOffset, 2);
+        sendScalar(MaterialFieldAlphaMode, static_cast<float>(before.alphaMode), static_cast<float>(after.alphaMode));
+        sendScalar(MaterialFieldAlphaCutoff, before.alphaCutoff, after.alphaCutoff);
+        sendScalar(MaterialFieldDoubleSided, before.doubleSided ? 1.0f : 0.0f, after.doubleSided ? 1.0f : 0.0f);
+        sendScalar(MaterialFieldUnlit, before.unlit ? 1.0f : 0.0f, after.unlit ? 1.0f : 0.0f);
+
+        sendTexture(0, before.baseColorHandle, after.baseColorHandle);
+        sendTexture(1, before.normalHandle, after.normalHandle);
+        sendTexture(2, before.metalRoughnessHandle, after.metalRoughnessHandle);
+        sendTexture(3, before.metallicHandle, after.metallicHandle);
+        sendTexture(4, before.roughnessHandle, after.roughnessHandle);
+        sendTexture(5, before.aoHandle, after.aoHandle);
+        sendTexture(6, before.emissiveHandle, after.emissiveHandle);
+        return sent;
+    }
+
     MaterialPopupState &GetMaterialPopupState(InspectorState &state) {
         return state.materialPopup;
     }
@@ -1569,7 +1700,14 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
     }
 
     const bool hasEntityId = !selectedIds.empty() || (selectedEntityId && selectedEntityId[0] != 0);
-    const bool hasValidEntity = hasEntityId && (MCEEditorEntityExists(context, selectedEntityId) != 0);
+    MCEEntityHandle selectedHandle = MCEEntityHandleNull();
+    MCEEntityHandleFromId(selectedEntityId, &selectedHandle);
+    const bool hasValidEntity = hasEntityId && (MCEEditorEntityHandleIsValid(context, selectedHandle) != 0);
+    // One presence mask per frame replaces a string-keyed HasComponent round trip per section.
+    uint32_t selectedComponentMask = hasValidEntity ? MCEEditorGetComponentMaskH(context, selectedHandle) : 0;
+    const auto selectedHasComponent = [&](int32_t componentType) -> bool {
+        return (selectedComponentMask & (1u << componentType)) != 0;
+    };
     const bool isPlaying = MCESceneIsPlaying(context) != 0;
     const bool isSimulating = MCESceneIsSimulating(context) != 0;
     const bool runtimeLocked = isPlaying || isSimulating;
@@ -1594,7 +1732,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
 
     if (hasValidEntity) {
         char nameBuffer[256] = {0};
-        if (MCEEditorGetEntityName(context, selectedEntityId, nameBuffer, sizeof(nameBuffer)) <= 0) {
+        if (MCEEditorGetEntityNameH(context, selectedHandle, nameBuffer, sizeof(nameBuffer)) <= 0) {
             strncpy(nameBuffer, "Entity", sizeof(nameBuffer) - 1);
         }
         const float addButtonWidth = ImGui::CalcTextSize(EditorIcons::Glyph(EditorIcons::Id::Plus)).x + ImGui::GetStyle().FramePadding.x * 2.0f;
@@ -1636,7 +1774,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         ImGui::Separator();
     }
 
-    if (hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentReflectionProbe) != 0) {
+    if (hasValidEntity && selectedHasComponent(ComponentReflectionProbe)) {
         if (ImGui::CollapsingHeader("Reflection Probe Runtime", ImGuiTreeNodeFlags_DefaultOpen)) {
             int32_t runtimeStatus = -1;
             const bool hasRuntimeStatus = MCEEditorGetReflectionProbeRuntimeStatus(context, selectedEntityId, &runtimeStatus) != 0;
@@ -1683,9 +1821,13 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         ImGui::Text("Multiple selection (%d)", static_cast<int>(selectedIds.size()));
         ImGui::Separator();
 
-        bool allHaveTransform = true;
-        for (const std::string &id : selectedIds) {
-            if (MCEEditorEntityHasComponent(context, id.c_str(), ComponentTransform) == 0) {
+        std::vector<MCEEntityHandle> selectedHandles(selectedIds.size(), MCEEntityHandleNull());
+        const int32_t selectedHandleCount = std::min<int32_t>(
+            MCEEditorGetSelectedEntityHandles(context, selectedHandles.data(), static_cast<int32_t>(selectedHandles.size())),
+            static_cast<int32_t>(selectedHandles.size()));
+        bool allHaveTransform = selectedHandleCount > 0;
+        for (int32_t i = 0; i < selectedHandleCount; ++i) {
+            if (MCEEditorEntityHasComponentH(context, selectedHandles[i], ComponentTransform) == 0) {
                 allHaveTransform = false;
                 break;
             }
@@ -1699,52 +1841,16 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             return;
         }
 
-        float px = 0, py = 0, pz = 0;
-        float rx = 0, ry = 0, rz = 0;
-        float sx = 1, sy = 1, sz = 1;
-        if (MCEEditorGetTransform(context, selectedIds.front().c_str(), &px, &py, &pz, &rx, &ry, &rz, &sx, &sy, &sz) != 0) {
-            float position[3] = {px, py, pz};
-            float rotation[3] = {rx * kRadToDeg, ry * kRadToDeg, rz * kRadToDeg};
-            float scale[3] = {sx, sy, sz};
-            bool dirty = false;
-            if (EditorUI::BeginPropertyTable("TransformPropsMulti")) {
-                dirty |= EditorUI::PropertyVec3("Position",
-                                               position,
-                                               0.0f,
-                                               EditorUIConstants::kPositionStep,
-                                               0.0f,
-                                               0.0f,
-                                               "%.3f",
-                                               false,
-                                               true);
-                dirty |= EditorUI::PropertyVec3("Rotation (deg)",
-                                               rotation,
-                                               0.0f,
-                                               EditorUIConstants::kRotationStepDeg,
-                                               EditorUIConstants::kRotationMinDeg,
-                                               EditorUIConstants::kRotationMaxDeg,
-                                               "%.2f",
-                                               true,
-                                               true);
-                dirty |= EditorUI::PropertyVec3("Scale",
-                                               scale,
-                                               1.0f,
-                                               EditorUIConstants::kScaleStep,
-                                               0.0f,
-                                               0.0f,
-                                               "%.3f",
-                                               false,
-                                               true);
-                EditorUI::EndPropertyTable();
-            }
-            if (dirty) {
-                float rotationRad[3] = {rotation[0] * kDegToRad, rotation[1] * kDegToRad, rotation[2] * kDegToRad};
-                for (const std::string &id : selectedIds) {
-                    MCEEditorSetTransform(context, id.c_str(),
-                                          position[0], position[1], position[2],
-                                          rotationRad[0], rotationRad[1], rotationRad[2],
-                                          scale[0], scale[1], scale[2]);
-                }
+        // The primary selection is what the single-entity inspector shows, so its stamp stays warm across
+        // single and multi selection; the selection order is only a fallback when it is not in the scene.
+        const MCEEntityHandle primaryHandle = hasValidEntity ? selectedHandle : selectedHandles.front();
+        auto &transformCache = state.transformBlock;
+        if (FetchComponentBlock(context, primaryHandle, ComponentTransform, transformCache)) {
+            MCEPanelState::TransformBlock edited = transformCache.block;
+            // Only the axes the user touched are written, so each entity keeps its own values elsewhere.
+            const uint32_t dirtyMask = DrawTransformBlockProperties("TransformPropsMulti", edited, false);
+            if (dirtyMask != 0) {
+                CommitComponentBlock(context, selectedHandles.data(), selectedHandleCount, ComponentTransform, transformCache, edited, dirtyMask);
             }
         }
 
@@ -1786,7 +1892,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    if (hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentTransform) != 0) {
+    if (hasValidEntity && selectedHasComponent(ComponentTransform)) {
         bool transformOpen = EditorUI::BeginSection(context, "Transform", "Inspector.Transform", true);
         if (ImGui::BeginPopupContextItem("TransformContext")) {
             if (ImGui::MenuItem("Reset")) {
@@ -1798,60 +1904,22 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             ImGui::EndPopup();
         }
         if (transformOpen) {
-            float px = 0, py = 0, pz = 0;
-            float rx = 0, ry = 0, rz = 0;
-            float sx = 1, sy = 1, sz = 1;
-            if (MCEEditorGetTransform(context, selectedEntityId, &px, &py, &pz, &rx, &ry, &rz, &sx, &sy, &sz) != 0) {
-                float position[3] = {px, py, pz};
-                float rotation[3] = {rx * kRadToDeg, ry * kRadToDeg, rz * kRadToDeg};
-                float scale[3] = {sx, sy, sz};
-                bool dirty = false;
-                if (EditorUI::BeginPropertyTable("TransformProps")) {
-                    EditorUI::SetNextPropertyInfoTooltip("Entity position in world space.\nUnits: meters.\nPerformance: none.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyVec3("Position",
-                                                   position,
-                                                   0.0f,
-                                                   EditorUIConstants::kPositionStep,
-                                                   0.0f,
-                                                   0.0f,
-                                                   "%.3f",
-                                                   false,
-                                                   true);
-                    EditorUI::SetNextPropertyInfoTooltip("Entity Euler rotation.\nUnits: degrees.\nPerformance: none.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyVec3("Rotation (deg)",
-                                                   rotation,
-                                                   0.0f,
-                                                   EditorUIConstants::kRotationStepDeg,
-                                                   EditorUIConstants::kRotationMinDeg,
-                                                   EditorUIConstants::kRotationMaxDeg,
-                                                   "%.2f",
-                                                   true,
-                                                   true);
-                    EditorUI::SetNextPropertyInfoTooltip("Entity local scale.\nUnits: scalar.\nPerformance: none.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyVec3("Scale",
-                                                   scale,
-                                                   1.0f,
-                                                   EditorUIConstants::kScaleStep,
-                                                   0.0f,
-                                                   0.0f,
-                                                   "%.3f",
-                                                   false,
-                                                   true);
-                    EditorUI::EndPropertyTable();
-                }
-                if (dirty) {
-                    float rotationRad[3] = {rotation[0] * kDegToRad, rotation[1] * kDegToRad, rotation[2] * kDegToRad};
-                    MCEEditorSetTransform(context, selectedEntityId,
-                                          position[0], position[1], position[2],
-                                          rotationRad[0], rotationRad[1], rotationRad[2],
-                                          scale[0], scale[1], scale[2]);
+            auto &transformCache = state.transformBlock;
+            if (FetchComponentBlock(context, selectedHandle, ComponentTransform, transformCache)) {
+                MCEPanelState::TransformBlock edited = transformCache.block;
+                const uint32_t dirtyMask = DrawTransformBlockProperties("TransformProps", edited, true);
+                if (dirtyMask != 0) {
+                    CommitComponentBlock(context, &selectedHandle, 1, ComponentTransform, transformCache, edited, dirtyMask);
                 }
             }
         }
     }
 
-    const bool hasRigidbody = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentRigidbody) != 0;
-    const bool hasCollider = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentCollider) != 0;
+    const bool hasRigidbody = hasValidEntity && selectedHasComponent(ComponentRigidbody);
+    const bool hasCollider = hasValidEntity && selectedHasComponent(ComponentCollider);
+    // Rigidbody reads the primary shape's trigger flag and Colliders draws every shape, so both share one read.
+    auto &colliderCache = state.colliderBlock;
+    const bool hasColliderBlock = hasCollider && FetchComponentBlock(context, selectedHandle, ComponentCollider, colliderCache);
 
     if (hasRigidbody) {
         bool rigidbodyOpen = EditorUI::BeginSectionWithContext(context,
@@ -1883,88 +1951,51 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
                                       : "Play mode required to rebuild runtime body.\nUnits: N/A.\nPersistence: N/A.");
             ImGui::EndDisabled();
             ImGui::Spacing();
-            uint32_t enabled = 1;
-            int32_t motionType = 1;
-            float mass = 1.0f;
-            float friction = 0.6f;
-            float restitution = 0.0f;
-            float linearDamping = 0.02f;
-            float angularDamping = 0.2f;
-            float gravityFactor = 1.0f;
-            uint32_t allowSleeping = 1;
-            uint32_t ccdEnabled = 0;
-            int32_t collisionLayer = 0;
-            uint32_t colliderEnabled = 1;
-            int32_t colliderShape = 0;
-            float boxX = 0.5f, boxY = 0.5f, boxZ = 0.5f;
-            float sphereRadius = 0.5f;
-            float capsuleHalfHeight = 0.5f;
-            float capsuleRadius = 0.5f;
-            float offsetX = 0.0f, offsetY = 0.0f, offsetZ = 0.0f;
-            float rotX = 0.0f, rotY = 0.0f, rotZ = 0.0f;
-            uint32_t isTrigger = 0;
-            const bool hasColliderData = hasCollider && MCEEditorGetCollider(context, selectedEntityId,
-                                     &colliderEnabled,
-                                     &colliderShape,
-                                     &boxX, &boxY, &boxZ,
-                                     &sphereRadius,
-                                     &capsuleHalfHeight,
-                                     &capsuleRadius,
-                                     &offsetX, &offsetY, &offsetZ,
-                                     &rotX, &rotY, &rotZ,
-                                     &isTrigger) != 0;
-            if (MCEEditorGetRigidbody(context, selectedEntityId,
-                                      &enabled,
-                                      &motionType,
-                                      &mass,
-                                      &friction,
-                                      &restitution,
-                                      &linearDamping,
-                                      &angularDamping,
-                                      &gravityFactor,
-                                      &allowSleeping,
-                                      &ccdEnabled,
-                                      &collisionLayer) != 0) {
-                bool dirty = false;
+            const bool hasColliderData = hasColliderBlock && colliderCache.block.shapeCount > 0;
+            uint32_t isTrigger = hasColliderData ? colliderCache.block.shapes[0].isTrigger : 0;
+            auto &rigidbodyCache = state.rigidbodyBlock;
+            if (FetchComponentBlock(context, selectedHandle, ComponentRigidbody, rigidbodyCache)) {
+                MCEPanelState::RigidbodyBlock rigidbody = rigidbodyCache.block;
+                uint32_t dirtyMask = 0;
                 bool colliderDirty = false;
-                bool allowSleepBool = allowSleeping != 0;
-                bool ccdBool = ccdEnabled != 0;
+                bool allowSleepBool = rigidbody.allowSleeping != 0;
+                bool ccdBool = rigidbody.ccdEnabled != 0;
                 if (EditorUI::BeginPropertyTable("RigidbodyProps")) {
                     const char* typeItems[] = { "Static", "Dynamic", "Kinematic" };
-                    int typeIndex = motionType;
+                    int typeIndex = rigidbody.motionType;
                     EditorUI::SetNextPropertyInfoTooltip("Rigid body simulation mode.\nUnits: enum.\nPerformance: dynamic is highest cost.\nPersistence: Scene.");
                     if (EditorUI::PropertyCombo("Motion Type", &typeIndex, typeItems, IM_ARRAYSIZE(typeItems))) {
-                        motionType = typeIndex;
-                        dirty = true;
+                        rigidbody.motionType = typeIndex;
+                        dirtyMask |= 1u << RigidbodyFieldMotionType;
                     }
-                    if (motionType == 1) {
+                    if (rigidbody.motionType == 1) {
                         EditorUI::SetNextPropertyInfoTooltip("Body mass.\nUnits: kilograms.\nPerformance: none.\nPersistence: Scene.");
-                        if (EditorUI::PropertyFloat("Mass", &mass, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 1.0f)) {
-                            dirty = true;
+                        if (EditorUI::PropertyFloat("Mass", &rigidbody.mass, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 1.0f)) {
+                            dirtyMask |= 1u << RigidbodyFieldMass;
                         }
                         EditorUI::SetNextPropertyInfoTooltip("Linear velocity damping.\nUnits: unitless.\nPerformance: low.\nPersistence: Scene.");
-                        if (EditorUI::PropertyFloat("Linear Damping", &linearDamping, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.02f)) {
-                            dirty = true;
+                        if (EditorUI::PropertyFloat("Linear Damping", &rigidbody.linearDamping, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.02f)) {
+                            dirtyMask |= 1u << RigidbodyFieldLinearDamping;
                         }
                         EditorUI::SetNextPropertyInfoTooltip("Angular velocity damping.\nUnits: unitless.\nPerformance: low.\nPersistence: Scene.");
-                        if (EditorUI::PropertyFloat("Angular Damping", &angularDamping, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.2f)) {
-                            dirty = true;
+                        if (EditorUI::PropertyFloat("Angular Damping", &rigidbody.angularDamping, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.2f)) {
+                            dirtyMask |= 1u << RigidbodyFieldAngularDamping;
                         }
-                        if (EditorUI::PropertyFloat("Friction", &friction, 0.05f, 0.0f, 1.0f, "%.2f", true, true, 0.6f)) {
-                            dirty = true;
+                        if (EditorUI::PropertyFloat("Friction", &rigidbody.friction, 0.05f, 0.0f, 1.0f, "%.2f", true, true, 0.6f)) {
+                            dirtyMask |= 1u << RigidbodyFieldFriction;
                         }
-                        if (EditorUI::PropertyFloat("Restitution", &restitution, 0.05f, 0.0f, 1.0f, "%.2f", true, true, 0.0f)) {
-                            dirty = true;
+                        if (EditorUI::PropertyFloat("Restitution", &rigidbody.restitution, 0.05f, 0.0f, 1.0f, "%.2f", true, true, 0.0f)) {
+                            dirtyMask |= 1u << RigidbodyFieldRestitution;
                         }
                         if (EditorUI::PropertyBool("Allow Sleeping", &allowSleepBool)) {
-                            allowSleeping = allowSleepBool ? 1 : 0;
-                            dirty = true;
+                            rigidbody.allowSleeping = allowSleepBool ? 1 : 0;
+                            dirtyMask |= 1u << RigidbodyFieldAllowSleeping;
                         }
                         if (EditorUI::PropertyBool("Enable CCD", &ccdBool)) {
-                            ccdEnabled = ccdBool ? 1 : 0;
-                            dirty = true;
+                            rigidbody.ccdEnabled = ccdBool ? 1 : 0;
+                            dirtyMask |= 1u << RigidbodyFieldCcdEnabled;
                         }
-                    } else if (motionType == 0 && hasColliderData) {
+                    } else if (rigidbody.motionType == 0 && hasColliderData) {
                         bool triggerBool = isTrigger != 0;
                         if (EditorUI::PropertyBool("Is Trigger", &triggerBool)) {
                             isTrigger = triggerBool ? 1 : 0;
@@ -1974,46 +2005,26 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
                     EditorUI::EndPropertyTable();
                 }
                 if (ImGui::CollapsingHeader("Advanced##Rigidbody")) {
-                    bool enabledBool = enabled != 0;
+                    bool enabledBool = rigidbody.isEnabled != 0;
                     if (EditorUI::BeginPropertyTable("RigidbodyAdvanced")) {
                         if (EditorUI::PropertyBool("Enabled", &enabledBool)) {
-                            enabled = enabledBool ? 1 : 0;
-                            dirty = true;
+                            rigidbody.isEnabled = enabledBool ? 1 : 0;
+                            dirtyMask |= 1u << RigidbodyFieldEnabled;
                         }
-                        if (EditorUI::PropertyFloat("Gravity Factor", &gravityFactor, 0.05f, 0.0f, 5.0f, "%.2f", true, true, 1.0f)) {
-                            dirty = true;
+                        if (EditorUI::PropertyFloat("Gravity Factor", &rigidbody.gravityFactor, 0.05f, 0.0f, 5.0f, "%.2f", true, true, 1.0f)) {
+                            dirtyMask |= 1u << RigidbodyFieldGravityFactor;
                         }
-                        if (EditorUI::PropertyInt("Collision Layer", &collisionLayer, 0, 15)) {
-                            dirty = true;
+                        if (EditorUI::PropertyInt("Collision Layer", &rigidbody.collisionLayer, 0, 15)) {
+                            dirtyMask |= 1u << RigidbodyFieldCollisionLayer;
                         }
                         EditorUI::EndPropertyTable();
                     }
                 }
-                if (dirty) {
-                    MCEEditorSetRigidbody(context, selectedEntityId,
-                                          enabled,
-                                          motionType,
-                                          mass,
-                                          friction,
-                                          restitution,
-                                          linearDamping,
-                                          angularDamping,
-                                          gravityFactor,
-                                          allowSleeping,
-                                          ccdEnabled,
-                                          collisionLayer);
-                }
+                CommitComponentBlock(context, &selectedHandle, 1, ComponentRigidbody, rigidbodyCache, rigidbody, dirtyMask);
                 if (colliderDirty && hasColliderData) {
-                    MCEEditorSetCollider(context, selectedEntityId,
-                                         colliderEnabled,
-                                         colliderShape,
-                                         boxX, boxY, boxZ,
-                                         sphereRadius,
-                                         capsuleHalfHeight,
-                                         capsuleRadius,
-                                         offsetX, offsetY, offsetZ,
-                                         rotX, rotY, rotZ,
-                                         isTrigger);
+                    MCEPanelState::ColliderBlock collider = colliderCache.block;
+                    collider.shapes[0].isTrigger = isTrigger;
+                    CommitComponentBlock(context, &selectedHandle, 1, ComponentCollider, colliderCache, collider, 1u);
                 }
             }
         }
@@ -2034,7 +2045,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             if (!hasRigidbody) {
                 ImGui::TextColored(ImVec4(0.95f, 0.7f, 0.2f, 1.0f), "Requires a Rigidbody to simulate.");
             }
-            const int32_t shapeCount = MCEEditorGetColliderShapeCount(context, selectedEntityId);
+            const int32_t shapeCount = hasColliderBlock ? colliderCache.block.shapeCount : 0;
             if (ImGui::Button("+ Add Collider")) {
                 MCEEditorAddColliderShape(context, selectedEntityId);
             }
@@ -2042,28 +2053,21 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             const char* shapeItems[] = { "Box", "Sphere", "Capsule" };
             for (int32_t shapeIndex = 0; shapeIndex < shapeCount; ++shapeIndex) {
                 ImGui::PushID(shapeIndex);
-                uint32_t enabled = 1;
-                int32_t shapeType = 0;
-                float boxX = 0.5f, boxY = 0.5f, boxZ = 0.5f;
-                float sphereRadius = 0.5f;
-                float capsuleHalfHeight = 0.5f;
-                float capsuleRadius = 0.5f;
-                float offsetX = 0.0f, offsetY = 0.0f, offsetZ = 0.0f;
-                float rotX = 0.0f, rotY = 0.0f, rotZ = 0.0f;
-                uint32_t isTrigger = 0;
-                uint32_t hasLayerOverride = 0;
-                int32_t layerOverride = 0;
-                if (MCEEditorGetColliderShape(context, selectedEntityId, shapeIndex,
-                                              &enabled, &shapeType,
-                                              &boxX, &boxY, &boxZ,
-                                              &sphereRadius,
-                                              &capsuleHalfHeight,
-                                              &capsuleRadius,
-                                              &offsetX, &offsetY, &offsetZ,
-                                              &rotX, &rotY, &rotZ,
-                                              &isTrigger,
-                                              &hasLayerOverride,
-                                              &layerOverride) == 0) {
+                const bool inBlock = shapeIndex < MCEPanelState::kColliderBlockShapeCapacity;
+                MCEPanelState::ColliderShapeBlock shape;
+                if (inBlock) {
+                    shape = colliderCache.block.shapes[shapeIndex];
+                } else if (MCEEditorGetColliderShape(context, selectedEntityId, shapeIndex,
+                                                     &shape.isEnabled, &shape.shapeType,
+                                                     &shape.boxX, &shape.boxY, &shape.boxZ,
+                                                     &shape.sphereRadius,
+                                                     &shape.capsuleHalfHeight,
+                                                     &shape.capsuleRadius,
+                                                     &shape.offsetX, &shape.offsetY, &shape.offsetZ,
+                                                     &shape.rotationX, &shape.rotationY, &shape.rotationZ,
+                                                     &shape.isTrigger,
+                                                     &shape.hasLayerOverride,
+                                                     &shape.layerOverride) == 0) {
                     ImGui::PopID();
                     continue;
                 }
@@ -2076,80 +2080,84 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
                         continue;
                     }
                     bool dirty = false;
-                    int shapeTypeIndex = shapeType;
-                    float offset[3] = { offsetX, offsetY, offsetZ };
-                    float rotationDeg[3] = { rotX * kRadToDeg, rotY * kRadToDeg, rotZ * kRadToDeg };
-                    bool triggerBool = isTrigger != 0;
-                    bool enabledBool = enabled != 0;
-                    bool overrideBool = hasLayerOverride != 0;
+                    int shapeTypeIndex = shape.shapeType;
+                    float offset[3] = { shape.offsetX, shape.offsetY, shape.offsetZ };
+                    float rotationDeg[3] = { shape.rotationX * kRadToDeg, shape.rotationY * kRadToDeg, shape.rotationZ * kRadToDeg };
+                    bool triggerBool = shape.isTrigger != 0;
+                    bool enabledBool = shape.isEnabled != 0;
+                    bool overrideBool = shape.hasLayerOverride != 0;
 
                     if (EditorUI::BeginPropertyTable("ColliderShapeProps")) {
                         if (EditorUI::PropertyBool("Enabled", &enabledBool)) {
-                            enabled = enabledBool ? 1 : 0;
+                            shape.isEnabled = enabledBool ? 1 : 0;
                             dirty = true;
                         }
                         if (EditorUI::PropertyCombo("Shape", &shapeTypeIndex, shapeItems, IM_ARRAYSIZE(shapeItems))) {
-                            shapeType = shapeTypeIndex;
+                            shape.shapeType = shapeTypeIndex;
                             dirty = true;
                         }
-                        if (shapeType == 0) {
-                            float extents[3] = { boxX, boxY, boxZ };
+                        if (shape.shapeType == 0) {
+                            float extents[3] = { shape.boxX, shape.boxY, shape.boxZ };
                             if (EditorUI::PropertyVec3("Half Extents", extents, 0.5f, 0.05f, 0.0f, 0.0f, "%.3f", false, true)) {
-                                boxX = extents[0];
-                                boxY = extents[1];
-                                boxZ = extents[2];
+                                shape.boxX = extents[0];
+                                shape.boxY = extents[1];
+                                shape.boxZ = extents[2];
                                 dirty = true;
                             }
-                        } else if (shapeType == 1) {
-                            if (EditorUI::PropertyFloat("Radius", &sphereRadius, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 0.5f)) {
+                        } else if (shape.shapeType == 1) {
+                            if (EditorUI::PropertyFloat("Radius", &shape.sphereRadius, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 0.5f)) {
                                 dirty = true;
                             }
                         } else {
-                            if (EditorUI::PropertyFloat("Radius", &capsuleRadius, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 0.5f)) {
+                            if (EditorUI::PropertyFloat("Radius", &shape.capsuleRadius, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 0.5f)) {
                                 dirty = true;
                             }
-                            if (EditorUI::PropertyFloat("Half Height", &capsuleHalfHeight, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 0.5f)) {
+                            if (EditorUI::PropertyFloat("Half Height", &shape.capsuleHalfHeight, 0.05f, 0.0f, 0.0f, "%.3f", false, true, 0.5f)) {
                                 dirty = true;
                             }
                         }
                         if (EditorUI::PropertyVec3("Offset Position", offset, 0.0f, 0.05f, 0.0f, 0.0f, "%.3f", false, true)) {
-                            offsetX = offset[0];
-                            offsetY = offset[1];
-                            offsetZ = offset[2];
+                            shape.offsetX = offset[0];
+                            shape.offsetY = offset[1];
+                            shape.offsetZ = offset[2];
                             dirty = true;
                         }
                         if (EditorUI::PropertyVec3("Offset Rotation (deg)", rotationDeg, 0.0f, EditorUIConstants::kRotationStepDeg,
                                                    EditorUIConstants::kRotationMinDeg, EditorUIConstants::kRotationMaxDeg, "%.2f", true, true)) {
-                            rotX = rotationDeg[0] * kDegToRad;
-                            rotY = rotationDeg[1] * kDegToRad;
-                            rotZ = rotationDeg[2] * kDegToRad;
+                            shape.rotationX = rotationDeg[0] * kDegToRad;
+                            shape.rotationY = rotationDeg[1] * kDegToRad;
+                            shape.rotationZ = rotationDeg[2] * kDegToRad;
                             dirty = true;
                         }
                         if (EditorUI::PropertyBool("Is Trigger", &triggerBool)) {
-                            isTrigger = triggerBool ? 1 : 0;
+                            shape.isTrigger = triggerBool ? 1 : 0;
                             dirty = true;
                         }
                         if (EditorUI::PropertyBool("Override Layer", &overrideBool)) {
-                            hasLayerOverride = overrideBool ? 1 : 0;
+                            shape.hasLayerOverride = overrideBool ? 1 : 0;
                             dirty = true;
                         }
-                        if (overrideBool && EditorUI::PropertyInt("Layer", &layerOverride, 0, 15)) {
+                        if (overrideBool && EditorUI::PropertyInt("Layer", &shape.layerOverride, 0, 15)) {
                             dirty = true;
                         }
                         EditorUI::EndPropertyTable();
                     }
-                    if (dirty) {
+                    if (dirty && inBlock) {
+                        MCEPanelState::ColliderBlock collider = colliderCache.block;
+                        collider.shapes[shapeIndex] = shape;
+                        CommitComponentBlock(context, &selectedHandle, 1, ComponentCollider, colliderCache, collider, 1u << shapeIndex);
+                    } else if (dirty) {
                         MCEEditorSetColliderShape(context, selectedEntityId, shapeIndex,
-                                                  enabled, shapeType,
-                                                  boxX, boxY, boxZ,
-                                                  sphereRadius,
-                                                  capsuleHalfHeight,
-                                                  capsuleRadius,
-                                                  offsetX, offsetY, offsetZ,
-                                                  rotX, rotY, rotZ,
-                                                  isTrigger,
-                                                  hasLayerOverride,
-                                                  layerOverride);
+                                                  shape.isEnabled, shape.shapeType,
+                                                  shape.boxX, shape.boxY, shape.boxZ,
+                                                  shape.sphereRadius,
+                                                  shape.capsuleHalfHeight,
+                                                  shape.capsuleRadius,
+                                                  shape.offsetX, shape.offsetY, shape.offsetZ,
+                                                  shape.rotationX, shape.rotationY, shape.rotationZ,
+                                                  shape.isTrigger,
+                                                  shape.hasLayerOverride,
+                                                  shape.layerOverride);
                     }
                 }
                 ImGui::PopID();
@@ -2157,7 +2165,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    const bool hasCamera = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentCamera) != 0;
+    const bool hasCamera = hasValidEntity && selectedHasComponent(ComponentCamera);
     if (hasCamera) {
         bool cameraOpen = EditorUI::BeginSectionWithContext(context, 
             "Camera",
@@ -2170,103 +2178,70 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             },
             true);
         if (cameraOpen) {
-            int32_t projectionType = 0;
-            float fovDegrees = 45.0f;
-            float orthoSize = 10.0f;
-            float nearPlane = 0.1f;
-            float farPlane = 1000.0f;
-            uint32_t isPrimary = 0;
-            uint32_t isEditor = 0;
-            if (MCEEditorGetCamera(context, selectedEntityId,
-                                   &projectionType,
-                                   &fovDegrees,
-                                   &orthoSize,
-                                   &nearPlane,
-                                   &farPlane,
-                                   &isPrimary,
-                                   &isEditor) != 0) {
+            auto &cameraCache = state.cameraBlock;
+            if (FetchComponentBlock(context, selectedHandle, ComponentCamera, cameraCache)) {
+                MCEPanelState::CameraBlock camera = cameraCache.block;
                 const char *projectionItems[] = {"Perspective", "Orthographic"};
-                int projectionIndex = projectionType;
-                bool dirty = false;
-                bool primaryDirty = false;
-                uint32_t autoExposureEnabled = 0;
-                float exposureEV = 0.0f;
-                float exposureCompensation = 0.0f;
-                float autoExposureMin = 0.03f;
-                float autoExposureMax = 8.0f;
-                float adaptationSpeed = 2.0f;
-                bool hasExposureSettings = MCEEditorGetCameraExposure(context,
-                                                                      selectedEntityId,
-                                                                      &autoExposureEnabled,
-                                                                      &exposureEV,
-                                                                      &exposureCompensation,
-                                                                      &autoExposureMin,
-                                                                      &autoExposureMax,
-                                                                      &adaptationSpeed) != 0;
+                int projectionIndex = camera.projectionType;
+                uint32_t dirtyMask = 0;
+                const bool editorCamera = camera.isEditor != 0;
                 if (EditorUI::BeginPropertyTable("CameraProps")) {
                     EditorUI::SetNextPropertyInfoTooltip("Camera projection model.\nUnits: enum.\nPerformance: similar.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyCombo("Projection", &projectionIndex, projectionItems, 2);
+                    if (EditorUI::PropertyCombo("Projection", &projectionIndex, projectionItems, 2)) {
+                        camera.projectionType = projectionIndex;
+                        dirtyMask |= 1u << CameraFieldProjection;
+                    }
                     if (projectionIndex == 0) {
                         EditorUI::SetNextPropertyInfoTooltip("Perspective field of view.\nUnits: degrees.\nPerformance: none.\nPersistence: Scene.");
-                        dirty |= EditorUI::PropertyFloat("FOV (deg)", &fovDegrees, 0.1f, 1.0f, 179.0f, "%.1f", true);
+                        if (EditorUI::PropertyFloat("FOV (deg)", &camera.fovDegrees, 0.1f, 1.0f, 179.0f, "%.1f", true)) {
+                            dirtyMask |= 1u << CameraFieldFov;
+                        }
                     } else {
                         EditorUI::SetNextPropertyInfoTooltip("Orthographic vertical size.\nUnits: world units.\nPerformance: none.\nPersistence: Scene.");
-                        dirty |= EditorUI::PropertyFloat("Ortho Size", &orthoSize, 0.05f, 0.01f, 10000.0f, "%.2f", true);
+                        if (EditorUI::PropertyFloat("Ortho Size", &camera.orthoSize, 0.05f, 0.01f, 10000.0f, "%.2f", true)) {
+                            dirtyMask |= 1u << CameraFieldOrthoSize;
+                        }
                     }
                     EditorUI::SetNextPropertyInfoTooltip("Near clipping plane.\nUnits: meters.\nPerformance: precision-sensitive.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyFloat("Near", &nearPlane, 0.01f, 0.01f, 10000.0f, "%.3f", true);
+                    if (EditorUI::PropertyFloat("Near", &camera.nearPlane, 0.01f, 0.01f, 10000.0f, "%.3f", true)) {
+                        dirtyMask |= 1u << CameraFieldNear;
+                    }
                     EditorUI::SetNextPropertyInfoTooltip("Far clipping plane.\nUnits: meters.\nPerformance: precision-sensitive.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyFloat("Far", &farPlane, 1.0f, 0.1f, 100000.0f, "%.1f", true);
-                    bool primary = isPrimary != 0;
-                    if (isEditor != 0) {
+                    if (EditorUI::PropertyFloat("Far", &camera.farPlane, 1.0f, 0.1f, 100000.0f, "%.1f", true)) {
+                        dirtyMask |= 1u << CameraFieldFar;
+                    }
+                    bool primary = camera.isPrimary != 0;
+                    if (editorCamera) {
                         ImGui::BeginDisabled();
                     }
-                    primaryDirty = EditorUI::PropertyBool("Primary", &primary);
-                    if (isEditor != 0) {
-                        ImGui::EndDisabled();
+                    if (EditorUI::PropertyBool("Primary", &primary)) {
+                        camera.isPrimary = primary ? 1u : 0u;
+                        dirtyMask |= 1u << CameraFieldPrimary;
                     }
-                    if (hasExposureSettings) {
-                        const bool editorCamera = isEditor != 0;
-                        const char *exposureModeItems[] = {"Manual (Phase 1)"};
-                        int exposureMode = 0;
-                        bool exposureDirty = false;
-
-                        EditorUI::SetNextPropertyInfoTooltip("Auto exposure is unavailable pending histogram and temporal-adaptation reconstruction. Phase 1 rendering is deterministic and manual-only.");
-                        ImGui::BeginDisabled(true);
-                        EditorUI::PropertyCombo("Exposure Mode", &exposureMode, exposureModeItems, 1);
+                    if (editorCamera) {
                         ImGui::EndDisabled();
-
-                        EditorUI::SetNextPropertyInfoTooltip(editorCamera
-                            ? "Stable editor viewport exposure in stops. EV 0 is unity; +1 doubles and -1 halves final-stage exposure.\nPersistence: Scene."
-                            : "Manual final-stage exposure in stops. EV 0 is unity; +1 doubles and -1 halves exposure.\nPersistence: Scene.");
-                        exposureDirty |= EditorUI::PropertyFloat("Exposure (EV)", &exposureEV, 0.1f, -16.0f, 16.0f, "%+.2f EV", true);
-
-                        if (exposureDirty) {
-                            autoExposureEnabled = 0;
-                            MCEEditorSetCameraExposure(context,
-                                                       selectedEntityId,
-                                                       autoExposureEnabled,
-                                                       exposureEV,
-                                                       exposureCompensation,
-                                                       autoExposureMin,
-                                                       autoExposureMax,
-                                                       adaptationSpeed);
-                        }
+                    }
+                    const char *exposureModeItems[] = {"Manual (Phase 1)"};
+                    int exposureMode = 0;
+
+                    EditorUI::SetNextPropertyInfoTooltip("Auto exposure is unavailable pending histogram and temporal-adaptation reconstruction. Phase 1 rendering is deterministic and manual-only.");
+                    ImGui::BeginDisabled(true);
+                    EditorUI::PropertyCombo("Exposure Mode", &exposureMode, exposureModeItems, 1);
+                    ImGui::EndDisabled();
+
+                    EditorUI::SetNextPropertyInfoTooltip(editorCamera
+                        ? "Stable editor viewport exposure in stops. EV 0 is unity; +1 doubles and -1 halves final-stage exposure.\nPersistence: Scene."
+                        : "Manual final-stage exposure in stops. EV 0 is unity; +1 doubles and -1 halves exposure.\nPersistence: Scene.");
+                    if (EditorUI::PropertyFloat("Exposure (EV)", &camera.exposureEV, 0.1f, -16.0f, 16.0f, "%+.2f EV", true)) {
+                        dirtyMask |= 1u << CameraFieldExposureEV;
                     }
                     EditorUI::EndPropertyTable();
 
-                    if (dirty || primaryDirty) {
-                        const uint32_t primaryValue = (primary ? 1u : 0u);
-                        MCEEditorSetCamera(context, selectedEntityId,
-                                           projectionIndex,
-                                           fovDegrees,
-                                           orthoSize,
-                                           nearPlane,
-                                           farPlane,
-                                           primaryValue);
+                    if (dirtyMask != 0) {
+                        CommitComponentBlock(context, &selectedHandle, 1, ComponentCamera, cameraCache, camera, dirtyMask);
                     }
                 }
-                if (isEditor != 0) {
+                if (editorCamera) {
                     ImGui::TextDisabled("Editor Camera");
                     ImGui::TextDisabled("Editor camera exposure settings persist with the scene.");
                 }
@@ -2278,7 +2253,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         ImGui::EndDisabled();
     }
 
-    const bool hasScript = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentScript) != 0;
+    const bool hasScript = hasValidEntity && selectedHasComponent(ComponentScript);
     if (hasScript) {
         bool scriptOpen = EditorUI::BeginSectionWithContext(context,
             "Script",
@@ -2647,7 +2622,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    const bool hasCharacterController = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentCharacterController) != 0;
+    const bool hasCharacterController = hasValidEntity && selectedHasComponent(ComponentCharacterController);
     if (hasCharacterController) {
         bool controllerOpen = EditorUI::BeginSectionWithContext(context,
             "Character Controller",
@@ -3024,7 +2999,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         ImGui::BeginDisabled(true);
     }
 
-    const bool hasMeshRenderer = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentMeshRenderer) != 0;
+    const bool hasMeshRenderer = hasValidEntity && selectedHasComponent(ComponentMeshRenderer);
     if (hasMeshRenderer) {
         bool meshOpen = EditorUI::BeginSectionWithContext(context, 
             "Mesh Renderer",
@@ -3061,34 +3036,20 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
 
             if (materialHandle[0] != 0) {
                 if (MaterialEditorState *textureState = GetInspectorMaterialState(context, state, materialHandle)) {
+                    MaterialEditorState texturesBefore = *textureState;
                     bool texturesDirty = DrawMaterialTextureInspector(context, state, *textureState, materialHandle);
                     TexturePickerState &picker = GetTexturePickerState(state);
                     bool pickerDirty = picker.didPick && strcmp(picker.materialHandle, materialHandle) == 0;
                     if (pickerDirty) {
                         picker.didPick = false;
+                        // The picker wrote into the cached state before this frame; diff against the stored material.
+                        LoadMaterialState(context, materialHandle, texturesBefore);
                     }
                     if (texturesDirty || pickerDirty) {
                         EnforceMetalRoughnessRule(*textureState);
-                        MCEEditorSetMaterialAsset(
-                            context,
-                            materialHandle,
-                            textureState->name,
-                            textureState->version,
-                            textureState->baseColor[0], textureState->baseColor[1], textureState->baseColor[2],
-                            textureState->metallic, textureState->roughness, textureState->ao,
-                            textureState->emissive[0], textureState->emissive[1], textureState->emissive[2],
-                            textureState->emissiveIntensity,
-                            textureState->uvTiling[0], textureState->uvTiling[1],
-                            textureState->uvOffset[0], textureState->uvOffset[1],
-                            textureState->alphaMode, textureState->alphaCutoff,
-                            textureState->doubleSided ? 1 : 0, textureState->unlit ? 1 : 0,
-                            textureState->baseColorHandle,
-                            textureState->normalHandle,
-                            textureState->metalRoughnessHandle,
-                            textureState->metallicHandle,
-                            textureState->roughnessHandle,
-                            textureState->aoHandle,
-                            textureState->emissiveHandle);
+                        if (SendMaterialDeltas(context, materialHandle, texturesBefore, *textureState) > 0) {
+                            MCEEditorFlushMaterialEdits(context, materialHandle);
+                        }
                     }
                 }
             }
@@ -3107,7 +3068,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    const bool hasSkinnedMesh = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentSkinnedMesh) != 0;
+    const bool hasSkinnedMesh = hasValidEntity && selectedHasComponent(ComponentSkinnedMesh);
     if (hasSkinnedMesh) {
         bool skinnedOpen = EditorUI::BeginSectionWithContext(context,
             "Skinned Mesh",
@@ -3204,7 +3165,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    const bool hasAnimator = hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentAnimator) != 0;
+    const bool hasAnimator = hasValidEntity && selectedHasComponent(ComponentAnimator);
     if (hasAnimator) {
         bool animatorOpen = EditorUI::BeginSectionWithContext(context,
             "Animator",
@@ -3675,7 +3636,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    bool hasMaterialComponent = hasValidEntity && (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentMaterial) != 0);
+    bool hasMaterialComponent = hasValidEntity && selectedHasComponent(ComponentMaterial);
     const bool showMaterialSection = !hasMeshRenderer && (hasSelectedMaterial || hasMaterialComponent);
     if (showMaterialSection) {
         char materialHandle[64] = {0};
@@ -3723,34 +3684,20 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
                 }
 
                 if (MaterialEditorState *textureState = GetInspectorMaterialState(context, state, materialHandle)) {
+                    MaterialEditorState texturesBefore = *textureState;
                     bool texturesDirty = DrawMaterialTextureInspector(context, state, *textureState, materialHandle);
                     TexturePickerState &picker = GetTexturePickerState(state);
                     bool pickerDirty = picker.didPick && strcmp(picker.materialHandle, materialHandle) == 0;
                     if (pickerDirty) {
                         picker.didPick = false;
+                        // The picker wrote into the cached state before this frame; diff against the stored material.
+                        LoadMaterialState(context, materialHandle, texturesBefore);
                     }
                     if (texturesDirty || pickerDirty) {
                         EnforceMetalRoughnessRule(*textureState);
-                        MCEEditorSetMaterialAsset(
-                            context,
-                            materialHandle,
-                            textureState->name,
-                            textureState->version,
-                            textureState->baseColor[0], textureState->baseColor[1], textureState->baseColor[2],
-                            textureState->metallic, textureState->roughness, textureState->ao,
-                            textureState->emissive[0], textureState->emissive[1], textureState->emissive[2],
-                            textureState->emissiveIntensity,
-                            textureState->uvTiling[0], textureState->uvTiling[1],
-                            textureState->uvOffset[0], textureState->uvOffset[1],
-                            textureState->alphaMode, textureState->alphaCutoff,
-                            textureState->doubleSided ? 1 : 0, textureState->unlit ? 1 : 0,
-                            textureState->baseColorHandle,
-                            textureState->normalHandle,
-                            textureState->metalRoughnessHandle,
-                            textureState->metallicHandle,
-                            textureState->roughnessHandle,
-                            textureState->aoHandle,
-                            textureState->emissiveHandle);
+                        if (SendMaterialDeltas(context, materialHandle, texturesBefore, *textureState) > 0) {
+                            MCEEditorFlushMaterialEdits(context, materialHandle);
+                        }
                     }
                 }
             }
@@ -3766,7 +3713,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         ImGui::Spacing();
     }
 
-    if (hasValidEntity && !isAutoDrivenSkySun && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentLight) != 0) {
+    if (hasValidEntity && !isAutoDrivenSkySun && selectedHasComponent(ComponentLight)) {
         bool lightOpen = EditorUI::BeginSectionWithContext(context, 
             "Light",
             "Inspector.Light",
@@ -3781,43 +3728,52 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             },
             true);
         if (lightOpen) {
-            int32_t type = 0;
-            float colorX = 1, colorY = 1, colorZ = 1;
-            float brightness = 1, range = 0, innerCos = 0.95f, outerCos = 0.9f;
-            float dirX = 0, dirY = -1, dirZ = 0;
-            uint32_t castsShadows = 0;
-            if (MCEEditorGetLight(context, selectedEntityId, &type, &colorX, &colorY, &colorZ, &brightness, &range, &innerCos, &outerCos, &dirX, &dirY, &dirZ, &castsShadows) != 0) {
+            auto &lightCache = state.lightBlock;
+            if (FetchComponentBlock(context, selectedHandle, ComponentLight, lightCache)) {
+                MCEPanelState::LightBlock light = lightCache.block;
                 const char* types[] = {"Point", "Spot", "Directional"};
-                bool dirty = false;
+                uint32_t dirtyMask = 0;
                 if (EditorUI::BeginPropertyTable("LightProps")) {
                     EditorUI::SetNextPropertyInfoTooltip("Light type.\nUnits: enum.\nPerformance: shadows + spot/directional often costlier.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyCombo("Type", &type, types, IM_ARRAYSIZE(types));
-                    float color[3] = {colorX, colorY, colorZ};
+                    if (EditorUI::PropertyCombo("Type", &light.type, types, IM_ARRAYSIZE(types))) {
+                        dirtyMask |= 1u << LightFieldType;
+                    }
+                    float color[3] = {light.colorX, light.colorY, light.colorZ};
                     const float lightDefault[3] = {1.0f, 1.0f, 1.0f};
                     EditorUI::SetNextPropertyInfoTooltip("Light color.\nUnits: linear RGB.\nPerformance: none.\nPersistence: Scene.");
                     if (EditorUI::PropertyColor3("Color", color, lightDefault, true)) {
-                        colorX = color[0];
-                        colorY = color[1];
-                        colorZ = color[2];
-                        dirty = true;
+                        light.colorX = color[0];
+                        light.colorY = color[1];
+                        light.colorZ = color[2];
+                        dirtyMask |= 1u << LightFieldColor;
                     }
-                    if (type == 2) {
+                    bool brightnessDirty = false;
+                    if (light.type == 2) {
                         EditorUI::SetNextPropertyInfoTooltip("Scene-relative incident illuminance. A value of pi produces radiance 1 from a white Lambertian at normal incidence before dielectric Fresnel redistribution. Not calibrated lux.\nPersistence: Scene.");
-                        dirty |= EditorUI::PropertyFloat("Illuminance", &brightness, 0.1f, 0.0f, 100.0f, "%.2f", true, true, 1.0f);
+                        brightnessDirty = EditorUI::PropertyFloat("Illuminance", &light.brightness, 0.1f, 0.0f, 100.0f, "%.2f", true, true, 1.0f);
                     } else {
                         EditorUI::SetNextPropertyInfoTooltip("Scene-relative numerator of inverse-square irradiance. Not calibrated candela.\nPersistence: Scene.");
-                        dirty |= EditorUI::PropertyFloat("Intensity", &brightness, 0.1f, 0.0f, 100.0f, "%.2f", true, true, 1.0f);
+                        brightnessDirty = EditorUI::PropertyFloat("Intensity", &light.brightness, 0.1f, 0.0f, 100.0f, "%.2f", true, true, 1.0f);
+                    }
+                    if (brightnessDirty) {
+                        dirtyMask |= 1u << LightFieldBrightness;
                     }
                     EditorUI::SetNextPropertyInfoTooltip("Finite-support distance. Inverse-square response is unchanged through 80% of range, then fades smoothly to zero. Zero means no finite cutoff.\nUnits: scene distance.\nPerformance: larger ranges can affect more pixels.\nPersistence: Scene.");
-                    dirty |= EditorUI::PropertyFloat("Range", &range, 0.1f, 0.0f, 100.0f, "%.2f", true, true, 0.0f);
-                    if (type == 1) {
+                    if (EditorUI::PropertyFloat("Range", &light.range, 0.1f, 0.0f, 100.0f, "%.2f", true, true, 0.0f)) {
+                        dirtyMask |= 1u << LightFieldRange;
+                    }
+                    if (light.type == 1) {
                         EditorUI::SetNextPropertyInfoTooltip("Spot inner cone cosine.\nUnits: cosine value.\nPerformance: low.\nPersistence: Scene.");
-                        dirty |= EditorUI::PropertyFloat("Inner Cone", &innerCos, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.95f);
+                        if (EditorUI::PropertyFloat("Inner Cone", &light.innerCos, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.95f)) {
+                            dirtyMask |= 1u << LightFieldInnerCos;
+                        }
                         EditorUI::SetNextPropertyInfoTooltip("Spot outer cone cosine.\nUnits: cosine value.\nPerformance: low.\nPersistence: Scene.");
-                        dirty |= EditorUI::PropertyFloat("Outer Cone", &outerCos, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.9f);
+                        if (EditorUI::PropertyFloat("Outer Cone", &light.outerCos, 0.01f, 0.0f, 1.0f, "%.3f", true, true, 0.9f)) {
+                            dirtyMask |= 1u << LightFieldOuterCos;
+                        }
                     }
-                    if (type == 2) {
-                        float direction[3] = {dirX, dirY, dirZ};
+                    if (light.type == 2) {
+                        float direction[3] = {light.directionX, light.directionY, light.directionZ};
                         ImGui::BeginDisabled(true);
                         EditorUI::SetNextPropertyInfoTooltip("Read-only transform-derived light direction.\nUnits: normalized vector.\nPersistence: Scene transform.");
                         EditorUI::PropertyVec3("Direction (from transform)",
@@ -3830,11 +3786,11 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
                                                false,
                                                true);
                         ImGui::EndDisabled();
-                        bool castsShadowsBool = castsShadows != 0;
+                        bool castsShadowsBool = light.castsShadows != 0;
                         EditorUI::SetNextPropertyInfoTooltip("Enables shadow casting for this directional light.\nUnits: boolean.\nPerformance: medium-to-high GPU cost.\nPersistence: Scene.");
                         if (EditorUI::PropertyBool("Casts Shadows", &castsShadowsBool)) {
-                            castsShadows = castsShadowsBool ? 1 : 0;
-                            dirty = true;
+                            light.castsShadows = castsShadowsBool ? 1 : 0;
+                            dirtyMask |= 1u << LightFieldCastsShadows;
                         }
                     } else {
                         ImGui::BeginDisabled(true);
@@ -3845,14 +3801,16 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
                     }
                     EditorUI::EndPropertyTable();
                 }
-                if (dirty) {
-                    MCEEditorSetLight(context, selectedEntityId, type, colorX, colorY, colorZ, brightness, range, innerCos, outerCos, dirX, dirY, dirZ, castsShadows);
+                // Direction is derived from the transform and never marked dirty here, so edits no longer
+                // rewrite the entity rotation as a side effect.
+                if (dirtyMask != 0) {
+                    CommitComponentBlock(context, &selectedHandle, 1, ComponentLight, lightCache, light, dirtyMask);
                 }
             }
         }
     }
 
-    if (hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentReflectionProbe) != 0) {
+    if (hasValidEntity && selectedHasComponent(ComponentReflectionProbe)) {
         bool probeOpen = EditorUI::BeginSectionWithContext(context,
             "Reflection Probe",
             "Inspector.ReflectionProbe",
@@ -3953,7 +3911,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    if (hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentEnvironment) != 0) {
+    if (hasValidEntity && selectedHasComponent(ComponentEnvironment)) {
         bool environmentOpen = EditorUI::BeginSectionWithContext(context,
             "Environment",
             "Inspector.Environment",
@@ -4640,7 +4598,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         }
     }
 
-    if (hasValidEntity && MCEEditorEntityHasComponent(context, selectedEntityId, ComponentSkyLight) != 0) {
+    if (hasValidEntity && selectedHasComponent(ComponentSkyLight)) {
         bool skyOpen = EditorUI::BeginSectionWithContext(context, 
             "Sky",
             "Inspector.Sky",
@@ -5298,62 +5256,63 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
     }
 
     if (ImGui::BeginPopup("AddComponentPopup")) {
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentMeshRenderer) == 0) {
+        selectedComponentMask = MCEEditorGetComponentMaskH(context, selectedHandle);
+        if (!selectedHasComponent(ComponentMeshRenderer)) {
             if (ImGui::MenuItem("Mesh Renderer")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentMeshRenderer);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentMaterial) == 0) {
+        if (!selectedHasComponent(ComponentMaterial)) {
             if (ImGui::MenuItem("Material")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentMaterial);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentCamera) == 0) {
+        if (!selectedHasComponent(ComponentCamera)) {
             if (ImGui::MenuItem("Camera")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentCamera);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentRigidbody) == 0) {
+        if (!selectedHasComponent(ComponentRigidbody)) {
             if (ImGui::MenuItem("Rigidbody")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentRigidbody);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentCollider) == 0) {
+        if (!selectedHasComponent(ComponentCollider)) {
             if (ImGui::MenuItem("Collider")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentCollider);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentScript) == 0) {
+        if (!selectedHasComponent(ComponentScript)) {
             if (ImGui::MenuItem("Script")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentScript);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentCharacterController) == 0) {
+        if (!selectedHasComponent(ComponentCharacterController)) {
             if (ImGui::MenuItem("Character Controller")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentCharacterController);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentSkinnedMesh) == 0) {
+        if (!selectedHasComponent(ComponentSkinnedMesh)) {
             if (ImGui::MenuItem("Skinned Mesh")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentSkinnedMesh);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentAnimator) == 0) {
+        if (!selectedHasComponent(ComponentAnimator)) {
             if (ImGui::MenuItem("Animator")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentAnimator);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentLight) == 0) {
+        if (!selectedHasComponent(ComponentLight)) {
             if (ImGui::MenuItem("Light")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentLight);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentEnvironment) == 0) {
+        if (!selectedHasComponent(ComponentEnvironment)) {
             if (ImGui::MenuItem("Environment")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentEnvironment);
             }
         }
-        if (MCEEditorEntityHasComponent(context, selectedEntityId, ComponentReflectionProbe) == 0) {
+        if (!selectedHasComponent(ComponentReflectionProbe)) {
             if (ImGui::MenuItem("Reflection Probe")) {
                 MCEEditorAddComponent(context, selectedEntityId, ComponentReflectionProbe);
             }
@@ -5366,9 +5325,11 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
         ImGui::SetNextWindowSize(ImVec2(520.0f, 520.0f), ImGuiCond_Once);
         if (ImGui::BeginPopupModal(popup.title.c_str(), &popup.open, ImGuiWindowFlags_AlwaysAutoResize)) {
             ImGui::BeginChild("MaterialEditorScroll", ImVec2(0, 360.0f), false, ImGuiWindowFlags_AlwaysVerticalScrollbar);
+            const MaterialEditorState before = popup.state;
             const bool changed = DrawMaterialEditorContents(popup.state);
             ImGui::EndChild();
-            if (changed) {
+            // Deltas only update the working copy as a preview; nothing is written until Save.
+            if (changed && SendMaterialDeltas(context, popup.handle, before, popup.state) > 0) {
                 popup.dirty = true;
             }
 
@@ -5378,27 +5339,7 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
             }
 
             if (ImGui::Button("Save")) {
-                EnforceMetalRoughnessRule(popup.state);
-                MCEEditorSetMaterialAsset(
-                    context,
-                    popup.handle,
-                    popup.state.name,
-                    popup.state.version,
-                    popup.state.baseColor[0], popup.state.baseColor[1], popup.state.baseColor[2],
-                    popup.state.metallic, popup.state.roughness, popup.state.ao,
-                    popup.state.emissive[0], popup.state.emissive[1], popup.state.emissive[2],
-                    popup.state.emissiveIntensity,
-                    popup.state.uvTiling[0], popup.state.uvTiling[1],
-                    popup.state.uvOffset[0], popup.state.uvOffset[1],
-                    popup.state.alphaMode, popup.state.alphaCutoff,
-                    popup.state.doubleSided ? 1 : 0, popup.state.unlit ? 1 : 0,
-                    popup.state.baseColorHandle,
-                    popup.state.normalHandle,
-                    popup.state.metalRoughnessHandle,
-                    popup.state.metallicHandle,
-                    popup.state.roughnessHandle,
-                    popup.state.aoHandle,
-                    popup.state.emissiveHandle);
+                MCEEditorFlushMaterialEdits(context, popup.handle);
                 popup.dirty = false;
             }
             ImGui::SameLine();
@@ -5409,6 +5350,15 @@ void ImGuiInspectorPanelDraw(void *context, bool *isOpen, const char *selectedEn
 
             ImGui::EndPopup();
         }
+        // Close and the title-bar button both land here; unsaved deltas are dropped and the inspector's
+        // texture rows reload from the material as saved.
+        if (!popup.open) {
+            if (popup.dirty) {
+                MCEEditorRevertMaterialEdits(context, popup.handle);
+                popup.dirty = false;
+            }
+            GetInspectorMaterialCache(state).valid = false;
+        }
     }
 
     ImGui::EndDisabled();
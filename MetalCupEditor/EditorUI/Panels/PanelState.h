@@ -58,6 +58,12 @@ namespace MCEPanelState {
         std::string importFailureReason;
     };
 
+    struct AssetReferenceEntry {
+        std::string handle;
+        std::string relativePath;
+        int32_t type = AssetUnknown;
+    };
+
     struct ContentBrowserState {
         std::string currentPath;
         std::vector<std::string> history;
@@ -89,6 +95,20 @@ namespace MCEPanelState {
         SortMode filteredSort = SortByName;
         bool filteredAscending = true;
         uint64_t filteredRevision = 0;
+        bool referencesOpen = false;
+        bool referencesTransitive = true;
+        std::string referencesHandle;
+        std::string referencesLabel;
+        uint64_t referencesRevision = 0;
+        std::vector<AssetReferenceEntry> referencesUsedBy;
+        std::vector<AssetReferenceEntry> referencesUses;
+    };
+
+    struct HierarchyNode {
+        std::string id;
+        std::string name;
+        int32_t depth = 0;
+        int32_t subtreeSize = 1;
     };
 
     struct SceneHierarchyState {
@@ -97,7 +117,17 @@ namespace MCEPanelState {
         char prefabFilter[64] = {0};
         std::string selectedPrefabHandle;
         std::unordered_map<std::string, bool> expandedByEntityId;
-        std::vector<std::string> visibleEntityIds;
+        // Depth-first snapshot of the whole tree, rebuilt only when the hierarchy generation changes.
+        uint64_t hierarchyGeneration = 0;
+        std::vector<HierarchyNode> nodes;
+        std::unordered_map<std::string, int32_t> nodeIndexByEntityId;
+        // Node indices of the rows currently shown; spliced in place on expand/collapse.
+        std::vector<int32_t> visibleRows;
+        std::vector<int32_t> rowByNode;
+        bool rowByNodeDirty = true;
+        std::vector<char> snapshotIds;
+        std::vector<char> snapshotNames;
+        std::vector<int32_t> snapshotDepths;
         std::string rangeAnchorEntityId;
         std::string pendingClickEntityId;
         bool pendingClickShift = false;
@@ -196,6 +226,103 @@ namespace MCEPanelState {
         int presetIndex = 0;
     };
 
+    // Mirrors MCETransformBlockBridge in EditorECSBridge.swift. Rotation is XYZ euler in radians.
+    struct TransformBlock {
+        float positionX = 0.0f;
+        float positionY = 0.0f;
+        float positionZ = 0.0f;
+        float rotationX = 0.0f;
+        float rotationY = 0.0f;
+        float rotationZ = 0.0f;
+        float scaleX = 1.0f;
+        float scaleY = 1.0f;
+        float scaleZ = 1.0f;
+    };
+
+    // Mirrors MCECameraBlockBridge in EditorECSBridge.swift.
+    struct CameraBlock {
+        int32_t projectionType = 0;
+        float fovDegrees = 60.0f;
+        float orthoSize = 10.0f;
+        float nearPlane = 0.1f;
+        float farPlane = 1000.0f;
+        uint32_t isPrimary = 0;
+        uint32_t isEditor = 0;
+        float exposureEV = 0.0f;
+    };
+
+    // Mirrors MCELightBlockBridge in EditorECSBridge.swift.
+    struct LightBlock {
+        int32_t type = 0;
+        float colorX = 1.0f;
+        float colorY = 1.0f;
+        float colorZ = 1.0f;
+        float brightness = 1.0f;
+        float range = 10.0f;
+        float innerCos = 0.95f;
+        float outerCos = 0.9f;
+        float directionX = 0.0f;
+        float directionY = -1.0f;
+        float directionZ = 0.0f;
+        uint32_t castsShadows = 0;
+    };
+
+    // Mirrors MCERigidbodyBlockBridge in EditorECSBridge.swift.
+    struct RigidbodyBlock {
+        uint32_t isEnabled = 1;
+        int32_t motionType = 1;
+        float mass = 1.0f;
+        float friction = 0.6f;
+        float restitution = 0.0f;
+        float linearDamping = 0.02f;
+        float angularDamping = 0.2f;
+        float gravityFactor = 1.0f;
+        uint32_t allowSleeping = 1;
+        uint32_t ccdEnabled = 0;
+        int32_t collisionLayer = 0;
+    };
+
+    // Mirrors MCEColliderShapeBlockBridge in EditorECSBridge.swift. Rotation is XYZ euler in radians.
+    struct ColliderShapeBlock {
+        uint32_t isEnabled = 1;
+        int32_t shapeType = 0;
+        float boxX = 0.5f;
+        float boxY = 0.5f;
+        float boxZ = 0.5f;
+        float sphereRadius = 0.5f;
+        float capsuleHalfHeight = 0.5f;
+        float capsuleRadius = 0.5f;
+        float offsetX = 0.0f;
+        float offsetY = 0.0f;
+        float offsetZ = 0.0f;
+        float rotationX = 0.0f;
+        float rotationY = 0.0f;
+        float rotationZ = 0.0f;
+        uint32_t isTrigger = 0;
+        uint32_t hasLayerOverride = 0;
+        int32_t layerOverride = 0;
+    };
+
+    // Matches EditorComponentBlocks.colliderShapeCapacity.
+    constexpr int32_t kColliderBlockShapeCapacity = 8;
+
+    // Mirrors MCEColliderBlockBridge in EditorECSBridge.swift. shapeCount is the full count and can exceed
+    // the capacity; shapes past it are read and written per index.
+    struct ColliderBlock {
+        int32_t shapeCount = 0;
+        ColliderShapeBlock shapes[kColliderBlockShapeCapacity];
+    };
+
+    // Last block read for one entity, with the per-component stamp the bridge handed out for it.
+    template <typename Block>
+    struct ComponentBlockCache {
+        uint64_t handleHigh = 0;
+        uint64_t handleLow = 0;
+        uint64_t revision = 0;
+        bool valid = false;
+        Block block;
+    };
+
     struct InspectorState {
         TexturePickerState texturePicker;
         EnvironmentPickerState environmentPicker;
@@ -205,6 +332,11 @@ namespace MCEPanelState {
         MaterialPopupState materialPopup;
         InspectorMaterialCache materialCache;
         PendingSkyState pendingSky;
+        ComponentBlockCache<TransformBlock> transformBlock;
+        ComponentBlockCache<CameraBlock> cameraBlock;
+        ComponentBlockCache<LightBlock> lightBlock;
+        ComponentBlockCache<RigidbodyBlock> rigidbodyBlock;
+        ComponentBlockCache<ColliderBlock> colliderBlock;
     };
 
     enum class GizmoOperation : uint8_t {
@@ -214,6 +346,23 @@ namespace MCEPanelState {
         Scale
     };
 
+    // Mirrors MCEWorldIconBridge in EditorECSBridge.swift.
+    struct WorldIconEntry {
+        uint64_t handleHigh = 0;
+        uint64_t handleLow = 0;
+        float positionX = 0.0f;
+        float positionY = 0.0f;
+        float positionZ = 0.0f;
+        int32_t kind = 0;
+        int32_t status = 0;
+    };
+
+    // Screen-space result of projecting one world icon; size 0 means culled.
+    struct ProjectedWorldIcon {
+        ImVec2 screenPos = ImVec2(0.0f, 0.0f);
+        float size = 0.0f;
+    };
+
     struct ViewportState {
         GizmoOperation operation = GizmoOperation::Translate;
         int mode = 0;
@@ -221,6 +370,8 @@ namespace MCEPanelState {
         float translateSnap = 0.5f;
         float rotateSnap = 15.0f;
         float scaleSnap = 0.1f;
+        std::vector<WorldIconEntry> worldIcons;
+        std::vector<ProjectedWorldIcon> projectedWorldIcons;
     };
 
     struct AnimationGraphPanelState {
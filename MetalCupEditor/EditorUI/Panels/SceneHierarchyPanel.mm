@@ -8,7 +8,6 @@
 #import "PanelState.h"
 #import "../Widgets/UIWidgets.h"
 #include <algorithm>
-#include <functional>
 #include <stdint.h>
 #include <string.h>
 #include <string>
@@ -45,6 +44,12 @@ extern "C" int32_t MCEEditorGetRootEntityCount(MCE_CTX);
 extern "C" int32_t MCEEditorGetRootEntityIdAt(MCE_CTX, int32_t index, char *buffer, int32_t bufferSize);
 extern "C" int32_t MCEEditorGetChildEntityCount(MCE_CTX, const char *parentId);
 extern "C" int32_t MCEEditorGetChildEntityIdAt(MCE_CTX, const char *parentId, int32_t index, char *buffer, int32_t bufferSize);
+extern "C" uint64_t MCEEditorGetHierarchyGeneration(MCE_CTX);
+extern "C" int32_t MCEEditorGetHierarchySnapshot(MCE_CTX,
+                                                 char *idsOut, int32_t idStride,
+                                                 char *namesOut, int32_t nameStride,
+                                                 int32_t *depthsOut,
+                                                 int32_t maxCount);
 extern "C" int32_t MCEEditorGetParentEntityId(MCE_CTX, const char *childId, char *buffer, int32_t bufferSize);
 extern "C" uint32_t MCEEditorSetParent(MCE_CTX, const char *childId, const char *parentId, uint32_t keepWorldTransform);
 extern "C" uint32_t MCEEditorUnparent(MCE_CTX, const char *childId, uint32_t keepWorldTransform);
@@ -53,8 +58,12 @@ extern "C" uint32_t MCESceneIsPlaying(MCE_CTX);
 extern "C" uint32_t MCESceneIsSimulating(MCE_CTX);
 
 namespace {
+using MCEPanelState::HierarchyNode;
 using MCEPanelState::SceneHierarchyState;
 
+constexpr int32_t kHierarchyIdStride = 64;
+constexpr int32_t kHierarchyNameStride = 128;
+
 SceneHierarchyState &GetSceneHierarchyState(void *context) {
     auto *state = static_cast<MCEPanelState::EditorUIPanelState *>(MCEContextGetUIPanelState(context));
     return state->sceneHierarchy;
@@ -146,6 +155,110 @@ std::vector<std::string> TopLevelSelection(void *context, const std::vector<std:
     return result;
 }
 
+bool IsNodeExpanded(const SceneHierarchyState &state, int32_t nodeIndex) {
+    auto it = state.expandedByEntityId.find(state.nodes[static_cast<size_t>(nodeIndex)].id);
+    return it == state.expandedByEntityId.end() ? true : it->second;
+}
+
+// Appends the visible descendants of `parentIndex` (or of the virtual root for -1), skipping collapsed subtrees.
+void AppendVisibleDescendants(const SceneHierarchyState &state, int32_t parentIndex, std::vector<int32_t> &out) {
+    const int32_t begin = parentIndex + 1;
+    const int32_t end = parentIndex < 0
+        ? static_cast<int32_t>(state.nodes.size())
+        : parentIndex + state.nodes[static_cast<size_t>(parentIndex)].subtreeSize;
+    int32_t index = begin;
+    while (index < end) {
+        out.push_back(index);
+        const HierarchyNode &node = state.nodes[static_cast<size_t>(index)];
+        index += (node.subtreeSize > 1 && !IsNodeExpanded(state, index)) ? node.subtreeSize : 1;
+    }
+}
+
+void RebuildHierarchySnapshot(void *context, SceneHierarchyState &state) {
+    int32_t capacity = std::max<int32_t>(static_cast<int32_t>(state.snapshotDepths.size()), 256);
+    int32_t total = 0;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        state.snapshotIds.resize(static_cast<size_t>(capacity) * kHierarchyIdStride);
+        state.snapshotNames.resize(static_cast<size_t>(capacity) * kHierarchyNameStride);
+        state.snapshotDepths.resize(static_cast<size_t>(capacity));
+        total = MCEEditorGetHierarchySnapshot(context,
+                                              state.snapshotIds.data(), kHierarchyIdStride,
+                                              state.snapshotNames.data(), kHierarchyNameStride,
+                                              state.snapshotDepths.data(),
+                                              capacity);
+        if (total <= capacity) { break; }
+        capacity = total + total / 4;
+    }
+    total = std::min(total, capacity);
+
+    state.nodes.clear();
+    state.nodes.resize(static_cast<size_t>(std::max(total, 0)));
+    state.nodeIndexByEntityId.clear();
+    state.nodeIndexByEntityId.reserve(state.nodes.size());
+    std::vector<int32_t> openAncestors;
+    for (int32_t i = 0; i < total; ++i) {
+        HierarchyNode &node = state.nodes[static_cast<size_t>(i)];
+        node.id.assign(&state.snapshotIds[static_cast<size_t>(i) * kHierarchyIdStride]);
+        node.name.assign(&state.snapshotNames[static_cast<size_t>(i) * kHierarchyNameStride]);
+        if (node.name.empty()) { node.name = node.id; }
+        node.depth = state.snapshotDepths[static_cast<size_t>(i)];
+        node.subtreeSize = 1;
+        while (!openAncestors.empty() && state.nodes[static_cast<size_t>(openAncestors.back())].depth >= node.depth) {
+            const int32_t closed = openAncestors.back();
+            state.nodes[static_cast<size_t>(closed)].subtreeSize = i - closed;
+            openAncestors.pop_back();
+        }
+        openAncestors.push_back(i);
+        state.nodeIndexByEntityId[node.id] = i;
+    }
+    for (int32_t open : openAncestors) {
+        state.nodes[static_cast<size_t>(open)].subtreeSize = total - open;
+    }
+
+    state.visibleRows.clear();
+    state.visibleRows.reserve(state.nodes.size());
+    AppendVisibleDescendants(state, -1, state.visibleRows);
+    state.rowByNodeDirty = true;
+}
+
+int32_t RowOfNode(SceneHierarchyState &state, int32_t nodeIndex) {
+    if (nodeIndex < 0) { return -1; }
+    if (state.rowByNodeDirty) {
+        state.rowByNode.assign(state.nodes.size(), -1);
+        for (size_t row = 0; row < state.visibleRows.size(); ++row) {
+            state.rowByNode[static_cast<size_t>(state.visibleRows[row])] = static_cast<int32_t>(row);
+        }
+        state.rowByNodeDirty = false;
+    }
+    return state.rowByNode[static_cast<size_t>(nodeIndex)];
+}
+
+int32_t RowOfEntity(SceneHierarchyState &state, const std::string &id) {
+    auto it = state.nodeIndexByEntityId.find(id);
+    return it == state.nodeIndexByEntityId.end() ? -1 : RowOfNode(state, it->second);
+}
+
+// Expands/collapses one node by splicing its visible descendants in place instead of rebuilding all rows.
+void SetNodeExpanded(SceneHierarchyState &state, int32_t nodeIndex, bool expanded) {
+    const HierarchyNode &node = state.nodes[static_cast<size_t>(nodeIndex)];
+    if (IsNodeExpanded(state, nodeIndex) == expanded) { return; }
+    state.expandedByEntityId[node.id] = expanded;
+    const int32_t row = RowOfNode(state, nodeIndex);
+    if (row < 0) { return; }
+    auto insertAt = state.visibleRows.begin() + row + 1;
+    if (expanded) {
+        std::vector<int32_t> descendants;
+        AppendVisibleDescendants(state, nodeIndex, descendants);
+        state.visibleRows.insert(insertAt, descendants.begin(), descendants.end());
+    } else {
+        const int32_t subtreeEnd = nodeIndex + node.subtreeSize;
+        auto eraseEnd = insertAt;
+        while (eraseEnd != state.visibleRows.end() && *eraseEnd < subtreeEnd) { ++eraseEnd; }
+        state.visibleRows.erase(insertAt, eraseEnd);
+    }
+    state.rowByNodeDirty = true;
+}
+
 std::vector<std::string> FetchChildren(void *context, const std::string &parentId) {
     std::vector<std::string> out;
     const int32_t count = MCEEditorGetChildEntityCount(context, parentId.c_str());
@@ -268,28 +381,10 @@ void ImGuiSceneHierarchyPanelDraw(void *context, bool *isOpen, char *selectedEnt
         ImGui::Separator();
     }
 
-    state.visibleEntityIds.clear();
-    std::function<void(const std::string &)> collectVisibleIds = [&](const std::string &id) {
-        state.visibleEntityIds.push_back(id);
-        auto expandedIt = state.expandedByEntityId.find(id);
-        bool expanded = expandedIt == state.expandedByEntityId.end() ? true : expandedIt->second;
-        if (expandedIt == state.expandedByEntityId.end()) {
-            state.expandedByEntityId[id] = true;
-        }
-        if (!expanded) { return; }
-        auto children = FetchChildren(context, id);
-        for (const std::string &child : children) {
-            collectVisibleIds(child);
-        }
-    };
-    {
-        const int32_t rootCount = MCEEditorGetRootEntityCount(context);
-        for (int32_t i = 0; i < rootCount; ++i) {
-            char idBuffer[64] = {0};
-            if (MCEEditorGetRootEntityIdAt(context, i, idBuffer, sizeof(idBuffer)) > 0) {
-                collectVisibleIds(std::string(idBuffer));
-            }
-        }
+    const uint64_t hierarchyGeneration = MCEEditorGetHierarchyGeneration(context);
+    if (hierarchyGeneration != state.hierarchyGeneration || hierarchyGeneration == 0) {
+        state.hierarchyGeneration = hierarchyGeneration;
+        RebuildHierarchySnapshot(context, state);
     }
 
     const float rowHeight = ImGui::GetTextLineHeight() + 10.0f;
@@ -297,20 +392,16 @@ void ImGuiSceneHierarchyPanelDraw(void *context, bool *isOpen, char *selectedEnt
     std::string pendingReorderTarget;
     std::string pendingParentTarget;
     bool pendingInsertAfter = false;
-
-    std::function<void(const std::string &, int)> drawNode = [&](const std::string &id, int depth) {
-        char nameBuffer[128] = {0};
-        if (MCEEditorGetEntityName(context, id.c_str(), nameBuffer, sizeof(nameBuffer)) <= 0) {
-            strncpy(nameBuffer, id.c_str(), sizeof(nameBuffer) - 1);
-        }
-
-        auto children = FetchChildren(context, id);
-        const bool hasChildren = !children.empty();
-        auto expandedIt = state.expandedByEntityId.find(id);
-        bool expanded = expandedIt == state.expandedByEntityId.end() ? true : expandedIt->second;
-        if (expandedIt == state.expandedByEntityId.end()) {
-            state.expandedByEntityId[id] = true;
-        }
+    int32_t pendingToggleNode = -1;
+
+    auto drawRow = [&](int32_t row) {
+        const int32_t nodeIndex = state.visibleRows[static_cast<size_t>(row)];
+        const HierarchyNode &node = state.nodes[static_cast<size_t>(nodeIndex)];
+        const std::string &id = node.id;
+        const char *nameText = node.name.c_str();
+        const int depth = node.depth;
+        const bool hasChildren = node.subtreeSize > 1;
+        const bool expanded = IsNodeExpanded(state, nodeIndex);
         const bool isSelected = HasId(selection, id);
 
         ImGui::PushID(id.c_str());
@@ -333,7 +424,7 @@ void ImGuiSceneHierarchyPanelDraw(void *context, bool *isOpen, char *selectedEnt
         if (hasChildren) {
             drawList->AddText(triangleMin, IM_COL32(220, 220, 220, 220), expanded ? "v" : ">");
         }
-        drawList->AddText(textPos, ImGui::GetColorU32(ImGuiCol_Text), nameBuffer);
+        drawList->AddText(textPos, ImGui::GetColorU32(ImGuiCol_Text), nameText);
 
         const bool clicked = ImGui::IsItemClicked(ImGuiMouseButton_Left);
         if (clicked) {
@@ -344,14 +435,12 @@ void ImGuiSceneHierarchyPanelDraw(void *context, bool *isOpen, char *selectedEnt
         }
 
         if (hasChildren && hovered && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
-            expanded = !expanded;
-            state.expandedByEntityId[id] = expanded;
+            pendingToggleNode = nodeIndex;
         }
         if (hasChildren && hovered && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
             const float triangleMaxX = triangleMin.x + 10.0f;
             if (ImGui::GetIO().MousePos.x >= triangleMin.x && ImGui::GetIO().MousePos.x <= triangleMaxX) {
-                expanded = !expanded;
-                state.expandedByEntityId[id] = expanded;
+                pendingToggleNode = nodeIndex;
             }
         }
 
@@ -362,32 +451,27 @@ void ImGuiSceneHierarchyPanelDraw(void *context, bool *isOpen, char *selectedEnt
             auto payloadSelection = HasId(selection, id) ? TopLevelSelection(context, selection) : std::vector<std::string>{id};
             const std::string csv = JoinCSV(payloadSelection);
             ImGui::SetDragDropPayload("MCE_SCENE_ENTITY_IDS", csv.c_str(), csv.size() + 1);
-            ImGui::TextUnformatted(nameBuffer);
+            ImGui::TextUnformatted(nameText);
             ImGui::EndDragDropSource();
         }
 
         const bool releaseThisItem = hovered && ImGui::IsMouseReleased(ImGuiMouseButton_Left);
         if (releaseThisItem && state.pendingClickEntityId == id && state.pendingClickShouldSelect) {
-            auto clickedIt = std::find(state.visibleEntityIds.begin(), state.visibleEntityIds.end(), id);
-            const int clickedVisibleIndex = clickedIt == state.visibleEntityIds.end()
-                ? -1
-                : static_cast<int>(clickedIt - state.visibleEntityIds.begin());
+            const int clickedVisibleIndex = row;
             const bool shift = state.pendingClickShift;
             const bool toggle = state.pendingClickToggle;
             const std::string anchorId = !state.rangeAnchorEntityId.empty()
                 ? state.rangeAnchorEntityId
                 : primary;
-            if (shift && clickedVisibleIndex >= 0 && !anchorId.empty()) {
-                auto anchorIt = std::find(state.visibleEntityIds.begin(), state.visibleEntityIds.end(), anchorId);
-                const int anchorIndex = anchorIt == state.visibleEntityIds.end()
-                    ? clickedVisibleIndex
-                    : static_cast<int>(anchorIt - state.visibleEntityIds.begin());
+            if (shift && !anchorId.empty()) {
+                const int32_t anchorRow = RowOfEntity(state, anchorId);
+                const int anchorIndex = anchorRow < 0 ? clickedVisibleIndex : anchorRow;
                 const int minIndex = std::min(anchorIndex, clickedVisibleIndex);
                 const int maxIndex = std::max(anchorIndex, clickedVisibleIndex);
                 std::vector<std::string> range;
                 range.reserve(static_cast<size_t>(maxIndex - minIndex + 1));
                 for (int i = minIndex; i <= maxIndex; ++i) {
-                    range.push_back(state.visibleEntityIds[static_cast<size_t>(i)]);
+                    range.push_back(state.nodes[static_cast<size_t>(state.visibleRows[static_cast<size_t>(i)])].id);
                 }
                 CommitSelection(context, selectedEntityId, selectedEntityIdSize, range, id);
                 selection = range;
@@ -510,21 +594,27 @@ void ImGuiSceneHierarchyPanelDraw(void *context, bool *isOpen, char *selectedEnt
         }
 
         ImGui::PopID();
+    };
 
-        if (expanded) {
-            for (const std::string &child : children) {
-                drawNode(child, depth + 1);
+    {
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(state.visibleRows.size()), rowHeight + ImGui::GetStyle().ItemSpacing.y);
+        if (!state.pendingClickEntityId.empty()) {
+            // Keep the pressed row submitted so its drag source survives scrolling out of view.
+            const int32_t pressedRow = RowOfEntity(state, state.pendingClickEntityId);
+            if (pressedRow >= 0) {
+                clipper.IncludeItemByIndex(pressedRow);
             }
         }
-    };
-
-    const int32_t rootCount = MCEEditorGetRootEntityCount(context);
-    for (int32_t i = 0; i < rootCount; ++i) {
-        char idBuffer[64] = {0};
-        if (MCEEditorGetRootEntityIdAt(context, i, idBuffer, sizeof(idBuffer)) > 0) {
-            drawNode(std::string(idBuffer), 0);
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                drawRow(row);
+            }
         }
     }
+    if (pendingToggleNode >= 0) {
+        SetNodeExpanded(state, pendingToggleNode, !IsNodeExpanded(state, pendingToggleNode));
+    }
     if (ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
         state.pendingClickEntityId.clear();
         state.pendingClickShift = false;
@@ -9,6 +9,8 @@
 #import "PanelState.h"
 #import "../Widgets/UIWidgets.h"
 #import "../EditorIcons.h"
+#import "../../EditorCore/Bridge/EditorEntityHandle.h"
+#include "../../EditorCore/Services/EditorJobs.h"
 #include <algorithm>
 #include <cmath>
 #include <string.h>
@@ -26,10 +28,6 @@ extern "C" int32_t MCEEditorCreateMeshEntityFromHandle(MCE_CTX,  const char *mes
 extern "C" int32_t MCEEditorInstantiatePrefabFromHandle(MCE_CTX,  const char *prefabHandle, char *outId, int32_t outIdSize);
 extern "C" uint32_t MCEEditorOpenSceneAtPath(MCE_CTX,  const char *relativePath);
 extern "C" int32_t MCEEditorCreateCameraFromView(MCE_CTX,  char *outId, int32_t outIdSize);
-extern "C" uint32_t MCEEditorGetTransform(MCE_CTX,  const char *entityId,
-                                          float *px, float *py, float *pz,
-                                          float *rx, float *ry, float *rz,
-                                          float *sx, float *sy, float *sz);
 extern "C" void MCEEditorSetTransformNoLog(MCE_CTX,  const char *entityId,
                                            float px, float py, float pz,
                                            float rx, float ry, float rz,
@@ -37,7 +35,6 @@ extern "C" void MCEEditorSetTransformNoLog(MCE_CTX,  const char *entityId,
 extern "C" uint32_t MCEEditorGetEditorCameraMatrices(MCE_CTX,  float *viewOut, float *projectionOut);
 extern "C" void MCEImGuiSetGizmoCapture(MCE_CTX,  uint32_t wantsMouse, uint32_t wantsKeyboard);
 extern "C" uint32_t MCEEditorSetTransformFromMatrix(MCE_CTX,  const char *entityId, const float *matrix);
-extern "C" uint32_t MCEEditorGetModelMatrix(MCE_CTX,  const char *entityId, float *matrixOut);
 extern "C" void *MCEContextGetUIPanelState(MCE_CTX);
 extern "C" uint32_t MCEImportBeginForHandle(MCE_CTX, const char *handle);
 extern "C" int32_t MCEEditorGetViewportGizmoOperation(MCE_CTX);
@@ -46,33 +43,6 @@ extern "C" int32_t MCEEditorGetViewportGizmoSpaceMode(MCE_CTX);
 extern "C" void MCEEditorSetViewportGizmoSpaceMode(MCE_CTX, int32_t value);
 extern "C" uint32_t MCEEditorGetViewportSnapEnabled(MCE_CTX);
 extern "C" void MCEEditorSetViewportSnapEnabled(MCE_CTX, uint32_t value);
-extern "C" int32_t MCEEditorGetEntityCount(MCE_CTX);
-extern "C" int32_t MCEEditorGetEntityIdAt(MCE_CTX, int32_t index, char *buffer, int32_t bufferSize);
-extern "C" uint32_t MCEEditorGetCamera(MCE_CTX, const char *entityId,
-                                      int32_t *projectionType,
-                                      float *fovDegrees,
-                                      float *orthoSize,
-                                      float *nearPlane,
-                                      float *farPlane,
-                                      uint32_t *isPrimary,
-                                      uint32_t *isEditor);
-extern "C" uint32_t MCEEditorGetLight(MCE_CTX, const char *entityId, int32_t *type,
-                                     float *colorX, float *colorY, float *colorZ,
-                                     float *brightness, float *range, float *innerCos, float *outerCos,
-                                     float *dirX, float *dirY, float *dirZ,
-                                     uint32_t *castsShadows);
-extern "C" uint32_t MCEEditorGetReflectionProbe(MCE_CTX, const char *entityId,
-                                                uint32_t *enabled,
-                                                float *boxExtentsX,
-                                                float *boxExtentsY,
-                                                float *boxExtentsZ,
-                                                float *blendDistance,
-                                                int32_t *priority,
-                                                float *intensity,
-                                                int32_t *captureResolution,
-                                                int32_t *rebuildMode,
-                                                uint32_t *includeSky);
-extern "C" uint32_t MCEEditorGetReflectionProbeRuntimeStatus(MCE_CTX, const char *entityId, int32_t *statusOut);
 extern "C" uint32_t MCEEditorGetEntityName(MCE_CTX, const char *entityId, char *buffer, int32_t bufferSize);
 extern "C" uint32_t MCEEditorGetViewportShowWorldIcons(MCE_CTX);
 extern "C" float MCEEditorGetViewportWorldIconBaseSize(MCE_CTX);
@@ -83,10 +53,13 @@ extern "C" uint32_t MCEEditorGetViewportShowSelectedCameraFrustum(MCE_CTX);
 extern "C" uint32_t MCEEditorGetViewportPreviewEnabled(MCE_CTX);
 extern "C" float MCEEditorGetViewportPreviewSize(MCE_CTX);
 extern "C" int32_t MCEEditorGetViewportPreviewPosition(MCE_CTX);
+extern "C" int32_t MCEEditorGetWorldIcons(MCE_CTX, const float *viewMatrix, const float *projectionMatrix,
+                                          void *iconsOut, int32_t maxCount);
 
 namespace {
     using MCEPanelState::GizmoOperation;
     using MCEPanelState::ViewportState;
+    using MCEPanelState::WorldIconEntry;
     struct Vec3 {
         float x;
         float y;
@@ -116,7 +89,11 @@ namespace {
         if (!entityId || entityId[0] == 0 || !outMatrix) {
             return false;
         }
-        if (MCEEditorGetModelMatrix(context, entityId, outMatrix) == 0) {
+        MCEEntityHandle handle = MCEEntityHandleNull();
+        if (MCEEntityHandleFromId(entityId, &handle) == 0) {
+            return false;
+        }
+        if (MCEEditorGetModelMatrixH(context, handle, outMatrix) == 0) {
             return false;
         }
         return true;
@@ -183,6 +160,18 @@ namespace {
         }
     }
 
+    enum WorldIconKind : int32_t {
+        WorldIconCamera = 0,
+        WorldIconReflectionProbe = 1,
+        WorldIconPointLight = 2,
+        WorldIconSpotLight = 3,
+        WorldIconDirectionalLight = 4
+    };
+
+    // Projection is a few dozen flops per icon, so typical scenes measure well under one chunk's worth
+    // of work and stay on this thread; only very large icon counts fan out.
+    static EditorJobs::LoopCost worldIconProjectionCost;
+
     void DrawWorldIcons(void *context,
                         const char *selectedEntityId,
                         const float *viewMatrix,
@@ -192,6 +181,21 @@ namespace {
         if (MCEEditorGetViewportShowWorldIcons(context) == 0) {
             return;
         }
+        ViewportState &state = GetViewportState(context);
+        // Frustum and screen-size culling happen inside the batch call, so only visible icons come
+        // back. Reuse last frame's capacity so the steady state is a single call.
+        int32_t capacity = static_cast<int32_t>(state.worldIcons.size());
+        int32_t iconCount = MCEEditorGetWorldIcons(context, viewMatrix, projectionMatrix, state.worldIcons.data(), capacity);
+        if (iconCount > capacity) {
+            state.worldIcons.resize(static_cast<size_t>(iconCount));
+            capacity = iconCount;
+            iconCount = MCEEditorGetWorldIcons(context, viewMatrix, projectionMatrix, state.worldIcons.data(), capacity);
+        }
+        const int32_t written = std::min(iconCount, capacity);
+        if (written <= 0) {
+            return;
+        }
+
         ImDrawList *drawList = ImGui::GetWindowDrawList();
         const ImVec2 imageSize(imageMax.x - imageMin.x, imageMax.y - imageMin.y);
         const float baseSize = MCEEditorGetViewportWorldIconBaseSize(context);
@@ -200,81 +204,69 @@ namespace {
         const float maxSize = MCEEditorGetViewportWorldIconMaxSize(context);
         const ImU32 normalColor = ImColorFromStyle(ImGui::GetStyleColorVec4(ImGuiCol_Text));
         const ImU32 accentColor = ImColorFromStyle(ImGui::GetStyleColorVec4(ImGuiCol_CheckMark));
-
-        const int32_t entityCount = MCEEditorGetEntityCount(context);
-        for (int32_t i = 0; i < entityCount; ++i) {
-            char entityId[64] = {0};
-            if (MCEEditorGetEntityIdAt(context, i, entityId, sizeof(entityId)) == 0) {
-                continue;
+        MCEEntityHandle selectedHandle = MCEEntityHandleNull();
+        MCEEntityHandleFromId(selectedEntityId, &selectedHandle);
+        ImFont *font = ImGui::GetFont();
+        const float fontSize = ImGui::GetFontSize();
+
+        // Projection and culling touch only the copied icon array, so they run on the job system;
+        // draw-list submission below stays on this thread.
+        state.projectedWorldIcons.resize(static_cast<size_t>(written));
+        const WorldIconEntry *icons = state.worldIcons.data();
+        ProjectedWorldIcon *projected = state.projectedWorldIcons.data();
+        EditorJobs::ParallelFor(static_cast<uint32_t>(written), worldIconProjectionCost, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                const WorldIconEntry &icon = icons[i];
+                ProjectedWorldIcon &result = projected[i];
+                result.size = 0.0f;
+                float depth = 0.0f;
+                if (!ProjectWorldToScreen(Vec3 { icon.positionX, icon.positionY, icon.positionZ },
+                                          viewMatrix, projectionMatrix, imageMin, imageSize, &result.screenPos, &depth)) {
+                    continue;
+                }
+                // Icons too small to see were already culled by the batch call; the rest honour the
+                // user's size range.
+                const float scaled = baseSize / (1.0f + depth * distanceScale * 0.1f);
+                result.size = std::max(minSize, std::min(maxSize, scaled));
             }
-            float modelMatrix[16] = {0};
-            if (!GetModelMatrix(context, entityId, modelMatrix)) {
+        });
+
+        for (int32_t i = 0; i < written; ++i) {
+            const WorldIconEntry &icon = icons[i];
+            const ImVec2 screenPos = projected[i].screenPos;
+            const float scaled = projected[i].size;
+            if (scaled <= 0.0f) {
                 continue;
             }
-            const float px = modelMatrix[12];
-            const float py = modelMatrix[13];
-            const float pz = modelMatrix[14];
 
             const char *glyph = nullptr;
             ImU32 glyphColor = normalColor;
-            int32_t projectionType = 0;
-            float fov = 60.0f, orthoSize = 10.0f, nearPlane = 0.01f, farPlane = 1000.0f;
-            uint32_t isPrimary = 0, isEditor = 0;
-            if (MCEEditorGetCamera(context, entityId, &projectionType, &fov, &orthoSize, &nearPlane, &farPlane, &isPrimary, &isEditor) != 0) {
-                if (isEditor != 0) {
-                    continue;
-                }
+            switch (icon.kind) {
+            case WorldIconCamera:
                 glyph = EditorIcons::Glyph(EditorIcons::Id::Camera);
-            } else {
-                if (MCEEditorGetReflectionProbe(context, entityId,
-                                                nullptr,
-                                                nullptr, nullptr, nullptr,
-                                                nullptr,
-                                                nullptr,
-                                                nullptr,
-                                                nullptr,
-                                                nullptr,
-                                                nullptr) != 0) {
-                    glyph = EditorIcons::Glyph(EditorIcons::Id::HDRI);
-                    int32_t probeStatus = 0;
-                    if (MCEEditorGetReflectionProbeRuntimeStatus(context, entityId, &probeStatus) != 0) {
-                        glyphColor = ReflectionProbeStatusColor(probeStatus);
-                    } else {
-                        glyphColor = ReflectionProbeStatusColor(0);
-                    }
-                } else {
-                    int32_t lightType = 0;
-                    if (MCEEditorGetLight(context, entityId, &lightType,
-                                          nullptr, nullptr, nullptr,
-                                          nullptr, nullptr, nullptr, nullptr,
-                                          nullptr, nullptr, nullptr,
-                                          nullptr) == 0) {
-                        continue;
-                    }
-                    if (lightType == 2) {
-                        glyph = EditorIcons::Glyph(EditorIcons::Id::DirectionalLight);
-                    } else if (lightType == 1) {
-                        glyph = EditorIcons::Glyph(EditorIcons::Id::SpotLight);
-                    } else {
-                        glyph = EditorIcons::Glyph(EditorIcons::Id::PointLight);
-                    }
-                }
-            }
-
-            ImVec2 screenPos {};
-            float depth = 0.0f;
-            if (!ProjectWorldToScreen(Vec3 { px, py, pz }, viewMatrix, projectionMatrix, imageMin, imageSize, &screenPos, &depth)) {
-                continue;
+                break;
+            case WorldIconReflectionProbe:
+                glyph = EditorIcons::Glyph(EditorIcons::Id::HDRI);
+                glyphColor = ReflectionProbeStatusColor(icon.status);
+                break;
+            case WorldIconSpotLight:
+                glyph = EditorIcons::Glyph(EditorIcons::Id::SpotLight);
+                break;
+            case WorldIconDirectionalLight:
+                glyph = EditorIcons::Glyph(EditorIcons::Id::DirectionalLight);
+                break;
+            case WorldIconPointLight:
+            default:
+                glyph = EditorIcons::Glyph(EditorIcons::Id::PointLight);
+                break;
             }
 
-            float scaled = baseSize / (1.0f + depth * distanceScale * 0.1f);
-            scaled = std::max(minSize, std::min(maxSize, scaled));
-            const bool selected = selectedEntityId && selectedEntityId[0] != 0 && strcmp(selectedEntityId, entityId) == 0;
+            const bool selected = selectedHandle.high == icon.handleHigh && selectedHandle.low == icon.handleLow
+                && MCEEntityHandleIsNull(selectedHandle) == 0;
             const ImU32 color = selected ? accentColor : glyphColor;
             ImVec2 glyphSize = ImGui::CalcTextSize(glyph);
-            float fontSize = ImGui::GetFontSize();
             float scale = scaled / std::max(1.0f, fontSize);
-            drawList->AddText(ImGui::GetFont(), fontSize * scale, ImVec2(screenPos.x - glyphSize.x * 0.5f * scale, screenPos.y - glyphSize.y * 0.5f * scale), color, glyph);
+            drawList->AddText(font, fontSize * scale, ImVec2(screenPos.x - glyphSize.x * 0.5f * scale, screenPos.y - glyphSize.y * 0.5f * scale), color, glyph);
         }
     }
 
@@ -651,7 +643,9 @@ void ImGuiViewportPanelDraw(void *context,
         float px = 0, py = 0, pz = 0;
         float rx = 0, ry = 0, rz = 0;
         float sx = 1, sy = 1, sz = 1;
-        if (MCEEditorGetTransform(context, selectedEntityId, &px, &py, &pz, &rx, &ry, &rz, &sx, &sy, &sz) != 0) {
+        MCEEntityHandle selectedHandle = MCEEntityHandleNull();
+        MCEEntityHandleFromId(selectedEntityId, &selectedHandle);
+        if (MCEEditorGetTransformH(context, selectedHandle, &px, &py, &pz, &rx, &ry, &rz, &sx, &sy, &sz) != 0) {
             float viewMatrix[16] = {0};
             float projectionMatrix[16] = {0};
             if (MCEEditorGetEditorCameraMatrices(context, viewMatrix, projectionMatrix) != 0) {
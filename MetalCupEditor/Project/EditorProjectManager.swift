@@ -6,6 +6,15 @@ import AppKit
 import Foundation
 import MetalCupEngine
 
+struct AssetMutationStats {
+    var mutations: UInt64 = 0
+    var registryUpdates: UInt64 = 0
+    var rescansAvoided: UInt64 = 0
+    var lastBatchMutations: Int = 0
+    var lastPathsReloaded: Int = 0
+    var lastUpdateMs: Double = 0
+}
+
 final class EditorProjectManager {
     private let settingsStore: EditorSettingsStore
     private let uiState: EditorUIState
@@ -28,11 +37,19 @@ final class EditorProjectManager {
     private(set) var isProjectOpen: Bool = false
 
     private var assetRegistry: AssetRegistry?
+    let assetDependencies = AssetDependencyGraph()
+    let textureCookCache = TextureCookCache()
+    let skeletonFingerprints = SkeletonFingerprintIndex()
+    let bakedClips = BakedClipStore()
     private var projectPaths: ProjectPaths?
     private var shouldShowProjectModal: Bool = false
     private var didRunStartupCheck: Bool = false
     private var sceneDirty: Bool = false
     private var assetRevision: UInt64 = 0
+    private var assetMutationDepth: Int = 0
+    private var assetMutationsInBatch: Int = 0
+    private var assetMutationPaths: Set<String> = []
+    private(set) var assetMutationStats = AssetMutationStats()
 
     init(settingsStore: EditorSettingsStore,
          uiState: EditorUIState,
@@ -331,13 +348,16 @@ final class EditorProjectManager {
         let registry = AssetRegistry(projectAssetRootURL: resolvedAssetRoot, logCenter: logCenter)
         registry.startWatching()
         assetRevision = 1
+        assetDependencies.reset()
+        assetDependencies.update(metadata: registry.allMetadata(), rootURL: registry.assetRootURL)
+        skeletonFingerprints.load(cacheRoot: cachePath)
+        bakedClips.configure(cacheRoot: cachePath)
         registry.onChange = { [weak self] in
             guard let self else { return }
             self.assetRevision &+= 1
             self.engineContext.assets.clearCache()
             self.engineContext.assets.preload(from: registry)
-            let prefabHandles = registry.allMetadata().filter { $0.type == .prefab }.map { $0.handle }
-            self.sceneController.markPrefabsDirty(handles: prefabHandles)
+            self.invalidateDependentPrefabs(registry: registry)
             self.logCenter.logInfo("Assets reloaded.", category: .assets)
         }
         assetRegistry = registry
@@ -496,18 +516,32 @@ final class EditorProjectManager {
         assetRevision &+= 1
         assetRegistry?.refresh()
         if let registry = assetRegistry {
-            let prefabHandles = registry.allMetadata().filter { $0.type == .prefab }.map { $0.handle }
-            sceneController.markPrefabsDirty(handles: prefabHandles)
+            invalidateDependentPrefabs(registry: registry)
         }
     }
 
+    /// Dirties only prefabs that changed or transitively reference a changed asset, instead of
+    /// re-resolving every prefab instance after any save.
+    private func invalidateDependentPrefabs(registry: AssetRegistry) {
+        let metadata = registry.allMetadata()
+        let changed = assetDependencies.update(metadata: metadata, rootURL: registry.assetRootURL)
+        guard !changed.isEmpty else { return }
+        let affected = assetDependencies.transitiveDependents(of: changed).union(changed)
+        let prefabHandles = metadata.filter { $0.type == .prefab && affected.contains($0.handle) }.map { $0.handle }
+        guard !prefabHandles.isEmpty else { return }
+        sceneController.markPrefabsDirty(handles: prefabHandles)
+    }
+
+    /// Runs one asset mutation. Inside `performAssetMutationBatch` the registry update is deferred
+    /// to the end of the batch; on its own it commits immediately.
     func performAssetMutation(_ operation: () throws -> Bool) -> Bool {
-        assetRegistry?.stopWatching()
-        defer { assetRegistry?.startWatching() }
+        beginAssetMutations()
+        defer { commitAssetMutations() }
         do {
             let ok = try operation()
             if ok {
-                refreshAssets()
+                assetMutationsInBatch += 1
+                assetMutationStats.mutations &+= 1
             }
             return ok
         } catch {
@@ -516,6 +550,54 @@ final class EditorProjectManager {
         }
     }
 
+    /// Groups any number of `performAssetMutation` calls into one incremental registry update,
+    /// one revision bump and one prefab invalidation pass.
+    func performAssetMutationBatch<T>(_ body: () throws -> T) rethrows -> T {
+        beginAssetMutations()
+        defer { commitAssetMutations() }
+        return try body()
+    }
+
+    func assetWatcherStats() -> (suppressed: UInt64, rescans: UInt64) {
+        (assetRegistry?.watcherEventsSuppressed ?? 0, assetRegistry?.watcherRescans ?? 0)
+    }
+
+    /// Marks a file whose metadata must be reloaded at commit even if its times look unchanged.
+    func noteAssetPathChanged(_ url: URL) {
+        guard assetMutationDepth > 0,
+              let rootURL = assetsRootPath,
+              let relativePath = PathUtils.relativePath(from: rootURL, to: url.standardizedFileURL) else { return }
+        assetMutationPaths.insert(relativePath)
+    }
+
+    private func beginAssetMutations() {
+        if assetMutationDepth == 0 {
+            assetRegistry?.beginSelfMutation()
+        }
+        assetMutationDepth += 1
+    }
+
+    private func commitAssetMutations() {
+        assetMutationDepth -= 1
+        guard assetMutationDepth == 0 else { return }
+        let mutations = assetMutationsInBatch
+        let paths = assetMutationPaths
+        assetMutationsInBatch = 0
+        assetMutationPaths.removeAll()
+        defer { assetRegistry?.endSelfMutation() }
+        guard mutations > 0, let registry = assetRegistry else { return }
+
+        let start = CFAbsoluteTimeGetCurrent()
+        assetRevision &+= 1
+        registry.refreshIncremental(changedPaths: paths)
+        invalidateDependentPrefabs(registry: registry)
+        assetMutationStats.registryUpdates &+= 1
+        assetMutationStats.rescansAvoided &+= UInt64(mutations - 1)
+        assetMutationStats.lastBatchMutations = mutations
+        assetMutationStats.lastPathsReloaded = registry.lastScanReloaded
+        assetMutationStats.lastUpdateMs = (CFAbsoluteTimeGetCurrent() - start) * 1000.0
+    }
+
     func notifySceneMutation() {
         markSceneDirty()
     }
@@ -1082,7 +1164,9 @@ public func MCESceneNotifyMutation(_ contextPtr: UnsafeMutableRawPointer) {
 
 @_cdecl("MCEProjectSaveAll")
 public func MCEProjectSaveAll(_ contextPtr: UnsafeMutableRawPointer) {
-    resolveContext(contextPtr).editorProjectManager.saveAll()
+    let context = resolveContext(contextPtr)
+    context.materialEditStore.flush(context: context)
+    context.editorProjectManager.saveAll()
 }
 
 @_cdecl("MCEEditorSaveSettings")
@@ -0,0 +1,77 @@
+import Foundation
+import Metal
+import MetalCupEngine
+
+@main
+struct FixedStepReplayTests {
+    static func main() throws {
+        guard (2...3).contains(CommandLine.arguments.count) else {
+            throw TestFailure("Pass a .mcscene path and optionally a step count")
+        }
+        let sceneURL = URL(fileURLWithPath: CommandLine.arguments[1]).standardizedFileURL
+        let steps = CommandLine.arguments.count == 3 ? Int(CommandLine.arguments[2]) ?? 0 : 600
+        require(steps > 0, "Step count must be a positive integer")
+        let document = try JSONDecoder().decode(SceneDocument.self, from: Data(contentsOf: sceneURL))
+
+        let application = Application(specification: ApplicationSpecification(
+            title: "FixedStepReplayTests",
+            resizable: false,
+            centered: false,
+            preferredFramesPerSecond: 60,
+            colorPixelFormat: .bgra8Unorm,
+            depthStencilPixelFormat: .invalid,
+            resourcesFolderName: "Resources",
+            assetsRootURL: sceneURL.deletingLastPathComponent()
+        ))
+        let engineContext = application.engineContext
+        var settings = engineContext.physicsSettings
+        settings.deterministic = true
+
+        let first = replay(document, engineContext: engineContext, settings: settings, steps: steps)
+        passesAgreeWithinOneReplay(first, steps: steps)
+        let second = replay(document, engineContext: engineContext, settings: settings, steps: steps)
+        replaysAgreeWithEachOther(first, second)
+        print("Fixed-step replay tests passed (\(steps) steps, checksum \(String(first.checksum, radix: 16)))")
+    }
+
+    private static func replay(_ document: SceneDocument,
+                               engineContext: EngineContext,
+                               settings: PhysicsSettings,
+                               steps: Int) -> FixedStepReplayResult {
+        FixedStepReplay.run(document: document,
+                            prefabSystem: engineContext.prefabSystem,
+                            engineContext: engineContext,
+                            physicsSettings: settings,
+                            fixedDelta: 1.0 / 60.0,
+                            steps: steps)
+    }
+
+    private static func passesAgreeWithinOneReplay(_ result: FixedStepReplayResult, steps: Int) {
+        require(result.steps == steps, "Replay must run exactly the requested \(steps) steps, ran \(result.steps)")
+        require(result.deterministic, "Both passes of one replay must end with the same transform checksum")
+    }
+
+    private static func replaysAgreeWithEachOther(_ first: FixedStepReplayResult, _ second: FixedStepReplayResult) {
+        require(second.deterministic, "Both passes of the repeated replay must end with the same transform checksum")
+        require(first.checksum == second.checksum,
+                "Two replays of the same document must end in the same state "
+                + "(\(String(first.checksum, radix: 16)) vs \(String(second.checksum, radix: 16)))")
+    }
+
+    private static func require(_ condition: @autoclosure () -> Bool,
+                                _ message: String) {
+        if !condition() {
+            fatalError(message)
+        }
+    }
+
+    private struct TestFailure: LocalizedError {
+        let message: String
+
+        init(_ message: String) {
+            self.message = message
+        }
+
+        var errorDescription: String? { message }
+    }
+}
@@ -0,0 +1,193 @@
+/// MeshSimplifierTests.cpp
+/// Executable tests for the quadric-error mesh simplifier behind import-time LOD chains.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "MeshSimplifier.h"
+
+namespace {
+
+void Require(bool condition, const char *message) {
+    if (condition) { return; }
+    std::fprintf(stderr, "MeshSimplifierTests: %s\n", message);
+    std::abort();
+}
+
+struct Mesh {
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+
+    uint32_t VertexCount() const { return static_cast<uint32_t>(positions.size() / 3); }
+    uint32_t TriangleCount() const { return static_cast<uint32_t>(indices.size() / 3); }
+};
+
+/// Closed latitude/longitude sphere with single pole vertices, so nothing is on a border.
+Mesh MakeSphere(float radius, uint32_t stacks, uint32_t slices) {
+    Mesh mesh;
+    auto push = [&](double x, double y, double z) {
+        mesh.positions.insert(mesh.positions.end(), { static_cast<float>(x * radius), static_cast<float>(y * radius),
+                                                      static_cast<float>(z * radius) });
+    };
+    push(0, 1, 0);
+    for (uint32_t stack = 1; stack < stacks; ++stack) {
+        const double phi = M_PI * stack / stacks;
+        for (uint32_t slice = 0; slice < slices; ++slice) {
+            const double theta = 2.0 * M_PI * slice / slices;
+            push(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+        }
+    }
+    push(0, -1, 0);
+    const uint32_t south = mesh.VertexCount() - 1;
+    auto ring = [&](uint32_t stack, uint32_t slice) { return 1 + (stack - 1) * slices + slice % slices; };
+    for (uint32_t slice = 0; slice < slices; ++slice) {
+        mesh.indices.insert(mesh.indices.end(), { 0, ring(1, slice + 1), ring(1, slice) });
+        mesh.indices.insert(mesh.indices.end(), { south, ring(stacks - 1, slice), ring(stacks - 1, slice + 1) });
+    }
+    for (uint32_t stack = 1; stack + 1 < stacks; ++stack) {
+        for (uint32_t slice = 0; slice < slices; ++slice) {
+            const uint32_t a = ring(stack, slice), b = ring(stack, slice + 1);
+            const uint32_t c = ring(stack + 1, slice), d = ring(stack + 1, slice + 1);
+            mesh.indices.insert(mesh.indices.end(), { a, b, d });
+            mesh.indices.insert(mesh.indices.end(), { a, d, c });
+        }
+    }
+    return mesh;
+}
+
+Mesh MakePlane(uint32_t cells) {
+    Mesh mesh;
+    for (uint32_t y = 0; y <= cells; ++y) {
+        for (uint32_t x = 0; x <= cells; ++x) {
+            mesh.positions.insert(mesh.positions.end(), { static_cast<float>(x), static_cast<float>(y), 0.0f });
+        }
+    }
+    for (uint32_t y = 0; y < cells; ++y) {
+        for (uint32_t x = 0; x < cells; ++x) {
+            const uint32_t a = y * (cells + 1) + x, b = a + 1, c = a + cells + 1, d = c + 1;
+            mesh.indices.insert(mesh.indices.end(), { a, b, d });
+            mesh.indices.insert(mesh.indices.end(), { a, d, c });
+        }
+    }
+    return mesh;
+}
+
+MCEMeshSimplifySettings Settings(float targetRatio) {
+    // Same attribute weights as the LOD bake; these meshes carry positions only.
+    return MCEMeshSimplifySettings { targetRatio, 0.0f, 0.02f, 0.02f, 0.05f };
+}
+
+bool Simplify(const Mesh &mesh, const MCEMeshSimplifySettings &settings,
+              std::vector<uint32_t> &indicesOut, MCEMeshSimplifyResult &result) {
+    MCEMeshSimplifyInput input {};
+    input.positions = mesh.positions.data();
+    input.vertexCount = mesh.VertexCount();
+    input.indices = mesh.indices.data();
+    input.indexCount = static_cast<uint32_t>(mesh.indices.size());
+    indicesOut.assign(mesh.indices.size(), 0);
+    result = MCEMeshSimplifyResult {};
+    if (!MCEMeshSimplify(&input, &settings, indicesOut.data(), &result)) { return false; }
+    indicesOut.resize(result.indexCount);
+    return true;
+}
+
+double DiagonalSquared(const Mesh &mesh) {
+    double lo[3] = { 1e30, 1e30, 1e30 }, hi[3] = { -1e30, -1e30, -1e30 };
+    for (size_t i = 0; i < mesh.positions.size(); ++i) {
+        lo[i % 3] = std::min(lo[i % 3], static_cast<double>(mesh.positions[i]));
+        hi[i % 3] = std::max(hi[i % 3], static_cast<double>(mesh.positions[i]));
+    }
+    return (hi[0] - lo[0]) * (hi[0] - lo[0]) + (hi[1] - lo[1]) * (hi[1] - lo[1]) + (hi[2] - lo[2]) * (hi[2] - lo[2]);
+}
+
+/// Area-weighted mean squared distance from `to` to the planes of the faces around `from`: the
+/// cost of the first collapse on a closed mesh, computed independently of the simplifier.
+double CheapestFirstCollapse(const Mesh &mesh) {
+    auto position = [&](uint32_t v) {
+        return std::vector<double> { mesh.positions[v * 3], mesh.positions[v * 3 + 1], mesh.positions[v * 3 + 2] };
+    };
+    double best = std::numeric_limits<double>::infinity();
+    for (uint32_t t = 0; t < mesh.TriangleCount(); ++t) {
+        for (int e = 0; e < 3; ++e) {
+            const uint32_t from = mesh.indices[t * 3 + e];
+            const uint32_t to = mesh.indices[t * 3 + (e + 1) % 3];
+            const std::vector<double> target = position(to);
+            double sum = 0.0, weight = 0.0;
+            for (uint32_t f = 0; f < mesh.TriangleCount(); ++f) {
+                const uint32_t *tri = &mesh.indices[f * 3];
+                if (tri[0] != from && tri[1] != from && tri[2] != from) { continue; }
+                const std::vector<double> p0 = position(tri[0]), p1 = position(tri[1]), p2 = position(tri[2]);
+                const double u[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                const double v[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                const double n[3] = { u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0] };
+                const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                const double distance = (n[0] * (target[0] - p0[0]) + n[1] * (target[1] - p0[1]) + n[2] * (target[2] - p0[2])) / length;
+                sum += distance * distance * length * 0.5;
+                weight += length * 0.5;
+            }
+            best = std::min(best, sum / weight);
+        }
+    }
+    return best;
+}
+
+void CollapseCostIsSquaredDistance() {
+    double unitCost = 0.0;
+    for (float radius : { 1.0f, 0.01f, 100.0f }) {
+        const Mesh sphere = MakeSphere(radius, 12, 24);
+        const uint32_t triangles = sphere.TriangleCount();
+        // One collapse removes two triangles of a closed mesh.
+        const float oneCollapse = (static_cast<float>(triangles) - 1.5f) / static_cast<float>(triangles);
+        std::vector<uint32_t> indices;
+        MCEMeshSimplifyResult result {};
+        Require(Simplify(sphere, Settings(oneCollapse), indices, result), "Sphere must simplify");
+        Require(result.collapses == 1, "Sphere target must take exactly one collapse");
+
+        // result.error is sqrt(cost) over the diagonal, so squaring it back must give the squared distance.
+        const double reported = static_cast<double>(result.error) * result.error * DiagonalSquared(sphere);
+        const double expected = CheapestFirstCollapse(sphere);
+        Require(expected > 0.0, "Curved surface collapse must have a cost");
+        Require(std::fabs(reported - expected) <= expected * 1e-3, "Collapse cost must be the mean squared plane distance");
+
+        // A squared distance grows with the square of the asset's scale.
+        const double normalized = reported / (static_cast<double>(radius) * radius);
+        if (unitCost == 0.0) { unitCost = normalized; }
+        Require(std::fabs(normalized - unitCost) <= unitCost * 1e-3, "Collapse cost must scale with the square of the mesh size");
+    }
+
+    std::vector<uint32_t> indices;
+    MCEMeshSimplifyResult flat {};
+    Require(Simplify(MakePlane(16), Settings(0.5f), indices, flat), "Plane must simplify");
+    Require(flat.collapses > 0 && flat.error < 1e-5f, "Coplanar collapses must cost nothing");
+}
+
+void LODTargetsAreMet() {
+    const Mesh sphere = MakeSphere(1.0f, 32, 64);
+    const uint32_t source = sphere.TriangleCount();
+    // The importer's default chain.
+    for (float ratio : { 0.5f, 0.25f, 0.125f }) {
+        std::vector<uint32_t> indices;
+        MCEMeshSimplifyResult result {};
+        Require(Simplify(sphere, Settings(ratio), indices, result), "LOD level must simplify");
+        const uint32_t target = static_cast<uint32_t>(std::floor(source * ratio));
+        const uint32_t triangles = result.indexCount / 3;
+        Require(triangles <= target, "LOD level must not exceed its triangle target");
+        Require(triangles + 2 >= target, "LOD level must stop at its triangle target");
+        for (uint32_t index : indices) { Require(index < sphere.VertexCount(), "LOD indices must reference source vertices"); }
+    }
+}
+
+}
+
+int main() {
+    CollapseCostIsSquaredDistance();
+    LODTargetsAreMet();
+    std::printf("Mesh simplifier tests passed\n");
+    return 0;
+}
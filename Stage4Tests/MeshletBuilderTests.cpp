@@ -0,0 +1,117 @@
+/// MeshletBuilderTests.cpp
+/// Executable tests for meshlet partitioning limits and the meshlet culling benchmark.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "MeshletBuilder.h"
+
+namespace {
+
+constexpr uint32_t kMaxVertices = 64;
+constexpr uint32_t kMaxTriangles = 124;
+
+void Require(bool condition, const char *message) {
+    if (condition) { return; }
+    std::fprintf(stderr, "MeshletBuilderTests: %s\n", message);
+    std::abort();
+}
+
+void BenchmarkHasNoConeViolations() {
+    std::array<MCEMeshletBenchmarkResult, 8> results {};
+    const int32_t written = MCEMeshletRunBenchmark(results.data(), static_cast<int32_t>(results.size()));
+    Require(written > 0, "Benchmark must produce results");
+    for (int32_t i = 0; i < written; ++i) {
+        const MCEMeshletBenchmarkResult &result = results[i];
+        std::printf("%-8s %u meshlets, max %uv/%ut, %u cone violations\n", MCEMeshletBenchmarkMeshName(i),
+                    result.meshletCount, result.maxMeshletVertices, result.maxMeshletTriangles, result.coneViolations);
+        Require(result.meshletCount > 0, "Benchmark mesh must build meshlets");
+        Require(result.coneViolations == 0, "Cone culling must never reject a front-facing triangle");
+        Require(result.maxMeshletVertices <= kMaxVertices, "Benchmark meshlet exceeds 64 vertices");
+        Require(result.maxMeshletTriangles <= kMaxTriangles, "Benchmark meshlet exceeds 124 triangles");
+    }
+}
+
+/// Wavy grid, so triangles face many directions and meshlets fill to their vertex limit.
+void BuiltMeshletsRespectLimits() {
+    constexpr uint32_t kCells = 48;
+    std::vector<float> positions;
+    for (uint32_t y = 0; y <= kCells; ++y) {
+        for (uint32_t x = 0; x <= kCells; ++x) {
+            const float height = std::sin(static_cast<float>(x) * 0.4f) * std::cos(static_cast<float>(y) * 0.3f);
+            positions.insert(positions.end(), { static_cast<float>(x), height, static_cast<float>(y) });
+        }
+    }
+    std::vector<uint32_t> indices;
+    for (uint32_t y = 0; y < kCells; ++y) {
+        for (uint32_t x = 0; x < kCells; ++x) {
+            const uint32_t a = y * (kCells + 1) + x, b = a + 1, c = a + kCells + 1, d = c + 1;
+            indices.insert(indices.end(), { a, c, d, a, d, b });
+        }
+    }
+    // One degenerate triangle, which the builder drops.
+    indices.insert(indices.end(), { 0, 0, 1 });
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size() / 3);
+    const uint32_t indexCount = static_cast<uint32_t>(indices.size());
+
+    const MCEMeshletSettings settings { kMaxVertices, kMaxTriangles, 0.25f };
+    const uint32_t bound = MCEMeshletBuildBound(indexCount, settings.maxVertices, settings.maxTriangles);
+    std::vector<MCEMeshlet> meshlets(bound);
+    std::vector<uint32_t> meshletVertices(static_cast<size_t>(bound) * settings.maxVertices);
+    std::vector<uint8_t> meshletTriangles(static_cast<size_t>(bound) * settings.maxTriangles * 3);
+    std::vector<MCEMeshletBounds> bounds(bound);
+    MCEMeshletBuildResult result {};
+    Require(MCEMeshletBuild(positions.data(), vertexCount, indices.data(), indexCount, &settings, meshlets.data(),
+                            meshletVertices.data(), meshletTriangles.data(), bounds.data(), &result) != 0,
+            "Grid must build meshlets");
+    Require(result.meshletCount > 0 && result.meshletCount <= bound, "Meshlet count must stay within the build bound");
+
+    std::vector<std::array<uint32_t, 3>> expected;
+    for (uint32_t i = 0; i + 2 < indexCount; i += 3) {
+        std::array<uint32_t, 3> tri { indices[i], indices[i + 1], indices[i + 2] };
+        if (tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2]) { continue; }
+        std::sort(tri.begin(), tri.end());
+        expected.push_back(tri);
+    }
+    std::vector<std::array<uint32_t, 3>> built;
+    for (uint32_t m = 0; m < result.meshletCount; ++m) {
+        const MCEMeshlet &meshlet = meshlets[m];
+        Require(meshlet.vertexCount > 0 && meshlet.vertexCount <= kMaxVertices, "Meshlet exceeds 64 vertices");
+        Require(meshlet.triangleCount > 0 && meshlet.triangleCount <= kMaxTriangles, "Meshlet exceeds 124 triangles");
+        Require(bounds[m].coneCutoff <= 1.0f && bounds[m].radius >= 0.0f, "Meshlet bounds must be well formed");
+        for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+            std::array<uint32_t, 3> tri {};
+            for (int c = 0; c < 3; ++c) {
+                const uint8_t local = meshletTriangles[meshlet.triangleOffset + t * 3 + c];
+                Require(local < meshlet.vertexCount, "Local triangle index must reference a meshlet vertex");
+                tri[c] = meshletVertices[meshlet.vertexOffset + local];
+                Require(tri[c] < vertexCount, "Meshlet vertex must reference a source vertex");
+            }
+            std::sort(tri.begin(), tri.end());
+            built.push_back(tri);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(built.begin(), built.end());
+    Require(built == expected, "Meshlets must cover every non-degenerate triangle exactly once");
+
+    const MCEMeshletSettings oversized { MCE_MESHLET_MAX_VERTICES_LIMIT + 1, kMaxTriangles, 0.0f };
+    Require(MCEMeshletBuild(positions.data(), vertexCount, indices.data(), indexCount, &oversized, meshlets.data(),
+                            meshletVertices.data(), meshletTriangles.data(), bounds.data(), &result) == 0,
+            "Vertex limits past a byte index must be rejected");
+}
+
+}
+
+int main() {
+    BenchmarkHasNoConeViolations();
+    BuiltMeshletsRespectLimits();
+    std::printf("Meshlet builder tests passed\n");
+    return 0;
+}
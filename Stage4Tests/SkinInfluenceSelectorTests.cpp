@@ -0,0 +1,159 @@
+/// SkinInfluenceSelectorTests.cpp
+/// Executable tests for top-K skin influence selection and renormalization.
+/// Created by Kaden Cringle.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "SkinInfluenceSelector.h"
+
+namespace {
+
+constexpr uint32_t kStride = MCE_SKIN_MAX_INFLUENCES;
+
+void Require(bool condition, const char *message) {
+    if (condition) { return; }
+    std::fprintf(stderr, "SkinInfluenceSelectorTests: %s\n", message);
+    std::abort();
+}
+
+struct Skin {
+    std::vector<uint32_t> offsets { 0 };
+    std::vector<int32_t> joints;
+    std::vector<float> weights;
+
+    void AddVertex(const std::vector<std::pair<int32_t, float>> &influences) {
+        for (const auto &influence : influences) {
+            joints.push_back(influence.first);
+            weights.push_back(influence.second);
+        }
+        offsets.push_back(static_cast<uint32_t>(joints.size()));
+    }
+
+    uint32_t VertexCount() const { return static_cast<uint32_t>(offsets.size() - 1); }
+};
+
+/// Deterministic skin: up to 12 influences per vertex over 40 joints, with repeated joints,
+/// negative joints, zero weights and exact ties mixed in.
+Skin MakeSkin(uint32_t vertexCount) {
+    Skin skin;
+    uint32_t state = 0x2545F491u;
+    auto next = [&state]() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    };
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        std::vector<std::pair<int32_t, float>> influences;
+        const uint32_t count = next() % 13;
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint32_t roll = next();
+            const int32_t joint = roll % 17 == 0 ? -1 : static_cast<int32_t>(roll % 40);
+            const float weight = roll % 11 == 0 ? 0.0f : static_cast<float>(next() % 1000 + 1) / 1000.0f;
+            influences.emplace_back(joint, weight);
+        }
+        if (v % 7 == 0) {
+            influences.emplace_back(3, 0.25f);
+            influences.emplace_back(9, 0.25f);
+        }
+        skin.AddVertex(influences);
+    }
+    return skin;
+}
+
+/// Merged, positive influences of one vertex, strongest first with ties on the lower joint.
+std::vector<std::pair<int32_t, float>> MergedInfluences(const Skin &skin, uint32_t vertex) {
+    std::map<int32_t, float> byJoint;
+    for (uint32_t i = skin.offsets[vertex]; i < skin.offsets[vertex + 1]; ++i) {
+        if (skin.joints[i] < 0 || !(skin.weights[i] > 0.0f)) { continue; }
+        byJoint[skin.joints[i]] += skin.weights[i];
+    }
+    std::vector<std::pair<int32_t, float>> merged(byJoint.begin(), byJoint.end());
+    std::stable_sort(merged.begin(), merged.end(), [](const auto &a, const auto &b) { return a.second > b.second; });
+    return merged;
+}
+
+void CheckSelection(const Skin &skin, const MCESkinInfluenceSettings &settings) {
+    const MCESkinInfluenceSource source { skin.offsets.data(), skin.joints.data(), skin.weights.data(), skin.VertexCount() };
+    std::vector<uint16_t> joints(static_cast<size_t>(skin.VertexCount()) * kStride);
+    std::vector<float> weights(joints.size());
+    MCESkinInfluenceCoverage coverage {};
+    Require(MCESkinSelectInfluences(&source, &settings, joints.data(), weights.data(), kStride, &coverage) == skin.VertexCount(),
+            "Selection must write every vertex");
+
+    uint32_t skinned = 0;
+    for (uint32_t v = 0; v < skin.VertexCount(); ++v) {
+        const uint16_t *vertexJoints = &joints[static_cast<size_t>(v) * kStride];
+        const float *vertexWeights = &weights[static_cast<size_t>(v) * kStride];
+        const std::vector<std::pair<int32_t, float>> merged = MergedInfluences(skin, v);
+
+        uint32_t used = 0;
+        float sum = 0.0f;
+        for (uint32_t slot = 0; slot < kStride; ++slot) {
+            if (vertexWeights[slot] > 0.0f) {
+                Require(slot == used, "Used slots must come before unused ones");
+                ++used;
+                sum += vertexWeights[slot];
+            } else {
+                Require(vertexJoints[slot] == 0 && vertexWeights[slot] == 0.0f, "Unused slots must be joint 0 with weight 0");
+            }
+        }
+        Require(used <= settings.maxInfluences, "Selection must keep at most K influences");
+        if (merged.empty()) {
+            Require(used == 0, "Unskinned vertices must stay unskinned");
+            continue;
+        }
+        ++skinned;
+        float total = 0.0f;
+        for (const auto &influence : merged) { total += influence.second; }
+        uint32_t aboveThreshold = 1;
+        while (aboveThreshold < merged.size() && merged[aboveThreshold].second >= settings.minWeight * total) { ++aboveThreshold; }
+        Require(used >= 1, "The strongest influence must survive the threshold");
+        Require(used == std::min(aboveThreshold, settings.maxInfluences), "Selection must keep every influence above the threshold up to K");
+        Require(vertexJoints[0] == merged[0].first, "The first slot must hold the strongest joint");
+
+        for (uint32_t slot = 1; slot < used; ++slot) {
+            const float previous = vertexWeights[slot - 1], current = vertexWeights[slot];
+            Require(previous >= current, "Selected weights must be ordered strongest first");
+        }
+        // The kept set is the strongest merged influences in the same order, ties on the lower joint.
+        // Ties are checked here, on the authored weights, because scaling can round two close
+        // weights to the same value.
+        for (uint32_t slot = 0; slot < used; ++slot) {
+            Require(vertexJoints[slot] == merged[slot].first, "Selection must keep the strongest influences");
+        }
+
+        if (settings.renormalize == MCESkinRenormalizeSum) {
+            Require(std::fabs(sum - 1.0f) <= 1e-5f, "Renormalized weights must sum to 1");
+        } else {
+            for (uint32_t slot = 0; slot < used; ++slot) {
+                Require(std::fabs(vertexWeights[slot] - merged[slot].second) <= 1e-6f * merged[slot].second,
+                        "Unnormalized weights must be the merged authored weights");
+            }
+        }
+    }
+    Require(coverage.skinnedVertexCount == skinned, "Coverage must count the skinned vertices");
+}
+
+}
+
+int main() {
+    const Skin skin = MakeSkin(4096);
+    Require(MCESkinInfluenceDefaultSettings().maxInfluences == 4, "Default selection must keep four influences");
+    CheckSelection(skin, MCESkinInfluenceDefaultSettings());
+    for (uint32_t k : { 1u, 2u, 4u, 8u }) {
+        for (float minWeight : { 0.0f, 0.01f, 0.2f }) {
+            CheckSelection(skin, MCESkinInfluenceSettings { k, minWeight, MCESkinRenormalizeSum });
+            CheckSelection(skin, MCESkinInfluenceSettings { k, minWeight, MCESkinRenormalizeNone });
+        }
+    }
+    std::printf("Skin influence selector tests passed\n");
+    return 0;
+}
@@ -0,0 +1,171 @@
+/// TextureHeaderProbeTests.cpp
+/// Executable tests for the texture container header parsers and pixel format mapping.
+/// Created by Kaden Cringle.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+#include "TextureHeaderProbe.h"
+
+namespace {
+
+void Require(bool condition, const char *message) {
+    if (condition) { return; }
+    std::fprintf(stderr, "TextureHeaderProbeTests: %s\n", message);
+    std::abort();
+}
+
+void AppendLE32(std::vector<uint8_t> &bytes, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) { bytes.push_back(static_cast<uint8_t>(value >> shift)); }
+}
+
+void AppendBE32(std::vector<uint8_t> &bytes, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) { bytes.push_back(static_cast<uint8_t>(value >> shift)); }
+}
+
+void AppendText(std::vector<uint8_t> &bytes, const char *text, bool terminate) {
+    bytes.insert(bytes.end(), text, text + std::strlen(text));
+    if (terminate) { bytes.push_back(0); }
+}
+
+bool Probe(const std::vector<uint8_t> &bytes, MCETextureHeaderInfo &info) {
+    std::memset(&info, 0, sizeof(info));
+    return MCETextureProbeHeader(bytes.data(), bytes.size(), &info) != 0;
+}
+
+std::vector<uint8_t> MakeBMP(int32_t width, int32_t height, uint16_t bitCount) {
+    std::vector<uint8_t> bytes = { 'B', 'M' };
+    AppendLE32(bytes, 0);
+    AppendLE32(bytes, 0);
+    AppendLE32(bytes, 54);
+    AppendLE32(bytes, 40);
+    AppendLE32(bytes, static_cast<uint32_t>(width));
+    AppendLE32(bytes, static_cast<uint32_t>(height));
+    bytes.insert(bytes.end(), { 1, 0, static_cast<uint8_t>(bitCount), static_cast<uint8_t>(bitCount >> 8) });
+    bytes.resize(bytes.size() + 64, 0);
+    return bytes;
+}
+
+std::vector<uint8_t> MakeEXR(int32_t xMin, int32_t yMin, int32_t xMax, int32_t yMax) {
+    std::vector<uint8_t> bytes;
+    AppendLE32(bytes, 20000630u);
+    AppendLE32(bytes, 2);
+    AppendText(bytes, "channels", true);
+    AppendText(bytes, "chlist", true);
+    AppendLE32(bytes, 3 * 18 + 1);
+    for (const char *channel : { "B", "G", "R" }) {
+        AppendText(bytes, channel, true);
+        AppendLE32(bytes, 1);
+        AppendLE32(bytes, 0);
+        AppendLE32(bytes, 1);
+        AppendLE32(bytes, 1);
+    }
+    bytes.push_back(0);
+    AppendText(bytes, "dataWindow", true);
+    AppendText(bytes, "box2i", true);
+    AppendLE32(bytes, 16);
+    AppendLE32(bytes, static_cast<uint32_t>(xMin));
+    AppendLE32(bytes, static_cast<uint32_t>(yMin));
+    AppendLE32(bytes, static_cast<uint32_t>(xMax));
+    AppendLE32(bytes, static_cast<uint32_t>(yMax));
+    bytes.push_back(0);
+    return bytes;
+}
+
+std::vector<uint8_t> MakePNG(uint32_t width, uint32_t height, uint8_t colorType) {
+    const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    std::vector<uint8_t> bytes(signature, signature + 8);
+    AppendBE32(bytes, 13);
+    AppendText(bytes, "IHDR", false);
+    AppendBE32(bytes, width);
+    AppendBE32(bytes, height);
+    bytes.insert(bytes.end(), { 8, colorType, 0, 0, 0 });
+    AppendBE32(bytes, 0);
+    AppendBE32(bytes, 0);
+    AppendText(bytes, "IDAT", false);
+    return bytes;
+}
+
+std::vector<uint8_t> MakeTGA(uint16_t width, uint16_t height, uint8_t pixelDepth) {
+    return { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+             static_cast<uint8_t>(width), static_cast<uint8_t>(width >> 8),
+             static_cast<uint8_t>(height), static_cast<uint8_t>(height >> 8), pixelDepth, 0 };
+}
+
+void TruncatedHeadersAreRejected() {
+    struct Case {
+        std::vector<uint8_t> bytes;
+        // Shortest prefix the parser needs: the BMP info header through biBitCount, the PNG
+        // signature plus the IHDR chunk and CRC, and the EXR attributes without the end-of-header byte.
+        size_t minimumLength;
+    };
+    const std::vector<uint8_t> exr = MakeEXR(0, 0, 63, 63);
+    const Case cases[] = { { MakeBMP(64, 64, 24), 30 }, { MakePNG(64, 64, 2), 33 }, { exr, exr.size() - 1 } };
+    MCETextureHeaderInfo info {};
+    for (const Case &entry : cases) {
+        Require(Probe(entry.bytes, info), "Complete reference header must probe");
+        const int32_t container = info.container;
+        const std::vector<uint8_t> minimum(entry.bytes.begin(), entry.bytes.begin() + static_cast<std::ptrdiff_t>(entry.minimumLength));
+        Require(Probe(minimum, info) && info.container == container, "Minimal header must probe");
+        for (size_t length = 0; length < entry.minimumLength; ++length) {
+            const std::vector<uint8_t> prefix(entry.bytes.begin(), entry.bytes.begin() + static_cast<std::ptrdiff_t>(length));
+            // The magic-less TGA fallback may claim a short prefix, but never as the original container.
+            Require(!Probe(prefix, info) || info.container != container, "Truncated header must not probe as its own container");
+        }
+    }
+    Require(MCETextureProbeHeader(nullptr, 16, &info) == 0, "Null bytes must be rejected");
+}
+
+void OversizedDimensionsAreRejected() {
+    MCETextureHeaderInfo info {};
+    // xMax - xMin + 1 overflows int32 for these windows; in 64 bits it is far past the limit.
+    Require(!Probe(MakeEXR(INT32_MIN, 0, INT32_MAX, 15), info), "EXR window spanning the int32 range must be rejected");
+    Require(!Probe(MakeEXR(0, INT32_MIN, 15, INT32_MAX), info), "EXR window spanning the int32 range must be rejected");
+    Require(!Probe(MakeEXR(10, 0, 5, 15), info), "Inverted EXR window must be rejected");
+    Require(!Probe(MakeEXR(0, 0, 65536, 15), info), "EXR window past 65536 must be rejected");
+    Require(Probe(MakeEXR(-32768, 0, 32767, 15), info) && info.width == 65536 && info.height == 16,
+            "EXR window at exactly 65536 must be accepted");
+
+    // -INT32_MIN does not fit in int32; the absolute value must be taken in 64 bits.
+    Require(!Probe(MakeBMP(INT32_MIN, 16, 24), info), "BMP width of INT32_MIN must be rejected");
+    Require(!Probe(MakeBMP(16, INT32_MIN, 24), info), "BMP height of INT32_MIN must be rejected");
+    Require(!Probe(MakeBMP(70000, 16, 24), info), "BMP width past 65536 must be rejected");
+    Require(Probe(MakeBMP(320, -240, 24), info) && info.container == MCETextureContainerBMP
+                && info.width == 320 && info.height == 240,
+            "Top-down BMP must report its absolute height");
+}
+
+void RGB8HeadersMapToRGBA8() {
+    MCETextureHeaderInfo info {};
+    const std::vector<uint8_t> headers[] = { MakeBMP(32, 32, 24), MakePNG(32, 32, 2), MakeTGA(32, 32, 24) };
+    for (const std::vector<uint8_t> &header : headers) {
+        Require(Probe(header, info), "RGB8 header must probe");
+        Require(info.channelCount == 3 && info.bitDepth == 8, "RGB8 header must report three 8-bit channels");
+        Require(std::strcmp(info.format, "rgb8") == 0, "RGB8 header must report the rgb8 format");
+        const char *format = MCETextureInternalPixelFormatName(0, info.bitDepth, info.channelCount);
+        Require(std::strcmp(format, "rgba8Unorm") == 0, "RGB8 must map to rgba8Unorm");
+        format = MCETextureInternalPixelFormatName(1, info.bitDepth, info.channelCount);
+        Require(std::strcmp(format, "rgba8Unorm_srgb") == 0, "sRGB RGB8 must map to rgba8Unorm_srgb");
+    }
+    Require(std::strcmp(MCETextureInternalPixelFormatName(0, 16, 3), "rgba16Float") == 0,
+            "16-bit RGB must map to rgba16Float");
+    Require(std::strcmp(MCETextureInternalPixelFormatName(1, 8, 4), "rgba8Unorm_srgb") == 0,
+            "sRGB RGBA8 must map to rgba8Unorm_srgb");
+    Require(std::strcmp(MCETextureInternalPixelFormatName(0, 8, 2), "rg8Unorm") == 0, "RG8 must map to rg8Unorm");
+    Require(std::strcmp(MCETextureInternalPixelFormatName(0, 8, 1), "r8Unorm") == 0, "R8 must map to r8Unorm");
+}
+
+}
+
+int main() {
+    TruncatedHeadersAreRejected();
+    OversizedDimensionsAreRejected();
+    RGB8HeadersMapToRGBA8();
+    std::printf("Texture header probe tests passed\n");
+    return 0;
+}